@@ -0,0 +1,17 @@
+/*
+ * asf.h
+ *
+ * Host build: stands for the ASF include file of src/, with the drivers
+ * of the models of sim/ (sim_hw.h) and the two components built as they are.
+ */
+
+
+#ifndef ASF_H
+#define ASF_H
+
+#include "sim_hw.h"
+#include <ili9488.h>
+#include <mxt_device_1.h>
+
+
+#endif /* ASF_H */
@@ -0,0 +1,8 @@
+/* Host build: board.h of ASF, see sim_hw.h */
+
+#ifndef SIM_BOARD_H_
+#define SIM_BOARD_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_BOARD_H_ */
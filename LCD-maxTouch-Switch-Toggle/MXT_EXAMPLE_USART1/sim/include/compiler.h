@@ -0,0 +1,8 @@
+/* Host build: compiler.h of ASF, see sim_hw.h */
+
+#ifndef SIM_COMPILER_H_
+#define SIM_COMPILER_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_COMPILER_H_ */
@@ -0,0 +1,8 @@
+/* Host build: interrupt.h of ASF, see sim_hw.h */
+
+#ifndef SIM_INTERRUPT_H_
+#define SIM_INTERRUPT_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_INTERRUPT_H_ */
@@ -0,0 +1,8 @@
+/* Host build: ioport.h of ASF, see sim_hw.h */
+
+#ifndef SIM_IOPORT_H_
+#define SIM_IOPORT_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_IOPORT_H_ */
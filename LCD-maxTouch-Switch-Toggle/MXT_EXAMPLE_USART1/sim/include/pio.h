@@ -0,0 +1,8 @@
+/* Host build: pio.h of ASF, see sim_hw.h */
+
+#ifndef SIM_PIO_H_
+#define SIM_PIO_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_PIO_H_ */
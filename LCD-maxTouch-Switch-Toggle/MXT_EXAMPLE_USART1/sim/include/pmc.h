@@ -0,0 +1,8 @@
+/* Host build: pmc.h of ASF, see sim_hw.h */
+
+#ifndef SIM_PMC_H_
+#define SIM_PMC_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_PMC_H_ */
@@ -0,0 +1,360 @@
+/*
+ * sim_hw.h
+ *
+ * What the firmware sees of the SAME70 and of ASF when it is built for the
+ * host: the register blocks it touches are plain structs (layouts and bit
+ * names from the CMSIS component headers of the tree), the core registers
+ * that count time are read through functions of the virtual clock, and the
+ * ASF drivers called by the code are implemented by the models of sim/.
+ *
+ * Every shadow header of sim/include (asf.h, compiler.h, pio.h, ...) is
+ * only an include of this one, so the firmware sources build unchanged.
+ */
+
+
+#ifndef SIM_HW_H_
+#define SIM_HW_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Registers that the hardware changes are written by the models too */
+#define __I  volatile
+#define __O  volatile
+#define __IO volatile
+
+#include "component/gpbr.h"
+#include "component/pio.h"
+#include "component/rtt.h"
+#include "component/spi.h"
+#include "component/twihs.h"
+#include "component/usart.h"
+#include "component/xdmac.h"
+
+#include <status_codes.h>
+
+/* -------- compiler.h -------- */
+
+#define UNUSED(v)             (void)(v)
+#define Assert(expr)          ((expr) ? (void)0 : sim_assert(#expr, __FILE__, __LINE__))
+#define COMPILER_PACK_SET(n)  _Pragma("pack(push, 1)")
+#define COMPILER_PACK_RESET() _Pragma("pack(pop)")
+#define RAMFUNC
+#define __no_inline           __attribute__((noinline))
+#define le16_to_cpu(x)        (x)
+#define cpu_to_le16(x)        (x)
+#ifndef min
+#define min(a, b)             (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b)             (((a) > (b)) ? (a) : (b))
+#endif
+
+void sim_assert(const char *expr, const char *file, int line);
+
+/* -------- device -------- */
+
+typedef enum IRQn {
+	SysTick_IRQn = -1,
+	RTT_IRQn     = 3,
+	PIOA_IRQn    = 10,
+	USART1_IRQn  = 14,
+	TWIHS0_IRQn  = 19,
+	SPI0_IRQn    = 21,
+	XDMAC_IRQn   = 58,
+	PERIPH_COUNT_IRQn = 74
+} IRQn_Type;
+
+#define ID_PIOA   10
+#define ID_USART1 14
+#define ID_TWIHS0 19
+#define ID_SPI0   21
+#define ID_XDMAC  58
+
+#define IFLASH_ADDR 0x00400000u
+#define IRAM_ADDR   0x20400000u
+
+extern Gpbr sim_gpbr;
+extern Pio sim_pioa;
+extern Rtt sim_rtt;
+extern Spi sim_spi0;
+extern Twihs sim_twihs0;
+extern Usart sim_usart1;
+extern Xdmac sim_xdmac;
+
+#define GPBR   (&sim_gpbr)
+#define PIOA   (&sim_pioa)
+#define RTT    (&sim_rtt)
+#define SPI0   (&sim_spi0)
+#define TWIHS0 (&sim_twihs0)
+#define USART1 (&sim_usart1)
+#define XDMAC  (&sim_xdmac)
+
+#define PIO_PA2_IDX  2
+#define PIO_PA6_IDX  6
+#define PIO_PA11_IDX 11
+
+#define XDMAC_CHANNEL_HWID_SPI0_TX 1
+
+/* -------- core -------- */
+
+typedef struct {
+	volatile uint32_t CTRL;
+	volatile uint32_t LOAD;
+	volatile uint32_t VAL;
+	volatile uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct {
+	volatile uint32_t ICSR;
+	volatile uint32_t CCR;
+	volatile uint32_t DCCMVAC;
+} SCB_Type;
+
+typedef struct {
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+	volatile uint32_t LAR;
+} DWT_Type;
+
+typedef struct {
+	volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define SysTick_CTRL_ENABLE_Msk     (1u << 0)
+#define SysTick_CTRL_TICKINT_Msk    (1u << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk  (1u << 2)
+#define SysTick_LOAD_RELOAD_Msk     0x00FFFFFFu
+#define SCB_ICSR_PENDSTSET_Msk      (1u << 26)
+#define SCB_CCR_DC_Msk              (1u << 16)
+#define DWT_CTRL_CYCCNTENA_Msk      (1u << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1u << 24)
+
+/*
+ * Read through the virtual clock: CYCCNT, VAL and PENDSTSET move with it,
+ * but CYCCNT stops in WFI, as on the core
+ */
+SysTick_Type *sim_systick(void);
+SCB_Type *sim_scb(void);
+DWT_Type *sim_dwt(void);
+extern CoreDebug_Type sim_coredebug;
+
+#define SysTick   (sim_systick())
+#define SCB       (sim_scb())
+#define DWT       (sim_dwt())
+#define CoreDebug (&sim_coredebug)
+
+#define __DSB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DMB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+void SCB_CleanInvalidateDCache(void);
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+void NVIC_SetPendingIRQ(IRQn_Type irq);
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+
+/* -------- interrupt.h -------- */
+
+typedef uint32_t irqflags_t;
+
+void cpu_irq_enable(void);
+void cpu_irq_disable(void);
+bool cpu_irq_is_enabled(void);
+irqflags_t cpu_irq_save(void);
+void cpu_irq_restore(irqflags_t flags);
+
+/* -------- clock, board, sleep, delay -------- */
+
+void sysclk_init(void);
+uint32_t sysclk_get_cpu_hz(void);
+void board_init(void);
+
+enum sleepmgr_mode {
+	SLEEPMGR_ACTIVE = 0,
+	SLEEPMGR_SLEEP_WFE,
+	SLEEPMGR_SLEEP_WFI,
+	SLEEPMGR_WAIT_FAST,
+	SLEEPMGR_WAIT,
+	SLEEPMGR_BACKUP,
+	SLEEPMGR_NR_OF_MODES,
+};
+
+void sleepmgr_init(void);
+void sleepmgr_lock_mode(enum sleepmgr_mode mode);
+void sleepmgr_unlock_mode(enum sleepmgr_mode mode);
+void sleepmgr_enter_sleep(void);
+
+void delay_ms(uint32_t ms);
+void delay_us(uint32_t us);
+
+void pmc_enable_periph_clk(uint32_t id);
+
+/* -------- board.h -------- */
+
+#define BOARD_ILI9488_ADDR       0x63000000
+#define BOARD_ILI9488_SPI        SPI0
+#define BOARD_ILI9488_SPI_IRQN   SPI0_IRQn
+#define BOARD_ILI9488_SPI_NPCS   3
+#define LCD_SPI_CDS_PIO          PIO_PA6_IDX
+#define MAXTOUCH_XPRO_TWIHS      TWIHS0
+#define MAXTOUCH_XPRO_CHG_PIO    PIO_PA2_IDX
+#define CONSOLE_UART             USART1
+#define CONSOLE_UART_ID          ID_USART1
+
+/* -------- pio.h -------- */
+
+typedef enum _pio_type {
+	PIO_NOT_A_PIN = 0,
+	PIO_INPUT     = 5u << 29,
+	PIO_OUTPUT_0  = 6u << 29,
+	PIO_OUTPUT_1  = 7u << 29,
+} pio_type_t;
+
+#define PIO_DEFAULT       (0u << 0)
+#define PIO_PULLUP        (1u << 0)
+#define PIO_DEGLITCH      (1u << 1)
+#define PIO_DEBOUNCE      (1u << 3)
+#define PIO_IT_AIME       (1u << 4)
+#define PIO_IT_RE_OR_HL   (1u << 5)
+#define PIO_IT_EDGE       (1u << 6)
+#define PIO_IT_FALL_EDGE  (0 | PIO_IT_EDGE | PIO_IT_AIME)
+#define PIO_IT_RISE_EDGE  (PIO_IT_RE_OR_HL | PIO_IT_EDGE | PIO_IT_AIME)
+
+/* Handlers are called (id, mask): the sketch passes void (void) ones too */
+typedef void (*sim_pio_handler_t)();
+
+uint32_t pio_configure(Pio *p_pio, const pio_type_t ul_type,
+		const uint32_t ul_mask, const uint32_t ul_attribute);
+void pio_set(Pio *p_pio, const uint32_t ul_mask);
+void pio_clear(Pio *p_pio, const uint32_t ul_mask);
+void pio_set_pin_high(uint32_t ul_pin);
+void pio_set_pin_low(uint32_t ul_pin);
+uint32_t pio_handler_set(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
+		uint32_t ul_attr, sim_pio_handler_t p_handler);
+uint32_t pio_handler_set_pin(uint32_t ul_pin, uint32_t ul_flag,
+		sim_pio_handler_t p_handler);
+void pio_enable_interrupt(Pio *p_pio, const uint32_t ul_mask);
+void pio_enable_pin_interrupt(uint32_t ul_pin);
+bool ioport_get_pin_level(uint32_t pin);
+
+/* -------- rtt.h -------- */
+
+uint32_t rtt_sel_source(Rtt *p_rtt, bool is_rtc_sel);
+uint32_t rtt_init(Rtt *p_rtt, uint16_t us_prescaler);
+void rtt_enable_interrupt(Rtt *p_rtt, uint32_t ul_sources);
+void rtt_disable_interrupt(Rtt *p_rtt, uint32_t ul_sources);
+uint32_t rtt_read_timer_value(Rtt *p_rtt);
+uint32_t rtt_get_status(Rtt *p_rtt);
+uint32_t rtt_write_alarm_time(Rtt *p_rtt, uint32_t ul_alarm_time);
+
+/* -------- spi_master.h -------- */
+
+#define SPI_CPOL   (1u << 0)
+#define SPI_CPHA   (1u << 1)
+#define SPI_MODE_3 (SPI_CPOL | SPI_CPHA)
+
+typedef uint8_t spi_flags_t;
+typedef uint32_t board_spi_select_id_t;
+
+struct spi_device {
+	board_spi_select_id_t id;
+};
+
+typedef enum {
+	SPI_CS_KEEP_LOW = 1,
+	SPI_CS_RISE_NO_TX = 0,
+	SPI_CS_RISE_FORCED = 2,
+} spi_cs_behavior_t;
+
+void spi_master_init(Spi *p_spi);
+void spi_master_setup_device(Spi *p_spi, struct spi_device *device,
+		spi_flags_t flags, uint32_t baud_rate, board_spi_select_id_t sel_id);
+void spi_configure_cs_behavior(Spi *p_spi, uint32_t ul_pcs_ch, uint32_t ul_cs_behavior);
+void spi_select_device(Spi *p_spi, struct spi_device *device);
+void spi_enable(Spi *p_spi);
+void spi_enable_interrupt(Spi *p_spi, uint32_t ul_sources);
+uint32_t spi_write(Spi *p_spi, uint16_t us_data, uint8_t uc_pcs, uint8_t uc_last);
+void spi_write_single(Spi *p_spi, uint8_t data);
+status_code_t spi_write_packet(Spi *p_spi, const uint8_t *data, size_t len);
+status_code_t spi_read_packet(Spi *p_spi, uint8_t *data, size_t len);
+uint32_t spi_is_tx_empty(Spi *p_spi);
+
+/* -------- xdmac.h -------- */
+
+typedef struct {
+	uint32_t mbr_ubc;
+	uint32_t mbr_sa;
+	uint32_t mbr_da;
+	uint32_t mbr_cfg;
+	uint32_t mbr_bc;
+	uint32_t mbr_ds;
+	uint32_t mbr_sus;
+	uint32_t mbr_dus;
+} xdmac_channel_config_t;
+
+void xdmac_configure_transfer(Xdmac *xdmac, uint32_t channel_num,
+		xdmac_channel_config_t *p_cfg);
+void xdmac_enable_interrupt(Xdmac *xdmac, uint32_t channel_num);
+void xdmac_channel_enable_interrupt(Xdmac *xdmac, uint32_t channel_num, uint32_t mask);
+void xdmac_channel_enable(Xdmac *xdmac, uint32_t channel_num);
+void xdmac_channel_disable(Xdmac *xdmac, uint32_t channel_num);
+uint32_t xdmac_channel_get_interrupt_status(Xdmac *xdmac, uint32_t channel_num);
+
+/* -------- twihs_master.h -------- */
+
+#define TWIHS_SUCCESS       0
+#define TWIHS_NO_CHIP_FOUND 3
+
+typedef Twihs *twihs_master_t;
+
+typedef struct {
+	uint8_t addr[3];
+	uint32_t addr_length;
+	void *buffer;
+	uint32_t length;
+	uint8_t chip;
+} twihs_package_t;
+
+typedef struct {
+	uint32_t speed;
+	uint8_t chip;
+	bool smbus;
+} twihs_master_options_t;
+
+uint32_t twihs_master_setup(twihs_master_t p_twihs, twihs_master_options_t *p_opt);
+uint32_t twihs_master_read(twihs_master_t p_twihs, twihs_package_t *p_package);
+uint32_t twihs_master_write(twihs_master_t p_twihs, twihs_package_t *p_package);
+
+/* -------- usart.h, stdio_serial.h -------- */
+
+typedef struct {
+	uint32_t baudrate;
+	uint32_t charlength;
+	uint32_t paritytype;
+	uint32_t stopbits;
+} usart_serial_options_t;
+
+void usart_enable_interrupt(Usart *p_usart, uint32_t ul_sources);
+void usart_disable_interrupt(Usart *p_usart, uint32_t ul_sources);
+uint32_t usart_is_tx_ready(Usart *p_usart);
+uint32_t usart_is_tx_empty(Usart *p_usart);
+uint32_t usart_write(Usart *p_usart, uint32_t c);
+uint32_t usart_is_rx_ready(Usart *p_usart);
+uint32_t usart_read(Usart *p_usart, uint32_t *c);
+
+extern int (*ptr_put)(void volatile *, char);
+void stdio_serial_init(Usart *usart, const usart_serial_options_t *opt);
+
+/* printf of the firmware, which goes to ptr_put as with the ASF syscalls */
+int sim_printf(const char *fmt, ...) __attribute__((format(__printf__, 1, 2)));
+#define printf sim_printf
+
+
+#endif /* SIM_HW_H_ */
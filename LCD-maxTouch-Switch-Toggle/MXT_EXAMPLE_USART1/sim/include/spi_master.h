@@ -0,0 +1,8 @@
+/* Host build: spi_master.h of ASF, see sim_hw.h */
+
+#ifndef SIM_SPI_MASTER_H_
+#define SIM_SPI_MASTER_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_SPI_MASTER_H_ */
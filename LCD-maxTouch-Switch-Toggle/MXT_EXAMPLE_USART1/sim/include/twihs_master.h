@@ -0,0 +1,8 @@
+/* Host build: twihs_master.h of ASF, see sim_hw.h */
+
+#ifndef SIM_TWIHS_MASTER_H_
+#define SIM_TWIHS_MASTER_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_TWIHS_MASTER_H_ */
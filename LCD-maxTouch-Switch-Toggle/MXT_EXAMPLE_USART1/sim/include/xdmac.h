@@ -0,0 +1,8 @@
+/* Host build: xdmac.h of ASF, see sim_hw.h */
+
+#ifndef SIM_XDMAC_H_
+#define SIM_XDMAC_H_
+
+#include "sim_hw.h"
+
+#endif /* SIM_XDMAC_H_ */
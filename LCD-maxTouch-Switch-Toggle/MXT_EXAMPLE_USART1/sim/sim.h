@@ -0,0 +1,133 @@
+/*
+ * sim.h
+ *
+ * Host simulator of the board: the firmware of src/ runs unchanged over
+ * models of the peripherals it uses, in virtual time.
+ *
+ * Time only moves inside the models: while the firmware sleeps (WFI), in
+ * delay_ms(), while it polls a bus that is still busy (SPI, TWIHS), and
+ * nowhere else, so code runs in zero time and every run of a scenario
+ * gives the same result. The interrupts the models raise are delivered
+ * as on the NVIC: by priority, when PRIMASK allows and no handler of the
+ * same or a higher priority is running.
+ */
+
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include "sim_hw.h"
+#include <mxt_device_1.h>
+
+#define SIM_NEVER UINT64_MAX
+
+#define SIM_CPU_HZ  300000000ull
+/* SysTick runs from the reference clock, HCLK / 8 */
+#define SIM_TICK_HZ (SIM_CPU_HZ / 8)
+
+/* ns since power on */
+uint64_t sim_now(void);
+void sim_advance_to(uint64_t t);
+void sim_advance(uint64_t ns);
+
+void sim_irq_pend(IRQn_Type irq);
+void sim_irq_deliver(void);
+bool sim_in_isr(void);
+/* Busy waits can let time go by only in the thread, with interrupts on */
+bool sim_can_wait(void);
+
+void sim_power_on(void);
+
+/* Stops the run: dumps what was asked and exits */
+void sim_finish(void) __attribute__((noreturn));
+
+/* Options of the run */
+typedef struct {
+	const char *script;
+	const char *out_dir;
+	const char *state;      /* flash and backup registers kept across runs */
+	const char *flash;      /* flash mapped on a file, kept as written */
+	const char *console;    /* bytes sent by the USART, stdout if NULL */
+	const char *report;     /* JSON benchmark report, none if NULL */
+	uint32_t spi_hz;
+	bool quiet;
+} sim_options_t;
+
+extern sim_options_t sim_opt;
+
+void sim_log(const char *fmt, ...) __attribute__((format(__printf__, 1, 2)));
+
+/* Panel: ILI9488 on SPI0, 18 bits per pixel */
+#define SIM_LCD_W 480
+#define SIM_LCD_H 320
+
+void sim_lcd_init(void);
+uint64_t sim_lcd_bus_free(void);
+/* The transfer callback of main.c held to the end of the wire (sim_wrap.c) */
+void sim_lcd_hold_callback(void (*callback)(void));
+void sim_lcd_driver_idle(void);
+bool sim_lcd_draining(void);
+bool sim_lcd_dump(const char *path);
+const uint8_t *sim_lcd_pixel(uint32_t x, uint32_t y);
+
+typedef struct {
+	uint64_t bytes;         /* bytes on the wire */
+	uint64_t commands;      /* bytes sent with CDS low */
+	uint64_t pixels;        /* pixels written to the GRAM */
+	uint64_t dma_blocks;    /* XDMAC transfers */
+	uint64_t busy_ns;       /* time the bus was busy */
+} sim_lcd_stats_t;
+
+extern sim_lcd_stats_t sim_lcd_stats;
+
+/* maXTouch on TWIHS0, CHG on PA2 */
+void sim_mxt_init(void);
+void sim_mxt_message(const uint8_t msg[MXT_TWI_MSG_SIZE_T5]);
+void sim_mxt_touch(uint8_t id, uint8_t status, uint16_t x, uint16_t y);
+bool sim_mxt_chg(void);
+uint32_t sim_mxt_lost(void);
+
+typedef struct {
+	uint64_t bytes;         /* byte times on the bus: addresses, registers and data */
+	uint64_t transfers;     /* reads and writes, from start to stop */
+	uint64_t busy_ns;       /* time the bus was busy */
+} sim_twi_stats_t;
+
+extern sim_twi_stats_t sim_twi_stats;
+
+/* PIO edges, RTT, SysTick, USART */
+void sim_pio_edge(uint32_t pin, bool level);
+void sim_pioa_irq(void);
+uint64_t sim_rtt_next(void);
+void sim_rtt_fire(uint64_t t);
+void sim_usart_irq(void);
+uint64_t sim_lcd_next(void);
+void sim_lcd_fire(void);
+void sim_xdmac_irq(void);
+void sim_usart_rx(uint8_t c);
+void sim_console_close(void);
+
+/* Flash and GPBR kept in the state file */
+void sim_state_load(void);
+void sim_state_save(void);
+uint8_t *sim_flash_mem(void);
+
+/* Flash on a file, and power cuts in its commands */
+#define SIM_FLASH_CUT_EXIT 86
+
+bool sim_flash_map(const char *path);
+void sim_flash_cut(uint32_t step);
+uint32_t sim_flash_steps(void);
+
+/* Benchmark: wire cost of the phases of the scenario */
+void sim_bench_mark(const char *name);
+void sim_bench_close(void);
+
+/* Scenario */
+bool sim_script_load(const char *path);
+uint64_t sim_script_next(void);
+void sim_script_fire(uint64_t t);
+bool sim_script_done(void);
+
+
+#endif /* SIM_H_ */
@@ -0,0 +1,133 @@
+/*
+ * sim_bench.c
+ *
+ * Benchmark report of a run. The scenario marks the end of each phase
+ * (mark NAME); the phase gets what went on the LCD bus since the mark
+ * before, as a whole (from the panel model), by drawing primitive (from
+ * the counters of the ILI9488 driver, CONF_ILI9488_STATS) and by kind of
+ * item of the tile renderer. The report is a JSON file, given with
+ * --report:
+ *
+ *   {"spi_hz": 20000000, "phases": [
+ *     {"name": "boot", "t_ms": 2000, "ms": 2000,
+ *      "bus": {"bytes": .., "commands": .., "pixels": .., "dma_blocks": ..,
+ *              "busy_us": ..},
+ *      "ops": {"pixmap": {"calls": .., "commands": .., "data_bytes": ..,
+ *                         "windows": .., "busy_cycles": ..}, ..},
+ *      "tiles": {"text": {"items": .., "pixels": .., "busy_cycles": ..},
+ *                ..}}, ..]}
+ *
+ * Operations and kinds with nothing counted in a phase are left out of
+ * it. "other" is the driver calls outside the drawing primitives; the
+ * waits between primitives go to the one whose transfers they wait for.
+ * The tiles are the "pixmap" operation, shared out by kind of item.
+ */
+
+#include <ili9488.h>
+#include "sim.h"
+#include "tile_render.h"
+
+static FILE *report;
+static uint32_t n_phases;
+static uint64_t last_t;
+static sim_lcd_stats_t last_bus;
+
+static void open_report(void)
+{
+	report = fopen(sim_opt.report, "w");
+	if (!report) {
+		perror(sim_opt.report);
+		exit(1);
+	}
+	fprintf(report, "{\"spi_hz\": %u, \"phases\": [", (unsigned)sim_opt.spi_hz);
+}
+
+static void print_ops(void)
+{
+	struct ili9488_stats st;
+	bool first = true;
+
+	fprintf(report, "\"ops\": {");
+	for (int op = 0; op < ILI9488_OP_COUNT; op++) {
+		ili9488_stats_get(op, &st);
+		if (st.ul_calls == 0 && st.ul_commands == 0 && st.ul_data_bytes == 0 &&
+		    st.ul_windows == 0 && st.ul_busy_cycles == 0) {
+			continue;
+		}
+		fprintf(report, "%s\n      \"%s\": {\"calls\": %u, \"commands\": %u, "
+		        "\"data_bytes\": %u, \"windows\": %u, \"busy_cycles\": %u}",
+		        first ? "" : ",", ili9488_stats_name(op),
+		        (unsigned)st.ul_calls, (unsigned)st.ul_commands,
+		        (unsigned)st.ul_data_bytes, (unsigned)st.ul_windows,
+		        (unsigned)st.ul_busy_cycles);
+		first = false;
+	}
+	fprintf(report, "}");
+}
+
+static void print_tiles(void)
+{
+	tile_stats_t st;
+	bool first = true;
+
+	fprintf(report, "\"tiles\": {");
+	for (uint32_t kind = 0; kind < TILE_STATS_COUNT; kind++) {
+		tile_stats_get(kind, &st);
+		if (st.items == 0 && st.pixels == 0 && st.busy_cycles == 0) {
+			continue;
+		}
+		fprintf(report, "%s\n      \"%s\": {\"items\": %u, \"pixels\": %u, "
+		        "\"busy_cycles\": %u}",
+		        first ? "" : ",", tile_stats_name(kind), (unsigned)st.items,
+		        (unsigned)st.pixels, (unsigned)st.busy_cycles);
+		first = false;
+	}
+	fprintf(report, "}");
+}
+
+void sim_bench_mark(const char *name)
+{
+	uint64_t t = sim_now();
+	const sim_lcd_stats_t *bus = &sim_lcd_stats;
+
+	if (!sim_opt.report) {
+		return;
+	}
+	if (!report) {
+		open_report();
+	}
+
+	/* Names come from the scenario: one word, nothing to escape */
+	fprintf(report, "%s\n  {\"name\": \"%s\", \"t_ms\": %.3f, \"ms\": %.3f,\n",
+	        n_phases ? "," : "", name, t / 1e6, (t - last_t) / 1e6);
+	fprintf(report, "    \"bus\": {\"bytes\": %llu, \"commands\": %llu, \"pixels\": %llu, "
+	        "\"dma_blocks\": %llu, \"busy_us\": %.3f},\n    ",
+	        (unsigned long long)(bus->bytes - last_bus.bytes),
+	        (unsigned long long)(bus->commands - last_bus.commands),
+	        (unsigned long long)(bus->pixels - last_bus.pixels),
+	        (unsigned long long)(bus->dma_blocks - last_bus.dma_blocks),
+	        (bus->busy_ns - last_bus.busy_ns) / 1e3);
+	print_ops();
+	fprintf(report, ",\n    ");
+	print_tiles();
+	fprintf(report, "}");
+
+	n_phases++;
+	last_t = t;
+	last_bus = *bus;
+	ili9488_stats_reset();
+	tile_stats_reset();
+}
+
+void sim_bench_close(void)
+{
+	if (!sim_opt.report) {
+		return;
+	}
+	if (!report) {
+		open_report();
+	}
+	fprintf(report, "\n]}\n");
+	fclose(report);
+	report = NULL;
+}
@@ -0,0 +1,426 @@
+/*
+ * sim_core.c
+ *
+ * Virtual clock, NVIC and core registers of the simulator.
+ */
+
+#include <stdarg.h>
+#include "conf_ili9488.h"
+#include "sim.h"
+
+#define N_IRQ (PERIPH_COUNT_IRQn + 16)
+#define IDX(irq) ((int)(irq) + 16)
+
+/* Thread mode runs below every interrupt */
+#define THREAD_PRIO 256
+
+sim_options_t sim_opt = {
+	.out_dir = ".",
+	.spi_hz = ILI9488_SPI_BAUDRATE,
+};
+
+static uint64_t now;
+
+static bool irq_enabled[N_IRQ];
+static bool irq_pending[N_IRQ];
+static uint8_t irq_prio[N_IRQ];
+static int active_prio = THREAD_PRIO;
+static uint32_t isr_depth;
+static bool primask;
+
+/*
+ * Handlers of the firmware, and of the models that stand for ASF ones:
+ * weak, so the tests of tests/ link without the handlers they do not use
+ */
+void SysTick_Handler(void) __attribute__((weak));
+void RTT_Handler(void) __attribute__((weak));
+void XDMAC_Handler(void) __attribute__((weak));
+
+static void (*const handlers[N_IRQ])(void) = {
+	[IDX(SysTick_IRQn)] = SysTick_Handler,
+	[IDX(RTT_IRQn)]     = RTT_Handler,
+	[IDX(PIOA_IRQn)]    = sim_pioa_irq,
+	[IDX(USART1_IRQn)]  = sim_usart_irq,
+	[IDX(XDMAC_IRQn)]   = sim_xdmac_irq,
+};
+
+CoreDebug_Type sim_coredebug;
+static SysTick_Type systick;
+static SCB_Type scb;
+static DWT_Type dwt;
+
+/* SysTick: counts down from LOAD at SIM_TICK_HZ since st_start */
+static uint32_t st_ctrl;
+static uint32_t st_val;
+static uint64_t st_start;
+static uint64_t st_wraps;
+
+static uint32_t dwt_last;
+static uint32_t dwt_base;
+/* ns the core spent in WFI, where CYCCNT stops */
+static uint64_t slept;
+
+uint64_t sim_now(void)
+{
+	return now;
+}
+
+void sim_log(const char *fmt, ...)
+{
+	va_list ap;
+
+	if (sim_opt.quiet) {
+		return;
+	}
+	fprintf(stderr, "[%10.3f] ", now / 1e6);
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+}
+
+void sim_assert(const char *expr, const char *file, int line)
+{
+	fprintf(stderr, "%s:%d: Assert(%s) failed at %.3f ms\n", file, line, expr, now / 1e6);
+	exit(2);
+}
+
+/* -------- SysTick, DWT, SCB -------- */
+
+static void systick_sync(void)
+{
+	/* Enabling the counter or writing VAL starts it again from LOAD */
+	if ((systick.CTRL ^ st_ctrl) & SysTick_CTRL_ENABLE_Msk || systick.VAL != st_val) {
+		st_start = now;
+		st_wraps = 0;
+	}
+	st_ctrl = systick.CTRL;
+}
+
+static uint64_t systick_ticks(void)
+{
+	return (unsigned __int128)(now - st_start) * SIM_TICK_HZ / 1000000000u;
+}
+
+static uint64_t systick_next(void)
+{
+	uint64_t period = (uint64_t)(systick.LOAD & SysTick_LOAD_RELOAD_Msk) + 1;
+	unsigned __int128 ticks = (unsigned __int128)(st_wraps + 1) * period;
+
+	systick_sync();
+	if (!(systick.CTRL & SysTick_CTRL_ENABLE_Msk)) {
+		return SIM_NEVER;
+	}
+	return st_start + (uint64_t)((ticks * 1000000000u + SIM_TICK_HZ - 1) / SIM_TICK_HZ);
+}
+
+static void systick_fire(void)
+{
+	st_wraps++;
+	if (systick.CTRL & SysTick_CTRL_TICKINT_Msk) {
+		sim_irq_pend(SysTick_IRQn);
+	}
+}
+
+SysTick_Type *sim_systick(void)
+{
+	uint64_t period = (uint64_t)(systick.LOAD & SysTick_LOAD_RELOAD_Msk) + 1;
+
+	systick_sync();
+	if (systick.CTRL & SysTick_CTRL_ENABLE_Msk) {
+		systick.VAL = (uint32_t)(period - 1 - systick_ticks() % period);
+	}
+	st_val = systick.VAL;
+	return &systick;
+}
+
+SCB_Type *sim_scb(void)
+{
+	if (irq_pending[IDX(SysTick_IRQn)]) {
+		scb.ICSR |= SCB_ICSR_PENDSTSET_Msk;
+	} else {
+		scb.ICSR &= ~SCB_ICSR_PENDSTSET_Msk;
+	}
+	return &scb;
+}
+
+DWT_Type *sim_dwt(void)
+{
+	uint32_t cycles = (uint32_t)((unsigned __int128)(now - slept) * SIM_CPU_HZ / 1000000000u);
+
+	/* A write of CYCCNT since the last read moves its origin */
+	if (dwt.CYCCNT != dwt_last) {
+		dwt_base = cycles - dwt.CYCCNT;
+	}
+	if (dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk) {
+		dwt.CYCCNT = cycles - dwt_base;
+	}
+	dwt_last = dwt.CYCCNT;
+	return &dwt;
+}
+
+void SCB_CleanInvalidateDCache(void)
+{
+}
+
+/* -------- NVIC and PRIMASK -------- */
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+	irq_enabled[IDX(irq)] = true;
+	sim_irq_deliver();
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+	irq_enabled[IDX(irq)] = false;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+	irq_pending[IDX(irq)] = false;
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type irq)
+{
+	sim_irq_pend(irq);
+}
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+	irq_prio[IDX(irq)] = priority & 7;
+}
+
+void sim_irq_pend(IRQn_Type irq)
+{
+	irq_pending[IDX(irq)] = true;
+	sim_irq_deliver();
+}
+
+bool sim_in_isr(void)
+{
+	return isr_depth > 0;
+}
+
+bool sim_can_wait(void)
+{
+	return isr_depth == 0 && !primask;
+}
+
+/* Runs the pending handlers that can preempt what is running now */
+void sim_irq_deliver(void)
+{
+	int saved;
+
+	while (!primask) {
+		int best = -1;
+
+		for (int i = 0; i < N_IRQ; i++) {
+			if (irq_pending[i] && irq_enabled[i] && handlers[i] &&
+			    irq_prio[i] < active_prio &&
+			    (best < 0 || irq_prio[i] < irq_prio[best])) {
+				best = i;
+			}
+		}
+		if (best < 0) {
+			return;
+		}
+
+		irq_pending[best] = false;
+		saved = active_prio;
+		active_prio = irq_prio[best];
+		isr_depth++;
+		handlers[best]();
+		isr_depth--;
+		active_prio = saved;
+	}
+}
+
+/* WFI wakes up on any enabled interrupt pending, even with PRIMASK set */
+static bool wakeup_pending(void)
+{
+	for (int i = 0; i < N_IRQ; i++) {
+		if (irq_pending[i] && irq_enabled[i] && handlers[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void cpu_irq_enable(void)
+{
+	primask = false;
+	sim_irq_deliver();
+}
+
+void cpu_irq_disable(void)
+{
+	primask = true;
+}
+
+bool cpu_irq_is_enabled(void)
+{
+	return !primask;
+}
+
+irqflags_t cpu_irq_save(void)
+{
+	irqflags_t flags = !primask;
+
+	primask = true;
+	return flags;
+}
+
+void cpu_irq_restore(irqflags_t flags)
+{
+	if (flags) {
+		cpu_irq_enable();
+	}
+}
+
+/* -------- time -------- */
+
+static uint64_t next_event(void)
+{
+	uint64_t t = systick_next();
+	uint64_t r = sim_rtt_next();
+	uint64_t s = sim_script_next();
+	uint64_t l = sim_lcd_next();
+
+	if (l < t) {
+		t = l;
+	}
+	if (r < t) {
+		t = r;
+	}
+	if (s < t) {
+		t = s;
+	}
+	return t;
+}
+
+/* Lets time go by up to t, running what happens on the way */
+void sim_advance_to(uint64_t t)
+{
+	for (;;) {
+		uint64_t e = next_event();
+
+		if (e > t) {
+			break;
+		}
+		if (e > now) {
+			now = e;
+		}
+		if (systick_next() <= now) {
+			systick_fire();
+		}
+		if (sim_rtt_next() <= now) {
+			sim_rtt_fire(now);
+		}
+		if (sim_lcd_next() <= now) {
+			sim_lcd_fire();
+		}
+		if (sim_script_next() <= now) {
+			sim_script_fire(now);
+		}
+		sim_irq_deliver();
+	}
+	if (t > now) {
+		now = t;
+	}
+}
+
+void sim_advance(uint64_t ns)
+{
+	sim_advance_to(now + ns);
+}
+
+void delay_ms(uint32_t ms)
+{
+	sim_advance((uint64_t)ms * 1000000u);
+}
+
+void delay_us(uint32_t us)
+{
+	sim_advance((uint64_t)us * 1000u);
+}
+
+/* Called with PRIMASK set, returns with it clear after the handler that woke it */
+void sleepmgr_enter_sleep(void)
+{
+	while (!wakeup_pending()) {
+		uint64_t t = next_event();
+
+		if (t == SIM_NEVER || sim_script_done()) {
+			sim_finish();
+		}
+		slept += t - now;
+		sim_advance_to(t);
+	}
+	cpu_irq_enable();
+}
+
+void sysclk_init(void)
+{
+}
+
+uint32_t sysclk_get_cpu_hz(void)
+{
+	return SIM_CPU_HZ;
+}
+
+void board_init(void)
+{
+}
+
+void sleepmgr_init(void)
+{
+}
+
+void sleepmgr_lock_mode(enum sleepmgr_mode mode)
+{
+	UNUSED(mode);
+}
+
+void sleepmgr_unlock_mode(enum sleepmgr_mode mode)
+{
+	UNUSED(mode);
+}
+
+void pmc_enable_periph_clk(uint32_t id)
+{
+	UNUSED(id);
+}
+
+/* -------- run -------- */
+
+/* The board at power on: NVIC as after a reset, flash and GPBR from --state */
+void sim_power_on(void)
+{
+	memset(irq_enabled, 0, sizeof(irq_enabled));
+	memset(irq_pending, 0, sizeof(irq_pending));
+	/* Until the firmware sets them, as after a reset */
+	memset(irq_prio, 0, sizeof(irq_prio));
+	irq_enabled[IDX(SysTick_IRQn)] = true;
+	active_prio = THREAD_PRIO;
+	isr_depth = 0;
+	primask = false;
+
+	sim_state_load();
+	sim_lcd_init();
+	sim_mxt_init();
+}
+
+void sim_finish(void)
+{
+	sim_log("end: SPI %llu bytes (%llu commands, %llu pixels, %llu DMA blocks), bus busy %.3f ms",
+	        (unsigned long long)sim_lcd_stats.bytes,
+	        (unsigned long long)sim_lcd_stats.commands,
+	        (unsigned long long)sim_lcd_stats.pixels,
+	        (unsigned long long)sim_lcd_stats.dma_blocks,
+	        sim_lcd_stats.busy_ns / 1e6);
+	sim_bench_close();
+	sim_state_save();
+	sim_console_close();
+	exit(0);
+}
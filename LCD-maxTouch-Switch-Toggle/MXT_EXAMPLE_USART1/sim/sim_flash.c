@@ -0,0 +1,229 @@
+/*
+ * sim_flash.c
+ *
+ * flash_efc.c of the simulator: the nvlog area is an array in RAM. An
+ * erase sets its block to 0xFF and a write can only clear bits, as on the
+ * flash; a chunk written twice between erases is reported, since the ECC
+ * of the chip would make it unreadable. Commands take no time.
+ *
+ * With --state the area and the GPBR registers are read from a file at
+ * boot and written back at the end of the run: what a reset of the board
+ * keeps, so a run can go on where the previous one stopped.
+ *
+ * With --flash, or sim_flash_map(), the area is a file mapped in memory
+ * instead, written as the commands go: a run killed at any point leaves
+ * the flash as the board would have it. sim_flash_cut() cuts the power
+ * in a command: a write programs only some bytes of its chunk, an erase
+ * clears only some pages of its block, and the process exits there.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "sim.h"
+#include "flash_efc.h"
+
+#define STATE_MAGIC "mxtsim1\n"
+
+static uint8_t flash_ram[FLASH_EFC_SIZE];
+static uint8_t *flash = flash_ram;
+static bool mapped;
+/* Chunks written since their last erase */
+static bool written[FLASH_EFC_SIZE / FLASH_EFC_CHUNK];
+
+/* Commands run since power on, and the one the power is cut in */
+static uint32_t steps;
+static uint32_t cut_step = UINT32_MAX;
+
+static void find_written(void)
+{
+	/* Chunks not erased count as written */
+	for (uint32_t c = 0; c < FLASH_EFC_SIZE / FLASH_EFC_CHUNK; c++) {
+		written[c] = false;
+		for (uint32_t i = 0; i < FLASH_EFC_CHUNK; i++) {
+			if (flash[c * FLASH_EFC_CHUNK + i] != 0xFF) {
+				written[c] = true;
+				break;
+			}
+		}
+	}
+}
+
+/* The area on path, created erased if it is missing or empty */
+bool sim_flash_map(const char *path)
+{
+	struct stat st;
+	void *p;
+	int fd = open(path, O_RDWR | O_CREAT, 0644);
+
+	if (fd < 0 || fstat(fd, &st) != 0) {
+		perror(path);
+		return false;
+	}
+	if (st.st_size == 0) {
+		memset(flash_ram, 0xFF, sizeof(flash_ram));
+		if (write(fd, flash_ram, sizeof(flash_ram)) != sizeof(flash_ram)) {
+			perror(path);
+			close(fd);
+			return false;
+		}
+	} else if (st.st_size != FLASH_EFC_SIZE) {
+		fprintf(stderr, "%s: not a flash of %u bytes\n", path, (unsigned)FLASH_EFC_SIZE);
+		close(fd);
+		return false;
+	}
+	p = mmap(NULL, FLASH_EFC_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED) {
+		perror(path);
+		return false;
+	}
+	if (mapped) {
+		munmap(flash, FLASH_EFC_SIZE);
+	}
+	flash = p;
+	mapped = true;
+	find_written();
+	return true;
+}
+
+/* The power goes off in command number step, counted from 0 */
+void sim_flash_cut(uint32_t step)
+{
+	cut_step = step;
+}
+
+uint32_t sim_flash_steps(void)
+{
+	return steps;
+}
+
+/* Takes the step of a command: true if the power goes off in it */
+static bool cut(void)
+{
+	return steps++ == cut_step;
+}
+
+/* Which bytes or pages the command cut got to, a different mix at each step */
+static uint32_t cut_mask(void)
+{
+	return (steps * 2654435761u) >> 16;
+}
+
+static void power_off(void)
+{
+	if (mapped) {
+		msync(flash, FLASH_EFC_SIZE, MS_SYNC);
+	}
+	_exit(SIM_FLASH_CUT_EXIT);
+}
+
+uint8_t *sim_flash_mem(void)
+{
+	return flash;
+}
+
+const void *flash_efc_ptr(uint32_t offset)
+{
+	Assert(offset < FLASH_EFC_SIZE);
+	return &flash[offset];
+}
+
+bool flash_efc_erase(uint32_t offset)
+{
+	if (offset % FLASH_EFC_BLOCK_SIZE || offset >= FLASH_EFC_SIZE) {
+		return false;
+	}
+	if (cut()) {
+		for (uint32_t p = 0; p < FLASH_EFC_BLOCK_PAGES; p++) {
+			if (cut_mask() & (1u << p)) {
+				memset(&flash[offset + p * FLASH_EFC_PAGE_SIZE], 0xFF, FLASH_EFC_PAGE_SIZE);
+			}
+		}
+		power_off();
+	}
+	memset(&flash[offset], 0xFF, FLASH_EFC_BLOCK_SIZE);
+	memset(&written[offset / FLASH_EFC_CHUNK], 0, FLASH_EFC_BLOCK_SIZE / FLASH_EFC_CHUNK);
+	return true;
+}
+
+bool flash_efc_write(uint32_t offset, const void *data)
+{
+	const uint8_t *d = data;
+
+	if (offset % FLASH_EFC_CHUNK || offset >= FLASH_EFC_SIZE) {
+		return false;
+	}
+	if (written[offset / FLASH_EFC_CHUNK]) {
+		sim_log("flash: chunk at 0x%05x written twice since its erase", (unsigned)offset);
+	}
+	written[offset / FLASH_EFC_CHUNK] = true;
+	if (cut()) {
+		for (uint32_t i = 0; i < FLASH_EFC_CHUNK; i++) {
+			if (cut_mask() & (1u << i)) {
+				flash[offset + i] &= d[i];
+			}
+		}
+		power_off();
+	}
+	for (uint32_t i = 0; i < FLASH_EFC_CHUNK; i++) {
+		flash[offset + i] &= d[i];
+	}
+	return true;
+}
+
+void sim_state_load(void)
+{
+	char magic[sizeof(STATE_MAGIC) - 1];
+	uint32_t gpbr[8];
+	FILE *f;
+
+	/* A new board: flash erased, backup registers cleared */
+	memset(&sim_gpbr, 0, sizeof(sim_gpbr));
+	steps = 0;
+	if (sim_opt.flash) {
+		if (!sim_flash_map(sim_opt.flash)) {
+			exit(1);
+		}
+	} else {
+		memset(flash, 0xFF, FLASH_EFC_SIZE);
+		memset(written, 0, sizeof(written));
+	}
+
+	if (!sim_opt.state || !(f = fopen(sim_opt.state, "rb"))) {
+		return;
+	}
+	if (fread(magic, sizeof(magic), 1, f) != 1 ||
+	    memcmp(magic, STATE_MAGIC, sizeof(magic)) ||
+	    fread(gpbr, sizeof(gpbr), 1, f) != 1 ||
+	    fread(flash, FLASH_EFC_SIZE, 1, f) != 1) {
+		fprintf(stderr, "%s: not a state of this simulator\n", sim_opt.state);
+		exit(1);
+	}
+	fclose(f);
+
+	for (int i = 0; i < 8; i++) {
+		sim_gpbr.SYS_GPBR[i] = gpbr[i];
+	}
+	find_written();
+}
+
+void sim_state_save(void)
+{
+	uint32_t gpbr[8];
+	FILE *f;
+
+	if (!sim_opt.state) {
+		return;
+	}
+	for (int i = 0; i < 8; i++) {
+		gpbr[i] = sim_gpbr.SYS_GPBR[i];
+	}
+	f = fopen(sim_opt.state, "wb");
+	if (!f || fwrite(STATE_MAGIC, sizeof(STATE_MAGIC) - 1, 1, f) != 1 ||
+	    fwrite(gpbr, sizeof(gpbr), 1, f) != 1 ||
+	    fwrite(flash, FLASH_EFC_SIZE, 1, f) != 1 || fclose(f) != 0) {
+		perror(sim_opt.state);
+	}
+}
@@ -0,0 +1,449 @@
+/*
+ * sim_lcd.c
+ *
+ * SPI0, XDMAC and the ILI9488 panel of the simulator.
+ *
+ * Bytes reach the panel when they are written: a DMA block is copied at
+ * once and its end interrupt raised right away. Their time on the wire is
+ * kept apart, on a bus cursor moved by 8 bits at the SPI clock per byte;
+ * the CPU only waits for the cursor where the driver polls the shifter
+ * (spi_is_tx_empty()) from the thread with interrupts on, which is where
+ * ili9488_wait_for_idle() waits on the board.
+ *
+ * The transfer callback of the firmware is held until the cursor: the
+ * driver goes idle when its last block is copied, and the callback runs
+ * from the XDMAC interrupt when the last byte is out on the wire, as on
+ * the board. The calls of main.c to ili9488_set_transfer_callback() and
+ * ili9488_is_busy() are wrapped by the linker to go through here
+ * (sim_wrap.c).
+ *
+ * The panel decodes the stream with CDS (PA6) as the ILI9488 does: column
+ * and page windows, memory writes of 3 bytes a pixel, the read of the ID.
+ * The framebuffer is in the coordinates of the application (x along the
+ * 480 columns, y along the 320 pages); MADCTL is kept but not applied.
+ */
+
+#include <unistd.h>
+#include <ili9488.h>
+#include "sim.h"
+
+Spi sim_spi0;
+Xdmac sim_xdmac;
+
+sim_lcd_stats_t sim_lcd_stats;
+
+/* Free again at this time */
+static uint64_t bus_free_at;
+
+/* Transfer callback of the firmware, and where it is */
+static ili9488_callback_t transfer_done;
+static bool draining;       /* driver idle, its last bytes on the wire */
+static bool drained;        /* out, the callback due in the XDMAC interrupt */
+
+static uint8_t fb[SIM_LCD_H][SIM_LCD_W][3];
+
+static struct {
+	uint8_t cmd;
+	uint8_t param[4];
+	uint32_t n_param;
+	uint16_t col_start, col_end, page_start, page_end;
+	uint16_t col, page;
+	uint8_t pixel[3];
+	uint32_t n_pixel;
+	uint8_t madctl;
+	uint8_t colmod;
+	uint8_t read_setting;
+} panel;
+
+/* Parameters of READ_ID4, by index of SPI_READ_SETTINGS */
+static const uint8_t id4[4] = {0x00, 0x00, 0x94, 0x88};
+
+void sim_lcd_init(void)
+{
+	memset(fb, 0, sizeof(fb));
+	memset(&panel, 0, sizeof(panel));
+	panel.col_end = SIM_LCD_W - 1;
+	panel.page_end = SIM_LCD_H - 1;
+	sim_lcd_stats = (sim_lcd_stats_t){0};
+	bus_free_at = 0;
+	transfer_done = NULL;
+	draining = false;
+	drained = false;
+}
+
+uint64_t sim_lcd_bus_free(void)
+{
+	return bus_free_at;
+}
+
+void sim_lcd_hold_callback(ili9488_callback_t callback)
+{
+	transfer_done = callback;
+}
+
+/* Callback of the driver: the queue is empty, the wire maybe not */
+void sim_lcd_driver_idle(void)
+{
+	if (bus_free_at > sim_now()) {
+		draining = true;
+	} else if (transfer_done) {
+		transfer_done();
+	}
+}
+
+bool sim_lcd_draining(void)
+{
+	return draining;
+}
+
+uint64_t sim_lcd_next(void)
+{
+	return draining ? bus_free_at : SIM_NEVER;
+}
+
+void sim_lcd_fire(void)
+{
+	draining = false;
+	drained = true;
+	sim_irq_pend(XDMAC_IRQn);
+}
+
+/* Weak as in sim_core.c: the tests without the driver have none */
+void XDMAC_Handler(void) __attribute__((weak));
+
+/* The handler of the driver, then the callback of the firmware if it is due */
+void sim_xdmac_irq(void)
+{
+	if (XDMAC_Handler) {
+		XDMAC_Handler();
+	}
+	if (drained) {
+		drained = false;
+		if (transfer_done) {
+			transfer_done();
+		}
+	}
+}
+
+const uint8_t *sim_lcd_pixel(uint32_t x, uint32_t y)
+{
+	return fb[y][x];
+}
+
+/* 6 bits a channel on the panel, spread back over 8 */
+bool sim_lcd_dump(const char *path)
+{
+	FILE *f = fopen(path, "wb");
+
+	if (!f) {
+		perror(path);
+		return false;
+	}
+	fprintf(f, "P6\n%d %d\n255\n", SIM_LCD_W, SIM_LCD_H);
+	for (int y = 0; y < SIM_LCD_H; y++) {
+		for (int x = 0; x < SIM_LCD_W; x++) {
+			for (int c = 0; c < 3; c++) {
+				uint8_t b = fb[y][x][c];
+
+				fputc((b & 0xFC) | (b >> 6), f);
+			}
+		}
+	}
+	return fclose(f) == 0;
+}
+
+static void panel_pixel(void)
+{
+	if (panel.col < SIM_LCD_W && panel.page < SIM_LCD_H) {
+		memcpy(fb[panel.page][panel.col], panel.pixel, 3);
+	}
+	sim_lcd_stats.pixels++;
+
+	if (panel.col++ >= panel.col_end) {
+		panel.col = panel.col_start;
+		if (panel.page++ >= panel.page_end) {
+			panel.page = panel.page_start;
+		}
+	}
+}
+
+static void panel_command(uint8_t b)
+{
+	sim_lcd_stats.commands++;
+	panel.cmd = b;
+	panel.n_param = 0;
+
+	if (b == ILI9488_CMD_MEMORY_WRITE) {
+		panel.col = panel.col_start;
+		panel.page = panel.page_start;
+		panel.n_pixel = 0;
+	} else if (b == ILI9488_CMD_WRITE_MEMORY_CONTINUE) {
+		panel.n_pixel = 0;
+	}
+}
+
+static void panel_data(uint8_t b)
+{
+	switch (panel.cmd) {
+	case ILI9488_CMD_COLUMN_ADDRESS_SET:
+	case ILI9488_CMD_PAGE_ADDRESS_SET:
+		if (panel.n_param < 4) {
+			panel.param[panel.n_param++] = b;
+		}
+		if (panel.n_param == 4) {
+			uint16_t start = (panel.param[0] << 8) | panel.param[1];
+			uint16_t end = (panel.param[2] << 8) | panel.param[3];
+
+			if (panel.cmd == ILI9488_CMD_COLUMN_ADDRESS_SET) {
+				panel.col_start = start;
+				panel.col_end = end;
+			} else {
+				panel.page_start = start;
+				panel.page_end = end;
+			}
+		}
+		break;
+
+	case ILI9488_CMD_MEMORY_WRITE:
+	case ILI9488_CMD_WRITE_MEMORY_CONTINUE:
+		panel.pixel[panel.n_pixel++] = b;
+		if (panel.n_pixel == 3) {
+			panel.n_pixel = 0;
+			panel_pixel();
+		}
+		break;
+
+	case ILI9488_CMD_MEMORY_ACCESS_CONTROL:
+		panel.madctl = b;
+		break;
+
+	case ILI9488_CMD_COLMOD_PIXEL_FORMAT_SET:
+		panel.colmod = b;
+		break;
+
+	case ILI9488_CMD_SPI_READ_SETTINGS:
+		panel.read_setting = b;
+		break;
+
+	default:
+		break;
+	}
+}
+
+/* Bytes read back, the panel driving MISO */
+static uint8_t panel_read(void)
+{
+	if (panel.cmd == ILI9488_CMD_READ_ID4) {
+		return id4[panel.read_setting & 0x03];
+	}
+	return 0;
+}
+
+/* n bytes on the wire after what is already there */
+static void bus_take(uint32_t n)
+{
+	uint64_t now = sim_now();
+	uint64_t ns = (uint64_t)n * 8000000000ull / sim_opt.spi_hz;
+
+	if (bus_free_at < now) {
+		bus_free_at = now;
+	}
+	bus_free_at += ns;
+	sim_lcd_stats.busy_ns += ns;
+	sim_lcd_stats.bytes += n;
+}
+
+static void wire(uint8_t b)
+{
+	if (ioport_get_pin_level(LCD_SPI_CDS_PIO)) {
+		panel_data(b);
+	} else {
+		panel_command(b);
+	}
+}
+
+/* A busy wait of the CPU on the shifter, where it can last */
+static void bus_wait(void)
+{
+	if (bus_free_at > sim_now() && sim_can_wait()) {
+		sim_advance_to(bus_free_at);
+	}
+}
+
+/* -------- SPI -------- */
+
+void spi_master_init(Spi *p_spi)
+{
+	UNUSED(p_spi);
+}
+
+void spi_master_setup_device(Spi *p_spi, struct spi_device *device,
+		spi_flags_t flags, uint32_t baud_rate, board_spi_select_id_t sel_id)
+{
+	UNUSED(p_spi);
+	UNUSED(device);
+	UNUSED(flags);
+	UNUSED(baud_rate);
+	UNUSED(sel_id);
+}
+
+void spi_configure_cs_behavior(Spi *p_spi, uint32_t ul_pcs_ch, uint32_t ul_cs_behavior)
+{
+	UNUSED(p_spi);
+	UNUSED(ul_pcs_ch);
+	UNUSED(ul_cs_behavior);
+}
+
+void spi_select_device(Spi *p_spi, struct spi_device *device)
+{
+	UNUSED(p_spi);
+	UNUSED(device);
+}
+
+void spi_enable(Spi *p_spi)
+{
+	UNUSED(p_spi);
+}
+
+void spi_enable_interrupt(Spi *p_spi, uint32_t ul_sources)
+{
+	UNUSED(p_spi);
+	UNUSED(ul_sources);
+}
+
+uint32_t spi_write(Spi *p_spi, uint16_t us_data, uint8_t uc_pcs, uint8_t uc_last)
+{
+	UNUSED(p_spi);
+	UNUSED(uc_pcs);
+	UNUSED(uc_last);
+	bus_take(1);
+	wire((uint8_t)us_data);
+	return 0;
+}
+
+void spi_write_single(Spi *p_spi, uint8_t data)
+{
+	UNUSED(p_spi);
+	bus_take(1);
+	wire(data);
+}
+
+/* Polled: the CPU feeds every byte, so it waits the whole transfer */
+status_code_t spi_write_packet(Spi *p_spi, const uint8_t *data, size_t len)
+{
+	UNUSED(p_spi);
+	bus_take(len);
+	for (size_t i = 0; i < len; i++) {
+		wire(data[i]);
+	}
+	bus_wait();
+	return STATUS_OK;
+}
+
+status_code_t spi_read_packet(Spi *p_spi, uint8_t *data, size_t len)
+{
+	UNUSED(p_spi);
+	bus_take(len);
+	for (size_t i = 0; i < len; i++) {
+		data[i] = panel_read();
+	}
+	bus_wait();
+	return STATUS_OK;
+}
+
+uint32_t spi_is_tx_empty(Spi *p_spi)
+{
+	UNUSED(p_spi);
+	bus_wait();
+	return 1;
+}
+
+/* -------- XDMAC -------- */
+
+/* Start of the program and end of the heap: all a DMA source can be in */
+extern char __executable_start[];
+
+static void dma_check_source(uint32_t sa, uint32_t len)
+{
+	uintptr_t lo = (uintptr_t)__executable_start;
+	uintptr_t hi = (uintptr_t)sbrk(0);
+
+	if (sa < lo || (uintptr_t)sa + len > hi) {
+		fprintf(stderr, "XDMAC source 0x%08x (%u bytes) out of the program: "
+		        "on the stack, or a pointer cut to 32 bits\n", sa, len);
+		exit(2);
+	}
+}
+
+void xdmac_configure_transfer(Xdmac *xdmac, uint32_t channel_num,
+		xdmac_channel_config_t *p_cfg)
+{
+	XdmacChid *ch = &xdmac->XDMAC_CHID[channel_num];
+
+	ch->XDMAC_CSA = p_cfg->mbr_sa;
+	ch->XDMAC_CDA = p_cfg->mbr_da;
+	ch->XDMAC_CUBC = p_cfg->mbr_ubc;
+	ch->XDMAC_CC = p_cfg->mbr_cfg;
+	ch->XDMAC_CBC = p_cfg->mbr_bc;
+	ch->XDMAC_CDS_MSP = p_cfg->mbr_ds;
+	ch->XDMAC_CSUS = p_cfg->mbr_sus;
+	ch->XDMAC_CDUS = p_cfg->mbr_dus;
+}
+
+void xdmac_enable_interrupt(Xdmac *xdmac, uint32_t channel_num)
+{
+	xdmac->XDMAC_GIM |= 1u << channel_num;
+}
+
+void xdmac_channel_enable_interrupt(Xdmac *xdmac, uint32_t channel_num, uint32_t mask)
+{
+	xdmac->XDMAC_CHID[channel_num].XDMAC_CIM |= mask;
+}
+
+void xdmac_channel_disable(Xdmac *xdmac, uint32_t channel_num)
+{
+	xdmac->XDMAC_GS &= ~(1u << channel_num);
+}
+
+/* Memory to SPI0 TDR, a byte a beat: the whole block goes at once */
+void xdmac_channel_enable(Xdmac *xdmac, uint32_t channel_num)
+{
+	XdmacChid *ch = &xdmac->XDMAC_CHID[channel_num];
+	uint32_t ubc = ch->XDMAC_CUBC;
+	uint32_t blocks = ch->XDMAC_CBC + 1;
+	uint32_t sam = ch->XDMAC_CC & XDMAC_CC_SAM_Msk;
+	uint32_t sa = ch->XDMAC_CSA;
+
+	Assert(ch->XDMAC_CDA == (uint32_t)(uintptr_t)&SPI0->SPI_TDR);
+	dma_check_source(sa, ubc);
+	if (sam == XDMAC_CC_SAM_INCREMENTED_AM) {
+		dma_check_source(sa, ubc * blocks);
+	}
+
+	bus_take(ubc * blocks);
+	for (uint32_t b = 0; b < blocks; b++) {
+		const uint8_t *src = (const uint8_t *)(uintptr_t)sa;
+
+		for (uint32_t i = 0; i < ubc; i++) {
+			wire(src[i]);
+		}
+		sa += ubc;
+		if (sam == XDMAC_CC_SAM_UBS_AM) {
+			sa += ch->XDMAC_CSUS;
+		}
+	}
+	sim_lcd_stats.dma_blocks++;
+
+	ch->XDMAC_CIS |= XDMAC_CIS_BIS;
+	if ((ch->XDMAC_CIM & XDMAC_CIE_BIE) && (xdmac->XDMAC_GIM & (1u << channel_num))) {
+		sim_irq_pend(XDMAC_IRQn);
+	}
+}
+
+uint32_t xdmac_channel_get_interrupt_status(Xdmac *xdmac, uint32_t channel_num)
+{
+	uint32_t status = xdmac->XDMAC_CHID[channel_num].XDMAC_CIS;
+
+	xdmac->XDMAC_CHID[channel_num].XDMAC_CIS = 0;
+	return status;
+}
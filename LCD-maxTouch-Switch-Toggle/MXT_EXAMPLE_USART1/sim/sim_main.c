@@ -0,0 +1,66 @@
+/*
+ * sim_main.c
+ *
+ * main() of the simulator: the firmware main() is built as firmware_main()
+ * and called once the models are up.
+ */
+
+#include "conf_ili9488.h"
+#include "sim.h"
+
+int firmware_main(void);
+
+static void usage(void)
+{
+	fprintf(stderr,
+	        "usage: mxt_sim [-o DIR] [--spi-hz HZ] [--state FILE] [--flash FILE]\n"
+	        "               [--console FILE] [--report FILE] [-q] SCRIPT\n"
+	        "  -o DIR          where the dump commands write (.)\n"
+	        "  --spi-hz HZ     clock of the LCD SPI (%u)\n"
+	        "  --state FILE    flash and backup registers, read at boot and written at the end\n"
+	        "  --flash FILE    flash mapped on FILE, written as the firmware programs it\n"
+	        "  --console FILE  bytes sent by the console USART (stdout)\n"
+	        "  --report FILE   JSON wire cost of the phases between mark commands\n"
+	        "  -q              no log on stderr\n",
+	        (unsigned)ILI9488_SPI_BAUDRATE);
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	for (int i = 1; i < argc; i++) {
+		const char *a = argv[i];
+
+		if (!strcmp(a, "-o") && i + 1 < argc) {
+			sim_opt.out_dir = argv[++i];
+		} else if (!strcmp(a, "--spi-hz") && i + 1 < argc) {
+			sim_opt.spi_hz = strtoul(argv[++i], NULL, 0);
+		} else if (!strcmp(a, "--state") && i + 1 < argc) {
+			sim_opt.state = argv[++i];
+		} else if (!strcmp(a, "--flash") && i + 1 < argc) {
+			sim_opt.flash = argv[++i];
+		} else if (!strcmp(a, "--console") && i + 1 < argc) {
+			sim_opt.console = argv[++i];
+		} else if (!strcmp(a, "--report") && i + 1 < argc) {
+			sim_opt.report = argv[++i];
+		} else if (!strcmp(a, "-q")) {
+			sim_opt.quiet = true;
+		} else if (a[0] == '-' && a[1] != 0) {
+			usage();
+		} else if (!sim_opt.script) {
+			sim_opt.script = a;
+		} else {
+			usage();
+		}
+	}
+	if (!sim_opt.script || sim_opt.spi_hz == 0) {
+		usage();
+	}
+
+	if (!sim_script_load(sim_opt.script)) {
+		return 1;
+	}
+	sim_power_on();
+
+	return firmware_main();
+}
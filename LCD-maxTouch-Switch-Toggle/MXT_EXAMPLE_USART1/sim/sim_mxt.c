@@ -0,0 +1,300 @@
+/*
+ * sim_mxt.c
+ *
+ * TWIHS0 and the maXTouch mXT143E of the simulator.
+ *
+ * The device is its memory map: the info block and object table (with
+ * their CRC) that mxt_init_device() checks, the config objects the
+ * firmware writes, T44 with the number of messages queued and T5, from
+ * which every read of 9 bytes takes the next message out of the queue (a
+ * read starting at T44 or T5 goes on from message to message, as on the
+ * chip). CHG is low while the queue is not empty.
+ *
+ * Transfers take their time on the bus: 9 bits a byte at the speed given
+ * to twihs_master_setup().
+ */
+
+#include "sim.h"
+
+#define MXT_CHIP       0x4A
+#define MXT_MEM_SIZE   0x200
+#define MXT_QUEUE_SIZE 32
+#define MSG_SIZE       MXT_TWI_MSG_SIZE_T5
+
+/* Objects of the mXT143E used by the firmware, in the order of the table */
+static const struct {
+	uint8_t type;
+	uint16_t addr;
+	uint8_t size;
+	uint8_t report_ids;
+} objects[] = {
+	{MXT_GEN_MESSAGEPROCESSOR_T5,   0x0101, MSG_SIZE, 0},
+	{MXT_GEN_COMMANDPROCESSOR_T6,   0x010A,  6,  1},
+	{MXT_GEN_POWERCONFIG_T7,        0x0110,  4,  0},
+	{MXT_GEN_ACQUISITIONCONFIG_T8,  0x0114, 10,  0},
+	{MXT_TOUCH_MULTITOUCHSCREEN_T9, 0x011E, 36, 10},
+	{MXT_SPT_MESSAGECOUNT_T44,      0x0100,  1,  0},
+	{MXT_SPT_CTE_CONFIGURATION_T46, 0x0142,  9,  0},
+	{MXT_PROCI_SHIELDLESS_T56,      0x014B, 33,  0},
+};
+
+#define N_OBJECTS   (sizeof(objects) / sizeof(objects[0]))
+#define ID_SIZE     7
+#define TABLE_SIZE  (N_OBJECTS * 6)
+
+#define T5_ADDR     0x0101
+#define T6_ADDR     0x010A
+#define T44_ADDR    0x0100
+
+/* First report id of T6 and of T9, as the driver numbers them */
+#define T6_REPORT_ID 1
+#define T9_REPORT_ID 2
+
+Twihs sim_twihs0;
+
+sim_twi_stats_t sim_twi_stats;
+
+static uint8_t mem[MXT_MEM_SIZE];
+
+static uint8_t queue[MXT_QUEUE_SIZE][MSG_SIZE];
+static uint32_t q_head, q_tail;
+static uint32_t q_lost;
+
+static uint32_t twi_speed = 400000;
+
+/* CRC of the info block, as mxt_calculate_infoblock_crc() */
+static uint32_t crc24(uint32_t crc, uint8_t byte1, uint8_t byte2)
+{
+	uint32_t result = (crc << 1) ^ (uint32_t)((byte2 << 8) | byte1);
+
+	if (result & 0x1000000) {
+		result ^= 0x80001B;
+	}
+	return result;
+}
+
+static uint8_t crc8(uint8_t crc, uint8_t data)
+{
+	for (int i = 0; i < 8; i++) {
+		uint8_t fb = (crc ^ data) & 0x01;
+
+		data >>= 1;
+		crc >>= 1;
+		if (fb) {
+			crc ^= 0x8c;
+		}
+	}
+	return crc;
+}
+
+static uint32_t queued(void)
+{
+	return q_head - q_tail;
+}
+
+static void update_chg(void)
+{
+	sim_pio_edge(MAXTOUCH_XPRO_CHG_PIO, sim_mxt_chg());
+}
+
+void sim_mxt_init(void)
+{
+	uint8_t *p = mem;
+	uint32_t crc = 0;
+	uint32_t i;
+
+	memset(mem, 0, sizeof(mem));
+	q_head = q_tail = q_lost = 0;
+
+	/* Info block: family, variant, version, build, matrix, objects */
+	*p++ = 0x81;
+	*p++ = 0x07;
+	*p++ = 0x10;
+	*p++ = 0xAA;
+	*p++ = 14;
+	*p++ = 8;
+	*p++ = N_OBJECTS;
+	for (i = 0; i < N_OBJECTS; i++) {
+		*p++ = objects[i].type;
+		*p++ = objects[i].addr & 0xFF;
+		*p++ = objects[i].addr >> 8;
+		*p++ = objects[i].size - 1;
+		*p++ = 0;
+		*p++ = objects[i].report_ids;
+	}
+
+	/* Over an even number of bytes, the last one paired with 0 */
+	for (i = 0; i + 1 < ID_SIZE + TABLE_SIZE; i += 2) {
+		crc = crc24(crc, mem[i], mem[i + 1]);
+	}
+	if (i < ID_SIZE + TABLE_SIZE) {
+		crc = crc24(crc, mem[i], 0);
+	}
+	crc &= 0x00FFFFFF;
+	*p++ = crc;
+	*p++ = crc >> 8;
+	*p++ = crc >> 16;
+
+	/* Released: CHG pulled up */
+	sim_pio_edge(MAXTOUCH_XPRO_CHG_PIO, true);
+}
+
+bool sim_mxt_chg(void)
+{
+	return queued() == 0;
+}
+
+/* Messages dropped because the queue of the chip was full */
+uint32_t sim_mxt_lost(void)
+{
+	return q_lost;
+}
+
+/* Report id and 7 bytes: the checksum is filled in */
+void sim_mxt_message(const uint8_t msg[MSG_SIZE])
+{
+	uint8_t *m;
+	uint8_t crc = 0;
+
+	if (queued() == MXT_QUEUE_SIZE) {
+		q_lost++;
+		sim_log("mxt: queue full, message %02x lost", msg[0]);
+		return;
+	}
+	m = queue[q_head % MXT_QUEUE_SIZE];
+	memcpy(m, msg, MSG_SIZE - 1);
+	for (int i = 0; i < MSG_SIZE - 1; i++) {
+		crc = crc8(crc, m[i]);
+	}
+	m[MSG_SIZE - 1] = crc;
+	q_head++;
+	update_chg();
+}
+
+/* Screen to the raw axes, the inverse of convert_axis_system_x/y() of main.c */
+static uint16_t to_raw(uint32_t v, uint32_t size)
+{
+	uint32_t raw = ((size - v) * 4096 + size - 1) / size;
+
+	return raw > 4095 ? 4095 : raw;
+}
+
+void sim_mxt_touch(uint8_t id, uint8_t status, uint16_t x, uint16_t y)
+{
+	uint8_t msg[MSG_SIZE] = {0};
+	uint16_t raw_x = to_raw(x, SIM_LCD_W);
+	uint16_t raw_y = to_raw(y, SIM_LCD_H);
+
+	msg[0] = T9_REPORT_ID + id;
+	msg[1] = status;
+	msg[2] = raw_x >> 4;
+	msg[3] = raw_y >> 4;
+	msg[4] = ((raw_x & 0xF) << 4) | (raw_y & 0xF);
+	msg[5] = (status & MXT_RELEASE_EVENT) ? 0 : 10;
+	msg[6] = (status & MXT_RELEASE_EVENT) ? 0 : 40;
+	sim_mxt_message(msg);
+}
+
+/* Status of T6: reset, calibration */
+static void t6_message(uint8_t status)
+{
+	uint8_t msg[MSG_SIZE] = {T6_REPORT_ID, status, 0x5A, 0xA5, 0x3C};
+
+	sim_mxt_message(msg);
+}
+
+/* Next byte of a read: from T5 on, the messages of the queue */
+static uint8_t read_message_byte(uint32_t rel)
+{
+	static uint8_t current[MSG_SIZE];
+
+	if (rel % MSG_SIZE == 0) {
+		if (queued()) {
+			memcpy(current, queue[q_tail % MXT_QUEUE_SIZE], sizeof(current));
+			q_tail++;
+		} else {
+			memset(current, 0, sizeof(current));
+			current[0] = 0xFF;
+		}
+	}
+	return current[rel % MSG_SIZE];
+}
+
+static void twi_wait(uint32_t bytes)
+{
+	uint64_t ns = (uint64_t)bytes * 9 * 1000000000u / twi_speed;
+
+	sim_twi_stats.bytes += bytes;
+	sim_twi_stats.transfers++;
+	sim_twi_stats.busy_ns += ns;
+	sim_advance(ns);
+}
+
+uint32_t twihs_master_setup(twihs_master_t p_twihs, twihs_master_options_t *p_opt)
+{
+	UNUSED(p_twihs);
+	if (p_opt->speed) {
+		twi_speed = p_opt->speed;
+	}
+	return TWIHS_SUCCESS;
+}
+
+uint32_t twihs_master_read(twihs_master_t p_twihs, twihs_package_t *p_package)
+{
+	uint8_t *buf = p_package->buffer;
+	/* Bit 15 asks for the checksum of the messages, always there */
+	uint32_t start = (p_package->addr[0] | (p_package->addr[1] << 8)) & 0x7FFF;
+	bool messages = (start == T44_ADDR || start == T5_ADDR);
+	uint8_t count = queued() > 255 ? 255 : queued();
+
+	UNUSED(p_twihs);
+	if (p_package->chip != MXT_CHIP) {
+		return TWIHS_NO_CHIP_FOUND;
+	}
+
+	for (uint32_t i = 0; i < p_package->length; i++) {
+		uint32_t a = start + i;
+
+		if (messages && a >= T5_ADDR) {
+			buf[i] = read_message_byte(a - T5_ADDR);
+		} else if (a == T44_ADDR) {
+			buf[i] = count;
+		} else {
+			buf[i] = a < MXT_MEM_SIZE ? mem[a] : 0;
+		}
+	}
+	update_chg();
+
+	/* Address written, repeated start, then the data */
+	twi_wait(1 + p_package->addr_length + 1 + p_package->length);
+	return TWIHS_SUCCESS;
+}
+
+uint32_t twihs_master_write(twihs_master_t p_twihs, twihs_package_t *p_package)
+{
+	const uint8_t *buf = p_package->buffer;
+	uint32_t start = p_package->addr[0] | (p_package->addr[1] << 8);
+
+	UNUSED(p_twihs);
+	if (p_package->chip != MXT_CHIP) {
+		return TWIHS_NO_CHIP_FOUND;
+	}
+
+	for (uint32_t i = 0; i < p_package->length; i++) {
+		uint32_t a = start + i;
+
+		if (a >= MXT_MEM_SIZE) {
+			break;
+		}
+		mem[a] = buf[i];
+		if (a == T6_ADDR + MXT_GEN_COMMANDPROCESSOR_RESET && buf[i]) {
+			q_head = q_tail;
+			t6_message(0x80);
+		} else if (a == T6_ADDR + MXT_GEN_COMMANDPROCESSOR_CALIBRATE && buf[i]) {
+			t6_message(0x10);
+		}
+	}
+
+	twi_wait(1 + p_package->addr_length + p_package->length);
+	return TWIHS_SUCCESS;
+}
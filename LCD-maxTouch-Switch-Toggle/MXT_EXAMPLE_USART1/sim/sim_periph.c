@@ -0,0 +1,384 @@
+/*
+ * sim_periph.c
+ *
+ * PIOA, RTT, console USART and GPBR of the simulator.
+ *
+ * PIOA: inputs only change through sim_pio_edge(); an edge of a pin whose
+ * interrupt is on raises PIOA_IRQn and the handlers registered for the pin
+ * are called as pio_handler_process() of ASF does.
+ * RTT: the counter is computed from the virtual clock; the alarm fires when
+ * the counter goes through AR + 1, as on the chip.
+ * USART: a byte written is out at once, so TXRDY is always set. A byte
+ * received (sim_usart_rx()) waits in RHR until it is read, and the one
+ * after it overwrites it, as on the chip.
+ */
+
+#include <stdarg.h>
+#include "sim.h"
+
+Gpbr sim_gpbr;
+Pio sim_pioa;
+Rtt sim_rtt;
+Usart sim_usart1;
+
+/* -------- PIOA -------- */
+
+#define PIO_HANDLERS 8
+
+static struct {
+	uint32_t mask;
+	uint32_t attr;
+	sim_pio_handler_t handler;
+} pio_handlers[PIO_HANDLERS];
+
+static uint32_t pio_n_handlers;
+
+uint32_t pio_configure(Pio *p_pio, const pio_type_t ul_type,
+		const uint32_t ul_mask, const uint32_t ul_attribute)
+{
+	switch (ul_type) {
+	case PIO_INPUT:
+		if (ul_attribute & PIO_PULLUP) {
+			p_pio->PIO_PDSR |= ul_mask;
+		}
+		break;
+	case PIO_OUTPUT_0:
+		pio_clear(p_pio, ul_mask);
+		break;
+	case PIO_OUTPUT_1:
+		pio_set(p_pio, ul_mask);
+		break;
+	default:
+		return 0;
+	}
+	return 1;
+}
+
+void pio_set(Pio *p_pio, const uint32_t ul_mask)
+{
+	p_pio->PIO_ODSR |= ul_mask;
+	p_pio->PIO_PDSR |= ul_mask;
+}
+
+void pio_clear(Pio *p_pio, const uint32_t ul_mask)
+{
+	p_pio->PIO_ODSR &= ~ul_mask;
+	p_pio->PIO_PDSR &= ~ul_mask;
+}
+
+/* Only PIOA is modelled: pins 0 to 31 */
+void pio_set_pin_high(uint32_t ul_pin)
+{
+	Assert(ul_pin < 32);
+	pio_set(PIOA, 1u << ul_pin);
+}
+
+void pio_set_pin_low(uint32_t ul_pin)
+{
+	Assert(ul_pin < 32);
+	pio_clear(PIOA, 1u << ul_pin);
+}
+
+bool ioport_get_pin_level(uint32_t pin)
+{
+	Assert(pin < 32);
+	return (PIOA->PIO_PDSR >> pin) & 1;
+}
+
+uint32_t pio_handler_set(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
+		uint32_t ul_attr, sim_pio_handler_t p_handler)
+{
+	Assert(p_pio == PIOA && ul_id == ID_PIOA);
+	if (pio_n_handlers == PIO_HANDLERS) {
+		return 1;
+	}
+	pio_handlers[pio_n_handlers].mask = ul_mask;
+	pio_handlers[pio_n_handlers].attr = ul_attr;
+	pio_handlers[pio_n_handlers].handler = p_handler;
+	pio_n_handlers++;
+	return 0;
+}
+
+uint32_t pio_handler_set_pin(uint32_t ul_pin, uint32_t ul_flag,
+		sim_pio_handler_t p_handler)
+{
+	Assert(ul_pin < 32);
+	return pio_handler_set(PIOA, ID_PIOA, 1u << ul_pin, ul_flag, p_handler);
+}
+
+void pio_enable_interrupt(Pio *p_pio, const uint32_t ul_mask)
+{
+	p_pio->PIO_IMR |= ul_mask;
+}
+
+void pio_enable_pin_interrupt(uint32_t ul_pin)
+{
+	Assert(ul_pin < 32);
+	pio_enable_interrupt(PIOA, 1u << ul_pin);
+}
+
+/* An external device drives an input pin */
+void sim_pio_edge(uint32_t pin, bool level)
+{
+	uint32_t mask = 1u << pin;
+	bool was = (PIOA->PIO_PDSR & mask) != 0;
+
+	if (was == level) {
+		return;
+	}
+	if (level) {
+		PIOA->PIO_PDSR |= mask;
+	} else {
+		PIOA->PIO_PDSR &= ~mask;
+	}
+
+	for (uint32_t i = 0; i < pio_n_handlers; i++) {
+		bool rise = (pio_handlers[i].attr & PIO_IT_RE_OR_HL) != 0;
+
+		if ((pio_handlers[i].mask & mask) && (PIOA->PIO_IMR & mask) && rise == level) {
+			PIOA->PIO_ISR |= mask;
+			sim_irq_pend(PIOA_IRQn);
+			return;
+		}
+	}
+}
+
+void sim_pioa_irq(void)
+{
+	uint32_t status = PIOA->PIO_ISR & PIOA->PIO_IMR;
+
+	PIOA->PIO_ISR = 0;
+	for (uint32_t i = 0; i < pio_n_handlers; i++) {
+		if (status & pio_handlers[i].mask) {
+			pio_handlers[i].handler(ID_PIOA, pio_handlers[i].mask);
+		}
+	}
+}
+
+/* -------- RTT -------- */
+
+/* Time of the last restart of the counter, and of the alarm, in ns */
+static uint64_t rtt_base;
+static uint64_t rtt_alarm_at = SIM_NEVER;
+
+static uint32_t rtt_prescaler(void)
+{
+	uint32_t p = RTT->RTT_MR & RTT_MR_RTPRES_Msk;
+
+	return p ? p : 0x10000;
+}
+
+static uint64_t rtt_ticks(uint64_t t)
+{
+	return (unsigned __int128)(t - rtt_base) * 32768u / ((uint64_t)rtt_prescaler() * 1000000000u);
+}
+
+uint32_t rtt_sel_source(Rtt *p_rtt, bool is_rtc_sel)
+{
+	UNUSED(p_rtt);
+	UNUSED(is_rtc_sel);
+	return 0;
+}
+
+uint32_t rtt_init(Rtt *p_rtt, uint16_t us_prescaler)
+{
+	p_rtt->RTT_MR = us_prescaler;
+	rtt_base = sim_now();
+	rtt_alarm_at = SIM_NEVER;
+	return 0;
+}
+
+void rtt_enable_interrupt(Rtt *p_rtt, uint32_t ul_sources)
+{
+	p_rtt->RTT_MR |= ul_sources;
+	/* The line is a level: an alarm already flagged interrupts now */
+	if ((ul_sources & RTT_MR_ALMIEN) && (p_rtt->RTT_SR & RTT_SR_ALMS)) {
+		sim_irq_pend(RTT_IRQn);
+	}
+}
+
+void rtt_disable_interrupt(Rtt *p_rtt, uint32_t ul_sources)
+{
+	p_rtt->RTT_MR &= ~ul_sources;
+}
+
+uint32_t rtt_read_timer_value(Rtt *p_rtt)
+{
+	p_rtt->RTT_VR = (uint32_t)rtt_ticks(sim_now());
+	return p_rtt->RTT_VR;
+}
+
+uint32_t rtt_get_status(Rtt *p_rtt)
+{
+	uint32_t status = p_rtt->RTT_SR;
+
+	p_rtt->RTT_SR = 0;
+	return status;
+}
+
+uint32_t rtt_write_alarm_time(Rtt *p_rtt, uint32_t ul_alarm_time)
+{
+	uint64_t now = sim_now();
+	uint64_t ticks = rtt_ticks(now);
+	uint32_t ahead;
+
+	p_rtt->RTT_AR = ul_alarm_time ? ul_alarm_time - 1 : 0xFFFFFFFF;
+	if (p_rtt->RTT_AR == 0xFFFFFFFF) {
+		rtt_alarm_at = SIM_NEVER;
+		return 0;
+	}
+
+	/* Ticks until the counter reaches AR + 1: a full turn if it is there */
+	ahead = p_rtt->RTT_AR + 1 - (uint32_t)ticks;
+	ticks += ahead ? ahead : 0x100000000ull;
+	rtt_alarm_at = rtt_base + (uint64_t)(((unsigned __int128)ticks * rtt_prescaler() *
+			1000000000u + 32767) / 32768u);
+	return 0;
+}
+
+uint64_t sim_rtt_next(void)
+{
+	return rtt_alarm_at;
+}
+
+void sim_rtt_fire(uint64_t t)
+{
+	UNUSED(t);
+	rtt_alarm_at = SIM_NEVER;
+	RTT->RTT_SR |= RTT_SR_ALMS;
+	if (RTT->RTT_MR & RTT_MR_ALMIEN) {
+		sim_irq_pend(RTT_IRQn);
+	}
+}
+
+/* -------- USART and stdio -------- */
+
+static FILE *console;
+
+int (*ptr_put)(void volatile *, char);
+static void volatile *stdio_base;
+
+static void console_open(void)
+{
+	if (console) {
+		return;
+	}
+	console = sim_opt.console ? fopen(sim_opt.console, "wb") : stdout;
+	if (!console) {
+		perror(sim_opt.console);
+		exit(1);
+	}
+}
+
+void sim_console_close(void)
+{
+	if (console && console != stdout) {
+		fclose(console);
+	} else {
+		fflush(stdout);
+	}
+	console = NULL;
+}
+
+void usart_enable_interrupt(Usart *p_usart, uint32_t ul_sources)
+{
+	p_usart->US_IMR |= ul_sources;
+	if (ul_sources & US_IER_TXRDY) {
+		sim_irq_pend(USART1_IRQn);
+	}
+}
+
+void usart_disable_interrupt(Usart *p_usart, uint32_t ul_sources)
+{
+	p_usart->US_IMR &= ~ul_sources;
+}
+
+uint32_t usart_is_tx_ready(Usart *p_usart)
+{
+	UNUSED(p_usart);
+	return 1;
+}
+
+uint32_t usart_is_tx_empty(Usart *p_usart)
+{
+	UNUSED(p_usart);
+	return 1;
+}
+
+uint32_t usart_write(Usart *p_usart, uint32_t c)
+{
+	UNUSED(p_usart);
+	console_open();
+	fputc(c & 0xFF, console);
+	return 0;
+}
+
+uint32_t usart_is_rx_ready(Usart *p_usart)
+{
+	return (p_usart->US_CSR & US_CSR_RXRDY) > 0;
+}
+
+uint32_t usart_read(Usart *p_usart, uint32_t *c)
+{
+	if (!(p_usart->US_CSR & US_CSR_RXRDY)) {
+		return 1;
+	}
+	*c = p_usart->US_RHR & US_RHR_RXCHR_Msk;
+	p_usart->US_CSR &= ~US_CSR_RXRDY;
+	return 0;
+}
+
+void sim_usart_rx(uint8_t c)
+{
+	USART1->US_RHR = c;
+	USART1->US_CSR |= US_CSR_RXRDY;
+	if (USART1->US_IMR & US_IMR_RXRDY) {
+		sim_irq_pend(USART1_IRQn);
+	}
+}
+
+/* USART1_Handler of the firmware, again while TXRDY stays enabled */
+void USART1_Handler(void) __attribute__((weak));
+
+void sim_usart_irq(void)
+{
+	if (!USART1_Handler) {
+		return;
+	}
+	USART1_Handler();
+	if (USART1->US_IMR & US_IMR_TXRDY) {
+		sim_irq_pend(USART1_IRQn);
+	}
+}
+
+static int usart_putchar(void volatile *usart, char c)
+{
+	usart_write((Usart *)usart, (uint8_t)c);
+	return 1;
+}
+
+void stdio_serial_init(Usart *usart, const usart_serial_options_t *opt)
+{
+	UNUSED(opt);
+	stdio_base = usart;
+	ptr_put = usart_putchar;
+}
+
+int sim_printf(const char *fmt, ...)
+{
+	char line[512];
+	va_list ap;
+	int n;
+
+	va_start(ap, fmt);
+	n = vsnprintf(line, sizeof(line), fmt, ap);
+	va_end(ap);
+
+	/* Nothing goes out before stdio_serial_init(), as on the board */
+	if (ptr_put) {
+		for (int i = 0; i < n && i < (int)sizeof(line) - 1; i++) {
+			ptr_put(stdio_base, line[i]);
+		}
+	}
+	return n;
+}
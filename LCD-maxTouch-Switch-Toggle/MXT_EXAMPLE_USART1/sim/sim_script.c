@@ -0,0 +1,238 @@
+/*
+ * sim_script.c
+ *
+ * Scenario of a run: what happens outside the board, and when.
+ *
+ * One command a line, after its time in ms since power on, or after the
+ * time of the line before with a leading +; # starts a comment.
+ *
+ *   <ms> touch X Y [HOLD]       press at X Y, release HOLD ms later (100)
+ *   <ms> press|move|release X Y [ID]
+ *                               one T9 message of finger ID (0)
+ *   <ms> t5 REPORTID B0 .. B6   any T5 message, bytes in hex
+ *   <ms> door                   the door switch (PA11) is pushed
+ *   <ms> dump FILE              the panel as a PPM image, in the -o directory
+ *   <ms> mark NAME              end of a phase of the --report benchmark
+ *   <ms> key C                  the character C is received on the console
+ *   <ms> end                    the run stops
+ *
+ * Without end the run stops the first time the firmware goes to sleep
+ * after the last command.
+ */
+
+#include <ctype.h>
+#include "sim.h"
+
+#define SCRIPT_MAX 1024
+
+enum cmd_kind {
+	CMD_TOUCH,
+	CMD_T5,
+	CMD_DOOR,
+	CMD_DUMP,
+	CMD_MARK,
+	CMD_KEY,
+	CMD_END,
+};
+
+typedef struct {
+	uint64_t t;
+	uint32_t line;
+	enum cmd_kind kind;
+	uint8_t status;
+	uint8_t id;
+	uint16_t x, y;
+	uint8_t msg[MXT_TWI_MSG_SIZE_T5];
+	char path[128];
+} command_t;
+
+static command_t cmds[SCRIPT_MAX];
+static uint32_t n_cmds;
+static uint32_t next;
+
+static const char *script_path;
+
+static bool add(const command_t *c)
+{
+	if (n_cmds == SCRIPT_MAX) {
+		fprintf(stderr, "%s:%u: more than %d commands\n", script_path, c->line, SCRIPT_MAX);
+		return false;
+	}
+	cmds[n_cmds++] = *c;
+	return true;
+}
+
+static bool parse_line(char *line, uint32_t n, uint64_t *last_ms)
+{
+	command_t c = {.line = n};
+	char *args[10];
+	int n_args = 0;
+	char *p = strchr(line, '#');
+	uint64_t ms;
+	char *end;
+
+	if (p) {
+		*p = 0;
+	}
+	for (p = strtok(line, " \t\r\n"); p && n_args < 10; p = strtok(NULL, " \t\r\n")) {
+		args[n_args++] = p;
+	}
+	if (n_args == 0) {
+		return true;
+	}
+	if (n_args < 2) {
+		goto bad;
+	}
+
+	ms = strtoull(args[0] + (args[0][0] == '+'), &end, 10);
+	if (*end) {
+		goto bad;
+	}
+	if (args[0][0] == '+') {
+		ms += *last_ms;
+	}
+	*last_ms = ms;
+	c.t = ms * 1000000u;
+
+	if (!strcmp(args[1], "touch") && (n_args == 4 || n_args == 5)) {
+		uint32_t hold = n_args == 5 ? strtoul(args[4], NULL, 10) : 100;
+
+		c.kind = CMD_TOUCH;
+		c.x = strtoul(args[2], NULL, 10);
+		c.y = strtoul(args[3], NULL, 10);
+		c.status = MXT_DETECT_EVENT | MXT_PRESS_EVENT;
+		if (!add(&c)) {
+			return false;
+		}
+		c.t += (uint64_t)hold * 1000000u;
+		c.status = MXT_RELEASE_EVENT;
+	} else if ((!strcmp(args[1], "press") || !strcmp(args[1], "move") ||
+	            !strcmp(args[1], "release")) && (n_args == 4 || n_args == 5)) {
+		c.kind = CMD_TOUCH;
+		c.x = strtoul(args[2], NULL, 10);
+		c.y = strtoul(args[3], NULL, 10);
+		c.id = n_args == 5 ? strtoul(args[4], NULL, 10) : 0;
+		c.status = args[1][0] == 'p' ? MXT_DETECT_EVENT | MXT_PRESS_EVENT :
+		           args[1][0] == 'm' ? MXT_DETECT_EVENT | MXT_MOVE_EVENT :
+		           MXT_RELEASE_EVENT;
+	} else if (!strcmp(args[1], "t5") && n_args == 10) {
+		c.kind = CMD_T5;
+		for (int i = 0; i < 8; i++) {
+			c.msg[i] = strtoul(args[2 + i], NULL, 16);
+		}
+	} else if (!strcmp(args[1], "door") && n_args == 2) {
+		c.kind = CMD_DOOR;
+	} else if (!strcmp(args[1], "dump") && n_args == 3) {
+		c.kind = CMD_DUMP;
+		snprintf(c.path, sizeof(c.path), "%s", args[2]);
+	} else if (!strcmp(args[1], "mark") && n_args == 3) {
+		c.kind = CMD_MARK;
+		snprintf(c.path, sizeof(c.path), "%s", args[2]);
+	} else if (!strcmp(args[1], "key") && n_args == 3 && strlen(args[2]) == 1) {
+		c.kind = CMD_KEY;
+		c.id = args[2][0];
+	} else if (!strcmp(args[1], "end") && n_args == 2) {
+		c.kind = CMD_END;
+	} else {
+		goto bad;
+	}
+	return add(&c);
+
+bad:
+	fprintf(stderr, "%s:%u: bad command\n", script_path, n);
+	return false;
+}
+
+static int by_time(const void *a, const void *b)
+{
+	const command_t *ca = a, *cb = b;
+
+	if (ca->t != cb->t) {
+		return ca->t < cb->t ? -1 : 1;
+	}
+	/* Same time: in the order of the file */
+	return ca->line < cb->line ? -1 : ca->line > cb->line;
+}
+
+bool sim_script_load(const char *path)
+{
+	char line[256];
+	uint32_t n = 0;
+	uint64_t last_ms = 0;
+	FILE *f = fopen(path, "r");
+
+	script_path = path;
+	if (!f) {
+		perror(path);
+		return false;
+	}
+	while (fgets(line, sizeof(line), f)) {
+		if (!parse_line(line, ++n, &last_ms)) {
+			fclose(f);
+			return false;
+		}
+	}
+	fclose(f);
+
+	/* The release of a touch can come after lines below it */
+	qsort(cmds, n_cmds, sizeof(cmds[0]), by_time);
+	next = 0;
+	return true;
+}
+
+uint64_t sim_script_next(void)
+{
+	return next < n_cmds ? cmds[next].t : SIM_NEVER;
+}
+
+bool sim_script_done(void)
+{
+	return next == n_cmds;
+}
+
+void sim_script_fire(uint64_t t)
+{
+	char path[512];
+
+	while (next < n_cmds && cmds[next].t <= t) {
+		const command_t *c = &cmds[next++];
+
+		switch (c->kind) {
+		case CMD_TOUCH:
+			sim_log("touch %u,%u status %02x", c->x, c->y, c->status);
+			sim_mxt_touch(c->id, c->status, c->x, c->y);
+			break;
+
+		case CMD_T5:
+			sim_log("t5 report id %02x", c->msg[0]);
+			sim_mxt_message(c->msg);
+			break;
+
+		case CMD_DOOR:
+			sim_log("door");
+			sim_pio_edge(PIO_PA11_IDX, false);
+			sim_pio_edge(PIO_PA11_IDX, true);
+			break;
+
+		case CMD_DUMP:
+			snprintf(path, sizeof(path), "%s/%s", sim_opt.out_dir, c->path);
+			if (sim_lcd_dump(path)) {
+				sim_log("dump %s", path);
+			}
+			break;
+
+		case CMD_MARK:
+			sim_log("mark %s", c->path);
+			sim_bench_mark(c->path);
+			break;
+
+		case CMD_KEY:
+			sim_log("key %c", c->id);
+			sim_usart_rx(c->id);
+			break;
+
+		case CMD_END:
+			sim_finish();
+		}
+	}
+}
@@ -0,0 +1,28 @@
+/*
+ * sim_wrap.c
+ *
+ * Functions of the drivers that main.c calls, wrapped by the linker
+ * (FIRMWARE_WRAPS of the Makefile) so the models can stand between them.
+ * Only the programs linked with the wraps pull this in.
+ *
+ * The transfer callback of the LCD driver runs when its queue is empty,
+ * which in the model is before the bytes are out on the wire: sim_lcd.c
+ * holds the one of main.c until then, and the LCD is busy until it ran.
+ */
+
+#include <ili9488.h>
+#include "sim.h"
+
+void __real_ili9488_set_transfer_callback(ili9488_callback_t callback);
+bool __real_ili9488_is_busy(void);
+
+void __wrap_ili9488_set_transfer_callback(ili9488_callback_t callback)
+{
+	sim_lcd_hold_callback(callback);
+	__real_ili9488_set_transfer_callback(callback ? sim_lcd_driver_idle : NULL);
+}
+
+bool __wrap_ili9488_is_busy(void)
+{
+	return __real_ili9488_is_busy() || sim_lcd_draining();
+}
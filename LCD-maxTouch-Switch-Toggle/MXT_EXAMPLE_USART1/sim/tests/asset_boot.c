@@ -0,0 +1,83 @@
+/*
+ * asset_boot.c
+ *
+ * Boot of the whole firmware with an icon missing from the asset blob:
+ * asset_get() is wrapped by the linker to fail for ASSET_LOCKED. The
+ * firmware must stop before the first screen, with the panel red and the
+ * message of erro_fatal() on it, and sleep from then on.
+ */
+
+#include <unistd.h>
+#include "sim.h"
+#include "assets.h"
+#include "dirty_rect.h"
+#include "check.h"
+
+int firmware_main(void);
+bool __real_asset_get(uint32_t id, tImage *image);
+
+static uint32_t n_gets;
+static bool screen_built;
+
+bool __wrap_asset_get(uint32_t id, tImage *image)
+{
+	n_gets++;
+	if (id == ASSET_LOCKED) {
+		return false;
+	}
+	return __real_asset_get(id, image);
+}
+
+void __real_dirty_init(dirty_paint_t paint);
+
+/* The dirty rectangles come after the icons: never reached */
+void __wrap_dirty_init(dirty_paint_t paint)
+{
+	screen_built = true;
+	__real_dirty_init(paint);
+}
+
+static bool is_red(uint32_t x, uint32_t y)
+{
+	const uint8_t *p = sim_lcd_pixel(x, y);
+
+	return p[0] >= 0xF0 && p[1] == 0 && p[2] == 0;
+}
+
+static void report(void)
+{
+	uint32_t white = 0, red = 0;
+	int status;
+
+	for (uint32_t y = 0; y < SIM_LCD_H; y++) {
+		for (uint32_t x = 0; x < SIM_LCD_W; x++) {
+			const uint8_t *p = sim_lcd_pixel(x, y);
+
+			white += p[0] >= 0xF0 && p[1] >= 0xF0 && p[2] >= 0xF0;
+			red += is_red(x, y);
+		}
+	}
+	printf("asset_get() called %u times; %u red and %u white pixels\n", n_gets, red, white);
+
+	CHECK_EQ(n_gets, 9);
+	CHECK(!screen_built);
+	/* The message, 2 lines of the driver charset at 10, 10 */
+	CHECK(white > 0);
+	CHECK(white + red == SIM_LCD_W * SIM_LCD_H);
+	CHECK(is_red(0, 0) && is_red(SIM_LCD_W - 1, SIM_LCD_H - 1));
+	/* Where the lock icon would be */
+	CHECK(is_red(390, 60));
+
+	status = check_end("asset_boot");
+	fflush(stdout);
+	_exit(status);
+}
+
+int main(void)
+{
+	sim_opt.quiet = true;
+	sim_opt.console = "/dev/null";
+	atexit(report);
+	sim_power_on();
+	return firmware_main();
+}
@@ -0,0 +1,53 @@
+/*
+ * check.h
+ *
+ * Checks of the tests of sim/tests: a failed check prints its line and the
+ * values compared, and the test goes on so one run shows every failure.
+ * check_end() prints the count and gives the exit status of the test.
+ */
+
+
+#ifndef CHECK_H_
+#define CHECK_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+
+/* What a test prints goes to stdout, not to the console of the firmware */
+#undef printf
+
+static unsigned check_n;
+static unsigned check_failed;
+
+static inline bool check_true(bool ok, const char *expr, const char *file, int line)
+{
+	check_n++;
+	if (!ok) {
+		check_failed++;
+		printf("%s:%d: check failed: %s\n", file, line, expr);
+	}
+	return ok;
+}
+
+static inline bool check_eq(long long a, long long b, const char *ea, const char *eb,
+		const char *file, int line)
+{
+	check_n++;
+	if (a != b) {
+		check_failed++;
+		printf("%s:%d: check failed: %s == %s (%lld != %lld)\n", file, line, ea, eb, a, b);
+	}
+	return a == b;
+}
+
+#define CHECK(expr)     check_true((expr), #expr, __FILE__, __LINE__)
+#define CHECK_EQ(a, b)  check_eq((long long)(a), (long long)(b), #a, #b, __FILE__, __LINE__)
+
+static inline int check_end(const char *name)
+{
+	printf("%s: %u checks, %u failed\n", name, check_n, check_failed);
+	return check_failed ? 1 : 0;
+}
+
+
+#endif /* CHECK_H_ */
@@ -0,0 +1,187 @@
+/*
+ * chg_burst.c
+ *
+ * Touch messages in bursts through the whole firmware: the CHG edge
+ * interrupt, the batched T5 reads and the event ring, with the main loop
+ * sleeping in between. The scenario is made here, bursts of 1 to
+ * MXT_FIFO messages (the queue of the chip) at random gaps, some landing
+ * while the firmware still reads or draws the one before.
+ *
+ * sim_mxt_touch(), event_push() and event_pop() are wrapped by the
+ * linker: every message the chip queued must come out of the ring once,
+ * in order, as a touch event with its finger and status, and the ring must
+ * never be full. A burst landing on a queue not yet drained can overflow
+ * the chip; those messages never reach the firmware and are counted apart.
+ */
+
+#include <unistd.h>
+#include "sim.h"
+#include "event_ring.h"
+#include "check.h"
+
+#define SEED       0x5EED
+#define N_BURSTS   60
+#define MXT_FIFO   32
+#define N_FINGERS  4
+
+int firmware_main(void);
+bool __real_event_push(event_ring_t *ring, const event_t *ev);
+bool __real_event_pop(event_ring_t *ring, event_t *ev);
+void __real_sim_mxt_touch(uint8_t id, uint8_t status, uint16_t x, uint16_t y);
+
+typedef struct {
+	uint8_t id;
+	uint8_t status;
+} touch_t;
+
+static touch_t sent[N_BURSTS * MXT_FIFO];
+static uint32_t n_sent;
+static uint32_t n_messages;
+static uint32_t chip_lost;
+
+static struct {
+	uint32_t pushed;
+	uint32_t push_failed;
+	uint32_t popped;
+	uint32_t out_of_order;
+	uint32_t max_queued;
+} st;
+
+static uint32_t queued;
+static uint32_t rnd_state = SEED;
+
+static uint32_t rnd(uint32_t n)
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return (rnd_state >> 16) % n;
+}
+
+/* What the chip queued, in order */
+void __wrap_sim_mxt_touch(uint8_t id, uint8_t status, uint16_t x, uint16_t y)
+{
+	uint32_t lost = sim_mxt_lost();
+
+	__real_sim_mxt_touch(id, status, x, y);
+	if (sim_mxt_lost() != lost) {
+		chip_lost++;
+	} else {
+		sent[n_sent].id = id;
+		sent[n_sent].status = status;
+		n_sent++;
+	}
+}
+
+bool __wrap_event_push(event_ring_t *ring, const event_t *ev)
+{
+	bool ok = __real_event_push(ring, ev);
+
+	if (ev->type == EVENT_TOUCH) {
+		st.pushed++;
+		st.push_failed += !ok;
+	}
+	if (ok && ++queued > st.max_queued) {
+		st.max_queued = queued;
+	}
+	return ok;
+}
+
+bool __wrap_event_pop(event_ring_t *ring, event_t *ev)
+{
+	if (!__real_event_pop(ring, ev)) {
+		return false;
+	}
+	queued--;
+	if (ev->type == EVENT_TOUCH) {
+		if (st.popped >= n_sent || sent[st.popped].id != ev->source ||
+		    sent[st.popped].status != ev->data) {
+			st.out_of_order++;
+		}
+		st.popped++;
+	}
+	return true;
+}
+
+/* Press, moves and release of N_FINGERS fingers, away from the buttons */
+static bool write_script(const char *path)
+{
+	FILE *f = fopen(path, "w");
+	bool down[N_FINGERS] = {false};
+
+	if (!f) {
+		perror(path);
+		return false;
+	}
+	/* After the boot, and the calibration messages */
+	fprintf(f, "2000 mark start\n");
+	for (uint32_t b = 0; b < N_BURSTS; b++) {
+		uint32_t n = 1 + rnd(MXT_FIFO);
+		/* A few ms, less than the redraw of the burst before at times */
+		uint32_t gap = 1 + rnd(40);
+
+		for (uint32_t i = 0; i < n; i++) {
+			uint8_t id = rnd(N_FINGERS);
+			const char *what;
+
+			if (!down[id]) {
+				what = "press";
+			} else if (rnd(4) == 0) {
+				what = "release";
+			} else {
+				what = "move";
+			}
+			down[id] = what[0] != 'r';
+			n_messages++;
+			fprintf(f, "+%u %s %u %u %u\n", i ? 0 : gap, what, 100 + rnd(240), 80 + rnd(150), id);
+		}
+	}
+	fclose(f);
+	return true;
+}
+
+static void report(void)
+{
+	int status;
+
+	printf("%u bursts, %u messages, %u queued by the chip (%u over its queue)\n",
+	       N_BURSTS, n_messages, n_sent, chip_lost);
+	printf("touch events: %u pushed, %u popped\n", st.pushed, st.popped);
+	printf("ring: %u events at most of %u, %u pushes failed, %u out of order\n",
+	       st.max_queued, EVENT_RING_SIZE, st.push_failed, st.out_of_order);
+
+	CHECK_EQ(n_sent + chip_lost, n_messages);
+	CHECK_EQ(st.pushed, n_sent);
+	CHECK_EQ(st.popped, n_sent);
+	CHECK_EQ(st.push_failed, 0);
+	CHECK_EQ(st.out_of_order, 0);
+	CHECK(st.max_queued < EVENT_RING_SIZE);
+	/* Every message read: CHG back up */
+	CHECK(sim_mxt_chg());
+
+	status = check_end("chg_burst");
+	fflush(stdout);
+	_exit(status);
+}
+
+int main(void)
+{
+	char path[] = "/tmp/chg_burst_XXXXXX";
+	int fd = mkstemp(path);
+	bool ok;
+
+	if (fd < 0) {
+		perror("mkstemp");
+		return 1;
+	}
+	close(fd);
+	ok = write_script(path) && sim_script_load(path);
+	unlink(path);
+	if (!ok) {
+		return 1;
+	}
+
+	sim_opt.quiet = true;
+	sim_opt.console = "/dev/null";
+	atexit(report);
+	sim_power_on();
+	return firmware_main();
+}
@@ -0,0 +1,111 @@
+/*
+ * dirty_rect.c
+ *
+ * Merge policy of the dirty rectangles: what each flush paints for pairs
+ * of areas side by side, touching at a corner, crossing, one inside the
+ * other, and when the list is full.
+ */
+
+#include "sim.h"
+#include "dirty_rect.h"
+#include "check.h"
+
+static dirty_rect_t painted[DIRTY_MAX_RECTS];
+static uint32_t n_painted;
+
+static void paint(const dirty_rect_t *r)
+{
+	if (n_painted < DIRTY_MAX_RECTS) {
+		painted[n_painted] = *r;
+	}
+	n_painted++;
+}
+
+static uint32_t flush(void)
+{
+	n_painted = 0;
+	return dirty_flush();
+}
+
+static bool was_painted(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	for (uint32_t i = 0; i < n_painted && i < DIRTY_MAX_RECTS; i++) {
+		if (painted[i].x1 == x1 && painted[i].y1 == y1 &&
+		    painted[i].x2 == x2 && painted[i].y2 == y2) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int main(void)
+{
+	dirty_init(paint);
+
+	/* Side by side along a whole edge: the union is what they cover */
+	dirty_invalidate(10, 10, 49, 29);
+	dirty_invalidate(50, 10, 89, 29);
+	CHECK_EQ(flush(), 80 * 20);
+	CHECK_EQ(n_painted, 1);
+	CHECK(was_painted(10, 10, 89, 29));
+
+	/* Touching at a corner: the union would paint two empty squares */
+	dirty_invalidate(0, 0, 39, 39);
+	dirty_invalidate(40, 40, 79, 79);
+	CHECK_EQ(flush(), 2 * 40 * 40);
+	CHECK_EQ(n_painted, 2);
+
+	/* Next to each other along a quarter of an edge: apart */
+	dirty_invalidate(100, 100, 199, 199);
+	dirty_invalidate(200, 100, 219, 124);
+	CHECK_EQ(flush(), 100 * 100 + 20 * 25);
+	CHECK_EQ(n_painted, 2);
+
+	/* A cross: the middle is painted twice, the corners never */
+	dirty_invalidate(100, 140, 299, 159);
+	dirty_invalidate(190, 50, 209, 249);
+	CHECK_EQ(flush(), 2 * 200 * 20);
+	CHECK_EQ(n_painted, 2);
+
+	/* One inside the other, in both orders */
+	dirty_invalidate(0, 0, 99, 99);
+	dirty_invalidate(10, 10, 19, 19);
+	CHECK_EQ(flush(), 100 * 100);
+	CHECK(was_painted(0, 0, 99, 99));
+	dirty_invalidate(10, 10, 19, 19);
+	dirty_invalidate(0, 0, 99, 99);
+	CHECK_EQ(flush(), 100 * 100);
+	CHECK_EQ(n_painted, 1);
+
+	/* A small overlap of two wide areas: the union wastes little */
+	dirty_invalidate(0, 0, 199, 19);
+	dirty_invalidate(4, 10, 203, 29);
+	CHECK_EQ(flush(), 204 * 30);
+	CHECK_EQ(n_painted, 1);
+
+	/* Four quarters, two of them only touching at a corner: one area */
+	dirty_invalidate(0, 0, 49, 49);
+	dirty_invalidate(50, 50, 99, 99);
+	dirty_invalidate(50, 0, 99, 49);
+	dirty_invalidate(0, 50, 49, 99);
+	CHECK_EQ(flush(), 100 * 100);
+	CHECK_EQ(n_painted, 1);
+
+	/* The list full: the new area goes with the one that grows least */
+	for (uint32_t i = 0; i < DIRTY_MAX_RECTS; i++) {
+		dirty_invalidate(i * 50, 0, i * 50 + 9, 9);
+	}
+	dirty_invalidate(0, 20, 9, 29);
+	CHECK_EQ(flush(), (DIRTY_MAX_RECTS - 1) * 100 + 10 * 30);
+	CHECK_EQ(n_painted, DIRTY_MAX_RECTS);
+	CHECK(was_painted(0, 0, 9, 29));
+
+	/* Clipped to the panel, nothing for an empty or outside area */
+	dirty_invalidate(470, 310, 999, 999);
+	dirty_invalidate(500, 0, 510, 10);
+	dirty_invalidate(20, 20, 10, 10);
+	CHECK_EQ(flush(), 10 * 10);
+	CHECK(!dirty_pending());
+
+	return check_end("dirty_rect");
+}
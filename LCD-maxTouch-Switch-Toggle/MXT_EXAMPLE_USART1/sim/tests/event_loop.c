@@ -0,0 +1,142 @@
+/*
+ * event_loop.c
+ *
+ * Dispatch of the events of a ring to the handler of their type: every
+ * event goes to its own handler once, in the order pushed, across types;
+ * events without a handler or of an unknown type are taken and dropped;
+ * a handler can replace another, and the events a handler pushes are
+ * dispatched in the same call.
+ */
+
+#include "event_loop.h"
+#include "check.h"
+
+#define N_LOG 64
+
+static event_ring_t ring;
+
+static struct {
+	uint8_t type;
+	uint8_t seq;
+	char by;
+} log_[N_LOG];
+static uint32_t n_log;
+
+static void record(const event_t *ev, char by)
+{
+	if (n_log < N_LOG) {
+		log_[n_log].type = ev->type;
+		log_[n_log].seq = ev->data;
+		log_[n_log].by = by;
+	}
+	n_log++;
+}
+
+static void on_touch(const event_t *ev)  { record(ev, 't'); }
+static void on_button(const event_t *ev) { record(ev, 'b'); }
+static void on_door(const event_t *ev)   { record(ev, 'd'); }
+static void on_rtt(const event_t *ev)    { record(ev, 'r'); }
+static void on_touch2(const event_t *ev) { record(ev, 'T'); }
+
+static uint8_t next_seq;
+
+static void push(uint8_t type)
+{
+	event_t ev = {.type = type, .data = next_seq++};
+
+	CHECK(event_push(&ring, &ev));
+}
+
+/* A button that opens the door: pushes a door event while dispatched */
+static void on_button_door(const event_t *ev)
+{
+	record(ev, 'b');
+	push(EVENT_DOOR);
+}
+
+static bool logged(uint32_t i, uint8_t type, uint8_t seq, char by)
+{
+	return i < n_log && log_[i].type == type && log_[i].seq == seq && log_[i].by == by;
+}
+
+int main(void)
+{
+	event_ring_init(&ring);
+	event_loop_init(&ring);
+	CHECK_EQ(event_dispatch(), 0);
+
+	/* Each type to its own handler, in the order pushed */
+	event_register(EVENT_TOUCH, on_touch);
+	event_register(EVENT_BUTTON, on_button);
+	event_register(EVENT_DOOR, on_door);
+	event_register(EVENT_RTT, on_rtt);
+	push(EVENT_RTT);
+	push(EVENT_TOUCH);
+	push(EVENT_TOUCH);
+	push(EVENT_BUTTON);
+	push(EVENT_DOOR);
+	push(EVENT_TOUCH);
+	CHECK_EQ(event_dispatch(), 6);
+	CHECK_EQ(n_log, 6);
+	CHECK(logged(0, EVENT_RTT, 0, 'r'));
+	CHECK(logged(1, EVENT_TOUCH, 1, 't'));
+	CHECK(logged(2, EVENT_TOUCH, 2, 't'));
+	CHECK(logged(3, EVENT_BUTTON, 3, 'b'));
+	CHECK(logged(4, EVENT_DOOR, 4, 'd'));
+	CHECK(logged(5, EVENT_TOUCH, 5, 't'));
+	CHECK(event_ring_empty(&ring));
+	CHECK_EQ(event_dispatch(), 0);
+
+	/* No handler, or an unknown type: taken from the ring and dropped */
+	n_log = 0;
+	event_register(EVENT_DOOR, NULL);
+	push(EVENT_DOOR);
+	push(EVENT_N_TYPES);
+	push(0xFF);
+	push(EVENT_BUTTON);
+	CHECK_EQ(event_dispatch(), 4);
+	CHECK_EQ(n_log, 1);
+	CHECK(logged(0, EVENT_BUTTON, 9, 'b'));
+	CHECK(event_ring_empty(&ring));
+
+	/* Registering an unknown type changes nothing */
+	event_register(EVENT_N_TYPES, on_touch2);
+	event_register(0xFF, on_touch2);
+
+	/* A later handler replaces the one before */
+	n_log = 0;
+	event_register(EVENT_TOUCH, on_touch2);
+	push(EVENT_TOUCH);
+	CHECK_EQ(event_dispatch(), 1);
+	CHECK(logged(0, EVENT_TOUCH, 10, 'T'));
+
+	/* What a handler pushes comes after what was already queued */
+	n_log = 0;
+	event_register(EVENT_DOOR, on_door);
+	event_register(EVENT_BUTTON, on_button_door);
+	push(EVENT_BUTTON);
+	push(EVENT_RTT);
+	CHECK_EQ(event_dispatch(), 3);
+	CHECK(logged(0, EVENT_BUTTON, 11, 'b'));
+	CHECK(logged(1, EVENT_RTT, 12, 'r'));
+	CHECK(logged(2, EVENT_DOOR, 13, 'd'));
+	CHECK(event_ring_empty(&ring));
+
+	/* A full ring: the push fails, the events queued all come out */
+	n_log = 0;
+	event_register(EVENT_BUTTON, on_button);
+	for (uint32_t i = 0; i < EVENT_RING_SIZE; i++) {
+		push(EVENT_BUTTON);
+	}
+	{
+		event_t ev = {.type = EVENT_TOUCH};
+
+		CHECK(!event_push(&ring, &ev));
+		CHECK_EQ(ring.dropped, 1);
+	}
+	CHECK_EQ(event_dispatch(), EVENT_RING_SIZE);
+	CHECK_EQ(n_log, EVENT_RING_SIZE);
+	CHECK(logged(EVENT_RING_SIZE - 1, EVENT_BUTTON, 14 + EVENT_RING_SIZE - 1, 'b'));
+
+	return check_end("event_loop");
+}
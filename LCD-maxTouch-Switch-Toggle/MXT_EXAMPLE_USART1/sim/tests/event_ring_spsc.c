@@ -0,0 +1,154 @@
+/*
+ * event_ring_spsc.c
+ *
+ * The event ring between two threads of the host, a producer and a
+ * consumer running at once on two cores, where a missing barrier or a
+ * torn index shows up as it would between an interrupt and the main loop.
+ *
+ * Every event carries its sequence number in time and fields made from it,
+ * so the consumer sees a slot read before it was written or a stale one:
+ *
+ * - lossless: the producer retries a full ring, every event must come out
+ *   once and in order, and the drops counted are the failed pushes;
+ * - lossy: the producer never retries, as the interrupts do, and what
+ *   comes out is in order with gaps, popped + dropped being all of it.
+ *
+ * On a single core the threads still cut into each other wherever the
+ * scheduler preempts them, and at every yield.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include "event_ring.h"
+#include "check.h"
+
+#define N_EVENTS 2000000u
+
+static event_ring_t ring;
+
+static struct {
+	bool retry;
+	uint32_t failed;
+	uint32_t lost;
+} producer;
+
+static struct {
+	uint32_t popped;
+	uint32_t bad_fields;
+	uint32_t out_of_order;
+	uint32_t gaps;
+	uint32_t empty_polls;
+} consumer;
+
+static void make_event(uint32_t seq, event_t *ev)
+{
+	ev->time = seq;
+	ev->x = (uint16_t)seq;
+	ev->y = (uint16_t)(seq >> 16) ^ 0xA5A5;
+	ev->type = seq % EVENT_N_TYPES;
+	ev->source = (uint8_t)(seq * 7);
+	ev->data = (uint8_t)~seq;
+}
+
+static bool good_event(const event_t *ev)
+{
+	event_t ref;
+
+	make_event(ev->time, &ref);
+	return ev->x == ref.x && ev->y == ref.y && ev->type == ref.type &&
+	       ev->source == ref.source && ev->data == ref.data;
+}
+
+static void *produce(void *arg)
+{
+	event_t ev;
+
+	for (uint32_t seq = 0; seq < N_EVENTS; seq++) {
+		make_event(seq, &ev);
+		while (!event_push(&ring, &ev)) {
+			producer.failed++;
+			if (!producer.retry) {
+				producer.lost++;
+				break;
+			}
+			sched_yield();
+		}
+		/* Bursts a bit longer than the ring, so some of them fit */
+		if (!producer.retry && seq % (EVENT_RING_SIZE + 8) == 0) {
+			sched_yield();
+		}
+	}
+	/* The end: a sequence number out of the run */
+	make_event(N_EVENTS, &ev);
+	while (!event_push(&ring, &ev)) {
+		producer.failed++;
+		sched_yield();
+	}
+	return arg;
+}
+
+static void *consume(void *arg)
+{
+	uint32_t expected = 0;
+	event_t ev;
+
+	for (;;) {
+		if (!event_pop(&ring, &ev)) {
+			consumer.empty_polls++;
+			sched_yield();
+			continue;
+		}
+		if (!good_event(&ev)) {
+			consumer.bad_fields++;
+		}
+		if (ev.time == N_EVENTS) {
+			break;
+		}
+		if (ev.time < expected) {
+			consumer.out_of_order++;
+		} else if (ev.time > expected) {
+			consumer.gaps++;
+		}
+		expected = ev.time + 1;
+		consumer.popped++;
+	}
+	return arg;
+}
+
+static void run(bool retry)
+{
+	pthread_t p, c;
+
+	event_ring_init(&ring);
+	producer.retry = retry;
+	producer.failed = 0;
+	producer.lost = 0;
+	memset(&consumer, 0, sizeof(consumer));
+
+	pthread_create(&c, NULL, consume, NULL);
+	pthread_create(&p, NULL, produce, NULL);
+	pthread_join(p, NULL);
+	pthread_join(c, NULL);
+
+	printf("%-8s %u events: %u popped, %u lost, %u pushes on a full ring, %u gaps, "
+	       "%u polls of an empty one\n", retry ? "lossless" : "lossy", N_EVENTS,
+	       consumer.popped, producer.lost, ring.dropped, consumer.gaps, consumer.empty_polls);
+	CHECK_EQ(consumer.bad_fields, 0);
+	CHECK_EQ(consumer.out_of_order, 0);
+	CHECK_EQ(ring.dropped, producer.failed);
+	CHECK(event_ring_empty(&ring));
+}
+
+int main(void)
+{
+	run(true);
+	CHECK_EQ(consumer.popped, N_EVENTS);
+	CHECK_EQ(consumer.gaps, 0);
+
+	run(false);
+	CHECK_EQ(consumer.popped + producer.lost, N_EVENTS);
+	CHECK(consumer.gaps <= producer.lost);
+
+	return check_end("event_ring_spsc");
+}
@@ -0,0 +1,214 @@
+/*
+ * event_sleep.c
+ *
+ * The event loop over a host sleep primitive: sleepmgr_enter_sleep() is a
+ * wait on a condition variable, and PRIMASK the mutex that goes with it,
+ * in place of the virtual time of sim_core.c. The interrupts are a thread
+ * of their own that takes the mutex, pushes an event and signals the
+ * condition, so they can land at any point of the main loop.
+ *
+ * The main loop is the one of main.c: dispatch, then espera_evento(),
+ * which checks the ring with interrupts masked and sleeps only if it is
+ * empty, WFI waking on an interrupt pending even with PRIMASK set. Every
+ * event pushed must be dispatched, in order, without the loop ever
+ * sleeping on a queued event: a wait that times out with the ring not
+ * empty is a lost wake-up. A burst that finds the ring full loses the
+ * rest, as the interrupts do; those are only counted. The time asleep and awake is counted as sono_stats does.
+ */
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "event_loop.h"
+#include "check.h"
+
+#define N_BURSTS    400
+#define MAX_BURST   (EVENT_RING_SIZE / 2)
+#define WAKE_LIMIT  2   /* s without a wake-up with events queued: lost */
+
+void cpu_irq_enable(void);
+void cpu_irq_disable(void);
+void sleepmgr_enter_sleep(void);
+
+static pthread_mutex_t primask = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wfi = PTHREAD_COND_INITIALIZER;
+static bool masked;
+static bool irq_pending;
+static bool irq_done;
+
+static event_ring_t ring;
+
+static struct {
+	uint32_t pushed;
+	uint32_t dropped;
+	uint32_t dispatched;
+	uint32_t out_of_order;
+	uint32_t sleeps;
+	uint32_t slept_queued;
+	uint32_t lost_wakeups;
+	double asleep_ns;
+	double awake_ns;
+} st;
+
+static double now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/* -------- the host primitives -------- */
+
+void cpu_irq_disable(void)
+{
+	if (!masked) {
+		pthread_mutex_lock(&primask);
+		masked = true;
+	}
+}
+
+void cpu_irq_enable(void)
+{
+	if (masked) {
+		masked = false;
+		pthread_mutex_unlock(&primask);
+	}
+}
+
+/* WFI with PRIMASK set: back on an interrupt pending, then unmasked */
+void sleepmgr_enter_sleep(void)
+{
+	struct timespec limit;
+
+	/* With PRIMASK held nothing can be pushed since the ring was checked */
+	st.slept_queued += !event_ring_empty(&ring);
+	clock_gettime(CLOCK_REALTIME, &limit);
+	limit.tv_sec += WAKE_LIMIT;
+	while (!irq_pending && !irq_done) {
+		if (pthread_cond_timedwait(&wfi, &primask, &limit) != 0) {
+			st.lost_wakeups += !event_ring_empty(&ring);
+			break;
+		}
+	}
+	irq_pending = false;
+	cpu_irq_enable();
+}
+
+/*
+ * An interrupt: runs when the main loop is unmasked or in WFI, the lock
+ * being free only then. With the loop unmasked it is taken at once; in
+ * WFI, PRIMASK set, it stays pending and ends the sleep.
+ */
+static void irq(uint8_t type)
+{
+	event_t ev = {.type = type};
+
+	pthread_mutex_lock(&primask);
+	ev.data = (uint8_t)st.pushed;
+	if (event_push(&ring, &ev)) {
+		st.pushed++;
+	} else {
+		st.dropped++;
+	}
+	irq_pending = masked;
+	pthread_cond_signal(&wfi);
+	pthread_mutex_unlock(&primask);
+}
+
+static void *interrupts(void *arg)
+{
+	uint32_t seed = 0x51EE9;
+
+	for (uint32_t b = 0; b < N_BURSTS; b++) {
+		uint32_t n;
+
+		seed = seed * 1103515245u + 12345u;
+		n = 1 + (seed >> 16) % MAX_BURST;
+		/* Sometimes right away, mostly after the loop went to sleep */
+		if ((seed >> 8) & 3) {
+			usleep((seed >> 20) % 500);
+		}
+		for (uint32_t i = 0; i < n; i++) {
+			irq(i % 2 ? EVENT_TOUCH : EVENT_RTT);
+		}
+	}
+
+	pthread_mutex_lock(&primask);
+	irq_done = true;
+	pthread_cond_signal(&wfi);
+	pthread_mutex_unlock(&primask);
+	return arg;
+}
+
+/* -------- the loop of main.c -------- */
+
+static uint8_t expected;
+
+static void handler(const event_t *ev)
+{
+	double t = now_ns();
+
+	st.out_of_order += ev->data != expected;
+	expected = ev->data + 1;
+	st.dispatched++;
+	/* Some work, for the interrupts to pile up at times */
+	while (now_ns() - t < 2000) {
+	}
+}
+
+/* espera_evento() of main.c */
+static bool espera_evento(void)
+{
+	double t;
+
+	cpu_irq_disable();
+	if (!event_ring_empty(&ring)) {
+		cpu_irq_enable();
+		return true;
+	}
+	if (irq_done) {
+		cpu_irq_enable();
+		return false;
+	}
+	t = now_ns();
+	st.sleeps++;
+	sleepmgr_enter_sleep();
+	st.asleep_ns += now_ns() - t;
+	return true;
+}
+
+int main(void)
+{
+	pthread_t isr;
+	double t0, t;
+
+	event_ring_init(&ring);
+	event_loop_init(&ring);
+	event_register(EVENT_TOUCH, handler);
+	event_register(EVENT_RTT, handler);
+
+	t0 = now_ns();
+	pthread_create(&isr, NULL, interrupts, NULL);
+	do {
+		t = now_ns();
+		event_dispatch();
+		st.awake_ns += now_ns() - t;
+	} while (espera_evento());
+	pthread_join(isr, NULL);
+	event_dispatch();
+
+	printf("%u events, %u dispatched, %u dropped on a full ring\n", st.pushed,
+	       st.dispatched, ring.dropped);
+	printf("%u sleeps, asleep %.1f ms, dispatching %.1f ms of %.1f ms\n", st.sleeps,
+	       st.asleep_ns / 1e6, st.awake_ns / 1e6, (now_ns() - t0) / 1e6);
+
+	CHECK_EQ(st.dispatched, st.pushed);
+	CHECK_EQ(st.out_of_order, 0);
+	CHECK_EQ(ring.dropped, st.dropped);
+	CHECK_EQ(st.slept_queued, 0);
+	CHECK_EQ(st.lost_wakeups, 0);
+	CHECK(st.sleeps > 0);
+
+	return check_end("event_sleep");
+}
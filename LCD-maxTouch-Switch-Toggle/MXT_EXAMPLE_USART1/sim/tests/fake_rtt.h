@@ -0,0 +1,80 @@
+/*
+ * fake_rtt.h
+ *
+ * An RTT for the tests of the timebase, in place of the one of
+ * sim_periph.c: the counter is a variable the test moves by hand and the
+ * alarm only the value last written, with no simulator behind them. A test
+ * includes it once, and the calls of timebase.c then never reach libsim.
+ */
+
+
+#ifndef FAKE_RTT_H_
+#define FAKE_RTT_H_
+
+#include "sim.h"
+#include "timebase.h"
+
+Rtt sim_rtt;
+
+static uint32_t rtt_counter;
+static uint32_t rtt_alarm;   /* the counter value of the alarm */
+static uint32_t rtt_alarms_written;
+
+uint32_t rtt_sel_source(Rtt *p_rtt, bool is_rtc_sel)
+{
+	UNUSED(p_rtt);
+	UNUSED(is_rtc_sel);
+	return 0;
+}
+
+uint32_t rtt_init(Rtt *p_rtt, uint16_t us_prescaler)
+{
+	UNUSED(p_rtt);
+	UNUSED(us_prescaler);
+	rtt_counter = 0;
+	rtt_alarm = 0;
+	return 0;
+}
+
+void rtt_enable_interrupt(Rtt *p_rtt, uint32_t ul_sources)
+{
+	UNUSED(p_rtt);
+	UNUSED(ul_sources);
+}
+
+uint32_t rtt_read_timer_value(Rtt *p_rtt)
+{
+	UNUSED(p_rtt);
+	return rtt_counter;
+}
+
+uint32_t rtt_write_alarm_time(Rtt *p_rtt, uint32_t ul_alarm_time)
+{
+	UNUSED(p_rtt);
+	rtt_alarm = ul_alarm_time;
+	rtt_alarms_written++;
+	return 0;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)                        { UNUSED(irq); }
+void NVIC_DisableIRQ(IRQn_Type irq)                       { UNUSED(irq); }
+void NVIC_ClearPendingIRQ(IRQn_Type irq)                  { UNUSED(irq); }
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)   { UNUSED(irq); UNUSED(priority); }
+
+/*
+ * Nothing in the wheel: the alarm is the farthest one, that only keeps the
+ * counter read. Right after timebase_run() or a start or stop of a timer.
+ */
+static inline bool rtt_idle(void)
+{
+	return rtt_alarm - rtt_counter == TIMEBASE_MAX_ALARM;
+}
+
+/* The counter at ms: the first tick at which timebase_now() reaches it */
+static inline uint32_t rtt_ticks_at(uint32_t ms)
+{
+	return (uint32_t)(((uint64_t)ms * TIMEBASE_HZ + 999) / 1000);
+}
+
+
+#endif /* FAKE_RTT_H_ */
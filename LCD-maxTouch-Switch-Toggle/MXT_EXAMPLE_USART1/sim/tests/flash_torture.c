@@ -0,0 +1,332 @@
+/*
+ * flash_torture.c
+ *
+ * Power cuts in every command of the settings log, on the flash mapped on
+ * a file by sim_flash_map().
+ *
+ * A writer process makes a fixed list of changes: fields of the cycles,
+ * the selected cycle, checkpoints of the wash, enough to go around the
+ * ring of blocks more than once. It is run once to the end to count its
+ * flash commands, then once for each of them with the power cut in that
+ * command (sim_flash_cut()), from a blank flash each time.
+ *
+ * After each cut a second process boots from what is left in the file and
+ * must find the settings of the last change the writer saw saved, or
+ * those of the change cut, if its record got through whole. It then saves
+ * one more change and boots again, to show the log still works after the
+ * cut.
+ */
+
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "sim.h"
+#include "flash_efc.h"
+#include "maquina1.h"
+#include "settings_log.h"
+#include "wash_program.h"
+#include "check.h"
+
+#define N_CHANGES   2400
+#define BOOT_CICLO  2
+
+/* The settings after some of the changes */
+typedef struct {
+	int16_t valor[N_CICLOS][CICLO_N_CAMPOS];
+	uint8_t ciclo;
+	wash_checkpoint_t lavagem;
+} settings_t;
+
+/* What the writer got through, seen by the test after its death */
+typedef struct {
+	uint32_t saved;     /* changes saved */
+	uint32_t started;   /* changes started, the one cut included */
+	uint32_t failed;
+	uint32_t steps;     /* flash commands of a run to the end */
+	uint32_t generation;
+} progress_t;
+
+static progress_t *progress;
+static char path[] = "/tmp/flash_torture_XXXXXX";
+
+/* -------- the changes -------- */
+
+static uint32_t seed;
+
+static uint32_t rnd(uint32_t n)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 8) % n;
+}
+
+typedef struct {
+	uint8_t type;       /* 0 field, 1 cycle, 2 wash */
+	uint8_t ciclo;
+	uint8_t campo;
+	int16_t valor;
+	wash_checkpoint_t lavagem;
+} change_t;
+
+static int16_t fabrica(uint8_t i, uint8_t campo)
+{
+	const t_ciclo *c = &ciclos[i];
+	const int v[CICLO_N_CAMPOS] = {
+		[CICLO_ENXAGUE_TEMPO] = c->enxagueTempo,
+		[CICLO_ENXAGUE_QNT] = c->enxagueQnt,
+		[CICLO_CENTRIFUGACAO_RPM] = c->centrifugacaoRPM,
+		[CICLO_CENTRIFUGACAO_TEMPO] = c->centrifugacaoTempo,
+		[CICLO_HEAVY] = c->heavy,
+		[CICLO_BUBBLES] = c->bubblesOn,
+	};
+
+	return v[campo];
+}
+
+static change_t change(uint32_t k)
+{
+	change_t c = {0};
+	uint32_t kind;
+
+	seed = 0x70A7 + k * 7919;
+	kind = rnd(20);
+	c.ciclo = rnd(N_CICLOS);
+	if (kind < 12) {
+		c.type = 0;
+		c.campo = rnd(CICLO_N_CAMPOS);
+		/* Now and then back to the factory value */
+		c.valor = rnd(4) ? (int16_t)rnd(1500) : fabrica(c.ciclo, c.campo);
+	} else if (kind < 17) {
+		c.type = 1;
+	} else {
+		c.type = 2;
+		c.lavagem.ciclo = c.ciclo;
+		c.lavagem.phase = rnd(WASH_MAX_PHASES);
+		c.lavagem.state = rnd(4) ? (rnd(2) ? WASH_RUNNING : WASH_PAUSED) : WASH_IDLE;
+		c.lavagem.elapsed = rnd(3600);
+		c.lavagem.program = rnd(0x10000);
+	}
+	return c;
+}
+
+/* The change through the firmware: true when it was saved */
+static bool save(const change_t *c)
+{
+	switch (c->type) {
+	case 0:
+		ciclo_altera(c->ciclo, c->campo, c->valor);
+		return settings_log_field(c->ciclo, c->campo);
+	case 1:
+		return settings_log_cycle(c->ciclo);
+	default:
+		return settings_log_wash(&c->lavagem);
+	}
+}
+
+/* The change on the model */
+static void apply(settings_t *s, const change_t *c)
+{
+	switch (c->type) {
+	case 0:
+		s->valor[c->ciclo][c->campo] = c->valor;
+		break;
+	case 1:
+		s->ciclo = c->ciclo;
+		break;
+	default:
+		s->lavagem = c->lavagem;
+		break;
+	}
+}
+
+static settings_t model(uint32_t n)
+{
+	settings_t s;
+	change_t c;
+
+	for (uint8_t i = 0; i < N_CICLOS; i++) {
+		for (uint8_t f = 0; f < CICLO_N_CAMPOS; f++) {
+			s.valor[i][f] = fabrica(i, f);
+		}
+	}
+	s.ciclo = BOOT_CICLO;
+	s.lavagem = (wash_checkpoint_t){.state = WASH_IDLE};
+	for (uint32_t k = 0; k < n; k++) {
+		c = change(k);
+		apply(&s, &c);
+	}
+	return s;
+}
+
+/* The settings the firmware has after settings_log_init() */
+static settings_t booted(void)
+{
+	settings_t s;
+
+	s.ciclo = BOOT_CICLO;
+	settings_log_init(&s.ciclo);
+	for (uint8_t i = 0; i < N_CICLOS; i++) {
+		for (uint8_t f = 0; f < CICLO_N_CAMPOS; f++) {
+			s.valor[i][f] = ciclo_valor(i, f);
+		}
+	}
+	if (!settings_log_wash_last(&s.lavagem)) {
+		s.lavagem = (wash_checkpoint_t){.state = WASH_IDLE};
+	}
+	return s;
+}
+
+static bool same(const settings_t *a, const settings_t *b)
+{
+	bool wash = a->lavagem.state == b->lavagem.state;
+
+	/* A finished wash is not kept, whatever its other fields */
+	if (wash && (a->lavagem.state == WASH_RUNNING || a->lavagem.state == WASH_PAUSED)) {
+		wash = a->lavagem.ciclo == b->lavagem.ciclo && a->lavagem.phase == b->lavagem.phase &&
+		       a->lavagem.elapsed == b->lavagem.elapsed &&
+		       a->lavagem.program == b->lavagem.program;
+	}
+	return wash && a->ciclo == b->ciclo && !memcmp(a->valor, b->valor, sizeof(a->valor));
+}
+
+/* -------- the processes -------- */
+
+static int run(void (*child)(uint32_t), uint32_t arg)
+{
+	int status;
+	pid_t pid = fork();
+
+	if (pid == 0) {
+		child(arg);
+		_exit(0);
+	}
+	waitpid(pid, &status, 0);
+	return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+/* All the changes on a blank flash, the power cut in command 'cut' */
+static void writer(uint32_t cut)
+{
+	uint8_t ciclo = BOOT_CICLO;
+	change_t c;
+
+	if (!sim_flash_map(path)) {
+		_exit(2);
+	}
+	sim_flash_cut(cut);
+	settings_log_init(&ciclo);
+	for (uint32_t k = 0; k < N_CHANGES; k++) {
+		c = change(k);
+		progress->started = k + 1;
+		if (save(&c)) {
+			progress->saved = k + 1;
+		} else {
+			progress->failed++;
+		}
+	}
+	progress->steps = sim_flash_steps();
+	progress->generation = settings_log_stats.generation;
+	_exit(0);
+}
+
+enum {
+	BOOT_SAVED,     /* the settings of the last change saved */
+	BOOT_CUT,       /* those of the change cut */
+	BOOT_WRONG,
+	BOOT_STUCK,     /* right, but a change saved after it was lost */
+};
+
+static void checker(uint32_t unused)
+{
+	settings_t saved = model(progress->saved);
+	settings_t cut = model(progress->started);
+	settings_t s;
+	change_t c = {.type = 0, .ciclo = 4, .campo = CICLO_BUBBLES, .valor = 77};
+	int found;
+
+	UNUSED(unused);
+	if (!sim_flash_map(path)) {
+		_exit(2);
+	}
+	s = booted();
+	if (same(&s, &saved)) {
+		found = BOOT_SAVED;
+	} else if (same(&s, &cut)) {
+		found = BOOT_CUT;
+	} else {
+		_exit(BOOT_WRONG);
+	}
+
+	/* One more change, and a boot again, as after a reset */
+	if (!save(&c)) {
+		_exit(BOOT_STUCK);
+	}
+	apply(&s, &c);
+	for (uint8_t i = 0; i < N_CICLOS; i++) {
+		ciclo_restaura(i);
+	}
+	{
+		settings_t again = booted();
+
+		_exit(same(&again, &s) ? found : BOOT_STUCK);
+	}
+}
+
+static void blank(void)
+{
+	if (truncate(path, 0) != 0) {
+		perror(path);
+		exit(1);
+	}
+}
+
+int main(void)
+{
+	uint32_t total, cut, counts[4] = {0};
+	int fd = mkstemp(path);
+	int status;
+
+	if (fd < 0) {
+		perror("mkstemp");
+		return 1;
+	}
+	close(fd);
+	progress = mmap(NULL, sizeof(*progress), PROT_READ | PROT_WRITE,
+	                MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+	/* The run without cuts: every change saved, and the number of commands */
+	CHECK_EQ(run(writer, UINT32_MAX), 0);
+	CHECK_EQ(progress->saved, N_CHANGES);
+	CHECK_EQ(progress->failed, 0);
+	CHECK_EQ(run(checker, 0), BOOT_SAVED);
+	/* Around the ring of blocks more than once */
+	CHECK(progress->generation > FLASH_EFC_SIZE / FLASH_EFC_BLOCK_SIZE);
+	total = progress->steps;
+
+	for (cut = 0; cut < total; cut++) {
+		blank();
+		*progress = (progress_t){0};
+		if (!CHECK_EQ(run(writer, cut), SIM_FLASH_CUT_EXIT)) {
+			break;
+		}
+		status = run(checker, 0);
+		if (status > BOOT_STUCK) {
+			status = BOOT_WRONG;
+		}
+		counts[status]++;
+		if (status >= BOOT_WRONG) {
+			printf("cut in command %u, change %u: %s\n", cut, progress->started,
+			       status == BOOT_WRONG ? "wrong settings" : "log stuck");
+		}
+	}
+
+	printf("%u flash commands, each cut once: %u boots with the last change saved, "
+	       "%u with the change cut, %u wrong, %u stuck\n", total, counts[BOOT_SAVED],
+	       counts[BOOT_CUT], counts[BOOT_WRONG], counts[BOOT_STUCK]);
+	CHECK_EQ(cut, total);
+	CHECK_EQ(counts[BOOT_WRONG], 0);
+	CHECK_EQ(counts[BOOT_STUCK], 0);
+
+	unlink(path);
+	return check_end("flash_torture");
+}
@@ -0,0 +1,95 @@
+/*
+ * image_rle.c
+ *
+ * RLE icons of the asset blob against the R8G8B8 exports they were made
+ * from (src/icones/raw/): image_rle_read() of every row, whole, and of
+ * every span x, n of it, as the tile renderer reads them, must give the
+ * pixels of the export.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include "tipos.h"
+#include "assets.h"
+#include "image_rle.h"
+#include "check.h"
+
+/* The exports leave tImage to the includer */
+#include "icones/raw/centri.h"
+#include "icones/raw/lock.h"
+#include "icones/raw/locked.h"
+#include "icones/raw/unlocked.h"
+#include "icones/raw/wash.h"
+#include "icones/raw/water.h"
+
+static const struct {
+	const char *name;
+	uint32_t id;
+	const tImage *raw;
+} icons[] = {
+	{"recyclewater", ASSET_RECYCLEWATER, &recyclewater},
+	{"lock", ASSET_LOCK, &lock},
+	{"locked", ASSET_LOCKED, &locked},
+	{"unlocked", ASSET_UNLOCKED, &unlocked},
+	{"wash", ASSET_WASH, &wash},
+	{"water", ASSET_WATER, &water},
+};
+
+#define N_ICONS (sizeof(icons) / sizeof(icons[0]))
+#define MAX_W   256
+
+/* Spans of a row that do not decode to the export */
+static uint32_t check_row(const tImage *rle, const tImage *raw, uint32_t y)
+{
+	const uint8_t *line = &raw->data[y * raw->width * 3];
+	uint8_t out[MAX_W * 3 + 3];
+	uint32_t bad = 0;
+
+	for (uint32_t x = 0; x < raw->width; x++) {
+		for (uint32_t n = 1; x + n <= raw->width; n++) {
+			/* A canary past the span: nothing written beyond n pixels */
+			memset(out, 0xA5, (n + 1) * 3);
+			image_rle_read(rle, x, y, n, out);
+			if (memcmp(out, &line[x * 3], n * 3) ||
+			    out[n * 3] != 0xA5 || out[n * 3 + 2] != 0xA5) {
+				bad++;
+			}
+		}
+	}
+	return bad;
+}
+
+int main(void)
+{
+	CHECK(asset_check());
+
+	for (uint32_t i = 0; i < N_ICONS; i++) {
+		const tImage *raw = icons[i].raw;
+		tImage rle;
+		uint32_t bad_rows = 0, bad_spans = 0;
+		uint8_t out[MAX_W * 3];
+
+		if (!CHECK(asset_get(icons[i].id, &rle))) {
+			continue;
+		}
+		CHECK(image_is_rle(&rle));
+		CHECK_EQ(rle.width, raw->width);
+		CHECK_EQ(rle.height, raw->height);
+		if (!CHECK(raw->width <= MAX_W) || rle.width != raw->width ||
+		    rle.height != raw->height) {
+			continue;
+		}
+
+		for (uint32_t y = 0; y < raw->height; y++) {
+			image_rle_read(&rle, 0, y, raw->width, out);
+			bad_rows += memcmp(out, &raw->data[y * raw->width * 3], raw->width * 3) != 0;
+			bad_spans += check_row(&rle, raw, y);
+		}
+		printf("%-14s %3ux%-3u %u rows and %u spans off\n", icons[i].name,
+		       raw->width, raw->height, bad_rows, bad_spans);
+		CHECK_EQ(bad_rows, 0);
+		CHECK_EQ(bad_spans, 0);
+	}
+
+	return check_end("image_rle");
+}
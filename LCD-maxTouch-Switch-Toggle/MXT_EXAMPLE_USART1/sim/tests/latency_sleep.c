@@ -0,0 +1,257 @@
+/*
+ * latency_sleep.c
+ *
+ * The touch latency of latency.c through the whole firmware, against the
+ * virtual time of the simulator. Touches on the next and back buttons at
+ * random gaps; the main loop sleeps in WFI while the LCD bus drains the
+ * redraw, and between touches.
+ *
+ * The stamps of the firmware, latency_chg(), latency_dispatch(), the end
+ * of the redraw and sleepmgr_enter_sleep() are wrapped by the linker:
+ *
+ * - each touch traced spans, in virtual time, from the CHG edge of its
+ *   release to the last byte of its redraw out on the bus, the time the
+ *   core slept in between included: the percentiles of the firmware, in
+ *   ticks of its clock, are the ones of those spans;
+ * - the core sleeps inside each span, in WFI while the last bytes of the
+ *   redraw drain, so a clock stopped in WFI would miss part of it;
+ * - CYCCNT stops in WFI, as on the core.
+ */
+
+#include <unistd.h>
+#include "sim.h"
+#include "latency.h"
+#include "check.h"
+
+#define SEED        0x1A7E
+#define N_TOUCHES   40
+#define MAX_SLEEPS  (1 << 16)
+/* Ticks the clock and the end of the bus are cut to */
+#define TOLERANCE   2
+
+int firmware_main(void);
+void __real_latency_chg(void);
+void __real_latency_dispatch(void);
+void __real_latency_flushed(bool lcd_busy);
+void __real_latency_lcd_idle(void);
+void __real_sleepmgr_enter_sleep(void);
+
+/* Virtual time, ns */
+static struct {
+	uint64_t chg;
+	uint64_t dispatch;
+	uint64_t done;
+} touches[N_TOUCHES * 2];
+static uint32_t n_done;
+
+static struct {
+	uint64_t start;
+	uint64_t end;
+} sleeps[MAX_SLEEPS];
+static uint32_t n_sleeps;
+
+static uint64_t last_chg;
+static uint64_t first_dispatch;
+static uint32_t traced;
+static uint64_t sleep_cycles;
+static uint32_t rnd_state = SEED;
+
+static uint32_t rnd(uint32_t n)
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return (rnd_state >> 16) % n;
+}
+
+/* The release comes 100 ms after the press: the last edge is the traced one */
+void __wrap_latency_chg(void)
+{
+	last_chg = sim_now();
+	first_dispatch = 0;
+	__real_latency_chg();
+}
+
+void __wrap_latency_dispatch(void)
+{
+	if (!first_dispatch) {
+		first_dispatch = sim_now();
+	}
+	__real_latency_dispatch();
+}
+
+/* A touch done: its redraw ends when the bus is free, now or later */
+static void done(void)
+{
+	uint64_t end = sim_lcd_bus_free();
+
+	if (latency_count() == traced) {
+		return;
+	}
+	traced = latency_count();
+	if (n_done < N_TOUCHES * 2) {
+		touches[n_done].chg = last_chg;
+		touches[n_done].dispatch = first_dispatch;
+		touches[n_done].done = end > sim_now() ? end : sim_now();
+		n_done++;
+	}
+}
+
+void __wrap_latency_flushed(bool lcd_busy)
+{
+	__real_latency_flushed(lcd_busy);
+	done();
+}
+
+void __wrap_latency_lcd_idle(void)
+{
+	__real_latency_lcd_idle();
+	done();
+}
+
+void __wrap_sleepmgr_enter_sleep(void)
+{
+	uint64_t start = sim_now();
+	uint32_t cycles = DWT->CYCCNT;
+
+	__real_sleepmgr_enter_sleep();
+	sleep_cycles += DWT->CYCCNT - cycles;
+	if (n_sleeps < MAX_SLEEPS) {
+		sleeps[n_sleeps].start = start;
+		sleeps[n_sleeps].end = sim_now();
+		n_sleeps++;
+	}
+}
+
+/* ns slept from a to b */
+static uint64_t slept(uint64_t a, uint64_t b)
+{
+	uint64_t ns = 0;
+
+	for (uint32_t i = 0; i < n_sleeps; i++) {
+		uint64_t s = sleeps[i].start > a ? sleeps[i].start : a;
+		uint64_t e = sleeps[i].end < b ? sleeps[i].end : b;
+
+		ns += e > s ? e - s : 0;
+	}
+	return ns;
+}
+
+static uint32_t ticks(uint64_t ns)
+{
+	return (uint32_t)(ns * SIM_TICK_HZ / 1000000000u);
+}
+
+static uint32_t us(uint32_t ticks)
+{
+	return (uint32_t)(ticks * 1000000ull / SIM_TICK_HZ);
+}
+
+static uint32_t diff(uint32_t a, uint32_t b)
+{
+	return a > b ? a - b : b - a;
+}
+
+/* The percentiles of the firmware against the spans in virtual time */
+static bool same_percentiles(enum latency_span span, uint32_t *v, uint32_t n)
+{
+	latency_pct_t pct;
+	uint32_t x, j;
+
+	for (uint32_t i = 1; i < n; i++) {
+		x = v[i];
+		for (j = i; j > 0 && v[j - 1] > x; j--) {
+			v[j] = v[j - 1];
+		}
+		v[j] = x;
+	}
+	if (!CHECK(latency_percentiles(span, &pct)) || !CHECK_EQ(pct.count, n)) {
+		return false;
+	}
+	printf("%-8s p50 %6u us, max %6u us (%u and %u ticks of the firmware)\n",
+	       latency_span_name(span), us(v[(50 * n + 99) / 100 - 1]), us(v[n - 1]),
+	       pct.p50, pct.max);
+	return CHECK(diff(pct.p50, v[(50 * n + 99) / 100 - 1]) <= TOLERANCE) &&
+	       CHECK(diff(pct.p95, v[(95 * n + 99) / 100 - 1]) <= TOLERANCE) &&
+	       CHECK(diff(pct.p99, v[(99 * n + 99) / 100 - 1]) <= TOLERANCE) &&
+	       CHECK(diff(pct.max, v[n - 1]) <= TOLERANCE);
+}
+
+static bool write_script(const char *path)
+{
+	FILE *f = fopen(path, "w");
+
+	if (!f) {
+		perror(path);
+		return false;
+	}
+	/* After the boot; each touch done before the next */
+	fprintf(f, "2000 touch 420 270\n");
+	for (uint32_t i = 1; i < N_TOUCHES; i++) {
+		fprintf(f, "+%u touch %u 270\n", 150 + rnd(300), rnd(2) ? 420 : 180);
+	}
+	fprintf(f, "+500 end\n");
+	fclose(f);
+	return true;
+}
+
+static void report(void)
+{
+	uint32_t total[N_TOUCHES * 2], redraw[N_TOUCHES * 2];
+	uint64_t span_ns = 0, span_slept = 0, all_slept = 0, ns;
+	uint32_t asleep = 0;
+	int status;
+
+	for (uint32_t i = 0; i < n_done; i++) {
+		total[i] = ticks(touches[i].done - touches[i].chg);
+		redraw[i] = ticks(touches[i].done - touches[i].dispatch);
+		span_ns += touches[i].done - touches[i].chg;
+		ns = slept(touches[i].chg, touches[i].done);
+		span_slept += ns;
+		asleep += ticks(ns) > TOLERANCE;
+	}
+	for (uint32_t i = 0; i < n_sleeps; i++) {
+		all_slept += sleeps[i].end - sleeps[i].start;
+	}
+	printf("%u touches traced, %u asleep in their span, %.1f%% of it\n", n_done, asleep,
+	       n_done ? 100.0 * span_slept / span_ns : 0.0);
+	printf("%u sleeps, %.3f s: CYCCNT went %u cycles in them\n", n_sleeps,
+	       all_slept / 1e9, (uint32_t)sleep_cycles);
+
+	CHECK_EQ(n_done, N_TOUCHES);
+	CHECK(n_sleeps < MAX_SLEEPS);
+	if (n_done > 0) {
+		same_percentiles(LATENCY_TOTAL, total, n_done);
+		same_percentiles(LATENCY_REDRAW, redraw, n_done);
+	}
+	/* Each span asleep longer than the tolerance: a clock stopped in WFI is seen */
+	CHECK_EQ(asleep, n_done);
+	/* CYCCNT only for the handlers that woke the core */
+	CHECK(sleep_cycles * 100 < all_slept * SIM_CPU_HZ / 1000000000u);
+
+	status = check_end("latency_sleep");
+	fflush(stdout);
+	_exit(status);
+}
+
+int main(void)
+{
+	char path[] = "/tmp/latency_sleep_XXXXXX";
+	int fd = mkstemp(path);
+	bool ok;
+
+	if (fd < 0) {
+		perror("mkstemp");
+		return 1;
+	}
+	close(fd);
+	ok = write_script(path) && sim_script_load(path);
+	unlink(path);
+	if (!ok) {
+		return 1;
+	}
+
+	sim_opt.quiet = true;
+	sim_opt.console = "/dev/null";
+	atexit(report);
+	sim_power_on();
+	return firmware_main();
+}
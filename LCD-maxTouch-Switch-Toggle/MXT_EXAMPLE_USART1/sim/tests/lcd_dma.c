@@ -0,0 +1,192 @@
+/*
+ * lcd_dma.c
+ *
+ * Transfer queue of the ILI9488 driver over the XDMAC: the model of sim/
+ * ends a DMA block at once, so the end interrupt is held back by masking
+ * XDMAC_IRQn in the NVIC, which leaves the queue as the board sees it
+ * while the SPI is still shifting.
+ *
+ * - queueing: a pixmap is one DMA block in flight and the rest waiting,
+ *   nothing of it on the panel but the first window parameters;
+ * - chaining: once the interrupt is let through, its handler sends every
+ *   command-only entry inline and starts the next data phase, down to the
+ *   end of the queue, and the pixels land where the windows put them;
+ * - full queue: the caller spins until the interrupt frees an entry, here
+ *   a SIGALRM that unmasks it while the caller is in the spin;
+ * - completion callback: once per drain, from the interrupt, with the
+ *   driver already idle.
+ */
+
+#include <signal.h>
+#include <sys/time.h>
+#include <ili9488.h>
+#include "sim.h"
+#include "check.h"
+
+/* Entries of a pixmap: 2 windows of CASET, NOP, PASET, NOP, and RAMWR */
+#define PIXMAP_ENTRIES 9
+#define PIXMAP_BLOCKS  5
+
+#define W 20
+#define H 10
+
+static ili9488_color_t pix_a[W * H * 3];
+static ili9488_color_t pix_b[W * H * 3];
+
+static struct ili9488_opt_t opt = {
+	.ul_width = ILI9488_LCD_WIDTH,
+	.ul_height = ILI9488_LCD_HEIGHT,
+};
+
+static uint32_t n_callbacks;
+static bool callback_in_isr;
+static bool callback_busy;
+
+static volatile bool b_returned;
+static bool alarm_blocked;
+static uint64_t alarm_blocks;
+
+static void on_idle(void)
+{
+	n_callbacks++;
+	callback_in_isr = sim_in_isr();
+	callback_busy = ili9488_is_busy();
+}
+
+static void fill_pixmap(ili9488_color_t *p, uint8_t seed)
+{
+	for (uint32_t i = 0; i < W * H * 3; i++) {
+		p[i] = (uint8_t)(seed + i * 7) & 0xFC;
+	}
+}
+
+static bool on_panel(uint32_t x, uint32_t y, const ili9488_color_t *p)
+{
+	for (uint32_t j = 0; j < H; j++) {
+		for (uint32_t i = 0; i < W; i++) {
+			if (memcmp(sim_lcd_pixel(x + i, y + j), &p[(j * W + i) * 3], 3)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/* The interrupt comes while the caller spins on the full queue */
+static void on_alarm(int sig)
+{
+	UNUSED(sig);
+	alarm_blocked = !b_returned;
+	alarm_blocks = sim_lcd_stats.dma_blocks;
+	NVIC_EnableIRQ(XDMAC_IRQn);
+}
+
+static void test_queue_and_chain(void)
+{
+	sim_lcd_stats_t before = sim_lcd_stats;
+
+	NVIC_DisableIRQ(XDMAC_IRQn);
+	ili9488_draw_pixmap(10, 20, W, H, pix_a);
+
+	/* CASET in flight, the 8 other entries wait */
+	CHECK(ili9488_is_busy());
+	CHECK_EQ(sim_lcd_stats.dma_blocks - before.dma_blocks, 1);
+	CHECK_EQ(sim_lcd_stats.pixels - before.pixels, 0);
+	CHECK_EQ(n_callbacks, 0);
+
+	NVIC_EnableIRQ(XDMAC_IRQn);
+
+	CHECK(!ili9488_is_busy());
+	CHECK_EQ(sim_lcd_stats.dma_blocks - before.dma_blocks, PIXMAP_BLOCKS);
+	CHECK_EQ(sim_lcd_stats.commands - before.commands, PIXMAP_ENTRIES);
+	CHECK_EQ(sim_lcd_stats.bytes - before.bytes, PIXMAP_ENTRIES + 4 * 4 + W * H * 3);
+	CHECK_EQ(sim_lcd_stats.pixels - before.pixels, W * H);
+	CHECK(on_panel(10, 20, pix_a));
+	/* Nothing out of the window */
+	CHECK(sim_lcd_pixel(10 + W, 20)[0] == 0 && sim_lcd_pixel(9, 20)[0] == 0);
+
+	CHECK_EQ(n_callbacks, 1);
+	CHECK(callback_in_isr);
+	CHECK(!callback_busy);
+}
+
+static void test_full_queue(void)
+{
+	struct itimerval t = {.it_value = {.tv_usec = 50000}};
+	sim_lcd_stats_t before = sim_lcd_stats;
+
+	n_callbacks = 0;
+	NVIC_DisableIRQ(XDMAC_IRQn);
+	ili9488_draw_pixmap(100, 100, W, H, pix_a);
+	CHECK_EQ(n_callbacks, 0);
+
+	/* 9 entries in the queue: the 8th of the next pixmap finds it full */
+	signal(SIGALRM, on_alarm);
+	setitimer(ITIMER_REAL, &t, NULL);
+	b_returned = false;
+	ili9488_draw_pixmap(200, 100, W, H, pix_b);
+	b_returned = true;
+
+	CHECK(alarm_blocked);
+	CHECK_EQ(alarm_blocks - before.dma_blocks, 1);
+	CHECK(!ili9488_is_busy());
+	CHECK_EQ(sim_lcd_stats.dma_blocks - before.dma_blocks, 2 * PIXMAP_BLOCKS);
+	CHECK(on_panel(100, 100, pix_a));
+	CHECK(on_panel(200, 100, pix_b));
+	/*
+	 * The queue drained in the alarm; the 2 entries left are then sent
+	 * each on its own, the DMA of the model ending as it starts
+	 */
+	CHECK_EQ(n_callbacks, 1 + 2);
+	CHECK(!callback_busy);
+}
+
+/* Filled rectangle: the pixel cache sent again and again in one block */
+static void test_repeat(void)
+{
+	sim_lcd_stats_t before = sim_lcd_stats;
+	bool ok = true;
+
+	n_callbacks = 0;
+	NVIC_DisableIRQ(XDMAC_IRQn);
+	ili9488_set_foreground_color(COLOR_CONVERT(0x40C080));
+	ili9488_draw_filled_rectangle(300, 200, 399, 299);
+	CHECK_EQ(sim_lcd_stats.pixels - before.pixels, 0);
+	NVIC_EnableIRQ(XDMAC_IRQn);
+	ili9488_wait_for_idle();
+
+	for (uint32_t y = 200; y < 300; y++) {
+		for (uint32_t x = 300; x < 400; x++) {
+			const uint8_t *p = sim_lcd_pixel(x, y);
+
+			ok &= p[0] == 0x40 && p[1] == 0xC0 && p[2] == 0x80;
+		}
+	}
+	CHECK(ok);
+	CHECK_EQ(sim_lcd_pixel(400, 200)[0], 0);
+	CHECK_EQ(sim_lcd_pixel(300, 300)[0], 0);
+	CHECK_EQ(sim_lcd_stats.pixels - before.pixels, 100 * 100);
+	CHECK_EQ(n_callbacks, 1);
+}
+
+int main(void)
+{
+	sim_opt.quiet = true;
+	sim_power_on();
+	fill_pixmap(pix_a, 0x11);
+	fill_pixmap(pix_b, 0x5D);
+
+	ili9488_init(&opt);
+	ili9488_wait_for_idle();
+	/* Panel black, as the tests compare with what they drew */
+	ili9488_set_foreground_color(0);
+	ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH - 1, ILI9488_LCD_HEIGHT - 1);
+	ili9488_wait_for_idle();
+	ili9488_set_transfer_callback(on_idle);
+
+	test_queue_and_chain();
+	test_full_queue();
+	test_repeat();
+
+	return check_end("lcd_dma");
+}
@@ -0,0 +1,165 @@
+/*
+ * lcd_text.c
+ *
+ * SPI cost of a text string, before and after ili9488_draw_string() wrote
+ * a window per line: the per pixel ili9488_draw_char() of the original
+ * driver is kept here as it was, and both draw the same strings on the
+ * panel model. For each string the bytes on the wire, the commands (one
+ * a transaction: cursor, memory write) and the time on the bus at the
+ * default SPI clock are printed; the lit pixels of both must be the same.
+ */
+
+#include <ili9488.h>
+#include "sim.h"
+#include "check.h"
+
+#define X0 4
+#define Y0 8
+
+static struct ili9488_opt_t opt = {
+	.ul_width = ILI9488_LCD_WIDTH,
+	.ul_height = ILI9488_LCD_HEIGHT,
+};
+
+static const char *const strings[] = {
+	"1",
+	"00:00",
+	"Rapido",
+	"Centrifuga",
+	"Enxague 3x 10 min",
+	"Pesado\n1200 rpm 10 min",
+	"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabc",
+};
+
+#define N_STRINGS (sizeof(strings) / sizeof(strings[0]))
+/* The last string is the longest line that fits after X0: 39 characters */
+#define AREA_W (ILI9488_LCD_WIDTH - X0)
+#define AREA_H (2 * 16)
+
+static uint8_t lit_before[AREA_H][AREA_W];
+
+/* ili9488_draw_char() of the original driver: a pixel write per set bit */
+static void draw_char_per_pixel(uint32_t ul_x, uint32_t ul_y, uint8_t uc_c)
+{
+	uint32_t row, col;
+	uint32_t offset, offset0, offset1;
+
+	offset = ((uint32_t)uc_c - 0x20) * 20;
+
+	for (col = 0; col < 10; col++) {
+		offset0 = offset + col * 2;
+		offset1 = offset0 + 1;
+
+		for (row = 0; row < 8; row++) {
+			if ((p_uc_charset10x14[offset0] >> (7 - row)) & 0x1) {
+				ili9488_draw_pixel(ul_x + col, ul_y + row);
+			}
+		}
+
+		for (row = 0; row < 6; row++) {
+			if ((p_uc_charset10x14[offset1] >> (7 - row)) & 0x1) {
+				ili9488_draw_pixel(ul_x + col, ul_y + row + 8);
+			}
+		}
+	}
+}
+
+static void draw_string_per_pixel(uint32_t ul_x, uint32_t ul_y, const uint8_t *p_str)
+{
+	uint32_t xorg = ul_x;
+
+	while (*p_str != 0) {
+		if (*p_str == '\n') {
+			ul_y += gfont.height + 2;
+			ul_x = xorg;
+		} else {
+			draw_char_per_pixel(ul_x, ul_y, *p_str);
+			ul_x += gfont.width + 2;
+		}
+		p_str++;
+	}
+}
+
+static void clear_area(void)
+{
+	ili9488_set_foreground_color(0);
+	ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH - 1, Y0 + AREA_H);
+	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
+	ili9488_wait_for_idle();
+}
+
+static void lit(uint8_t out[AREA_H][AREA_W])
+{
+	for (uint32_t y = 0; y < AREA_H; y++) {
+		for (uint32_t x = 0; x < AREA_W; x++) {
+			out[y][x] = sim_lcd_pixel(X0 + x, Y0 + y)[0] != 0;
+		}
+	}
+}
+
+/* Wire cost of one drawing, from the clear panel */
+static sim_lcd_stats_t measure(bool per_pixel, const char *s)
+{
+	sim_lcd_stats_t before, d;
+
+	clear_area();
+	before = sim_lcd_stats;
+	if (per_pixel) {
+		draw_string_per_pixel(X0, Y0, (const uint8_t *)s);
+	} else {
+		ili9488_draw_string(X0, Y0, (const uint8_t *)s);
+	}
+	ili9488_wait_for_idle();
+
+	d.bytes = sim_lcd_stats.bytes - before.bytes;
+	d.commands = sim_lcd_stats.commands - before.commands;
+	d.pixels = sim_lcd_stats.pixels - before.pixels;
+	d.dma_blocks = sim_lcd_stats.dma_blocks - before.dma_blocks;
+	d.busy_ns = sim_lcd_stats.busy_ns - before.busy_ns;
+	return d;
+}
+
+int main(void)
+{
+	static uint8_t lit_after[AREA_H][AREA_W];
+	char name[48];
+
+	sim_opt.quiet = true;
+	sim_power_on();
+	opt.foreground_color = COLOR_CONVERT(COLOR_WHITE);
+	opt.background_color = 0;
+	ili9488_init(&opt);
+
+	snprintf(name, sizeof(name), "SPI at %u Hz", (unsigned)sim_opt.spi_hz);
+	printf("%-42s %24s %24s\n", name, "per pixel (before)", "window a line (after)");
+	printf("%-42s %8s %6s %8s %8s %6s %8s %6s\n", "string", "bytes", "cmds", "us",
+	       "bytes", "cmds", "us", "ratio");
+
+	for (uint32_t i = 0; i < N_STRINGS; i++) {
+		sim_lcd_stats_t b, a;
+
+		b = measure(true, strings[i]);
+		lit(lit_before);
+		a = measure(false, strings[i]);
+		lit(lit_after);
+
+		snprintf(name, sizeof(name), "\"%s\"", strings[i]);
+		for (char *p = name; *p; p++) {
+			if (*p == '\n') {
+				*p = '|';
+			}
+		}
+		printf("%-42s %8llu %6llu %8.1f %8llu %6llu %8.1f %6.1f\n", name,
+		       (unsigned long long)b.bytes, (unsigned long long)b.commands, b.busy_ns / 1e3,
+		       (unsigned long long)a.bytes, (unsigned long long)a.commands, a.busy_ns / 1e3,
+		       (double)b.bytes / a.bytes);
+
+		CHECK(!memcmp(lit_before, lit_after, sizeof(lit_before)));
+		CHECK(a.bytes < b.bytes);
+		CHECK(a.commands < b.commands);
+		/* A window and a memory write a line, whatever its length */
+		CHECK(a.commands <= 2 * (4 + 1 + 4) + 1);
+	}
+
+	return check_end("lcd_text");
+}
@@ -0,0 +1,158 @@
+/*
+ * maquina1.c
+ *
+ * The cycles of maquina1.c: the factory table, the menu ring over it and
+ * the layer of user changes.
+ *
+ * - the table is const and holds the five factory cycles as the old
+ *   header had them, and nothing the user does writes to it;
+ * - next goes through every cycle once in the order of the old
+ *   initMenuOrder() and back to the first, previous undoes next (the old
+ *   ring went from Rapido back to Enxague, past Centrifuga);
+ * - a change shows in that cycle and field only, setting the factory
+ *   value again drops it, restoring drops them all, and changes out of
+ *   the table are ignored.
+ */
+
+#include <string.h>
+#include "maquina1.h"
+#include "check.h"
+
+_Static_assert(__builtin_types_compatible_p(__typeof__(ciclos), const t_ciclo[N_CICLOS]),
+               "the factory cycles must be a const table");
+
+/* The factory cycles of the old maquina1.h, in the order of its ring */
+static const struct {
+	const char *nome;
+	int enxagueTempo, enxagueQnt, centrifugacaoRPM, centrifugacaoTempo;
+	char heavy, bubblesOn;
+} fabrica[N_CICLOS] = {
+	{"Rapido",      5, 3,  900,  5, 0, 1},
+	{"Diario",     15, 2, 1200,  8, 0, 1},
+	{"Pesado",     10, 3, 1200, 10, 1, 1},
+	{"Enxague",    10, 1,    0,  0, 0, 0},
+	{"Centrifuga",  0, 0, 1200, 10, 0, 0},
+};
+
+static bool same_as_factory(const t_ciclo *c, uint8_t i)
+{
+	return strcmp(c->nome, fabrica[i].nome) == 0 &&
+	       c->enxagueTempo == fabrica[i].enxagueTempo &&
+	       c->enxagueQnt == fabrica[i].enxagueQnt &&
+	       c->centrifugacaoRPM == fabrica[i].centrifugacaoRPM &&
+	       c->centrifugacaoTempo == fabrica[i].centrifugacaoTempo &&
+	       c->heavy == fabrica[i].heavy && c->bubblesOn == fabrica[i].bubblesOn;
+}
+
+static void navigation(void)
+{
+	const uint8_t all = (1 << N_CICLOS) - 1;
+
+	for (uint8_t i = 0; i < N_CICLOS; i++) {
+		uint8_t k = i, fwd = 0, back = 0;
+
+		CHECK_EQ(ciclo_anterior(ciclo_proximo(i)), i);
+		CHECK_EQ(ciclo_proximo(ciclo_anterior(i)), i);
+
+		/* Every cycle once, back to i after N_CICLOS steps either way */
+		for (uint8_t j = 0; j < N_CICLOS; j++) {
+			fwd |= 1 << k;
+			k = ciclo_proximo(k);
+		}
+		CHECK_EQ(k, i);
+		for (uint8_t j = 0; j < N_CICLOS; j++) {
+			back |= 1 << k;
+			k = ciclo_anterior(k);
+		}
+		CHECK_EQ(k, i);
+		CHECK_EQ(fwd, all);
+		CHECK_EQ(back, all);
+	}
+	/* The order of the old ring */
+	for (uint8_t i = 0; i < N_CICLOS; i++) {
+		CHECK_EQ(ciclo_proximo(i), (i + 1) % N_CICLOS);
+	}
+}
+
+static void presets(void)
+{
+	static t_ciclo before[N_CICLOS];
+	t_ciclo c;
+	uint8_t i, f;
+
+	memcpy(before, ciclos, sizeof(before));
+	for (i = 0; i < N_CICLOS; i++) {
+		CHECK(same_as_factory(&ciclos[i], i));
+		ciclo_le(i, &c);
+		CHECK(same_as_factory(&c, i));
+		for (f = 0; f < CICLO_N_CAMPOS; f++) {
+			CHECK(!ciclo_alterado(i, f));
+		}
+	}
+
+	/* One field of one cycle */
+	ciclo_altera(1, CICLO_ENXAGUE_QNT, 7);
+	CHECK_EQ(ciclo_valor(1, CICLO_ENXAGUE_QNT), 7);
+	CHECK(ciclo_alterado(1, CICLO_ENXAGUE_QNT));
+	ciclo_le(1, &c);
+	CHECK_EQ(c.enxagueQnt, 7);
+	c.enxagueQnt = fabrica[1].enxagueQnt;
+	CHECK(same_as_factory(&c, 1));
+	for (i = 0; i < N_CICLOS; i++) {
+		for (f = 0; f < CICLO_N_CAMPOS; f++) {
+			CHECK_EQ(ciclo_alterado(i, f), i == 1 && f == CICLO_ENXAGUE_QNT);
+		}
+		if (i != 1) {
+			ciclo_le(i, &c);
+			CHECK(same_as_factory(&c, i));
+		}
+	}
+
+	/* The factory value again is no change */
+	ciclo_altera(1, CICLO_ENXAGUE_QNT, fabrica[1].enxagueQnt);
+	CHECK(!ciclo_alterado(1, CICLO_ENXAGUE_QNT));
+
+	/* Every field of every cycle, then restored */
+	for (i = 0; i < N_CICLOS; i++) {
+		for (f = 0; f < CICLO_N_CAMPOS; f++) {
+			ciclo_altera(i, f, 100 + i * 10 + f);
+		}
+	}
+	for (i = 0; i < N_CICLOS; i++) {
+		for (f = 0; f < CICLO_N_CAMPOS; f++) {
+			CHECK_EQ(ciclo_valor(i, f), 100 + i * 10 + f);
+		}
+	}
+	ciclo_restaura(2);
+	ciclo_le(2, &c);
+	CHECK(same_as_factory(&c, 2));
+	CHECK_EQ(ciclo_valor(3, CICLO_HEAVY), 134);
+
+	/* Out of the table */
+	ciclo_altera(N_CICLOS, CICLO_HEAVY, 1);
+	ciclo_altera(0, CICLO_N_CAMPOS, 1);
+	ciclo_restaura(N_CICLOS);
+	CHECK_EQ(ciclo_valor(N_CICLOS, CICLO_HEAVY), 0);
+	CHECK_EQ(ciclo_valor(255, 0), 0);
+	CHECK_EQ(ciclo_valor(0, CICLO_N_CAMPOS), 0);
+	CHECK_EQ(ciclo_valor(0, 255), 0);
+	CHECK(!ciclo_alterado(N_CICLOS, CICLO_HEAVY));
+	CHECK(!ciclo_alterado(255, 0));
+	CHECK(!ciclo_alterado(0, CICLO_N_CAMPOS));
+	CHECK(!ciclo_alterado(0, 255));
+	for (i = 0; i < N_CICLOS; i++) {
+		ciclo_restaura(i);
+		ciclo_le(i, &c);
+		CHECK(same_as_factory(&c, i));
+	}
+
+	CHECK(memcmp(before, ciclos, sizeof(before)) == 0);
+}
+
+int main(void)
+{
+	navigation();
+	presets();
+
+	return check_end("maquina1");
+}
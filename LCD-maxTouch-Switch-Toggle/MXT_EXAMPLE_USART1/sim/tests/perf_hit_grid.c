@@ -0,0 +1,146 @@
+/*
+ * perf_hit_grid.c
+ *
+ * Time of a hit test on the host: hit_grid_find() against the linear scan
+ * of processa_touch(), kept here as it was (a copy of the button found),
+ * over the 8 buttons of the screen and over menus of 16 to 64 buttons in
+ * rows of 8, as a service menu would have. The touches are spread over the
+ * whole panel, on buttons and between them; both must find the same
+ * button for every one of them.
+ */
+
+#include <time.h>
+#include "hit_grid.h"
+#include "check.h"
+
+#define N_TOUCHES 1000000
+#define N_ROUNDS  5
+
+static botao layout[HIT_MAX_BUTTONS];
+static botao *botoes[HIT_MAX_BUTTONS];
+
+static uint16_t touch_x[N_TOUCHES];
+static uint16_t touch_y[N_TOUCHES];
+
+static volatile uint32_t sink;
+
+/* processa_touch() of the original main.c */
+static int processa_touch(botao *b, botao *rtn, int N, uint32_t x, uint32_t y)
+{
+	for (int i = 0; i < N; i++) {
+		if (((x >= b->x) && (x <= b->x + b->size_x)) && ((y >= b->y) && (y <= b->y + b->size_y))) {
+			*rtn = *b;
+			return 1;
+		}
+		b++;
+	}
+	return 0;
+}
+
+static void handler(void)
+{
+}
+
+static void set(uint32_t i, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+	layout[i] = (botao){.x = x, .y = y, .size_x = w, .size_y = h, .p_handler = handler};
+	botoes[i] = &layout[i];
+}
+
+/* The screen of main.c: config_buttons() */
+static uint32_t screen(void)
+{
+	set(0, 10, 10, 60, 60);
+	set(1, 10, 90, 60, 60);
+	set(2, 10, 170, 60, 60);
+	set(3, 10, 250, 60, 60);
+	set(4, 130, 230, 100, 80);
+	set(5, 370, 230, 100, 80);
+	set(6, 250, 230, 100, 80);
+	set(7, 360, 10, 60, 60);
+	return 8;
+}
+
+/* n buttons in rows of 8 over the panel, 10 pixels apart */
+static uint32_t menu(uint32_t n)
+{
+	uint32_t pitch = (HIT_HEIGHT - 20) / ((n + 7) / 8);
+
+	for (uint32_t i = 0; i < n; i++) {
+		set(i, 10 + (i % 8) * 60, 10 + (i / 8) * pitch, 50, pitch - 10);
+	}
+	return n;
+}
+
+static double now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static void bench(const char *name, uint32_t n)
+{
+	botao rtn;
+	double t0, scan_ns = 1e30, grid_ns = 1e30;
+	uint32_t hits = 0, differ = 0;
+
+	CHECK(hit_grid_build(botoes, n));
+
+	for (uint32_t i = 0; i < N_TOUCHES; i++) {
+		botao *g = hit_grid_find(touch_x[i], touch_y[i]);
+		int found = processa_touch(layout, &rtn, n, touch_x[i], touch_y[i]);
+
+		hits += found;
+		differ += found ? (g == NULL || g->x != rtn.x || g->y != rtn.y) : g != NULL;
+	}
+	CHECK_EQ(differ, 0);
+
+	/* Best of N_ROUNDS, against the noise of the host */
+	for (uint32_t r = 0; r < N_ROUNDS; r++) {
+		uint32_t acc = 0;
+
+		t0 = now_ns();
+		for (uint32_t i = 0; i < N_TOUCHES; i++) {
+			acc += processa_touch(layout, &rtn, n, touch_x[i], touch_y[i]);
+		}
+		sink = acc + rtn.x;
+		if (now_ns() - t0 < scan_ns) {
+			scan_ns = now_ns() - t0;
+		}
+
+		acc = 0;
+		t0 = now_ns();
+		for (uint32_t i = 0; i < N_TOUCHES; i++) {
+			acc += hit_grid_find(touch_x[i], touch_y[i]) != NULL;
+		}
+		sink = acc;
+		if (now_ns() - t0 < grid_ns) {
+			grid_ns = now_ns() - t0;
+		}
+	}
+
+	printf("%-10s %3u %5.1f%% %10.2f %10.2f %7.1f\n", name, n, 100.0 * hits / N_TOUCHES,
+	       scan_ns / N_TOUCHES, grid_ns / N_TOUCHES, scan_ns / grid_ns);
+}
+
+int main(void)
+{
+	uint32_t seed = 0x48177;
+
+	for (uint32_t i = 0; i < N_TOUCHES; i++) {
+		seed = seed * 1103515245u + 12345u;
+		touch_x[i] = (seed >> 8) % (HIT_WIDTH + 1);
+		seed = seed * 1103515245u + 12345u;
+		touch_y[i] = (seed >> 8) % (HIT_HEIGHT + 1);
+	}
+
+	printf("%-10s %3s %6s %10s %10s %7s\n", "layout", "n", "hits", "scan ns", "grid ns", "ratio");
+	bench("screen", screen());
+	bench("menu", menu(16));
+	bench("menu", menu(40));
+	bench("menu", menu(HIT_MAX_BUTTONS));
+
+	return check_end("perf_hit_grid");
+}
@@ -0,0 +1,121 @@
+/*
+ * perf_mxt_read.c
+ *
+ * Bus cost of a touch event on the TWIHS model, for queues of 1 to 32 T9
+ * messages on the chip:
+ *
+ * - one by one: mxt_read_touch_event() until CHG goes up, a transfer of
+ *   address and 9 bytes a message, as the handler did before;
+ * - batched: mxt_read_touch_events(), the T44 count and the first message
+ *   in one transfer and the rest of the batch in a second, with the batch
+ *   of the firmware (MAX_ENTRIES of main.c, 3) and the largest one.
+ *
+ * A transfer costs a start, the chip address, the 2 bytes of the register,
+ * a repeated start and the chip address again before the data: the model
+ * counts 1 + 2 + 1 byte times on top of the data. Times are at 400 kHz.
+ *
+ * Only those 4 byte times of the 13 of a message are saved, so a batch
+ * cannot halve the bus time of an event: a batch of 8 saves 22 %, one of
+ * 3 about 7 %, and a single message costs the byte of T44 more.
+ */
+
+#include "sim.h"
+#include "check.h"
+
+#define FIRMWARE_BATCH 3
+
+static struct mxt_device device;
+
+static const uint32_t depths[] = {1, 2, 3, 4, 6, 8, 12, 16, 32};
+
+#define N_DEPTHS (sizeof(depths) / sizeof(depths[0]))
+
+typedef struct {
+	uint32_t events;
+	sim_twi_stats_t bus;
+} cost_t;
+
+static void queue_touches(uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		sim_mxt_touch(i % 4, MXT_DETECT_EVENT | MXT_MOVE_EVENT, 100 + i, 100 + 2 * i);
+	}
+}
+
+static cost_t measure(uint32_t depth, uint8_t batch)
+{
+	sim_twi_stats_t before = sim_twi_stats;
+	struct mxt_touch_event events[MXT_MAX_BURST_MSGS];
+	cost_t c = {0};
+
+	queue_touches(depth);
+	while (mxt_is_message_pending(&device)) {
+		if (batch == 0) {
+			if (mxt_read_touch_event(&device, &events[0]) == STATUS_OK) {
+				c.events++;
+			}
+		} else {
+			uint8_t n = 0;
+
+			if (mxt_read_touch_events(&device, events, batch, &n) != STATUS_OK) {
+				break;
+			}
+			c.events += n;
+		}
+	}
+	c.bus.bytes = sim_twi_stats.bytes - before.bytes;
+	c.bus.transfers = sim_twi_stats.transfers - before.transfers;
+	c.bus.busy_ns = sim_twi_stats.busy_ns - before.busy_ns;
+	return c;
+}
+
+static double per_event(uint64_t v, const cost_t *c)
+{
+	return c->events ? (double)v / c->events : 0;
+}
+
+int main(void)
+{
+	twihs_master_options_t opt = {.speed = 400000, .chip = 0x4A};
+
+	sim_opt.quiet = true;
+	sim_power_on();
+	twihs_master_setup(TWIHS0, &opt);
+	if (!CHECK_EQ(mxt_init_device(&device, TWIHS0, 0x4A, MAXTOUCH_XPRO_CHG_PIO), STATUS_OK)) {
+		return check_end("perf_mxt_read");
+	}
+
+	printf("bytes on the bus a touch event (transfers a event, us a event)\n");
+	printf("%6s %24s %18s%6u %18s%6u %7s\n", "queue", "one by one", "batch of",
+	       FIRMWARE_BATCH, "batch of", MXT_MAX_BURST_MSGS, "ratio");
+	for (uint32_t i = 0; i < N_DEPTHS; i++) {
+		cost_t one = measure(depths[i], 0);
+		cost_t fw = measure(depths[i], FIRMWARE_BATCH);
+		cost_t max = measure(depths[i], MXT_MAX_BURST_MSGS);
+
+		printf("%6u %6.1f (%4.2f, %6.1f) %6.1f (%4.2f, %6.1f) %6.1f (%4.2f, %6.1f) %7.2f\n",
+		       depths[i],
+		       per_event(one.bus.bytes, &one), per_event(one.bus.transfers, &one),
+		       per_event(one.bus.busy_ns, &one) / 1e3,
+		       per_event(fw.bus.bytes, &fw), per_event(fw.bus.transfers, &fw),
+		       per_event(fw.bus.busy_ns, &fw) / 1e3,
+		       per_event(max.bus.bytes, &max), per_event(max.bus.transfers, &max),
+		       per_event(max.bus.busy_ns, &max) / 1e3,
+		       per_event(max.bus.bytes, &max) / per_event(one.bus.bytes, &one));
+
+		CHECK_EQ(one.events, depths[i]);
+		CHECK_EQ(fw.events, depths[i]);
+		CHECK_EQ(max.events, depths[i]);
+		/*
+		 * The count of T44 is one byte more a batch: a batch of 1 or 2
+		 * costs that much more, from 3 messages on a batch costs less
+		 */
+		CHECK(fw.bus.bytes <= one.bus.bytes + (depths[i] + FIRMWARE_BATCH - 1) / FIRMWARE_BATCH);
+		CHECK(max.bus.bytes <= fw.bus.bytes);
+		if (depths[i] >= 3) {
+			CHECK(fw.bus.bytes < one.bus.bytes);
+		}
+	}
+
+	return check_end("perf_mxt_read");
+}
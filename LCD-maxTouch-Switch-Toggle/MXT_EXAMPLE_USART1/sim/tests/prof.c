@@ -0,0 +1,357 @@
+/*
+ * prof.c
+ *
+ * The bookkeeping of the zones of prof.c, built with PROF_HOST on a cycle
+ * counter of the test (prof_host_cycles()), and its report through a
+ * serial_tx of the test that takes lines while it has room.
+ *
+ * - count, min, max and total of a zone, and the avg of the report, are
+ *   those of the durations timed, PROF_SCOPE() included however its block
+ *   is left;
+ * - a zone across the wrap of the 32 bit counter counts its true length;
+ * - a duration goes to the bucket of its size, on both sides of each
+ *   edge, and prof_bucket_floor() is the first duration of each bucket;
+ * - the ring keeps the last PROF_RING_SIZE samples, oldest first;
+ * - the report comes in its order (header, a line and a histogram per
+ *   zone in the order of prof.def, samples oldest first), from the
+ *   snapshot taken at its start, and with the console almost full it
+ *   waits rather than cut or drop a line.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "prof.h"
+#include "serial_tx.h"
+#include "check.h"
+
+#define MAX_REPORT 16384
+
+/* -------- the cycle counter and the console -------- */
+
+static uint32_t cycles;
+
+uint32_t prof_host_cycles(void)
+{
+	return cycles;
+}
+
+static char console[MAX_REPORT];
+static uint32_t n_console;
+static uint32_t room;       /* bytes the console takes before it is full */
+
+uint32_t serial_tx_free(void)
+{
+	return room;
+}
+
+bool serial_tx_write(const void *data, uint32_t len)
+{
+	if (len > room || n_console + len > MAX_REPORT) {
+		return false;
+	}
+	memcpy(&console[n_console], data, len);
+	n_console += len;
+	room -= len;
+	return true;
+}
+
+/* -------- the zones -------- */
+
+static void timed(enum prof_zone zone, uint32_t length)
+{
+	uint32_t start = prof_begin();
+
+	cycles += length;
+	prof_end(zone, start);
+}
+
+/* A scope left by a return from its middle */
+static uint32_t scoped(uint32_t length, bool early)
+{
+	PROF_SCOPE(PROF_DRAW_INFO);
+
+	cycles += length;
+	if (early) {
+		return 1;
+	}
+	cycles += length;
+	return 2;
+}
+
+static void stats(void)
+{
+	static const uint32_t lengths[] = {500, 70, 12345, 1, 900000, 33};
+	prof_stats_t s;
+	uint64_t total = 0;
+
+	prof_clear();
+	prof_get(PROF_MXT_HANDLER, &s);
+	CHECK_EQ(s.count, 0);
+	CHECK_EQ(s.min, UINT32_MAX);
+	CHECK_EQ(s.max, 0);
+
+	for (uint32_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+		timed(PROF_MXT_HANDLER, lengths[i]);
+		total += lengths[i];
+		cycles += 1000;
+	}
+	prof_get(PROF_MXT_HANDLER, &s);
+	CHECK_EQ(s.count, 6);
+	CHECK_EQ(s.min, 1);
+	CHECK_EQ(s.max, 900000);
+	CHECK_EQ(s.total, total);
+
+	/* Other zones untouched */
+	prof_get(PROF_MAIN_LOOP, &s);
+	CHECK_EQ(s.count, 0);
+
+	{
+		PROF_BEGIN(PROF_MAIN_LOOP);
+		cycles += 4242;
+		PROF_END(PROF_MAIN_LOOP);
+	}
+	prof_get(PROF_MAIN_LOOP, &s);
+	CHECK_EQ(s.count, 1);
+	CHECK_EQ(s.total, 4242);
+
+	CHECK_EQ(scoped(100, true), 1);
+	CHECK_EQ(scoped(100, false), 2);
+	prof_get(PROF_DRAW_INFO, &s);
+	CHECK_EQ(s.count, 2);
+	CHECK_EQ(s.min, 100);
+	CHECK_EQ(s.max, 200);
+
+	/* Across the wrap of the counter */
+	prof_clear();
+	cycles = UINT32_MAX - 99;
+	timed(PROF_DRAW_PIXMAP, 300);
+	CHECK_EQ(cycles, 200);
+	cycles = UINT32_MAX;
+	timed(PROF_DRAW_PIXMAP, 1);
+	prof_get(PROF_DRAW_PIXMAP, &s);
+	CHECK_EQ(s.count, 2);
+	CHECK_EQ(s.min, 1);
+	CHECK_EQ(s.max, 300);
+	CHECK_EQ(s.total, 301);
+	/* The longest duration the counter can tell */
+	timed(PROF_DRAW_PIXMAP, UINT32_MAX);
+	prof_get(PROF_DRAW_PIXMAP, &s);
+	CHECK_EQ(s.max, UINT32_MAX);
+	CHECK_EQ(s.hist[PROF_HIST_BUCKETS - 1], 1);
+}
+
+static void histogram(void)
+{
+	prof_stats_t s;
+	uint32_t want[PROF_HIST_BUCKETS] = {0};
+
+	CHECK_EQ(prof_bucket(0), 0);
+	CHECK_EQ(prof_bucket(1023), 0);
+	CHECK_EQ(prof_bucket(1024), 1);
+	CHECK_EQ(prof_bucket(4095), 1);
+	CHECK_EQ(prof_bucket(4096), 2);
+	CHECK_EQ(prof_bucket((4u << 20) - 1), PROF_HIST_BUCKETS - 2);
+	CHECK_EQ(prof_bucket(4u << 20), PROF_HIST_BUCKETS - 1);
+	CHECK_EQ(prof_bucket(UINT32_MAX), PROF_HIST_BUCKETS - 1);
+	CHECK_EQ(prof_bucket_floor(0), 0);
+
+	/* Both sides of every edge, and each edge a factor 4 above the last */
+	prof_clear();
+	for (uint32_t b = 1; b < PROF_HIST_BUCKETS; b++) {
+		uint32_t edge = prof_bucket_floor(b);
+
+		CHECK_EQ(edge, b == 1 ? 1024 : 4 * prof_bucket_floor(b - 1));
+		CHECK_EQ(prof_bucket(edge - 1), b - 1);
+		CHECK_EQ(prof_bucket(edge), b);
+		timed(PROF_DIRTY_FLUSH, edge - 1);
+		timed(PROF_DIRTY_FLUSH, edge);
+		want[b - 1]++;
+		want[b]++;
+	}
+	prof_get(PROF_DIRTY_FLUSH, &s);
+	for (uint32_t b = 0; b < PROF_HIST_BUCKETS; b++) {
+		CHECK_EQ(s.hist[b], want[b]);
+	}
+}
+
+static void ring(void)
+{
+	prof_sample_t out[PROF_RING_SIZE + 1];
+	uint32_t n, bad = 0;
+
+	prof_clear();
+	CHECK_EQ(prof_samples(out, PROF_RING_SIZE), 0);
+	cycles = 5000;
+	for (uint32_t i = 0; i < 10; i++) {
+		timed(i % PROF_N_ZONES, i + 1);
+	}
+	n = prof_samples(out, PROF_RING_SIZE + 1);
+	CHECK_EQ(n, 10);
+	for (uint32_t i = 0; i < n; i++) {
+		bad += out[i].cycles != i + 1 || out[i].zone != i % PROF_N_ZONES;
+	}
+	CHECK_EQ(bad, 0);
+
+	/* Around the ring: the last ones, in order */
+	for (uint32_t i = 10; i < 3 * PROF_RING_SIZE + 5; i++) {
+		timed(i % PROF_N_ZONES, i + 1);
+	}
+	n = prof_samples(out, PROF_RING_SIZE + 1);
+	CHECK_EQ(n, PROF_RING_SIZE);
+	for (uint32_t i = 0; i < n; i++) {
+		uint32_t k = 3 * PROF_RING_SIZE + 5 - PROF_RING_SIZE + i;
+
+		bad += out[i].cycles != k + 1 || out[i].zone != k % PROF_N_ZONES;
+		bad += i > 0 && out[i].start != out[i - 1].start + out[i - 1].cycles;
+	}
+	CHECK_EQ(bad, 0);
+	n = prof_samples(out, 3);
+	CHECK_EQ(n, 3);
+	CHECK_EQ(out[2].cycles, 3 * PROF_RING_SIZE + 5);
+}
+
+/* -------- the report -------- */
+
+/* Sends the report with 'step' bytes of room more at each poll */
+static uint32_t send(bool samples, uint32_t step, uint32_t *polls)
+{
+	n_console = 0;
+	room = step;
+	*polls = 0;
+	prof_report_start(samples);
+	while (prof_report_poll()) {
+		room += step;
+		if (++*polls > MAX_REPORT) {
+			break;
+		}
+	}
+	return n_console;
+}
+
+/* The next line of the console, without its \n\r */
+static const char *next_line(const char **p)
+{
+	static char line[128];
+	const char *end = strstr(*p, "\n\r");
+	size_t n;
+
+	if (!end) {
+		return NULL;
+	}
+	n = end - *p < (long)sizeof(line) - 1 ? (size_t)(end - *p) : sizeof(line) - 1;
+	memcpy(line, *p, n);
+	line[n] = '\0';
+	*p = end + 2;
+	return line;
+}
+
+static void report(void)
+{
+	static char whole[MAX_REPORT];
+	char name[32];
+	unsigned long count, min, avg, max, start, len;
+	const char *p, *l;
+	uint32_t n_whole, polls, zone, i;
+
+	prof_clear();
+	cycles = 100;
+	timed(PROF_MXT_HANDLER, 300);
+	timed(PROF_MXT_HANDLER, 500);
+	timed(PROF_MXT_HANDLER, 2000);
+	timed(PROF_DRAW_PIXMAP, 5000000);
+
+	/* All at once */
+	n_whole = send(true, MAX_REPORT, &polls);
+	CHECK_EQ(polls, 0);
+	memcpy(whole, console, n_whole);
+	whole[n_whole] = '\0';
+
+	p = whole;
+	l = next_line(&p);
+	CHECK(l && strncmp(l, "prof:", 5) == 0);
+	for (zone = 0; zone < PROF_N_ZONES; zone++) {
+		prof_stats_t s;
+
+		prof_get(zone, &s);
+		l = next_line(&p);
+		if (!CHECK(l && sscanf(l, "%31s %lu %lu %lu %lu", name, &count, &min, &avg, &max) == 5)) {
+			return;
+		}
+		CHECK(strcmp(name, prof_zone_name(zone)) == 0);
+		CHECK_EQ(count, s.count);
+		CHECK_EQ(min, s.count ? s.min : 0);
+		CHECK_EQ(avg, s.count ? s.total / s.count : 0);
+		CHECK_EQ(max, s.max);
+		/* The histogram: count of each bucket, in order */
+		l = next_line(&p);
+		for (i = 0; l && i < PROF_HIST_BUCKETS; i++) {
+			char bucket[16];
+			unsigned long in;
+			int used;
+
+			if (sscanf(l, " %15s %lu%n", bucket, &in, &used) != 2) {
+				break;
+			}
+			CHECK_EQ(in, s.hist[i]);
+			l += used;
+		}
+		CHECK_EQ(i, PROF_HIST_BUCKETS);
+	}
+	l = next_line(&p);
+	CHECK(l && strncmp(l, "prof:", 5) == 0);
+	for (i = 0; (l = next_line(&p)) != NULL; i++) {
+		static const uint32_t want[] = {300, 500, 2000, 5000000};
+
+		if (CHECK(sscanf(l, "%31s %lu %lu", name, &start, &len) == 3) && i < 4) {
+			CHECK_EQ(len, want[i]);
+		}
+	}
+	CHECK_EQ(i, 4);
+	CHECK_EQ(*p, '\0');
+
+	/* mxt_handler: 3 samples, min 300, avg 933, max 2000 */
+	p = strstr(whole, "mxt_handler");
+	CHECK(p && sscanf(p, "%31s %lu %lu %lu %lu", name, &count, &min, &avg, &max) == 5 &&
+	      count == 3 && min == 300 && avg == 933 && max == 2000);
+
+	/* Records after the start are not in it */
+	n_console = 0;
+	room = 0;
+	prof_report_start(true);
+	timed(PROF_MXT_HANDLER, 7);
+	room = MAX_REPORT;
+	CHECK(!prof_report_poll());
+	CHECK_EQ(n_console, n_whole);
+	CHECK(memcmp(console, whole, n_whole) == 0);
+
+	/* A few bytes of room at a time: the same report, no line cut or lost */
+	prof_clear();
+	cycles = 100;
+	timed(PROF_MXT_HANDLER, 300);
+	timed(PROF_MXT_HANDLER, 500);
+	timed(PROF_MXT_HANDLER, 2000);
+	timed(PROF_DRAW_PIXMAP, 5000000);
+	for (uint32_t step = 1; step < 100; step += 7) {
+		CHECK_EQ(send(true, step, &polls), n_whole);
+		CHECK(memcmp(console, whole, n_whole) == 0);
+		CHECK(polls > 0);
+	}
+
+	/* Without the samples: the header and the zones only */
+	n_whole = send(false, MAX_REPORT, &polls);
+	console[n_whole] = '\0';
+	for (p = console, i = 0; next_line(&p); i++) {
+	}
+	CHECK_EQ(i, 1 + 2 * PROF_N_ZONES);
+	CHECK(memcmp(console, whole, n_whole) == 0);
+}
+
+int main(void)
+{
+	stats();
+	histogram();
+	ring();
+	report();
+
+	return check_end("prof");
+}
@@ -0,0 +1,99 @@
+/*
+ * rtt_lost.c
+ *
+ * The RTT alarm through the whole firmware with its event lost: a wash
+ * program started, and event_push() wrapped by the linker to drop every
+ * EVENT_RTT, as a ring full of touch or door events would. The flag the
+ * ISR leaves set must still get the alarm to timebase_run(), so the
+ * program keeps counting down, one call at least per second of the count
+ * on the screen.
+ */
+
+#include <unistd.h>
+#include "sim.h"
+#include "event_ring.h"
+#include "timebase.h"
+#include "wash_program.h"
+#include "check.h"
+
+#define RUN_MS  20000
+
+int firmware_main(void);
+bool __real_event_push(event_ring_t *ring, const event_t *ev);
+void __real_timebase_run(void);
+
+static uint32_t dropped;
+static uint32_t runs;
+
+bool __wrap_event_push(event_ring_t *ring, const event_t *ev)
+{
+	if (ev->type == EVENT_RTT) {
+		dropped++;
+		return false;
+	}
+	return __real_event_push(ring, ev);
+}
+
+void __wrap_timebase_run(void)
+{
+	runs++;
+	__real_timebase_run();
+}
+
+static bool write_script(const char *path)
+{
+	FILE *f = fopen(path, "w");
+
+	if (!f) {
+		perror(path);
+		return false;
+	}
+	/* Play after the boot */
+	fprintf(f, "2000 touch 300 270\n");
+	fprintf(f, "+%u end\n", RUN_MS);
+	fclose(f);
+	return true;
+}
+
+static void report(void)
+{
+	uint32_t ran = wash_total_ms() - wash_remaining();
+	int status;
+
+	printf("%u alarm events dropped, timebase_run() called %u times, "
+	       "program ran %u ms\n", dropped, runs, ran);
+
+	CHECK(dropped > 0);
+	CHECK_EQ(wash_state(), WASH_RUNNING);
+	CHECK(runs >= RUN_MS / 1000 - 1);
+	/* The touch and the redraw of play before the count starts */
+	CHECK(ran <= RUN_MS && ran + 500 >= RUN_MS);
+
+	status = check_end("rtt_lost");
+	fflush(stdout);
+	_exit(status);
+}
+
+int main(void)
+{
+	char path[] = "/tmp/rtt_lost_XXXXXX";
+	int fd = mkstemp(path);
+	bool ok;
+
+	if (fd < 0) {
+		perror("mkstemp");
+		return 1;
+	}
+	close(fd);
+	ok = write_script(path) && sim_script_load(path);
+	unlink(path);
+	if (!ok) {
+		return 1;
+	}
+
+	sim_opt.quiet = true;
+	sim_opt.console = "/dev/null";
+	atexit(report);
+	sim_power_on();
+	return firmware_main();
+}
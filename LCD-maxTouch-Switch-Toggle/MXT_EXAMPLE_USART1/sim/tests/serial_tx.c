@@ -0,0 +1,354 @@
+/*
+ * serial_tx.c
+ *
+ * The ring of serial_tx.c emptied by a USART of its own, in place of the
+ * one of sim_periph.c: a byte takes BYTE_NS on the wire, as at 115200
+ * baud, with one byte in the shift register and one in THR, and TXRDY is
+ * set when THR is free. The handler is called as the NVIC would, whenever
+ * the interrupt is enabled and TXRDY set, and the CPU takes POLL_NS for
+ * every read of the status of the USART.
+ *
+ * - touch records and text at the rate of a finger on the panel: nothing
+ *   dropped, and each line in the USART no later than the bytes queued
+ *   before it take on the wire;
+ * - records much faster than the line: the writes that do not fit are
+ *   dropped whole and counted, the ones that fit go out whole and in
+ *   order, and the USART never waits while there are bytes in the ring;
+ * - writes never touch the USART but to enable its interrupt, so they
+ *   cost no time on the wire;
+ * - a flush with the interrupts masked empties the ring by polling.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sim.h"
+#include "serial_tx.h"
+#include "tlog.h"
+#include "check.h"
+
+#define BAUD        115200
+#define BYTE_NS     (10 * 1000000000ull / BAUD)
+#define POLL_NS     20
+#define MS          1000000ull
+#define MAX_WIRE    (1 << 20)
+
+Usart sim_usart1;
+
+static struct {
+	uint64_t now;           /* ns */
+	uint64_t shift_end;     /* when the byte in the shift register is out */
+	bool shifting;
+	bool holding;           /* a byte in THR */
+	bool irq;               /* TXRDY interrupt enabled */
+	bool masked;            /* PRIMASK */
+	uint32_t calls;         /* calls to the USART but the interrupt enable */
+	uint64_t idle_ns;       /* USART idle with bytes in the ring */
+	uint8_t wire[MAX_WIRE];
+	uint32_t n_wire;
+} uart;
+
+/* What the writes that were taken put in the ring, in order */
+static uint8_t expected[MAX_WIRE];
+static uint32_t n_expected;
+
+/* When the last byte of each write taken must be in the USART at the latest */
+#define MAX_PENDING 4096
+
+static struct {
+	uint32_t end;
+	uint64_t deadline;
+} pending[MAX_PENDING];
+static uint32_t pending_in, pending_out;
+static uint32_t late;
+
+/* -------- the USART -------- */
+
+/* The line goes on to t; the CPU polling the USART is not it waiting */
+static void advance(uint64_t t, bool polling)
+{
+	while (uart.now < t) {
+		uint64_t next = uart.shifting && uart.shift_end < t ? uart.shift_end : t;
+
+		if (!polling && !uart.shifting && serial_tx_free() < SERIAL_TX_SIZE) {
+			uart.idle_ns += next - uart.now;
+		}
+		uart.now = next;
+		if (uart.shifting && uart.shift_end <= uart.now) {
+			/* THR to the shift register, on the end of the byte before */
+			uart.shifting = uart.holding;
+			uart.shift_end += BYTE_NS;
+			uart.holding = false;
+		}
+	}
+}
+
+static void poll(void)
+{
+	advance(uart.now + POLL_NS, true);
+	uart.calls++;
+}
+
+void usart_enable_interrupt(Usart *p_usart, uint32_t ul_sources)
+{
+	UNUSED(p_usart);
+	if (ul_sources & US_IER_TXRDY) {
+		uart.irq = true;
+	}
+}
+
+void usart_disable_interrupt(Usart *p_usart, uint32_t ul_sources)
+{
+	UNUSED(p_usart);
+	if (ul_sources & US_IDR_TXRDY) {
+		uart.irq = false;
+	}
+	uart.calls++;
+}
+
+uint32_t usart_is_tx_ready(Usart *p_usart)
+{
+	UNUSED(p_usart);
+	poll();
+	return !uart.holding;
+}
+
+uint32_t usart_is_tx_empty(Usart *p_usart)
+{
+	UNUSED(p_usart);
+	poll();
+	return !uart.holding && !uart.shifting;
+}
+
+uint32_t usart_write(Usart *p_usart, uint32_t c)
+{
+	UNUSED(p_usart);
+	uart.calls++;
+	if (uart.holding) {
+		return 1;
+	}
+	if (uart.n_wire < MAX_WIRE) {
+		uart.wire[uart.n_wire++] = c;
+	}
+	while (pending_out != pending_in && pending[pending_out % MAX_PENDING].end <= uart.n_wire) {
+		late += uart.now > pending[pending_out % MAX_PENDING].deadline;
+		pending_out++;
+	}
+	if (uart.shifting) {
+		uart.holding = true;
+	} else {
+		uart.shifting = true;
+		uart.shift_end = uart.now + BYTE_NS;
+	}
+	return 0;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)                        { UNUSED(irq); }
+void NVIC_DisableIRQ(IRQn_Type irq)                       { UNUSED(irq); }
+void NVIC_ClearPendingIRQ(IRQn_Type irq)                  { UNUSED(irq); }
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)   { UNUSED(irq); UNUSED(priority); }
+
+bool cpu_irq_is_enabled(void)
+{
+	return !uart.masked;
+}
+
+/* The handler, as often as the NVIC would call it */
+static void deliver(void)
+{
+	while (uart.irq && !uart.masked && !uart.holding) {
+		serial_tx_isr();
+	}
+}
+
+/* The line goes on to t, the handler called at each byte out */
+static void run_until(uint64_t t)
+{
+	deliver();
+	while (uart.now < t) {
+		advance(uart.shifting && uart.shift_end < t ? uart.shift_end : t, false);
+		deliver();
+	}
+}
+
+/* -------- the writes -------- */
+
+static uint32_t seed = 0x5E41;
+
+static uint32_t rnd(uint32_t n)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 8) % n;
+}
+
+static struct {
+	uint32_t writes;
+	uint32_t refused;
+	uint32_t refused_bytes;
+	uint32_t wrong;         /* taken when it did not fit, or the other way */
+	uint32_t touched;       /* writes that did more than enable the interrupt */
+} w;
+
+/* A touch record as mxt_handler() logs it, or a line of printf() */
+static uint32_t line(uint8_t *out)
+{
+	if (rnd(4)) {
+		const int32_t a[] = {rnd(10), rnd(4096), rnd(4096), rnd(256), rnd(320), rnd(480)};
+
+		return tlog_encode(out, TLOG_TOUCH, a, 6);
+	}
+	return sprintf((char *)out, "Tempo de lavagem: %u min\n\r", rnd(200));
+}
+
+static bool put(const uint8_t *data, uint32_t len)
+{
+	uint32_t fits = len <= SERIAL_TX_SIZE - (n_expected - uart.n_wire);
+	uint64_t now = uart.now;
+	uint32_t calls = uart.calls;
+	bool ok = serial_tx_write(data, len);
+
+	w.writes++;
+	w.wrong += ok != fits;
+	w.touched += uart.now != now || uart.calls != calls;
+	if (ok) {
+		/* After the bytes queued before it, and the two in the USART */
+		uint32_t queued = n_expected - uart.n_wire;
+
+		memcpy(&expected[n_expected], data, len);
+		n_expected += len;
+		if (pending_in - pending_out < MAX_PENDING) {
+			pending[pending_in % MAX_PENDING].end = n_expected;
+			pending[pending_in % MAX_PENDING].deadline = now + (queued + len + 1) * BYTE_NS;
+			pending_in++;
+		}
+	} else {
+		w.refused++;
+		w.refused_bytes += len;
+	}
+	return ok;
+}
+
+/* Lines every 'gap' ns or so, for 'time' ns */
+static void traffic(uint64_t gap, uint64_t time)
+{
+	uint64_t end = uart.now + time;
+	uint8_t buf[64];
+
+	while (uart.now < end) {
+		uint64_t t0 = uart.now;
+
+		put(buf, line(buf));
+		run_until(t0 + gap / 2 + rnd(gap + 1));
+	}
+}
+
+static void stats_check(void)
+{
+	CHECK_EQ(w.wrong, 0);
+	CHECK_EQ(w.touched, 0);
+	CHECK_EQ(serial_tx_stats.overflows, w.refused);
+	CHECK_EQ(serial_tx_stats.dropped, w.refused_bytes);
+	CHECK_EQ(serial_tx_stats.sent, uart.n_wire);
+	CHECK(serial_tx_stats.max_used <= SERIAL_TX_SIZE);
+	CHECK_EQ(uart.idle_ns, 0);
+	/* Every write taken on the wire, whole and in order, and nothing else */
+	CHECK_EQ(uart.n_wire, n_expected);
+	CHECK(memcmp(uart.wire, expected, n_expected) == 0);
+}
+
+static void reset(void)
+{
+	memset(&uart, 0, sizeof(uart));
+	memset(&w, 0, sizeof(w));
+	n_expected = 0;
+	pending_in = pending_out = 0;
+	late = 0;
+	serial_tx_init();
+}
+
+int main(void)
+{
+	uint8_t big[SERIAL_TX_SIZE + 1];
+	struct timespec h0, h1;
+	uint32_t n, bytes;
+	double ns;
+
+	/* A finger on the panel: a record every 10 ms, 10 s */
+	reset();
+	traffic(10 * MS, 10000 * MS);
+	run_until(uart.now + 100 * MS);
+	stats_check();
+	CHECK_EQ(w.refused, 0);
+	CHECK_EQ(late, 0);
+	CHECK(!uart.irq);
+	printf("%u writes, %u bytes, %u most in the ring\n", w.writes, uart.n_wire,
+	       serial_tx_stats.max_used);
+
+	/* Three times faster than the line: the ring full, writes dropped */
+	reset();
+	traffic(BYTE_NS * 8, 2000 * MS);
+	bytes = uart.n_wire;
+	run_until(uart.now + 200 * MS);
+	stats_check();
+	CHECK(w.refused > w.writes / 4);
+	CHECK(serial_tx_stats.max_used > SERIAL_TX_SIZE - sizeof(uint8_t[64]));
+	CHECK_EQ(late, 0);
+	/* The line kept busy: a byte every BYTE_NS from the first write */
+	CHECK(bytes + 2 >= 2000 * MS / BYTE_NS);
+	printf("%u writes, %u dropped (%u bytes), %u bytes out\n", w.writes, w.refused,
+	       w.refused_bytes, uart.n_wire);
+
+	/* A write the size of the ring fits in it empty, one byte more never */
+	reset();
+	memset(big, 'a', sizeof(big));
+	CHECK(put(big, SERIAL_TX_SIZE + 1) == false);
+	CHECK(put(big, SERIAL_TX_SIZE));
+	CHECK(put(big, 1) == false);
+	CHECK_EQ(serial_tx_free(), 0);
+	run_until(uart.now + BYTE_NS + 1);
+	CHECK(put(big, 1));
+	run_until(uart.now + (SERIAL_TX_SIZE + 2) * BYTE_NS);
+	stats_check();
+
+	/* The flush with the interrupts masked */
+	reset();
+	uart.masked = true;
+	for (n = 0; n < 20; n++) {
+		uint8_t buf[64];
+
+		put(buf, line(buf));
+	}
+	CHECK_EQ(uart.n_wire, 0);
+	serial_tx_flush();
+	CHECK_EQ(serial_tx_free(), SERIAL_TX_SIZE);
+	CHECK(!uart.holding && !uart.shifting);
+	CHECK(uart.now >= n_expected * BYTE_NS);
+	uart.masked = false;
+	stats_check();
+
+	/* What a record costs on the host: the ring filled, then emptied untimed */
+	reset();
+	ns = 0;
+	for (n = 0; n < 100000;) {
+		const int32_t a[] = {1, 2000, 3000, 0xC0, 100, 200};
+		uint32_t k;
+
+		clock_gettime(CLOCK_MONOTONIC, &h0);
+		for (k = 0; serial_tx_free() >= TLOG_MAX_ARGS * 5 + 6; k++) {
+			tlog_emit(TLOG_TOUCH, a, 6);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &h1);
+		ns += (h1.tv_sec - h0.tv_sec) * 1e9 + (h1.tv_nsec - h0.tv_nsec);
+		if (!CHECK(k > 0)) {
+			break;
+		}
+		n += k;
+		run_until(uart.now + SERIAL_TX_SIZE * BYTE_NS);
+	}
+	bytes = serial_tx_stats.sent;
+	CHECK_EQ(serial_tx_stats.overflows, 0);
+	printf("a touch record: %.0f ns of the host, %.0f us on the wire\n", ns / n,
+	       bytes / (double)n * BYTE_NS / 1000);
+
+	return check_end("serial_tx");
+}
@@ -0,0 +1,343 @@
+/*
+ * tile_render.c
+ *
+ * The tile renderer on the panel model, item by item:
+ *
+ * - clipping: an area not aligned on the tiles is painted whole and
+ *   nothing around it, one window a tile; items crossing the edges of the
+ *   tiles and of the area are cut at them;
+ * - order: items are painted in the order they were added, the hidden
+ *   ones not at all;
+ * - images: the indexes of a palette image across a corner of four tiles;
+ * - text: transparent over a fill, the pixels of ili9488_draw_string() at
+ *   the same place, cut at the edges of the area and at the width of the
+ *   item; characters outside the charset are blank cells;
+ * - stats: each pixel sent charged to the kind of item painted last on
+ *   it, the waits between the tiles to the "pixmap" of the driver and not
+ *   to "other", which counts its own calls;
+ * - the panel written to a PPM file, as the screens of the simulator are.
+ */
+
+#include <string.h>
+#include <unistd.h>
+#include <ili9488.h>
+#include "sim.h"
+#include "tile_render.h"
+#include "check.h"
+
+/* The reference text is drawn by the driver this far below */
+#define REF_DY 160
+
+static struct ili9488_opt_t opt = {
+	.ul_width = ILI9488_LCD_WIDTH,
+	.ul_height = ILI9488_LCD_HEIGHT,
+};
+
+static tile_item items[4];
+
+static bool is(uint32_t x, uint32_t y, uint32_t rgb)
+{
+	const uint8_t *p = sim_lcd_pixel(x, y);
+	uint32_t c = COLOR_CONVERT(rgb);
+
+	return p[0] == (uint8_t)(c >> 16) && p[1] == (uint8_t)(c >> 8) && p[2] == (uint8_t)c;
+}
+
+/* Pixels of the area of that color */
+static uint32_t count(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint32_t rgb)
+{
+	uint32_t n = 0;
+
+	for (uint32_t y = y1; y <= y2; y++) {
+		for (uint32_t x = x1; x <= x2; x++) {
+			n += is(x, y, rgb);
+		}
+	}
+	return n;
+}
+
+/* The whole panel in one color, by the driver */
+static void clear(uint32_t rgb)
+{
+	ili9488_set_foreground_color(COLOR_CONVERT(rgb));
+	ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH - 1, ILI9488_LCD_HEIGHT - 1);
+	ili9488_wait_for_idle();
+}
+
+static sim_lcd_stats_t render(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	dirty_rect_t r = {x1, y1, x2, y2};
+	sim_lcd_stats_t before = sim_lcd_stats, d;
+
+	tile_render(&r);
+	ili9488_wait_for_idle();
+	d.commands = sim_lcd_stats.commands - before.commands;
+	d.pixels = sim_lcd_stats.pixels - before.pixels;
+	return d;
+}
+
+static void clipping(void)
+{
+	sim_lcd_stats_t one, six;
+
+	clear(COLOR_BLUE);
+	tile_init(COLOR_WHITE);
+	tile_fill(&items[0], 0, 0, 100, 100, COLOR_GREEN);
+	tile_add(&items[0]);
+
+	/* A tile, then 3 by 2 tiles cut on every side */
+	one = render(0, 0, TILE_SIZE - 1, TILE_SIZE - 1);
+	CHECK_EQ(one.pixels, TILE_SIZE * TILE_SIZE);
+	clear(COLOR_BLUE);
+	six = render(5, 7, 77, 50);
+	CHECK_EQ(six.pixels, 73 * 44);
+	CHECK_EQ(six.commands, 6 * one.commands);
+	CHECK_EQ(count(5, 7, 77, 50, COLOR_GREEN), 73 * 44);
+	CHECK_EQ(count(0, 0, 99, 99, COLOR_GREEN), 73 * 44);
+
+	/* An item across tiles, and one past the edge of the area */
+	clear(COLOR_BLUE);
+	tile_init(COLOR_WHITE);
+	tile_fill(&items[0], 20, 20, 30, 30, COLOR_RED);
+	tile_fill(&items[1], 50, 50, 30, 30, COLOR_GREEN);
+	tile_add(&items[0]);
+	tile_add(&items[1]);
+	render(0, 0, 63, 63);
+	CHECK_EQ(count(20, 20, 49, 49, COLOR_RED), 30 * 30);
+	CHECK_EQ(count(0, 0, 63, 63, COLOR_RED), 30 * 30);
+	CHECK_EQ(count(50, 50, 63, 63, COLOR_GREEN), 14 * 14);
+	CHECK_EQ(count(0, 0, 99, 99, COLOR_GREEN), 14 * 14);
+	CHECK(is(19, 20, COLOR_WHITE) && is(50, 49, COLOR_WHITE) && is(64, 64, COLOR_BLUE));
+}
+
+static void order(void)
+{
+	tile_init(COLOR_WHITE);
+	tile_fill(&items[0], 10, 10, 40, 40, COLOR_RED);
+	tile_fill(&items[1], 30, 30, 40, 40, COLOR_BLUE);
+	tile_add(&items[0]);
+	tile_add(&items[1]);
+	render(0, 0, 95, 95);
+	CHECK(is(15, 15, COLOR_RED) && is(35, 35, COLOR_BLUE) && is(69, 69, COLOR_BLUE));
+	CHECK(is(70, 70, COLOR_WHITE) && is(5, 5, COLOR_WHITE));
+
+	/* Hidden: what is below shows */
+	items[1].visible = false;
+	render(0, 0, 95, 95);
+	CHECK(is(35, 35, COLOR_RED) && is(60, 60, COLOR_WHITE));
+
+	/* Added the other way round */
+	items[1].visible = true;
+	tile_init(COLOR_WHITE);
+	tile_add(&items[1]);
+	tile_add(&items[0]);
+	render(0, 0, 95, 95);
+	CHECK(is(35, 35, COLOR_RED) && is(60, 60, COLOR_BLUE));
+}
+
+static void image(void)
+{
+	static const uint32_t palette[4] = {0xFC0000, 0x00FC00, 0x0000FC, 0xFCFCFC};
+	/* 6 x 3 pixels of 2 bits, rows on a byte boundary */
+	static const uint8_t data[] = {
+		0x1B, 0xE0,   /* 0 1 2 3 | 2 0 */
+		0xE4, 0x50,   /* 3 2 1 0 | 1 1 */
+		0x00, 0xF0,   /* 0 0 0 0 | 3 3 */
+	};
+	static const tImage img = {data, 6, 3, 8, 0, 2, palette};
+	uint32_t bad = 0;
+
+	clear(COLOR_BLACK);
+	tile_init(COLOR_BLACK);
+	/* Across the corner of four tiles */
+	tile_image(&items[0], TILE_SIZE - 3, TILE_SIZE - 2, &img);
+	tile_add(&items[0]);
+	render(0, 0, 2 * TILE_SIZE - 1, 2 * TILE_SIZE - 1);
+
+	for (uint32_t y = 0; y < 3; y++) {
+		for (uint32_t x = 0; x < 6; x++) {
+			uint32_t bit = x * 2;
+			uint32_t i = (data[y * 2 + bit / 8] >> (6 - bit % 8)) & 3;
+
+			bad += !is(TILE_SIZE - 3 + x, TILE_SIZE - 2 + y, palette[i]);
+		}
+	}
+	CHECK_EQ(bad, 0);
+	CHECK_EQ(count(0, 0, 2 * TILE_SIZE - 1, 2 * TILE_SIZE - 1, COLOR_BLACK),
+	         4 * TILE_SIZE * TILE_SIZE - 18);
+}
+
+/* The reference: the driver draws s black on white, REF_DY below */
+static void reference(uint32_t x, uint32_t y, const char *s)
+{
+	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_BLACK));
+	ili9488_set_background_color(COLOR_CONVERT(COLOR_WHITE));
+	ili9488_draw_string(x, y + REF_DY, (const uint8_t *)s);
+	ili9488_wait_for_idle();
+}
+
+/* Pixels that differ from the reference, and the unlit ones not of color off */
+static uint32_t text_diff(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint32_t off)
+{
+	uint32_t n = 0;
+
+	for (uint32_t y = y1; y <= y2; y++) {
+		for (uint32_t x = x1; x <= x2; x++) {
+			n += is(x, y, COLOR_BLACK) != is(x, y + REF_DY, COLOR_BLACK);
+			n += !is(x, y, COLOR_BLACK) && !is(x, y, off);
+		}
+	}
+	return n;
+}
+
+static void text(void)
+{
+	static const char s[] = "Tile 42 min";
+	uint32_t cell = gfont.width + 2;
+	uint32_t w = (sizeof(s) - 1) * cell - 2;
+	uint32_t x0 = TILE_SIZE - 7, y0 = TILE_SIZE - 5;
+
+	clear(COLOR_WHITE);
+	reference(x0, y0, s);
+
+	/* Over a fill, across tiles */
+	tile_init(COLOR_WHITE);
+	tile_fill(&items[0], x0 - 4, y0 - 4, w + 8, gfont.height + 8, COLOR_GREEN);
+	tile_text(&items[1], x0, y0, w, s, COLOR_BLACK);
+	tile_add(&items[0]);
+	tile_add(&items[1]);
+	render(0, 0, 4 * TILE_SIZE + w, 2 * TILE_SIZE - 1);
+	CHECK_EQ(text_diff(x0, y0, x0 + w - 1, y0 + gfont.height - 1, COLOR_GREEN), 0);
+	CHECK(count(x0, y0, x0 + w - 1, y0 + gfont.height - 1, COLOR_BLACK) > 0);
+
+	/* Cut by the area, through the middle of a character and of its rows */
+	clear(COLOR_BLUE);
+	reference(x0, y0, s);
+	render(x0 + 15, y0 + 3, x0 + 3 * cell + 4, y0 + 9);
+	CHECK_EQ(text_diff(x0 + 15, y0 + 3, x0 + 3 * cell + 4, y0 + 9, COLOR_GREEN), 0);
+	CHECK_EQ(count(0, 0, ILI9488_LCD_WIDTH - 1, REF_DY - 1, COLOR_BLUE),
+	         ILI9488_LCD_WIDTH * REF_DY - (3 * cell - 10) * 7);
+
+	/* Cut by the width of the item: 4 characters and 2 columns of the 5th */
+	clear(COLOR_WHITE);
+	items[1].w = 4 * cell + 2;
+	render(0, 0, 4 * TILE_SIZE + w, 2 * TILE_SIZE - 1);
+	CHECK_EQ(count(x0 + 4 * cell + 2, y0, x0 + w - 1, y0 + gfont.height - 1, COLOR_BLACK), 0);
+	CHECK(count(x0, y0, x0 + 4 * cell - 1, y0 + gfont.height - 1, COLOR_BLACK) > 0);
+}
+
+/* Below 0x20 and past 0x7F: blank cells, the others drawn in their place */
+static void outside_charset(void)
+{
+	static const char s[] = "\x01" "A\x80\xFF" "B\x1F";
+	uint32_t cell = gfont.width + 2;
+	uint32_t w = (sizeof(s) - 1) * cell - 2;
+	uint32_t x0 = 40, y0 = 40;
+
+	clear(COLOR_WHITE);
+	reference(x0, y0, " A  B ");
+
+	tile_init(COLOR_WHITE);
+	tile_text(&items[0], x0, y0, w, s, COLOR_BLACK);
+	tile_add(&items[0]);
+	render(0, 0, 3 * TILE_SIZE + w, 3 * TILE_SIZE - 1);
+	CHECK_EQ(text_diff(x0, y0, x0 + w - 1, y0 + gfont.height - 1, COLOR_WHITE), 0);
+	CHECK(count(x0 + cell, y0, x0 + 2 * cell - 1, y0 + gfont.height - 1, COLOR_BLACK) > 0);
+	CHECK_EQ(count(x0, y0, x0 + cell - 1, y0 + gfont.height - 1, COLOR_BLACK), 0);
+	CHECK_EQ(count(x0 + 2 * cell, y0, x0 + 4 * cell - 1, y0 + gfont.height - 1, COLOR_BLACK), 0);
+}
+
+static void stats(void)
+{
+	struct ili9488_stats pixmap, other;
+	tile_stats_t fill, text, fundo;
+	sim_lcd_stats_t d;
+	uint32_t lit, busy = 0;
+
+	clear(COLOR_BLUE);
+	tile_init(COLOR_WHITE);
+	tile_fill(&items[0], 0, 0, 40, 40, COLOR_RED);
+	tile_text(&items[1], 4, 8, 2 * (gfont.width + 2), "AB", COLOR_BLACK);
+	tile_add(&items[0]);
+	tile_add(&items[1]);
+	ili9488_stats_reset();
+	tile_stats_reset();
+	d = render(0, 0, 2 * TILE_SIZE - 1, TILE_SIZE - 1);
+
+	lit = count(0, 0, 2 * TILE_SIZE - 1, TILE_SIZE - 1, COLOR_BLACK);
+	tile_stats_get(TILE_FILL, &fill);
+	tile_stats_get(TILE_TEXT, &text);
+	tile_stats_get(TILE_STATS_BACKGROUND, &fundo);
+	CHECK(lit > 0);
+	CHECK_EQ(text.pixels, lit);
+	CHECK_EQ(fill.pixels, 40 * TILE_SIZE - lit);
+	CHECK_EQ(fundo.pixels, 24 * TILE_SIZE);
+	CHECK_EQ(fill.pixels + text.pixels + fundo.pixels, d.pixels);
+	CHECK(fill.items == 2 && text.items == 1 && fundo.items == 2);
+	for (uint32_t kind = 0; kind < TILE_STATS_COUNT; kind++) {
+		tile_stats_t st;
+
+		tile_stats_get(kind, &st);
+		busy += st.busy_cycles;
+	}
+
+	/* The second tile waited for the first, and render() for the second */
+	ili9488_stats_get(ILI9488_OP_PIXMAP, &pixmap);
+	ili9488_stats_get(ILI9488_OP_OTHER, &other);
+	CHECK_EQ(pixmap.ul_calls, 2);
+	CHECK(busy > 0 && pixmap.ul_busy_cycles > busy);
+	CHECK(other.ul_calls == 0 && other.ul_busy_cycles == 0);
+
+	ili9488_set_window(0, 0, 10, 10);
+	ili9488_wait_for_idle();
+	ili9488_stats_get(ILI9488_OP_OTHER, &other);
+	CHECK(other.ul_calls == 1 && other.ul_windows == 1 && other.ul_commands == 4);
+	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
+}
+
+/* The panel as a PPM file: the 6 bits of each channel spread over 8 */
+static void ppm(void)
+{
+	char path[] = "/tmp/tile_render_XXXXXX";
+	int fd = mkstemp(path);
+	char magic[16] = {0};
+	uint8_t px[3];
+	const uint8_t *p;
+	FILE *f;
+
+	if (!CHECK(fd >= 0)) {
+		return;
+	}
+	close(fd);
+	CHECK(sim_lcd_dump(path));
+	f = fopen(path, "rb");
+	if (CHECK(f != NULL)) {
+		CHECK(fread(magic, 1, 15, f) == 15);
+		CHECK(!memcmp(magic, "P6\n480 320\n255\n", 15));
+		fseek(f, 15 + (41L * ILI9488_LCD_WIDTH + 50) * 3, SEEK_SET);
+		CHECK(fread(px, 1, 3, f) == 3);
+		p = sim_lcd_pixel(50, 41);
+		CHECK(px[0] == ((p[0] & 0xFC) | (p[0] >> 6)) && px[2] == ((p[2] & 0xFC) | (p[2] >> 6)));
+		fclose(f);
+	}
+	unlink(path);
+}
+
+int main(void)
+{
+	sim_opt.quiet = true;
+	sim_power_on();
+	opt.foreground_color = COLOR_CONVERT(COLOR_WHITE);
+	opt.background_color = COLOR_CONVERT(COLOR_BLACK);
+	ili9488_init(&opt);
+
+	clipping();
+	order();
+	image();
+	text();
+	outside_charset();
+	stats();
+	ppm();
+
+	return check_end("tile_render");
+}
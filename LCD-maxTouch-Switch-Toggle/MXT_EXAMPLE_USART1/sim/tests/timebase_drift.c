@@ -0,0 +1,121 @@
+/*
+ * timebase_drift.c
+ *
+ * 24 hours of the timebase on the fake RTT of fake_rtt.h. The counter goes
+ * to each alarm the timebase programs, late by up to LATE_TICKS as an
+ * interrupt waiting on the main loop would be, and now and then to a tick
+ * before it, for a wake-up of some other interrupt.
+ *
+ * Periodic timers of many periods run all along, the second and minute of
+ * the wash among them. None may be called before its deadline nor later
+ * than the latency, and at the end each must have been called exactly as
+ * many times as its period fits in the day: no drift accumulates, where
+ * restarting the RTT every minute lost the ticks of each restart.
+ */
+
+#include "fake_rtt.h"
+#include "check.h"
+
+#define DAY_MS      (24u * 3600u * 1000u)
+#define LATE_TICKS  20
+/* The alarm is the first tick at or after the deadline: one tick more */
+#define LATE_MS     ((LATE_TICKS + 1) * 1000 / TIMEBASE_HZ + 1)
+#define N_TIMERS    64
+
+typedef struct {
+	sw_timer_t t;
+	uint32_t start;
+	uint32_t period;
+	uint32_t calls;
+	uint32_t early;
+	uint32_t max_late;
+} drift_t;
+
+static drift_t timers[N_TIMERS];
+
+static void tick(void *arg)
+{
+	drift_t *d = arg;
+	uint32_t now = timebase_now();
+	uint32_t deadline = d->start + (d->calls + 1) * d->period;
+
+	d->calls++;
+	if ((int32_t)(now - deadline) < 0) {
+		d->early++;
+	} else if (now - deadline > d->max_late) {
+		d->max_late = now - deadline;
+	}
+}
+
+static uint32_t seed = 0x24A11;
+
+static uint32_t rnd(uint32_t n)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 8) % n;
+}
+
+int main(void)
+{
+	uint32_t wakeups = 0, early_wakeups = 0;
+	uint32_t i, calls = 0, early = 0, late = 0, wrong = 0;
+
+	timebase_init();
+	CHECK_EQ(timebase_now(), 0);
+
+	/* The second and the minute of main.c, then periods of 7 ms to 17 min */
+	timers[0].period = 1000;
+	timers[1].period = 60000;
+	for (i = 2; i < N_TIMERS; i++) {
+		timers[i].period = 7 + rnd(i < N_TIMERS / 2 ? 5000 : 1000000);
+	}
+	for (i = 0; i < N_TIMERS; i++) {
+		/* Started at odd points, not on a tick */
+		rtt_counter += rnd(LATE_TICKS);
+		timebase_run();
+		timers[i].start = timebase_now();
+		sw_timer_start(&timers[i].t, timers[i].period, timers[i].period, tick, &timers[i]);
+	}
+
+	while (timebase_now() < DAY_MS) {
+		if (rtt_idle()) {
+			break;
+		}
+		if ((int32_t)(rtt_alarm - rtt_counter) > 1 && rnd(8) == 0) {
+			/* Some other interrupt before the alarm */
+			rtt_counter += 1 + rnd(rtt_alarm - rtt_counter - 1);
+			early_wakeups++;
+		} else {
+			rtt_counter = rtt_alarm + rnd(LATE_TICKS + 1);
+		}
+		wakeups++;
+		timebase_run();
+	}
+
+	for (i = 0; i < N_TIMERS; i++) {
+		drift_t *d = &timers[i];
+		uint32_t due = (timebase_now() - d->start) / d->period;
+
+		calls += d->calls;
+		early += d->early;
+		late += d->max_late > LATE_MS;
+		/* timebase_run() just ran: all that is due has been called */
+		if (d->calls != due) {
+			printf("period %u ms: %u calls, %u due\n", d->period, d->calls, due);
+			wrong++;
+		}
+	}
+
+	printf("%u ms: %u timers, %u calls, %u wake-ups (%u before the alarm), "
+	       "%u alarms written\n", timebase_now(), N_TIMERS, calls, wakeups,
+	       early_wakeups, rtt_alarms_written);
+	printf("second: %u calls, minute: %u calls, latest call %u ms after its deadline\n",
+	       timers[0].calls, timers[1].calls, timers[0].max_late);
+
+	CHECK(timebase_now() >= DAY_MS);
+	CHECK_EQ(wrong, 0);
+	CHECK_EQ(early, 0);
+	CHECK_EQ(late, 0);
+
+	return check_end("timebase_drift");
+}
@@ -0,0 +1,167 @@
+/*
+ * timebase_wrap.c
+ *
+ * The timebase across the wraps of its clocks, on the fake RTT of
+ * fake_rtt.h: the 32 bits RTT counter wraps after about 48 days, the ms of
+ * timebase_now() at 2^32, about 28 hours later. The counter goes from alarm
+ * to alarm, the keep-alive ones of an empty wheel included, and the test
+ * keeps its own count of ticks on 64 bits.
+ *
+ * - timebase_now() is that count in ms, cut to 32 bits, at every step:
+ *   no jump back at the wrap of the counter;
+ * - periodic timers of 1 s and 1 min running across each wrap are called
+ *   once per period, never early nor later than the latency: no burst to
+ *   catch up, no period lost;
+ * - one shot timers due across each wrap are called within the latency,
+ *   and one 20 days ahead, so past TIMEBASE_MAX_ALARM, at the ms of its
+ *   deadline.
+ */
+
+#include "fake_rtt.h"
+#include "check.h"
+
+#define LATE_TICKS  20
+/* The alarm is the first tick at or after the deadline: one tick more */
+#define LATE_MS     ((LATE_TICKS + 1) * 1000 / TIMEBASE_HZ + 1)
+#define RUN_MS      (10u * 60u * 1000u)
+#define FAR_MS      (20u * 24u * 3600u * 1000u)
+/* The first tick at which the ms reach 2^32 */
+#define MS_WRAP     ((((uint64_t)1 << 32) * TIMEBASE_HZ + 999) / 1000)
+
+typedef struct {
+	sw_timer_t t;
+	uint32_t start;
+	uint32_t period;
+	uint32_t calls;
+	uint32_t early;
+	uint32_t max_late;
+} ptimer_t;
+
+typedef struct {
+	sw_timer_t t;
+	uint32_t calls;
+	uint32_t last;
+} otimer_t;
+
+static ptimer_t periodic[2];
+static otimer_t once[2];
+
+/* Ticks since timebase_init(), as the test counts them */
+static uint64_t ticks;
+static uint32_t bad_now;
+static uint32_t steps;
+
+static void tick(void *arg)
+{
+	ptimer_t *p = arg;
+	uint32_t now = timebase_now();
+	uint32_t deadline = p->start + (p->calls + 1) * p->period;
+
+	p->calls++;
+	if ((int32_t)(now - deadline) < 0) {
+		p->early++;
+	} else if (now - deadline > p->max_late) {
+		p->max_late = now - deadline;
+	}
+}
+
+static void called(void *arg)
+{
+	otimer_t *o = arg;
+
+	o->calls++;
+	o->last = timebase_now();
+}
+
+static uint32_t seed = 0x3A7F;
+
+static uint32_t rnd(uint32_t n)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 8) % n;
+}
+
+/* Counter moved on by delta ticks, and the wheel run there */
+static void step(uint32_t delta)
+{
+	rtt_counter += delta;
+	ticks += delta;
+	timebase_run();
+	bad_now += timebase_now() != (uint32_t)(ticks * 1000 / TIMEBASE_HZ);
+	steps++;
+}
+
+/* From alarm to alarm up to the tick 'to', nothing in the wheel but far timers */
+static void walk_to(uint64_t to)
+{
+	while (ticks < to) {
+		uint32_t ahead = rtt_alarm - rtt_counter;
+
+		step(to - ticks < ahead ? (uint32_t)(to - ticks) : ahead);
+	}
+}
+
+/* RUN_MS of timers across a wrap, the counter late by up to LATE_TICKS */
+static void across(const char *what, otimer_t *o, uint32_t delay)
+{
+	uint32_t start, i;
+
+	for (i = 0; i < 2; i++) {
+		periodic[i].start = timebase_now();
+		periodic[i].calls = 0;
+		sw_timer_start(&periodic[i].t, periodic[i].period, periodic[i].period,
+		               tick, &periodic[i]);
+	}
+	start = timebase_now();
+	sw_timer_start(&o->t, delay, 0, called, o);
+
+	while (timebase_now() - start < RUN_MS) {
+		step(rtt_alarm - rtt_counter + rnd(LATE_TICKS + 1));
+	}
+	for (i = 0; i < 2; i++) {
+		ptimer_t *p = &periodic[i];
+
+		sw_timer_stop(&p->t);
+		printf("%s: period %u ms, %u calls, latest %u ms after its deadline\n", what,
+		       p->period, p->calls, p->max_late);
+		CHECK_EQ(p->calls, (timebase_now() - p->start) / p->period);
+		CHECK_EQ(p->early, 0);
+		CHECK(p->max_late <= LATE_MS);
+	}
+	CHECK_EQ(o->calls, 1);
+	CHECK(o->last - (start + delay) <= LATE_MS);
+	CHECK(rtt_idle());
+}
+
+int main(void)
+{
+	otimer_t far = {0};
+
+	timebase_init();
+	periodic[0].period = 1000;
+	periodic[1].period = 60000;
+
+	/*
+	 * A minute before the wrap of the counter, through keep-alive alarms and
+	 * the two alarms of a timer 20 days ahead
+	 */
+	sw_timer_start(&far.t, FAR_MS, 0, called, &far);
+	walk_to(((uint64_t)1 << 32) - 60 * TIMEBASE_HZ);
+	printf("%u steps to the counter at %08x, %u ms\n", steps, rtt_counter, timebase_now());
+	CHECK(steps >= 4);
+	CHECK_EQ(far.calls, 1);
+	CHECK_EQ(far.last, FAR_MS);
+	across("counter wrap", &once[0], 2 * 60000);
+	CHECK(ticks > (uint64_t)1 << 32);
+
+	/* Up to a minute before the wrap of the ms */
+	walk_to(MS_WRAP - 60 * TIMEBASE_HZ);
+	printf("%u steps to %u ms, counter at %08x\n", steps, timebase_now(), rtt_counter);
+	across("ms wrap", &once[1], 2 * 60000);
+	CHECK(timebase_now() < RUN_MS);
+
+	printf("%u steps, %u alarms written\n", steps, rtt_alarms_written);
+	CHECK_EQ(bad_now, 0);
+
+	return check_end("timebase_wrap");
+}
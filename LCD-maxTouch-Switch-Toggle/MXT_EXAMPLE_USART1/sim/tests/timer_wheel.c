@@ -0,0 +1,311 @@
+/*
+ * timer_wheel.c
+ *
+ * The timer wheel of timebase.c on the fake RTT of fake_rtt.h:
+ *
+ * - cascades: a timer held in level 1, 2 or 3, and on either side of the
+ *   boundaries of the levels, is called at the ms of its deadline, the
+ *   counter going from alarm to alarm, and in a handful of alarms;
+ * - callbacks that start and stop timers: a one shot timer started again
+ *   from its callback, a periodic one stopping itself, and one stopping a
+ *   timer due in the same ms before it is called;
+ * - late timers: a start with no delay, and a counter that jumps seconds
+ *   ahead, after which a periodic timer is called once for each period
+ *   missed and keeps its deadlines;
+ * - a model: timers of deadlines over all the levels started, stopped and
+ *   restarted at random while the counter goes to the alarm, before it or
+ *   far past it; after each timebase_run() every timer must have been
+ *   called as often as a plain list of deadlines says.
+ */
+
+#include "fake_rtt.h"
+#include "check.h"
+
+#define N_MODEL     200
+#define MODEL_STEPS 200000
+
+typedef struct {
+	sw_timer_t t;
+	uint32_t calls;
+	uint32_t last;      /* timebase_now() of the last call */
+	/* the model */
+	bool active;
+	uint32_t deadline;
+	uint32_t period;
+	uint32_t due;
+} wtimer_t;
+
+static wtimer_t timers[N_MODEL];
+
+static void called(void *arg)
+{
+	wtimer_t *t = arg;
+
+	t->calls++;
+	t->last = timebase_now();
+}
+
+static uint32_t seed = 0x3EE1;
+
+static uint32_t rnd(uint32_t n)
+{
+	/* xorshift: all 32 bits, for delays up to 2^25 ms */
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed % n;
+}
+
+/* Counter to the alarm, and the wheel run there; false with no timer */
+static bool to_alarm(void)
+{
+	if (rtt_idle()) {
+		return false;
+	}
+	rtt_counter = rtt_alarm;
+	timebase_run();
+	return true;
+}
+
+static void to_ms(uint32_t ms)
+{
+	rtt_counter = rtt_ticks_at(ms);
+	timebase_run();
+}
+
+/* -------- cascades -------- */
+
+static void cascade(uint32_t from, uint32_t delay)
+{
+	wtimer_t *t = &timers[0];
+	uint32_t alarms = 0;
+
+	timebase_init();
+	to_ms(from);
+	t->calls = 0;
+	sw_timer_start(&t->t, delay, 0, called, t);
+	/* A deadline past TIMEBASE_MAX_ALARM is reached in more than one alarm */
+	while (t->calls == 0 && alarms < 16) {
+		rtt_counter = rtt_alarm;
+		timebase_run();
+		alarms++;
+	}
+	if (!CHECK_EQ(t->calls, 1) || !CHECK_EQ(t->last, from + delay) ||
+	    !CHECK(alarms <= 8)) {
+		printf("from %u, delay %u: %u calls at %u, %u alarms\n", from, delay,
+		       t->calls, t->last, alarms);
+	}
+	CHECK(!t->t.active);
+	CHECK(rtt_idle());
+}
+
+static void cascades(void)
+{
+	static const uint32_t from[] = {0, 1, 255, 256, 65535, 70000, 16777215, 20000000};
+	static const uint32_t delay[] = {
+		1, 200, 255, 256, 257,                  /* level 0 and 1 */
+		65535, 65536, 65537, 100000,            /* level 1 and 2 */
+		16777215, 16777216, 16777217, 50000000, /* level 2 and 3 */
+		2000000000,
+	};
+
+	for (uint32_t i = 0; i < sizeof(from) / sizeof(from[0]); i++) {
+		for (uint32_t j = 0; j < sizeof(delay) / sizeof(delay[0]); j++) {
+			cascade(from[i], delay[j]);
+		}
+	}
+}
+
+/* -------- callbacks that start and stop timers -------- */
+
+static uint32_t chain_left;
+
+static void chain(void *arg)
+{
+	wtimer_t *t = arg;
+
+	called(t);
+	if (--chain_left) {
+		/* From its own deadline, not from now */
+		sw_timer_start(&t->t, t->t.deadline + 300 - timebase_now(), 0, chain, t);
+	}
+}
+
+static void stop_self(void *arg)
+{
+	wtimer_t *t = arg;
+
+	called(t);
+	if (t->calls == 3) {
+		sw_timer_stop(&t->t);
+	}
+}
+
+static void stop_other(void *arg)
+{
+	called(arg);
+	sw_timer_stop(&timers[3].t);
+	sw_timer_stop(&timers[4].t);
+}
+
+static void callbacks(void)
+{
+	uint32_t i;
+
+	timebase_init();
+	for (i = 0; i < 5; i++) {
+		timers[i].calls = 0;
+	}
+
+	chain_left = 5;
+	sw_timer_start(&timers[0].t, 300, 0, chain, &timers[0]);
+	sw_timer_start(&timers[1].t, 70, 70, stop_self, &timers[1]);
+	/* Both due at 1000 ms: 2 stops 3 whichever comes first, 4 later */
+	sw_timer_start(&timers[2].t, 1000, 0, stop_other, &timers[2]);
+	sw_timer_start(&timers[3].t, 1000, 0, called, &timers[3]);
+	sw_timer_start(&timers[4].t, 1001, 0, called, &timers[4]);
+
+	while (to_alarm()) {
+	}
+	CHECK_EQ(timers[0].calls, 5);
+	CHECK_EQ(timers[0].last, 1500);
+	CHECK_EQ(timers[1].calls, 3);
+	CHECK_EQ(timers[1].last, 210);
+	CHECK_EQ(timers[2].calls, 1);
+	CHECK(timers[3].calls <= 1);
+	CHECK_EQ(timers[4].calls, 0);
+	for (i = 0; i < 5; i++) {
+		CHECK(!timers[i].t.active);
+	}
+}
+
+/* -------- late timers -------- */
+
+static void late(void)
+{
+	timebase_init();
+	to_ms(1000);
+	timers[0].calls = 0;
+	timers[1].calls = 0;
+
+	/* No delay: at the next run, not from within the start */
+	sw_timer_start(&timers[0].t, 0, 0, called, &timers[0]);
+	CHECK_EQ(timers[0].calls, 0);
+	timebase_run();
+	CHECK_EQ(timers[0].calls, 1);
+	CHECK_EQ(timers[0].last, 1000);
+
+	/* 10 s with nothing run: 50 periods missed, all called at once */
+	sw_timer_start(&timers[1].t, 200, 200, called, &timers[1]);
+	to_ms(11100);
+	CHECK_EQ(timers[1].calls, 50);
+	CHECK_EQ(timers[1].t.deadline, 11200);
+	CHECK(to_alarm());
+	CHECK_EQ(timers[1].calls, 51);
+	CHECK_EQ(timers[1].last, 11200);
+	sw_timer_stop(&timers[1].t);
+	CHECK(rtt_idle());
+}
+
+/* -------- the model -------- */
+
+/* Delays of 0 ms to 2^25 ms, spread evenly over the levels */
+static uint32_t random_delay(void)
+{
+	return rnd(2u << rnd(25));
+}
+
+static void model_start(wtimer_t *t)
+{
+	uint32_t delay = random_delay();
+	uint32_t period = rnd(3) == 0 ? 0 : 5 + random_delay();
+
+	sw_timer_start(&t->t, delay, period, called, t);
+	t->active = true;
+	t->deadline = timebase_now() + delay;
+	t->period = period;
+}
+
+static void model_stop(wtimer_t *t)
+{
+	sw_timer_stop(&t->t);
+	t->active = false;
+}
+
+/* Calls due up to now, as a list of deadlines has them */
+static void model_run(uint32_t now)
+{
+	for (uint32_t i = 0; i < N_MODEL; i++) {
+		wtimer_t *t = &timers[i];
+
+		while (t->active && (int32_t)(now - t->deadline) >= 0) {
+			t->due++;
+			if (t->period) {
+				t->deadline += t->period;
+			} else {
+				t->active = false;
+			}
+		}
+	}
+}
+
+static void model(void)
+{
+	uint32_t wrong = 0, calls = 0, jumps = 0, early = 0;
+	uint32_t i, step;
+
+	timebase_init();
+	for (i = 0; i < N_MODEL; i++) {
+		timers[i] = (wtimer_t){0};
+		model_start(&timers[i]);
+	}
+
+	for (step = 0; step < MODEL_STEPS; step++) {
+		wtimer_t *t = &timers[rnd(N_MODEL)];
+		uint32_t op = rnd(16);
+
+		if (op == 0) {
+			model_stop(t);
+		} else if (op <= 2) {
+			model_start(t);
+		}
+
+		op = rnd(16);
+		if (op == 0 || rtt_idle()) {
+			/* Seconds late, past any number of alarms */
+			rtt_counter += rnd(10 * TIMEBASE_HZ);
+			jumps++;
+		} else if (op <= 3 && (int32_t)(rtt_alarm - rtt_counter) > 1) {
+			rtt_counter += 1 + rnd(rtt_alarm - rtt_counter - 1);
+			early++;
+		} else {
+			rtt_counter = rtt_alarm;
+		}
+		timebase_run();
+		model_run(timebase_now());
+
+		for (i = 0; i < N_MODEL; i++) {
+			if (timers[i].calls != timers[i].due || timers[i].t.active != timers[i].active) {
+				wrong++;
+				timers[i].calls = timers[i].due;
+			}
+		}
+	}
+
+	for (i = 0; i < N_MODEL; i++) {
+		calls += timers[i].calls;
+	}
+	printf("model: %u steps to %u ms, %u calls, %u jumps, %u runs before the alarm\n",
+	       MODEL_STEPS, timebase_now(), calls, jumps, early);
+	CHECK_EQ(wrong, 0);
+}
+
+int main(void)
+{
+	cascades();
+	callbacks();
+	late();
+	model();
+
+	return check_end("timer_wheel");
+}
@@ -0,0 +1,250 @@
+/*
+ * tlog.c
+ *
+ * Records of tlog.c put back into text by tools/tlog_decode.py, against
+ * the text printf() makes of the same formats and arguments.
+ *
+ * The records, with text of printf() between them, are written to a file
+ * given to the decoder, once with the formats of src/tlog.def and once
+ * with formats of the test (a def file of its own) that take every
+ * conversion the decoder knows, with flags and widths. The arguments are
+ * the edges of the varints and of int32_t, and random values.
+ *
+ * - the text of the decoder is the text of snprintf(), byte for byte,
+ *   text that is not ASCII included;
+ * - a record takes 1 byte of marker, then the bytes of its varints: 7
+ *   bits each, the zigzag keeping small negative numbers short;
+ * - a record cut at the end of the capture, or with an unknown format
+ *   number, comes out as <tlog ?>, and what follows its marker as text.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "tlog.h"
+#include "check.h"
+
+#define DECODER     "../tools/tlog_decode.py"
+#define MAX_TEXT    (1 << 20)
+#define N_RECORDS   3000
+
+/* The formats of tlog.def, as the decoder reads them */
+static const char *const tlog_formats[] = {
+#define TLOG_FORMAT(id, format) format,
+#include "tlog.def"
+#undef TLOG_FORMAT
+};
+
+/* Formats of the test: every conversion, with flags and widths */
+static const char *const test_formats[] = {
+	"%d %i %u %x %X %c|\n",
+	"[%5d] [%-5d] [%05d] [%+d] [% d]\n",
+	"[%8x] [%08X] [%-8x] [%#x] [%#X]\n",
+	"%u%%%c%c\n",
+	"no arguments\n",
+	"%10u,%-3i,%3c.\n",
+};
+
+static const int32_t edges[] = {
+	0, 1, -1, 2, -2, 63, -64, 64, -65, 127, 128, 8191, -8192, 8192, -8193,
+	(1 << 20) - 1, 1 << 20, (1 << 27) - 1, -(1 << 27), 1 << 27, INT32_MAX, INT32_MIN,
+	INT32_MAX - 1, INT32_MIN + 1, 'A', 0xE9, 0x9E, -0x62,
+};
+
+static uint32_t seed = 0x7106;
+
+static uint32_t rnd(uint32_t n)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 8) % n;
+}
+
+static int32_t value(void)
+{
+	switch (rnd(3)) {
+	case 0:
+		return edges[rnd(sizeof(edges) / sizeof(edges[0]))];
+	case 1:
+		return (int32_t)(rnd(1 << 16) << 16 | rnd(1 << 16)) >> rnd(32);
+	default:
+		return (int32_t)rnd(200) - 100;
+	}
+}
+
+static uint32_t conversions(const char *f)
+{
+	uint32_t n = 0;
+
+	while ((f = strchr(f, '%')) != NULL) {
+		f += 1 + strspn(f + 1, "-+ #0123456789");
+		n += *f != '%';
+		f += *f != '\0';
+	}
+	return n;
+}
+
+/* Bytes of the varint of the zigzag of v */
+static uint32_t varint_len(int32_t v)
+{
+	uint32_t z = ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+	uint32_t n = 1;
+
+	while (z >= 0x80) {
+		z >>= 7;
+		n++;
+	}
+	return n;
+}
+
+static struct {
+	uint8_t capture[MAX_TEXT];
+	uint32_t n_capture;
+	char expected[MAX_TEXT];
+	uint32_t n_expected;
+	uint32_t bad_len;
+} t;
+
+static void text(const char *s)
+{
+	uint32_t n = strlen(s);
+
+	memcpy(&t.capture[t.n_capture], s, n);
+	memcpy(&t.expected[t.n_expected], s, n);
+	t.n_capture += n;
+	t.n_expected += n;
+}
+
+static void record(const char *const *formats, uint32_t id)
+{
+	int32_t a[TLOG_MAX_ARGS] = {0};
+	uint32_t n = conversions(formats[id]);
+	/* The id is a plain varint, not a zigzag one */
+	uint32_t len = 1 + (id < 0x80 ? 1 : 2);
+
+	for (uint32_t i = 0; i < n; i++) {
+		a[i] = value();
+		len += varint_len(a[i]);
+	}
+	t.bad_len += tlog_encode(&t.capture[t.n_capture], id, a, n) != len;
+	t.n_capture += len;
+	t.n_expected += snprintf(&t.expected[t.n_expected], MAX_TEXT - t.n_expected,
+	                         formats[id], a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+}
+
+/* The text of the decoder for what was captured, with the formats of defs */
+static bool decode(const char *defs, char *out, uint32_t *n_out)
+{
+	char capture[] = "/tmp/tlog_XXXXXX";
+	char cmd[256];
+	int fd = mkstemp(capture);
+	FILE *p;
+
+	if (fd < 0 || write(fd, t.capture, t.n_capture) != (ssize_t)t.n_capture) {
+		perror(capture);
+		return false;
+	}
+	close(fd);
+	snprintf(cmd, sizeof(cmd), "python3 " DECODER "%s%s %s", defs ? " --def " : "",
+	         defs ? defs : "", capture);
+	p = popen(cmd, "r");
+	if (!p) {
+		perror(cmd);
+		return false;
+	}
+	*n_out = fread(out, 1, MAX_TEXT, p);
+	unlink(capture);
+	return pclose(p) == 0;
+}
+
+static bool same_text(const char *out, uint32_t n_out)
+{
+	uint32_t i = 0;
+
+	while (i < n_out && i < t.n_expected && out[i] == t.expected[i]) {
+		i++;
+	}
+	if (i == n_out && i == t.n_expected) {
+		return true;
+	}
+	printf("decoded text differs at byte %u of %u:\n  got      \"%.40s\"\n  expected \"%.40s\"\n",
+	       i, t.n_expected, &out[i], &t.expected[i]);
+	return false;
+}
+
+/* Records of formats among text of printf(), and the text of the decoder */
+static void round_trip(const char *const *formats, uint32_t n_formats, const char *defs)
+{
+	static char out[MAX_TEXT];
+	uint32_t n_out;
+
+	memset(&t, 0, sizeof(t));
+	for (uint32_t k = 0; k < N_RECORDS; k++) {
+		record(formats, rnd(n_formats));
+		if (rnd(8) == 0) {
+			text(rnd(2) ? "Tempo de lavagem: 54 min\n\r" : "lavagem conclu\xED" "da\n\r");
+		}
+	}
+	CHECK_EQ(t.bad_len, 0);
+	if (CHECK(decode(defs, out, &n_out))) {
+		CHECK(same_text(out, n_out));
+	}
+}
+
+int main(void)
+{
+	static char out[MAX_TEXT];
+	const uint32_t n_test = sizeof(test_formats) / sizeof(test_formats[0]);
+	char defs[] = "/tmp/tlog_def_XXXXXX";
+	uint8_t rec[64];
+	uint32_t n_out, n;
+	FILE *f;
+	int fd;
+
+	/* The formats of the firmware */
+	round_trip(tlog_formats, TLOG_N_FORMATS, NULL);
+
+	/* The formats of the test, in a def file as tlog.def */
+	fd = mkstemp(defs);
+	if (fd < 0 || !(f = fdopen(fd, "w"))) {
+		perror(defs);
+		return 1;
+	}
+	for (uint32_t i = 0; i < n_test; i++) {
+		fprintf(f, "TLOG_FORMAT(TEST_%u, \"", i);
+		for (const char *c = test_formats[i]; *c; c++) {
+			fputs(*c == '\n' ? "\\n" : (char[]){*c, '\0'}, f);
+		}
+		fprintf(f, "\")\n");
+	}
+	fclose(f);
+	round_trip(test_formats, n_test, defs);
+
+	/* Short values take a byte, the longest 5 */
+	CHECK_EQ(tlog_encode(rec, 0, (const int32_t[]){0, -1, 63, -64}, 4), 6);
+	CHECK_EQ(tlog_encode(rec, 0, (const int32_t[]){64, -65}, 2), 6);
+	CHECK_EQ(tlog_encode(rec, 0, (const int32_t[]){INT32_MIN, INT32_MAX}, 2), 12);
+	CHECK_EQ(rec[0], TLOG_MARKER);
+
+	/* An unknown format and a record cut by the end of the capture */
+	memset(&t, 0, sizeof(t));
+	text("a");
+	t.capture[t.n_capture++] = TLOG_MARKER;
+	t.capture[t.n_capture++] = 0x7F;
+	memcpy(&t.expected[t.n_expected], "<tlog ?>\x7F", 9);
+	t.n_expected += 9;
+	text("b\n");
+	n = tlog_encode(&t.capture[t.n_capture], 0, (const int32_t[]){1, 2000, 3000, 4, 5, 6}, 6);
+	t.n_capture += n - 1;
+	memcpy(&t.expected[t.n_expected], "<tlog ?>", 8);
+	t.n_expected += 8;
+	for (uint32_t i = 1; i < n - 1; i++) {
+		t.expected[t.n_expected++] = t.capture[t.n_capture - n + 1 + i];
+	}
+	if (CHECK(decode(defs, out, &n_out))) {
+		CHECK(same_text(out, n_out));
+	}
+
+	printf("%u records of %u formats decoded\n", 2 * N_RECORDS, TLOG_N_FORMATS + n_test);
+	unlink(defs);
+	return check_end("tlog");
+}
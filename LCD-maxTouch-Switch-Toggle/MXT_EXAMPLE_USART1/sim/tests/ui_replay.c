@@ -0,0 +1,110 @@
+/*
+ * ui_replay.c
+ *
+ * Pixels redrawn a frame by the dirty rectangles, over a replay of button
+ * presses (tests/ui_replay.txt) through the whole firmware.
+ *
+ * dirty_invalidate() and dirty_flush() are wrapped by the linker: the
+ * areas the UI invalidates are marked on a map of the panel, and at each
+ * flush the pixels marked (what had to be redrawn) are compared with the
+ * pixels painted by the merged rectangles. The merges may cost up to
+ * 1/DIRTY_MERGE_WASTE more than what they cover, and more only when the
+ * list of rectangles is full.
+ */
+
+#include <unistd.h>
+#include "sim.h"
+#include "dirty_rect.h"
+#include "check.h"
+
+#define SCRIPT "tests/ui_replay.txt"
+
+int firmware_main(void);
+void __real_dirty_invalidate(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2);
+uint32_t __real_dirty_flush(void);
+
+static uint8_t marked[SIM_LCD_H][SIM_LCD_W];
+
+static struct {
+	uint32_t frames;
+	uint64_t needed;
+	uint64_t painted;
+	uint32_t worst;             /* most pixels painted over in a frame */
+	uint32_t full_screens;
+} st;
+
+void __wrap_dirty_invalidate(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2)
+{
+	for (uint32_t y = y1; y <= y2 && y < SIM_LCD_H; y++) {
+		for (uint32_t x = x1; x <= x2 && x < SIM_LCD_W; x++) {
+			marked[y][x] = 1;
+		}
+	}
+	__real_dirty_invalidate(x1, y1, x2, y2);
+}
+
+uint32_t __wrap_dirty_flush(void)
+{
+	uint32_t painted = __real_dirty_flush();
+	uint32_t needed = 0;
+
+	if (painted == 0) {
+		return 0;
+	}
+	for (uint32_t y = 0; y < SIM_LCD_H; y++) {
+		for (uint32_t x = 0; x < SIM_LCD_W; x++) {
+			needed += marked[y][x];
+		}
+	}
+	memset(marked, 0, sizeof(marked));
+
+	st.frames++;
+	st.needed += needed;
+	st.painted += painted;
+	if (needed == SIM_LCD_W * SIM_LCD_H) {
+		st.full_screens++;
+	}
+	CHECK(painted >= needed);
+	if (painted - needed > st.worst) {
+		st.worst = painted - needed;
+	}
+	return painted;
+}
+
+/* The firmware never returns: the run ends in sim_finish(), with exit() */
+static void report(void)
+{
+	uint64_t partial_needed = st.needed - (uint64_t)st.full_screens * SIM_LCD_W * SIM_LCD_H;
+	uint64_t partial_painted = st.painted - (uint64_t)st.full_screens * SIM_LCD_W * SIM_LCD_H;
+	int status;
+
+	printf("%u frames, %u of the whole screen\n", st.frames, st.full_screens);
+	printf("pixels a frame: %llu to redraw, %llu painted (+%.1f%%)\n",
+	       (unsigned long long)(st.needed / st.frames),
+	       (unsigned long long)(st.painted / st.frames),
+	       100.0 * (st.painted - st.needed) / st.needed);
+	printf("partial frames: %llu to redraw, %llu painted (+%.1f%%)\n",
+	       (unsigned long long)(partial_needed / (st.frames - st.full_screens)),
+	       (unsigned long long)(partial_painted / (st.frames - st.full_screens)),
+	       100.0 * (partial_painted - partial_needed) / partial_needed);
+	printf("most pixels painted over in a frame: %u\n", st.worst);
+
+	CHECK(st.frames > st.full_screens);
+	CHECK(partial_painted <= partial_needed + partial_needed / DIRTY_MERGE_WASTE);
+
+	status = check_end("ui_replay");
+	fflush(stdout);
+	_exit(status);
+}
+
+int main(void)
+{
+	sim_opt.quiet = true;
+	sim_opt.console = "/dev/null";
+	if (!sim_script_load(SCRIPT)) {
+		return 1;
+	}
+	atexit(report);
+	sim_power_on();
+	return firmware_main();
+}
@@ -0,0 +1,341 @@
+/*
+ * wash_journal.c
+ *
+ * Resets in the middle of a wash program, on the models of the simulator:
+ * the GPBR block and the flash go from one boot to the next through the
+ * state file (sim_state_save() at the reset, sim_power_on() after it), and
+ * every boot is a process of its own, with the RAM of a board just reset.
+ * A new board is a state file removed. The program is wired as main.c does
+ * it: a checkpoint at each phase and every WASH_JOURNAL_PERIOD.
+ *
+ * - reset: the GPBR block is kept, and the program must resume at the
+ *   last checkpoint, paused if it was;
+ * - power loss without VDDBU: the registers are lost, and the program must
+ *   resume from the flash, no more than a flash period behind;
+ * - reset in a checkpoint: the slot being written holds any mix of its old
+ *   and new words, with the inverted CRC or not, and the boot must find
+ *   the checkpoint before or the new one, never something else;
+ * - a program that ended, or whose cycle was changed, does not resume.
+ *
+ * A resumed program must run to its end, and a boot after that finds
+ * nothing to resume.
+ */
+
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "sim.h"
+#include "maquina1.h"
+#include "settings_log.h"
+#include "timebase.h"
+#include "wash_journal.h"
+#include "wash_program.h"
+#include "check.h"
+
+#define CICLO       1       /* Diario: 5 phases, 54 min */
+#define N_RESETS    24
+#define SLOT_WORDS  4
+
+enum reset {
+	RESET,          /* GPBR kept */
+	NO_VDDBU,       /* GPBR lost */
+	TORN,           /* in the middle of a checkpoint to GPBR */
+	CHANGED,        /* the cycle changed before the program resumed */
+};
+
+typedef struct {
+	uint8_t phase;
+	uint8_t state;
+	uint16_t elapsed;   /* s */
+} pos_t;
+
+/* What a boot leaves for the next one, besides the state file */
+static struct {
+	pos_t last;         /* the last checkpoint */
+	pos_t before;       /* the one before it */
+	uint32_t remaining; /* ms of the program at the reset */
+	uint32_t gpbr_old[8];
+	uint32_t gpbr_new[8];
+	bool ended;
+} *shared;
+
+static char path[] = "/tmp/wash_journal_XXXXXX";
+
+static sw_timer_t journal_timer;
+static bool ended;
+
+static void checkpoint(void)
+{
+	shared->before = shared->last;
+	shared->last = (pos_t){wash_phase_index(), wash_state(), wash_phase_elapsed() / 1000};
+	wash_journal_checkpoint();
+}
+
+static void journal_tick(void *arg)
+{
+	UNUSED(arg);
+	checkpoint();
+}
+
+/* fase_lavagem() of main.c */
+static void on_phase(const wash_phase_t *phase)
+{
+	if (phase == NULL) {
+		sw_timer_stop(&journal_timer);
+		wash_journal_end();
+		ended = true;
+	} else {
+		checkpoint();
+	}
+}
+
+static void run_until(uint32_t ms)
+{
+	while (!ended && (int32_t)(ms - timebase_now()) > 0) {
+		uint64_t to = sim_now() + (uint64_t)(ms - timebase_now()) * 1000000u;
+
+		sim_advance_to(sim_rtt_next() < to ? sim_rtt_next() : to);
+		timebase_run();
+	}
+}
+
+static void run_to_end(void)
+{
+	while (!ended && sim_rtt_next() != SIM_NEVER) {
+		sim_advance_to(sim_rtt_next());
+		timebase_run();
+	}
+}
+
+/* The boot of main.c, up to the resume of the program */
+static bool boot(void)
+{
+	uint8_t ciclo = 0;
+
+	timebase_init();
+	settings_log_init(&ciclo);
+	wash_journal_init();
+	if (!wash_journal_resume(on_phase, &ciclo)) {
+		return false;
+	}
+	sw_timer_start(&journal_timer, WASH_JOURNAL_PERIOD, WASH_JOURNAL_PERIOD, journal_tick, NULL);
+	return true;
+}
+
+/* -------- the boots, each in a process of its own -------- */
+
+static int stage(void (*f)(uint32_t, uint32_t), uint32_t a, uint32_t b)
+{
+	int status;
+	pid_t pid;
+
+	fflush(stdout);
+	pid = fork();
+	if (pid == 0) {
+		check_failed = 0;
+		sim_opt.quiet = true;
+		sim_opt.state = path;
+		sim_power_on();
+		f(a, b);
+		fflush(stdout);
+		_exit(check_failed ? 1 : 0);
+	}
+	waitpid(pid, &status, 0);
+	return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+/* A new board starts the program, and is reset at ms 'at', paused from 'pause' */
+static void start(uint32_t at, uint32_t pause)
+{
+	t_ciclo settings;
+
+	CHECK(!boot());
+
+	ciclo_le(CICLO, &settings);
+	wash_load(&settings);
+	wash_journal_begin(CICLO, &settings);
+	wash_start(on_phase);
+	sw_timer_start(&journal_timer, WASH_JOURNAL_PERIOD, WASH_JOURNAL_PERIOD, journal_tick, NULL);
+
+	if (pause < at) {
+		run_until(pause);
+		wash_pause();
+		checkpoint();
+	}
+	run_until(at);
+	shared->ended = ended;
+	shared->remaining = wash_remaining();
+	sim_state_save();
+}
+
+/* As start(), and the reset comes in a checkpoint 3 s after the last one */
+static void start_torn(uint32_t at, uint32_t unused)
+{
+	UNUSED(unused);
+	start(at, UINT32_MAX);
+	run_until(timebase_now() + 3000);
+	memcpy(shared->gpbr_old, (const void *)sim_gpbr.SYS_GPBR, sizeof(shared->gpbr_old));
+	checkpoint();
+	memcpy(shared->gpbr_new, (const void *)sim_gpbr.SYS_GPBR, sizeof(shared->gpbr_new));
+	sim_state_save();
+}
+
+static bool at(const pos_t *p)
+{
+	return wash_phase_index() == p->phase && wash_state() == p->state &&
+	       wash_phase_elapsed() == p->elapsed * 1000u;
+}
+
+/* The boot after the reset */
+static void resume(uint32_t how, uint32_t mix)
+{
+	/* The callback of the phase resumed records a checkpoint of its own */
+	const pos_t last = shared->last, before = shared->before;
+	bool resumed;
+
+	if (how == NO_VDDBU) {
+		memset(&sim_gpbr, 0, sizeof(sim_gpbr));
+	} else if (how == TORN) {
+		/* The slot that changed: words of mix from the new one */
+		for (uint32_t i = 0; i < 8; i++) {
+			uint32_t w = i % SLOT_WORDS;
+
+			if (shared->gpbr_old[i] == shared->gpbr_new[i]) {
+				continue;
+			}
+			if (mix & (1u << w)) {
+				sim_gpbr.SYS_GPBR[i] = shared->gpbr_new[i];
+			} else if (w == SLOT_WORDS - 1 && (mix & 0x10)) {
+				sim_gpbr.SYS_GPBR[i] = ~shared->gpbr_new[i];
+			} else {
+				sim_gpbr.SYS_GPBR[i] = shared->gpbr_old[i];
+			}
+		}
+	} else if (how == CHANGED) {
+		uint8_t ciclo = 0;
+
+		settings_log_init(&ciclo);
+		ciclo_altera(CICLO, CICLO_ENXAGUE_QNT, ciclo_valor(CICLO, CICLO_ENXAGUE_QNT) + 1);
+		settings_log_field(CICLO, CICLO_ENXAGUE_QNT);
+	}
+
+	resumed = boot();
+	if (shared->ended || how == CHANGED) {
+		CHECK(!resumed);
+		CHECK_EQ(wash_journal_source(), WASH_JOURNAL_NONE);
+		sim_state_save();
+		return;
+	}
+	if (!CHECK(resumed)) {
+		return;
+	}
+
+	switch (how) {
+	case RESET:
+		CHECK_EQ(wash_journal_source(), WASH_JOURNAL_GPBR);
+		CHECK(at(&last));
+		break;
+	case NO_VDDBU:
+		CHECK_EQ(wash_journal_source(), WASH_JOURNAL_FLASH);
+		CHECK(wash_state() == last.state);
+		/* What is done again: since the last checkpoint to the flash */
+		CHECK(wash_remaining() >= shared->remaining);
+		CHECK(wash_remaining() - shared->remaining <
+		      WASH_JOURNAL_FLASH_PERIOD + WASH_JOURNAL_PERIOD + 1000);
+		break;
+	case TORN:
+		CHECK_EQ(wash_journal_source(), WASH_JOURNAL_GPBR);
+		if ((mix & 0xF) == 0xF) {
+			CHECK(at(&last));
+		} else if ((mix & 0xF) == 0) {
+			CHECK(at(&before));
+		} else {
+			CHECK(at(&last) || at(&before));
+		}
+		break;
+	}
+
+	if (wash_state() == WASH_PAUSED) {
+		wash_resume();
+	}
+	run_to_end();
+	CHECK(ended);
+	sim_state_save();
+}
+
+/* The boot after the program ended */
+static void nothing_left(uint32_t how, uint32_t unused)
+{
+	UNUSED(unused);
+	if (how == NO_VDDBU) {
+		memset(&sim_gpbr, 0, sizeof(sim_gpbr));
+	}
+	CHECK(!boot());
+	CHECK_EQ(wash_journal_source(), WASH_JOURNAL_NONE);
+}
+
+static uint32_t seed = 0x5E7;
+
+static uint32_t rnd(uint32_t n)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 8) % n;
+}
+
+int main(void)
+{
+	t_ciclo settings;
+	uint32_t total, trials = 0;
+	int fd = mkstemp(path);
+
+	if (fd < 0) {
+		perror("mkstemp");
+		return 1;
+	}
+	close(fd);
+	shared = mmap(NULL, sizeof(*shared), PROT_READ | PROT_WRITE,
+	              MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+	ciclo_le(CICLO, &settings);
+	total = wash_load(&settings);
+
+	for (uint32_t how = RESET; how <= NO_VDDBU; how++) {
+		for (uint32_t i = 0; i < N_RESETS; i++) {
+			uint32_t t = 1000 + rnd(total + 60000);
+			/* A third of them paused for a while before the reset */
+			uint32_t pause = rnd(3) == 0 ? t - rnd(t) / 4 : UINT32_MAX;
+
+			unlink(path);
+			CHECK_EQ(stage(start, t, pause), 0);
+			CHECK_EQ(stage(resume, how, 0), 0);
+			CHECK_EQ(stage(nothing_left, how, 0), 0);
+			trials++;
+		}
+	}
+
+	for (uint32_t i = 0; i < 4; i++) {
+		uint32_t t = 10000 + rnd(total - 20000);
+
+		for (uint32_t mix = 0; mix < 0x20; mix++) {
+			if ((mix & 0x10) && (mix & 0x8)) {
+				continue;
+			}
+			unlink(path);
+			CHECK_EQ(stage(start_torn, t, 0), 0);
+			CHECK_EQ(stage(resume, TORN, mix), 0);
+			trials++;
+		}
+	}
+
+	unlink(path);
+	CHECK_EQ(stage(start, total / 2, UINT32_MAX), 0);
+	CHECK_EQ(stage(resume, CHANGED, 0), 0);
+	CHECK_EQ(stage(nothing_left, RESET, 0), 0);
+	trials++;
+
+	printf("%u resets of a program of %.0f min\n", trials, total / 60000.0);
+
+	unlink(path);
+	return check_end("wash_journal");
+}
@@ -0,0 +1,220 @@
+/*
+ * wash_program.c
+ *
+ * Wash programs run to the end on the fake RTT of fake_rtt.h, a virtual
+ * clock that goes straight to each alarm, late by up to LATE_TICKS: a
+ * program of an hour takes some us of the host.
+ *
+ * Each factory cycle, and some changed by the user, runs once straight
+ * and once with pauses at random points. The phases must come in the
+ * order of the cycle (fill, wash, one rinse per enxagueQnt, spin at its
+ * rpm), each starting when the one before should have ended, whatever
+ * the latency of the alarms; wash_remaining() must always be the duration
+ * of the program less the time run, and not move while paused; and the
+ * program must end after its duration plus the pauses, within the
+ * latency of one alarm.
+ */
+
+#include <time.h>
+#include "fake_rtt.h"
+#include "maquina1.h"
+#include "wash_program.h"
+#include "check.h"
+
+#define LATE_TICKS  20
+#define LATE_MS     ((LATE_TICKS + 1) * 1000 / TIMEBASE_HZ + 1)
+
+static uint32_t seed = 0x3A5A;
+
+static uint32_t rnd(uint32_t n)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (seed >> 8) % n;
+}
+
+/* What the program did, from the callbacks */
+static struct {
+	wash_phase_t phase[WASH_MAX_PHASES];
+	uint32_t start[WASH_MAX_PHASES];     /* in ms run, pauses left out */
+	uint32_t t0;
+	uint32_t paused;
+	uint32_t n;
+	bool done;
+	uint32_t end;
+	uint32_t bad_start;
+} run;
+
+static void on_phase(const wash_phase_t *phase)
+{
+	uint32_t now = timebase_now();
+
+	if (phase == NULL) {
+		run.done = true;
+		run.end = now;
+		return;
+	}
+	if (run.n < WASH_MAX_PHASES) {
+		run.phase[run.n] = *phase;
+		/* Late or not, the phase is counted from where the last one ended */
+		run.start[run.n] = now - run.t0 - run.paused - wash_phase_elapsed();
+		if (run.start[run.n] !=
+		    (run.n ? run.start[run.n - 1] + run.phase[run.n - 1].duration : 0)) {
+			run.bad_start++;
+		}
+	}
+	run.n++;
+}
+
+/* The phases a cycle must have */
+static uint32_t expected(const t_ciclo *c, wash_phase_t *p)
+{
+	uint32_t n = 0;
+
+	if (c->enxagueTempo > 0) {
+		p[n++] = (wash_phase_t){WASH_FILL, 0, 0, WASH_FILL_TIME};
+		p[n++] = (wash_phase_t){WASH_WASH, 0, 0, c->enxagueTempo * 60000u * (c->heavy ? 2 : 1)};
+		for (int i = 0; i < c->enxagueQnt; i++) {
+			p[n++] = (wash_phase_t){WASH_RINSE, i + 1, 0, c->enxagueTempo * 60000u};
+		}
+	}
+	if (c->centrifugacaoTempo > 0) {
+		p[n++] = (wash_phase_t){WASH_SPIN, 0, c->centrifugacaoRPM, c->centrifugacaoTempo * 60000u};
+	}
+	return n;
+}
+
+static void program(const t_ciclo *c, bool pauses)
+{
+	wash_phase_t want[WASH_MAX_PHASES];
+	uint32_t n_want = expected(c, want);
+	uint32_t total = wash_load(c);
+	uint32_t n_pauses = 0, bad_left = 0, i;
+	uint32_t sum = 0;
+
+	for (i = 0; i < n_want; i++) {
+		sum += want[i].duration;
+	}
+	CHECK_EQ(total, sum);
+	CHECK_EQ(wash_total_ms(), total);
+	CHECK_EQ(wash_phase_count(), n_want);
+	CHECK_EQ(wash_remaining(), total);
+
+	memset(&run, 0, sizeof(run));
+	run.t0 = timebase_now();
+	wash_start(on_phase);
+
+	while (!run.done && !rtt_idle()) {
+		if (pauses && rnd(4) == 0) {
+			/* Paused somewhere before the alarm, for up to 10 min */
+			uint32_t p;
+
+			rtt_counter += rnd(rtt_alarm - rtt_counter);
+			timebase_run();
+			if (run.done) {
+				break;
+			}
+			wash_pause();
+			p = timebase_now();
+			bad_left += wash_remaining() != total - (p - run.t0 - run.paused);
+			rtt_counter += rnd(600 * TIMEBASE_HZ);
+			timebase_run();
+			bad_left += wash_remaining() != total - (p - run.t0 - run.paused);
+			CHECK_EQ(wash_state(), WASH_PAUSED);
+			run.paused += timebase_now() - p;
+			n_pauses++;
+			wash_resume();
+			continue;
+		}
+		rtt_counter = rtt_alarm + rnd(LATE_TICKS + 1);
+		timebase_run();
+		if (!run.done && wash_state() == WASH_RUNNING) {
+			/* Remaining: the duration less the time run, never late */
+			uint32_t ran = timebase_now() - run.t0 - run.paused;
+
+			bad_left += wash_remaining() != (ran < total ? total - ran : 0) &&
+			            wash_remaining() != 0;
+		}
+	}
+
+	CHECK(run.done);
+	CHECK_EQ(wash_state(), WASH_DONE);
+	CHECK_EQ(wash_remaining(), 0);
+	CHECK_EQ(run.bad_start, 0);
+	CHECK_EQ(bad_left, 0);
+	if (CHECK_EQ(run.n, n_want)) {
+		for (i = 0; i < n_want; i++) {
+			CHECK(run.phase[i].type == want[i].type && run.phase[i].n == want[i].n &&
+			      run.phase[i].rpm == want[i].rpm && run.phase[i].duration == want[i].duration);
+		}
+	}
+	/* The last phase ended at its alarm, late by the latency at most */
+	CHECK(run.end - run.t0 - run.paused >= total);
+	CHECK(run.end - run.t0 - run.paused <= total + LATE_MS);
+	if (pauses) {
+		CHECK(n_pauses > 0);
+	}
+	printf("%-10s %2u phases %6.1f min, %2u pauses %6.1f min, ended %u ms late\n",
+	       c->nome, run.n, total / 60000.0, n_pauses, run.paused / 60000.0,
+	       run.end - run.t0 - run.paused - total);
+}
+
+int main(void)
+{
+	struct timespec h0, h1;
+	uint32_t programs = 0;
+	t_ciclo c;
+
+	timebase_init();
+	clock_gettime(CLOCK_MONOTONIC, &h0);
+
+	for (uint8_t i = 0; i < N_CICLOS; i++) {
+		ciclo_le(i, &c);
+		program(&c, false);
+		program(&c, true);
+		programs += 2;
+	}
+
+	/* Pesado: fill, wash doubled, 3 rinses and spin, as the idle screen shows it */
+	ciclo_le(2, &c);
+	wash_load(&c);
+	CHECK_EQ(wash_total_ms(), 61 * 60000u);
+
+	/* Changed by the user: more rinses, heavy, no spin */
+	ciclo_altera(0, CICLO_ENXAGUE_QNT, WASH_MAX_RINSES);
+	ciclo_altera(0, CICLO_HEAVY, 1);
+	ciclo_altera(0, CICLO_CENTRIFUGACAO_TEMPO, 0);
+	ciclo_le(0, &c);
+	program(&c, true);
+	ciclo_restaura(0);
+	programs++;
+
+	/* Paused and resumed on the ms a phase ends */
+	ciclo_le(1, &c);
+	wash_load(&c);
+	memset(&run, 0, sizeof(run));
+	run.t0 = timebase_now();
+	wash_start(on_phase);
+	rtt_counter = rtt_ticks_at(run.t0 + WASH_FILL_TIME);
+	wash_pause();
+	CHECK_EQ(wash_phase_remaining(), 0);
+	timebase_run();
+	CHECK_EQ(run.n, 1);
+	rtt_counter += 10 * TIMEBASE_HZ;
+	run.paused = 10000;
+	wash_resume();
+	CHECK(rtt_alarm == rtt_counter + 1);
+	rtt_counter = rtt_alarm;
+	timebase_run();
+	CHECK_EQ(run.n, 2);
+	CHECK_EQ(run.phase[1].type, WASH_WASH);
+	CHECK_EQ(run.bad_start, 0);
+	wash_stop();
+	CHECK_EQ(wash_state(), WASH_IDLE);
+	CHECK(rtt_idle());
+
+	clock_gettime(CLOCK_MONOTONIC, &h1);
+	printf("%u programs in %.1f ms of the host\n", programs,
+	       (h1.tv_sec - h0.tv_sec) * 1e3 + (h1.tv_nsec - h0.tv_nsec) / 1e6);
+
+	return check_end("wash_program");
+}
@@ -44,6 +44,7 @@
 #define  MXT_MEM_ADDR               0x00
 #define  MXT_FAMILY_143E            0x81
 #define  MXT_VARIANT_143E           0x07
+#define  MXT_REPORTID_INVALID       0xff
 
 /**
  * \internal
@@ -388,17 +389,16 @@ static uint8_t inline mxt_crc_8(uint8_t crc, uint8_t data)
  * \internal
  * \brief Validates the message received from the maXTouch device.
  *
- * \param packet  Message received from the maXTouch device
+ * \param message  Message received from the maXTouch device
  * \return Operation result status code.
  */
-static inline status_code_t mxt_validate_message(
-		twihs_package_t *packet)
+static inline status_code_t mxt_validate_message(const void *message)
 {
 	uint8_t crc = 0;
 	uint8_t i;
 
 	for (i = 0; i < (MXT_TWI_MSG_SIZE_T5); ++i) {
-		crc = mxt_crc_8(crc, ((uint8_t *)packet->buffer)[i]);
+		crc = mxt_crc_8(crc, ((const uint8_t *)message)[i]);
 	}
 
 	if (crc != 0) {
@@ -425,6 +425,31 @@ static void mxt_info_le_to_cpu(struct mxt_device *device)
 	}
 }
 
+/**
+ * \internal
+ * \brief Decode a multitouch T9 message into a touch event.
+ *
+ * \param *device Pointer to mxt_device instance
+ * \param *message T9 message read from the T5 message processor
+ * \param *touch_event Pointer to mxt_touch_event instance
+ */
+static void mxt_decode_touch_event(struct mxt_device *device,
+		const struct mxt_conf_messageprocessor_t5 *message,
+		struct mxt_touch_event *touch_event)
+{
+	touch_event->id = (message->reportid -
+			device->multitouch_report_offset);
+
+	touch_event->status = message->message[0];
+
+	touch_event->x = (message->message[1] << 4) |
+			((message->message[3] & 0xf0) >> 4);
+	touch_event->y = (message->message[2] << 4) |
+			(message->message[3] & 0x0f);
+
+	touch_event->size = message->message[4];
+}
+
 /**
  * \brief Probe for a maXTouch connected to a specific TWI line
  *
@@ -512,6 +537,12 @@ status_code_t mxt_init_device(struct mxt_device *device,
 
 	device->multitouch_report_offset = status;
 
+	/* Cache the message objects, they are read on every touch */
+	device->t5_address = mxt_get_object_address(device,
+			MXT_GEN_MESSAGEPROCESSOR_T5, 0);
+	device->t44_address = mxt_get_object_address(device,
+			MXT_SPT_MESSAGECOUNT_T44, 0);
+
 	return STATUS_OK;
 }
 
@@ -703,8 +734,7 @@ bool mxt_is_message_pending(struct mxt_device *device)
 int8_t mxt_get_message_count(struct mxt_device *device)
 {
 	uint8_t count_tmp = 0;
-	uint16_t obj_adr = mxt_get_object_address(device,
-			MXT_SPT_MESSAGECOUNT_T44, 0);
+	uint16_t obj_adr = device->t44_address;
 
 	/* Initializing the TWI packet to send to the slave */
 	twihs_package_t packet = {
@@ -734,8 +764,7 @@ int8_t mxt_get_message_count(struct mxt_device *device)
 status_code_t mxt_read_message(struct mxt_device *device,
 		struct mxt_conf_messageprocessor_t5 *message)
 {
-	uint16_t obj_adr = mxt_get_object_address(device,
-			MXT_GEN_MESSAGEPROCESSOR_T5, 0);
+	uint16_t obj_adr = device->t5_address;
 
 	/* Initializing the TWI packet to send to the slave */
 	twihs_package_t packet = {
@@ -756,7 +785,7 @@ status_code_t mxt_read_message(struct mxt_device *device,
 		return ERR_IO_ERROR;
 	} else {
 #ifdef CONF_VALIDATE_MESSAGES
-		return mxt_validate_message(&packet);
+		return mxt_validate_message(message);
 #else
 		return STATUS_OK;
 #endif
@@ -785,23 +814,111 @@ status_code_t mxt_read_touch_event(struct mxt_device *device,
 		obj_type = mxt_get_object_type(device, &message);
 
 		if (obj_type == MXT_TOUCH_MULTITOUCHSCREEN_T9) {
-			touch_event->id = (message.reportid -
-					device->multitouch_report_offset);
+			mxt_decode_touch_event(device, &message, touch_event);
+			return STATUS_OK;
+		}
+	}
 
-			touch_event->status = message.message[0];
+	return ERR_BAD_DATA;
+}
+
+/**
+ * \brief Read all pending touch events in one burst, skip other events
+ *        (other events are lost)
+ *
+ * The T44 message count is read first; when T44 directly precedes T5 in the
+ * memory map the first message comes along in the same transfer. The rest of
+ * the queue is then read from T5 in a single transfer, the device advancing
+ * to the next message every MXT_TWI_MSG_SIZE_T5 bytes. Messages beyond
+ * \a max_events are left in the queue and /CHG stays low.
+ *
+ * \param *device Pointer to mxt_device instance
+ * \param *touch_events Array of at least \a max_events mxt_touch_event
+ * \param max_events Size of \a touch_events, capped at MXT_MAX_BURST_MSGS
+ * \param *num_events Number of touch events stored in \a touch_events
+ * \return Operation result status code
+ */
+status_code_t mxt_read_touch_events(struct mxt_device *device,
+		struct mxt_touch_event *touch_events, uint8_t max_events,
+		uint8_t *num_events)
+{
+	uint8_t buffer[1 + MXT_MAX_BURST_MSGS * MXT_TWI_MSG_SIZE_T5];
+	struct mxt_conf_messageprocessor_t5 *message;
+	uint8_t count, n_msgs, first, i;
+	bool joined;
 
-			touch_event->x = (message.message[1] << 4) |
-					((message.message[3] & 0xf0) >> 4);
-			touch_event->y = (message.message[2] << 4) |
-					(message.message[3] & 0x0f);
+	*num_events = 0;
 
-			touch_event->size = message.message[4];
+	if (max_events > MXT_MAX_BURST_MSGS) {
+		max_events = MXT_MAX_BURST_MSGS;
+	}
 
-			return STATUS_OK;
+#ifdef CONF_VALIDATE_MESSAGES
+	/* The checksum bit only applies to reads starting at T5 */
+	joined = false;
+#else
+	joined = (device->t44_address + 1 == device->t5_address);
+#endif
+
+	/* Initializing the TWI packet to send to the slave */
+	twihs_package_t packet = {
+		.addr[0]      = device->t44_address,
+		.addr[1]      = device->t44_address >> 8,
+		.addr_length  = sizeof(mxt_memory_adr),
+		.chip         = device->mxt_chip_adr,
+		.buffer       = buffer,
+		.length       = joined ? 1 + MXT_TWI_MSG_SIZE_T5 : 1
+	};
+
+	if (twihs_master_read(device->interface, &packet) != STATUS_OK) {
+		return ERR_IO_ERROR;
+	}
+
+	count = buffer[0];
+	if (count == 0) {
+		return STATUS_OK;
+	}
+
+	n_msgs = min(count, max_events);
+	first = joined ? 1 : 0;
+
+	if (n_msgs > first) {
+		packet.addr[0] = device->t5_address;
+#ifdef CONF_VALIDATE_MESSAGES
+		packet.addr[1] = (device->t5_address >> 8) | 0x80;
+#else
+		packet.addr[1] = device->t5_address >> 8;
+#endif
+		packet.buffer = &buffer[1 + first * MXT_TWI_MSG_SIZE_T5];
+		packet.length = (n_msgs - first) * MXT_TWI_MSG_SIZE_T5;
+
+		if (twihs_master_read(device->interface, &packet) != STATUS_OK) {
+			return ERR_IO_ERROR;
 		}
 	}
 
-	return ERR_BAD_DATA;
+	for (i = 0; i < n_msgs; i++) {
+		message = (struct mxt_conf_messageprocessor_t5 *)
+				&buffer[1 + i * MXT_TWI_MSG_SIZE_T5];
+
+#ifdef CONF_VALIDATE_MESSAGES
+		if (mxt_validate_message(message) != STATUS_OK) {
+			continue;
+		}
+#endif
+		if (message->reportid == MXT_REPORTID_INVALID) {
+			continue;
+		}
+
+		if (mxt_get_object_type(device, message) ==
+				MXT_TOUCH_MULTITOUCHSCREEN_T9) {
+			mxt_decode_touch_event(device, message,
+					&touch_events[*num_events]);
+			(*num_events)++;
+		}
+	}
+
+	return STATUS_OK;
 }
 
 /**
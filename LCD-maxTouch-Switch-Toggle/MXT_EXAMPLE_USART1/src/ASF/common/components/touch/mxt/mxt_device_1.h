@@ -48,9 +48,14 @@ extern "C" {
 
 
 #define MXT_MAX_MSG_SIZE       7
-#define MXT_TWI_MSG_SIZE_T5    MXT_MAX_MSG_SIZE + 2
+#define MXT_TWI_MSG_SIZE_T5    (MXT_MAX_MSG_SIZE + 2)
 #define MXT_RESET_TIME         65
 
+/** Maximum number of T5 messages fetched by one mxt_read_touch_events burst */
+#ifndef MXT_MAX_BURST_MSGS
+#define MXT_MAX_BURST_MSGS     8
+#endif
+
 typedef uint16_t mxt_memory_adr;
 
 /**
@@ -213,6 +218,9 @@ struct mxt_device {
 
 	uint32_t chgpin;
 	int8_t multitouch_report_offset;
+
+	mxt_memory_adr t5_address;  /**< Cached message processor address */
+	mxt_memory_adr t44_address; /**< Cached message count address     */
 };
 
 status_code_t mxt_probe_device(twihs_master_t interface, uint8_t chip_adr);
@@ -253,6 +261,10 @@ status_code_t mxt_read_message(struct mxt_device *device,
 status_code_t mxt_read_touch_event(struct mxt_device *device,
 		struct mxt_touch_event *touch_event);
 
+status_code_t mxt_read_touch_events(struct mxt_device *device,
+		struct mxt_touch_event *touch_events, uint8_t max_events,
+		uint8_t *num_events);
+
 enum mxt_object_type mxt_get_object_type(struct mxt_device *device,
 		struct mxt_conf_messageprocessor_t5 *message);
 
@@ -56,6 +56,11 @@
 #ifdef ILI9488_SPIMODE
 #  include "spi_master.h"
 #endif
+#ifdef ILI9488_XDMAC_ENABLED
+#  include "pmc.h"
+#  include "xdmac.h"
+#  include "interrupt.h"
+#endif
 
 /// @cond 0
 /**INDENT-OFF**/
@@ -69,6 +74,84 @@
 #define LCD_DATA_CACHE_SIZE ILI9488_LCD_WIDTH
 static ili9488_color_t g_ul_pixel_cache[LCD_DATA_CACHE_SIZE*LCD_DATA_COLOR_UNIT];
 
+#ifdef ILI9488_XDMAC_ENABLED
+/* Marks a queued transfer without command phase */
+#define ILI9488_DMA_NO_CMD      0xFFFF
+/* Parameters up to this size are copied into the queue entry */
+#define ILI9488_DMA_INLINE_SIZE 8
+
+/**
+ * One queued LCD transfer: an optional command byte (sent with CDS low)
+ * followed by an optional data phase (sent by the XDMAC with CDS high).
+ * The data phase can be repeated back to back, which is used to fill
+ * areas from the pixel cache with a single DMA block.
+ */
+struct ili9488_dma_xfer {
+	const ili9488_color_t *p_data;
+	uint32_t ul_size;
+	uint32_t ul_repeat;
+	uint16_t us_cmd;
+	ili9488_color_t inline_data[ILI9488_DMA_INLINE_SIZE];
+};
+
+static struct ili9488_dma_xfer g_dma_queue[ILI9488_XDMAC_QUEUE_SIZE];
+/* Written by the caller only */
+static volatile uint32_t g_ul_dma_head;
+/* Written by the XDMAC interrupt only (or the caller when idle) */
+static volatile uint32_t g_ul_dma_tail;
+static volatile bool g_b_dma_busy;
+static ili9488_callback_t g_dma_callback;
+#endif
+
+/* Current colors (RGB 24 bits) used by the text functions */
+static uint32_t g_ul_foreground_color;
+static uint32_t g_ul_background_color;
+
+/* Row buffers used to stream text, two so one can be filled while the other is sent */
+static ili9488_color_t g_ul_text_row[2][ILI9488_LCD_WIDTH * LCD_DATA_COLOR_UNIT];
+#ifdef ILI9488_XDMAC_ENABLED
+/* Queue mark of the transfer that last read each row buffer */
+static uint32_t g_ul_text_row_mark[2];
+#endif
+
+#ifdef ILI9488_STATS_ENABLED
+/* Wire cost of each operation, and the operation being drawn */
+static struct ili9488_stats g_stats[ILI9488_OP_COUNT];
+static enum ili9488_op g_stats_op;
+/* Driver calls in progress, the outer one included */
+static uint32_t g_ul_stats_depth;
+#ifdef ILI9488_XDMAC_ENABLED
+/* Operation that queued the last transfer */
+static enum ili9488_op g_stats_op_queued;
+#endif
+
+static const char *const g_stats_names[ILI9488_OP_COUNT] = {
+	"other", "init", "fill", "pixel", "line", "rectangle",
+	"filled_rectangle", "circle", "filled_circle", "string", "pixmap"
+};
+
+#  define ILI9488_STATS_ADD(field, n)  (g_stats[g_stats_op].field += (n))
+/* A busy wait, timed with the DWT cycle counter */
+#  define ILI9488_STATS_WAIT_BEGIN()   uint32_t ul_wait_start = DWT->CYCCNT
+#  define ILI9488_STATS_WAIT_END()     ILI9488_STATS_ADD(ul_busy_cycles, DWT->CYCCNT - ul_wait_start)
+/* Charge what follows to op, unless called from another driver call */
+#  define ILI9488_STATS_ENTER(op)      enum ili9488_op stats_outer = ili9488_stats_enter(op)
+#  define ILI9488_STATS_LEAVE()        (g_ul_stats_depth--, g_stats_op = stats_outer)
+#  define ILI9488_STATS_QUEUED()       (g_stats_op_queued = g_stats_op)
+/* Outside the driver calls, charge what follows to the operation that queued the last transfer */
+#  define ILI9488_STATS_WAIT_QUEUED()  enum ili9488_op stats_outer = ili9488_stats_wait_queued()
+#  define ILI9488_STATS_WAIT_DONE()    (g_stats_op = stats_outer)
+#else
+#  define ILI9488_STATS_ADD(field, n)
+#  define ILI9488_STATS_WAIT_BEGIN()
+#  define ILI9488_STATS_WAIT_END()
+#  define ILI9488_STATS_ENTER(op)
+#  define ILI9488_STATS_LEAVE()
+#  define ILI9488_STATS_QUEUED()
+#  define ILI9488_STATS_WAIT_QUEUED()
+#  define ILI9488_STATS_WAIT_DONE()
+#endif
+
 /* Global variable describing the font size used by the driver */
 const struct ili9488_font gfont = {10, 14};
 /**
@@ -328,6 +411,21 @@ static void ili9488_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t u
 	LCD_MULTI_WD(p_ul_buf, ul_size);
 }
 
+/**
+ * \brief Write the same buffer several times in a row to LCD controller.
+ *
+ * \param p_ul_buf data buffer.
+ * \param ul_size size of the buffer.
+ * \param ul_count number of times the buffer is sent.
+ */
+static void ili9488_write_ram_buffer_repeat(const ili9488_color_t *p_ul_buf,
+		uint32_t ul_size, uint32_t ul_count)
+{
+	while (ul_count--) {
+		ili9488_write_ram_buffer(p_ul_buf, ul_size);
+	}
+}
+
 /**
  * \brief Write data to LCD Register.
  *
@@ -388,15 +486,265 @@ static uint32_t ili9488_read_chipid(void)
 }
 #endif
 #ifdef ILI9488_SPIMODE
+#ifdef ILI9488_STATS_ENABLED
+/**
+ * \brief Make op the operation charged for the transfers, unless a driver
+ * call is already in progress.
+ *
+ * \return the operation charged until now, to restore when op is done.
+ */
+static enum ili9488_op ili9488_stats_enter(enum ili9488_op op)
+{
+	enum ili9488_op outer = g_stats_op;
+
+	if (g_ul_stats_depth++ == 0) {
+		g_stats_op = op;
+		g_stats[op].ul_calls++;
+	}
+	return outer;
+}
+
+#ifdef ILI9488_XDMAC_ENABLED
+/**
+ * \brief Make the operation that queued the last transfer the one charged,
+ * unless a driver call is in progress.
+ *
+ * A wait for the queue between two primitives is part of the cost of the
+ * one that queued the transfers, not a call of its own.
+ *
+ * \return the operation charged until now, to restore after the wait.
+ */
+static enum ili9488_op ili9488_stats_wait_queued(void)
+{
+	enum ili9488_op outer = g_stats_op;
+
+	if (g_ul_stats_depth == 0) {
+		g_stats_op = g_stats_op_queued;
+	}
+	return outer;
+}
+#endif
+#endif
+
+#ifdef ILI9488_XDMAC_ENABLED
+/**
+ * \brief Wait until the last byte has left the SPI shifter.
+ *
+ * \note From the XDMAC interrupt the wait is charged to the operation being
+ * drawn at that time.
+ */
+static void ili9488_wait_tx_empty(void)
+{
+	ILI9488_STATS_WAIT_BEGIN();
+	while (!spi_is_tx_empty(BOARD_ILI9488_SPI)) {
+	}
+	ILI9488_STATS_WAIT_END();
+}
+
+/**
+ * \brief Clean the data cache lines covering a buffer about to be read by the XDMAC.
+ *
+ * \param p_buf buffer address.
+ * \param ul_size buffer size in bytes.
+ */
+static void ili9488_dma_clean_dcache(const void *p_buf, uint32_t ul_size)
+{
+#ifdef CONF_BOARD_ENABLE_CACHE
+	uint32_t ul_addr = (uint32_t)p_buf & ~31u;
+	uint32_t ul_end = (uint32_t)p_buf + ul_size;
+
+	/* Flash content is never dirty */
+	if ((uint32_t)p_buf < IRAM_ADDR) {
+		return;
+	}
+
+	__DSB();
+	while (ul_addr < ul_end) {
+		SCB->DCCMVAC = ul_addr;
+		ul_addr += 32;
+	}
+	__DSB();
+	__ISB();
+#else
+	UNUSED(p_buf);
+	UNUSED(ul_size);
+#endif
+}
+
+/**
+ * \brief Start the transfer at the tail of the queue.
+ *
+ * Command-only entries are sent right away; the first entry with a data
+ * phase is handed to the XDMAC and the function returns. When the queue is
+ * empty the driver goes idle and the transfer callback is called.
+ *
+ * \note Must be called with interrupts disabled or from the XDMAC interrupt.
+ */
+static void ili9488_dma_start(void)
+{
+	struct ili9488_dma_xfer *p_xfer;
+	xdmac_channel_config_t cfg;
+
+	while (g_ul_dma_tail != g_ul_dma_head) {
+		p_xfer = &g_dma_queue[g_ul_dma_tail & (ILI9488_XDMAC_QUEUE_SIZE - 1)];
+
+		/* Let the last byte leave the shifter before moving the CDS line */
+		ili9488_wait_tx_empty();
+
+		if (p_xfer->us_cmd != ILI9488_DMA_NO_CMD) {
+			pio_set_pin_low(LCD_SPI_CDS_PIO);
+			spi_write_single(BOARD_ILI9488_SPI, (uint8_t)p_xfer->us_cmd);
+			ili9488_wait_tx_empty();
+		}
+
+		if (p_xfer->ul_size > 0) {
+			pio_set_pin_high(LCD_SPI_CDS_PIO);
+			ili9488_dma_clean_dcache(p_xfer->p_data, p_xfer->ul_size);
+
+			cfg.mbr_ubc = p_xfer->ul_size;
+			cfg.mbr_sa = (uint32_t)p_xfer->p_data;
+			cfg.mbr_da = (uint32_t)&BOARD_ILI9488_SPI->SPI_TDR;
+			cfg.mbr_cfg = XDMAC_CC_TYPE_PER_TRAN |
+					XDMAC_CC_MBSIZE_SINGLE |
+					XDMAC_CC_DSYNC_MEM2PER |
+					XDMAC_CC_CSIZE_CHK_1 |
+					XDMAC_CC_DWIDTH_BYTE |
+					XDMAC_CC_SIF_AHB_IF0 |
+					XDMAC_CC_DIF_AHB_IF1 |
+					XDMAC_CC_DAM_FIXED_AM |
+					XDMAC_CC_PERID(XDMAC_CHANNEL_HWID_SPI0_TX);
+			cfg.mbr_bc = p_xfer->ul_repeat - 1;
+			cfg.mbr_ds = 0;
+			cfg.mbr_dus = 0;
+			if (p_xfer->ul_repeat > 1) {
+				/* Rewind the source after each microblock */
+				cfg.mbr_cfg |= XDMAC_CC_SAM_UBS_AM;
+				cfg.mbr_sus = -(int32_t)p_xfer->ul_size;
+			} else {
+				cfg.mbr_cfg |= XDMAC_CC_SAM_INCREMENTED_AM;
+				cfg.mbr_sus = 0;
+			}
+
+			xdmac_configure_transfer(XDMAC, ILI9488_XDMAC_CHANNEL, &cfg);
+			xdmac_channel_enable_interrupt(XDMAC, ILI9488_XDMAC_CHANNEL, XDMAC_CIE_BIE);
+			xdmac_channel_enable(XDMAC, ILI9488_XDMAC_CHANNEL);
+			return;
+		}
+
+		g_ul_dma_tail++;
+	}
+
+	g_b_dma_busy = false;
+	if (g_dma_callback) {
+		g_dma_callback();
+	}
+}
+
+/**
+ * \brief Queue a transfer to the LCD, blocking only while the queue is full.
+ *
+ * \param us_cmd command byte or ILI9488_DMA_NO_CMD.
+ * \param p_data data phase buffer; small parameter blocks are copied, bigger
+ * buffers must stay valid until ili9488_wait_for_idle() returns, or
+ * ili9488_dma_wait_mark() for a mark taken after this call.
+ * \param ul_size data phase size in bytes.
+ * \param ul_repeat number of times the data phase is sent.
+ */
+static void ili9488_dma_enqueue(uint16_t us_cmd, const ili9488_color_t *p_data,
+		uint32_t ul_size, uint32_t ul_repeat)
+{
+	struct ili9488_dma_xfer *p_xfer;
+	irqflags_t flags;
+
+	if ((us_cmd == ILI9488_DMA_NO_CMD) && ((ul_size == 0) || (ul_repeat == 0))) {
+		return;
+	}
+	if (ul_repeat == 0) {
+		ul_size = 0;
+		ul_repeat = 1;
+	}
+
+	ILI9488_STATS_WAIT_BEGIN();
+	while ((g_ul_dma_head - g_ul_dma_tail) >= ILI9488_XDMAC_QUEUE_SIZE) {
+	}
+	ILI9488_STATS_WAIT_END();
+
+	p_xfer = &g_dma_queue[g_ul_dma_head & (ILI9488_XDMAC_QUEUE_SIZE - 1)];
+	p_xfer->us_cmd = us_cmd;
+	p_xfer->ul_size = ul_size;
+	p_xfer->ul_repeat = ul_repeat;
+	if ((ul_size <= ILI9488_DMA_INLINE_SIZE) && (ul_repeat == 1)) {
+		memcpy(p_xfer->inline_data, p_data, ul_size);
+		p_xfer->p_data = p_xfer->inline_data;
+	} else {
+		p_xfer->p_data = p_data;
+	}
+
+	ILI9488_STATS_QUEUED();
+	flags = cpu_irq_save();
+	g_ul_dma_head++;
+	if (!g_b_dma_busy) {
+		g_b_dma_busy = true;
+		ili9488_dma_start();
+	}
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Mark of the transfers queued so far, for ili9488_dma_wait_mark().
+ */
+static uint32_t ili9488_dma_mark(void)
+{
+	return g_ul_dma_head;
+}
+
+/**
+ * \brief Wait until the transfers queued before a mark have been sent.
+ *
+ * Their buffers can then be reused, while the transfers queued after the
+ * mark are still in flight.
+ *
+ * \param ul_mark value of ili9488_dma_mark() after the last of them.
+ */
+static void ili9488_dma_wait_mark(uint32_t ul_mark)
+{
+	ILI9488_STATS_WAIT_BEGIN();
+	while ((int32_t)(g_ul_dma_tail - ul_mark) < 0) {
+	}
+	ILI9488_STATS_WAIT_END();
+}
+
+/**
+ * \brief XDMAC interrupt handler: a data phase is complete, start the next one.
+ */
+void XDMAC_Handler(void)
+{
+	uint32_t ul_status;
+
+	ul_status = xdmac_channel_get_interrupt_status(XDMAC, ILI9488_XDMAC_CHANNEL);
+	if (ul_status & XDMAC_CIS_BIS) {
+		g_ul_dma_tail++;
+		ili9488_dma_start();
+	}
+}
+#endif
+
 /**
  * \brief Prepare to write GRAM data.
  */
 static void ili9488_write_ram_prepare(void)
 {
+	ILI9488_STATS_ADD(ul_commands, 1);
+#ifdef ILI9488_XDMAC_ENABLED
+	ili9488_dma_enqueue(ILI9488_CMD_MEMORY_WRITE, NULL, 0, 1);
+#else
 	volatile uint32_t i;
+	ILI9488_STATS_WAIT_BEGIN();
 	pio_set_pin_low(LCD_SPI_CDS_PIO);
 	spi_write(BOARD_ILI9488_SPI, ILI9488_CMD_MEMORY_WRITE, BOARD_ILI9488_SPI_NPCS, 0);
 	for(i = 0; i < 0xFF; i++);
+	ILI9488_STATS_WAIT_END();
+#endif
 }
 
 /**
@@ -406,8 +754,12 @@ static void ili9488_write_ram_prepare(void)
  */
 static void ili9488_write_ram(ili9488_color_t ul_color)
 {
+	ILI9488_STATS_ADD(ul_data_bytes, 1);
+	ili9488_wait_for_idle();
+	ILI9488_STATS_WAIT_BEGIN();
 	pio_set_pin_high(LCD_SPI_CDS_PIO);
 	spi_write(BOARD_ILI9488_SPI, ul_color, BOARD_ILI9488_SPI_NPCS, 0);
+	ILI9488_STATS_WAIT_END();
 }
 
 /**
@@ -418,10 +770,37 @@ static void ili9488_write_ram(ili9488_color_t ul_color)
  */
 static void ili9488_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t ul_size)
 {
+	ILI9488_STATS_ADD(ul_data_bytes, ul_size);
+#ifdef ILI9488_XDMAC_ENABLED
+	ili9488_dma_enqueue(ILI9488_DMA_NO_CMD, p_ul_buf, ul_size, 1);
+#else
 	volatile uint32_t i;
+	ILI9488_STATS_WAIT_BEGIN();
 	pio_set_pin_high(LCD_SPI_CDS_PIO);
 	spi_write_packet(BOARD_ILI9488_SPI, p_ul_buf, ul_size);
 	for(i = 0; i < 0xFF; i++);
+	ILI9488_STATS_WAIT_END();
+#endif
+}
+
+/**
+ * \brief Write the same buffer several times in a row to LCD controller.
+ *
+ * \param p_ul_buf data buffer.
+ * \param ul_size size of the buffer.
+ * \param ul_count number of times the buffer is sent.
+ */
+static void ili9488_write_ram_buffer_repeat(const ili9488_color_t *p_ul_buf,
+		uint32_t ul_size, uint32_t ul_count)
+{
+#ifdef ILI9488_XDMAC_ENABLED
+	ILI9488_STATS_ADD(ul_data_bytes, ul_size * ul_count);
+	ili9488_dma_enqueue(ILI9488_DMA_NO_CMD, p_ul_buf, ul_size, ul_count);
+#else
+	while (ul_count--) {
+		ili9488_write_ram_buffer(p_ul_buf, ul_size);
+	}
+#endif
 }
 
 /**
@@ -433,7 +812,13 @@ static void ili9488_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t u
  */
 static void ili9488_write_register(uint8_t uc_reg, const ili9488_color_t *us_data, uint32_t size)
 {
+	ILI9488_STATS_ADD(ul_commands, 1);
+	ILI9488_STATS_ADD(ul_data_bytes, size);
+#ifdef ILI9488_XDMAC_ENABLED
+	ili9488_dma_enqueue(uc_reg, us_data, size, 1);
+#else
 	volatile uint32_t i;
+	ILI9488_STATS_WAIT_BEGIN();
 
 	/* Transfer cmd */
 	pio_set_pin_low(LCD_SPI_CDS_PIO);
@@ -446,6 +831,8 @@ static void ili9488_write_register(uint8_t uc_reg, const ili9488_color_t *us_dat
 		spi_write_packet(BOARD_ILI9488_SPI, us_data, size);
 		for(i = 0; i < 0x5F; i++);
 	}
+	ILI9488_STATS_WAIT_END();
+#endif
 }
 
 /**
@@ -460,6 +847,7 @@ static uint32_t ili9488_read_ram(void)
 {
 	uint8_t grambuf[4];
 	ili9488_write_register(ILI9488_CMD_MEMORY_READ, 0x0000, 0);
+	ili9488_wait_for_idle();
 
 	pio_set_pin_high(LCD_SPI_CDS_PIO);
 	spi_read_packet(BOARD_ILI9488_SPI, grambuf, 4);
@@ -485,6 +873,7 @@ static uint32_t ili9488_read_chipid(void)
 		reg++;
 		for(j = 0; j < 0xFF; j++);
 		ili9488_write_register(ILI9488_CMD_READ_ID4, 0, 0);
+		ili9488_wait_for_idle();
 		{
 			pio_set_pin_high(LCD_SPI_CDS_PIO);
 			spi_read_packet(BOARD_ILI9488_SPI, &chipidBuf, 1);
@@ -560,12 +949,14 @@ static void ili9488_check_box_coordinates(uint32_t *p_ul_x1, uint32_t *p_ul_y1,
 void ili9488_set_display_direction(enum ili9488_display_direction direction )
 {
 	ili9488_color_t value;
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	if(direction) {
 		value = 0xE8;
 	} else {
 		value = 0x48;
 	}
 	ili9488_write_register(ILI9488_CMD_MEMORY_ACCESS_CONTROL, &value, 1);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -581,6 +972,7 @@ void ili9488_set_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height
 	uint16_t col_start, col_end, row_start, row_end;
 	uint32_t cnt = 0;
 	ili9488_color_t buf[4];
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 
 	cnt = sizeof(buf)/sizeof(ili9488_color_t);
 
@@ -590,6 +982,8 @@ void ili9488_set_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height
 	row_start = y ;
 	row_end   = height + y - 1;
 
+	ILI9488_STATS_ADD(ul_windows, 1);
+
 	buf[0] = get_8b_to_16b(col_start);
 	buf[1] = get_0b_to_8b(col_start);
 	buf[2] = get_8b_to_16b(col_end);
@@ -604,6 +998,7 @@ void ili9488_set_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height
 	buf[3] = get_0b_to_8b(row_end);
 	ili9488_write_register(ILI9488_CMD_PAGE_ADDRESS_SET, buf, cnt);
 	ili9488_write_register(ILI9488_CMD_NOP, 0, 0);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -621,6 +1016,10 @@ uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
 {
 	ili9488_color_t param;
 	uint32_t chipid;
+#ifdef ILI9488_STATS_ENABLED
+	ili9488_stats_reset();
+#endif
+	ILI9488_STATS_ENTER(ILI9488_OP_INIT);
 #ifdef ILI9488_EBIMODE
 	/* Enable peripheral clock */
 	pmc_enable_periph_clk(ID_SMC);
@@ -660,6 +1059,15 @@ uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
 	spi_enable(BOARD_ILI9488_SPI);
 	spi_enable_interrupt(BOARD_ILI9488_SPI, SPI_IER_RDRF);
 #endif
+#ifdef ILI9488_XDMAC_ENABLED
+	/* XDMAC channel feeding the SPI transmitter */
+	pmc_enable_periph_clk(ID_XDMAC);
+	xdmac_channel_disable(XDMAC, ILI9488_XDMAC_CHANNEL);
+	xdmac_enable_interrupt(XDMAC, ILI9488_XDMAC_CHANNEL);
+	NVIC_ClearPendingIRQ(XDMAC_IRQn);
+	NVIC_SetPriority(XDMAC_IRQn, 1);
+	NVIC_EnableIRQ(XDMAC_IRQn);
+#endif
 
 	ili9488_write_register(ILI9488_CMD_SOFTWARE_RESET, 0x0000, 0);
 	ili9488_delay(200);
@@ -670,6 +1078,7 @@ uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
 	/** read chipid */
 	chipid = ili9488_read_chipid();
 	if (chipid != ILI9488_DEVICE_CODE) {
+		ILI9488_STATS_LEAVE();
 		return 1;
 	}
 
@@ -705,8 +1114,10 @@ uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
 
 	ili9488_set_window(0, 0,p_opt->ul_width,p_opt->ul_height);
 	ili9488_set_foreground_color(p_opt->foreground_color);
+	ili9488_set_background_color(p_opt->background_color);
 	ili9488_set_cursor_position(0, 0);
 
+	ILI9488_STATS_LEAVE();
 	return 0;
 }
 
@@ -715,7 +1126,9 @@ uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
  */
 void ili9488_display_on(void)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	ili9488_write_register(ILI9488_CMD_DISPLAY_ON, 0, 0);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -723,7 +1136,9 @@ void ili9488_display_on(void)
  */
 void ili9488_display_off(void)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	ili9488_write_register(ILI9488_CMD_DISPLAY_OFF, 0x00, 0);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -734,6 +1149,10 @@ void ili9488_display_off(void)
 void ili9488_set_foreground_color(uint32_t ul_color)
 {
 	uint32_t i;
+
+	/* Queued fills may still be reading the cache */
+	ili9488_wait_for_idle();
+	g_ul_foreground_color = ul_color;
 #ifdef ILI9488_EBIMODE
 	/* Fill the cache with selected color */
 	for (i = 0; i < LCD_DATA_CACHE_SIZE; ++i) {
@@ -749,6 +1168,16 @@ void ili9488_set_foreground_color(uint32_t ul_color)
 #endif
 }
 
+/**
+ * \brief Set background color, used to fill the cells of the text functions.
+ *
+ * \param ul_color background color.
+ */
+void ili9488_set_background_color(uint32_t ul_color)
+{
+	g_ul_background_color = ul_color;
+}
+
 /**
  * \brief Fill the LCD buffer with the specified color.
  *
@@ -757,6 +1186,7 @@ void ili9488_set_foreground_color(uint32_t ul_color)
 void ili9488_fill(ili9488_color_t ul_color)
 {
 	uint32_t dw;
+	ILI9488_STATS_ENTER(ILI9488_OP_FILL);
 
 	ili9488_set_cursor_position(0, 0);
 	ili9488_write_ram_prepare();
@@ -764,6 +1194,7 @@ void ili9488_fill(ili9488_color_t ul_color)
 	for (dw = ILI9488_LCD_WIDTH * ILI9488_LCD_HEIGHT; dw > 0; dw--) {
 		ili9488_write_ram(ul_color);
 	}
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -778,8 +1209,10 @@ void ili9488_set_cursor_position(uint16_t x, uint16_t y)
 	uint32_t cnt = 0;
 
 	ili9488_color_t buf[4];
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	cnt = sizeof(buf)/sizeof(ili9488_color_t);
 
+	ILI9488_STATS_ADD(ul_windows, 1);
 	buf[0] = get_8b_to_16b(x);
 	buf[1] = get_0b_to_8b(x);
 	buf[2] = get_8b_to_16b(x);
@@ -795,6 +1228,7 @@ void ili9488_set_cursor_position(uint16_t x, uint16_t y)
 	buf[3] = get_0b_to_8b(y);
 	ili9488_write_register(ILI9488_CMD_PAGE_ADDRESS_SET, buf, cnt);
 	ili9488_write_register(ILI9488_CMD_NOP, 0, 0);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -808,6 +1242,7 @@ void ili9488_scroll(uint16_t ul_tfa, uint16_t ul_vsa, uint16_t ul_bfa)
 {
 	uint32_t cnt = 0;
 	ili9488_color_t buf[6];
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 
 	cnt = sizeof(buf)/sizeof(ili9488_color_t);
 
@@ -821,6 +1256,7 @@ void ili9488_scroll(uint16_t ul_tfa, uint16_t ul_vsa, uint16_t ul_bfa)
 	buf[5] = get_0b_to_8b(ul_bfa);
 
 	ili9488_write_register(ILI9488_CMD_VERT_SCROLL_DEFINITION, buf, cnt);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -833,11 +1269,13 @@ void ili9488_set_scroll_address(uint16_t ul_vsp)
 	uint32_t cnt = 0;
 
 	ili9488_color_t buf[2];
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	cnt = sizeof(buf)/sizeof(ili9488_color_t);
 
 	buf[0] = get_8b_to_16b(ul_vsp);
 	buf[1] = get_0b_to_8b(ul_vsp);
 	ili9488_write_register(ILI9488_CMD_VERT_SCROLL_START_ADDRESS, buf, cnt);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -853,6 +1291,7 @@ uint32_t ili9488_draw_pixel(uint32_t ul_x, uint32_t ul_y)
 	if ((ul_x >= ILI9488_LCD_WIDTH) || (ul_y >= ILI9488_LCD_HEIGHT)) {
 		return 1;
 	}
+	ILI9488_STATS_ENTER(ILI9488_OP_PIXEL);
 
 	/* Set cursor */
 	ili9488_set_cursor_position(ul_x, ul_y);
@@ -860,6 +1299,7 @@ uint32_t ili9488_draw_pixel(uint32_t ul_x, uint32_t ul_y)
 	/* Prepare to write in GRAM */
 	ili9488_write_ram_prepare();
 	ili9488_write_ram_buffer(g_ul_pixel_cache, LCD_DATA_COLOR_UNIT);
+	ILI9488_STATS_LEAVE();
 	return 0;
 }
 
@@ -958,11 +1398,14 @@ static void ili9488_draw_line_bresenham(uint32_t ul_x1, uint32_t ul_y1,
 void ili9488_draw_line(uint32_t ul_x1, uint32_t ul_y1,
 		uint32_t ul_x2, uint32_t ul_y2)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_LINE);
+
 	if ((ul_y1 == ul_y2) || (ul_x1 == ul_x2)) {
 		ili9488_draw_filled_rectangle(ul_x1, ul_y1, ul_x2, ul_y2);
 	} else {
 		ili9488_draw_line_bresenham(ul_x1, ul_y1, ul_x2, ul_y2);
 	}
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -976,6 +1419,8 @@ void ili9488_draw_line(uint32_t ul_x1, uint32_t ul_y1,
 void ili9488_draw_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 		uint32_t ul_x2, uint32_t ul_y2)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_RECTANGLE);
+
 	ili9488_check_box_coordinates(&ul_x1, &ul_y1, &ul_x2, &ul_y2);
 
 	ili9488_draw_filled_rectangle(ul_x1, ul_y1, ul_x2, ul_y1);
@@ -983,6 +1428,7 @@ void ili9488_draw_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 
 	ili9488_draw_filled_rectangle(ul_x1, ul_y1, ul_x1, ul_y2);
 	ili9488_draw_filled_rectangle(ul_x2, ul_y1, ul_x2, ul_y2);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -997,6 +1443,7 @@ void ili9488_draw_filled_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 		uint32_t ul_x2, uint32_t ul_y2)
 {
 	uint32_t size, blocks;
+	ILI9488_STATS_ENTER(ILI9488_OP_FILLED_RECTANGLE);
 
 	/* Swap coordinates if necessary */
 	ili9488_check_box_coordinates(&ul_x1, &ul_y1, &ul_x2, &ul_y2);
@@ -1010,16 +1457,14 @@ void ili9488_draw_filled_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 	size = (ul_x2 - ul_x1 + 1) * (ul_y2 - ul_y1 + 1);
 	/* Send pixels blocks => one SPI IT / block */
 	blocks = size / LCD_DATA_CACHE_SIZE;
-	while (blocks--) {
-		ili9488_write_ram_buffer(g_ul_pixel_cache, LCD_DATA_CACHE_SIZE * LCD_DATA_COLOR_UNIT);
-	}
+	ili9488_write_ram_buffer_repeat(g_ul_pixel_cache, LCD_DATA_CACHE_SIZE * LCD_DATA_COLOR_UNIT, blocks);
 
 	/* Send remaining pixels */
 	ili9488_write_ram_buffer(g_ul_pixel_cache, (size % LCD_DATA_CACHE_SIZE) * LCD_DATA_COLOR_UNIT);
 
 	/* Reset the refresh window area */
 	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
-
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -1040,6 +1485,7 @@ uint32_t ili9488_draw_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 	if (ul_r == 0) {
 		return 1;
 	}
+	ILI9488_STATS_ENTER(ILI9488_OP_CIRCLE);
 
 	d = 3 - (ul_r << 1);
 	curX = 0;
@@ -1064,6 +1510,7 @@ uint32_t ili9488_draw_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 		curX++;
 	}
 
+	ILI9488_STATS_LEAVE();
 	return 0;
 }
 
@@ -1086,6 +1533,7 @@ uint32_t ili9488_draw_filled_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 	if (ul_r == 0) {
 		return 1;
 	}
+	ILI9488_STATS_ENTER(ILI9488_OP_FILLED_CIRCLE);
 
 	d = 3 - (ul_r << 1);
 	dwCurX = 0;
@@ -1111,6 +1559,7 @@ uint32_t ili9488_draw_filled_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 		dwCurX++;
 	}
 
+	ILI9488_STATS_LEAVE();
 	return 0;
 }
 
@@ -1136,64 +1585,135 @@ void ili9488_draw_prepare(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 }
 
 /**
- * \brief Draw an ASCII character on LCD.
+ * \brief Store one pixel in a buffer, in the LCD format.
+ *
+ * \param p_buf destination.
+ * \param ul_color pixel color.
  *
- * \param ul_x X coordinate of character upper-left corner.
- * \param ul_y Y coordinate of character upper-left corner.
- * \param uc_c character to print.
+ * \return position right after the pixel.
  */
-static void ili9488_draw_char(uint32_t ul_x, uint32_t ul_y, uint8_t uc_c)
+static inline ili9488_color_t *ili9488_put_color(ili9488_color_t *p_buf, uint32_t ul_color)
 {
-	uint32_t row, col;
-	uint32_t offset, offset0, offset1;
+#ifdef ILI9488_EBIMODE
+	*p_buf++ = ul_color;
+#endif
+#ifdef ILI9488_SPIMODE
+	*p_buf++ = ul_color >> 16;
+	*p_buf++ = ul_color >> 8;
+	*p_buf++ = ul_color & 0xFF;
+#endif
+	return p_buf;
+}
 
-	/* Compute offset according of the specified ASCII character */
-	/* Note: the first 32 characters of the ASCII table are not handled */
-	offset = ((uint32_t)uc_c - 0x20) * 20;
+/**
+ * \brief Draw one line of text (no newline) on LCD.
+ *
+ * The whole line is written through a single window, row by row, with the
+ * foreground color for the set bits of the charset and the background color
+ * for the rest of each character cell (including the 2 pixels spacing).
+ *
+ * \param ul_x X coordinate of the line top-left corner.
+ * \param ul_y Y coordinate of the line top-left corner.
+ * \param p_str first character of the line.
+ * \param ul_len number of characters in the line.
+ */
+static void ili9488_draw_text_line(uint32_t ul_x, uint32_t ul_y,
+		const uint8_t *p_str, uint32_t ul_len)
+{
+	uint32_t ul_cell = gfont.width + 2;
+	uint32_t ul_width, ul_height;
+	uint32_t row, col, i;
+	uint32_t offset;
+	uint8_t uc_bits;
+	ili9488_color_t *p_buf;
+
+	if ((ul_len == 0) || (ul_x >= ILI9488_LCD_WIDTH) || (ul_y >= ILI9488_LCD_HEIGHT)) {
+		return;
+	}
 
-	for (col = 0; col < 10; col++) {
-		/* Compute the first and second byte offset of a column */
-		offset0 = offset + col * 2;
-		offset1 = offset0 + 1;
+	/* Drop the characters that do not fit on the line */
+	if (ul_x + ul_len * ul_cell - 2 > ILI9488_LCD_WIDTH) {
+		ul_len = (ILI9488_LCD_WIDTH - ul_x + 2) / ul_cell;
+		if (ul_len == 0) {
+			return;
+		}
+	}
+	ul_width = ul_len * ul_cell - 2;
+
+	ul_height = gfont.height;
+	if (ul_y + ul_height > ILI9488_LCD_HEIGHT) {
+		ul_height = ILI9488_LCD_HEIGHT - ul_y;
+	}
+
+	ili9488_set_window(ul_x, ul_y, ul_width, ul_height);
+	ili9488_write_ram_prepare();
 
-		/* Draw pixel on screen depending on the corresponding bit value from the charset */
-		for (row = 0; row < 8; row++) {
-			if ((p_uc_charset10x14[offset0] >> (7 - row)) & 0x1) {
-				ili9488_draw_pixel(ul_x + col, ul_y + row);
+	for (row = 0; row < ul_height; row++) {
+#ifdef ILI9488_XDMAC_ENABLED
+		/* Only the row that last used this buffer must be sent; the other one stays in flight */
+		ili9488_dma_wait_mark(g_ul_text_row_mark[row & 1]);
+#endif
+		p_buf = g_ul_text_row[row & 1];
+
+		for (i = 0; i < ul_len; i++) {
+			/* Note: the first 32 characters of the ASCII table are not handled */
+			offset = ((uint32_t)p_str[i] - 0x20) * 20;
+			/* Each column is coded on 2 bytes: rows 0-7, then rows 8-13 */
+			offset += (row < 8) ? 0 : 1;
+
+			for (col = 0; col < gfont.width; col++) {
+				uc_bits = p_uc_charset10x14[offset + col * 2];
+				if ((uc_bits >> (7 - (row & 7))) & 0x1) {
+					p_buf = ili9488_put_color(p_buf, g_ul_foreground_color);
+				} else {
+					p_buf = ili9488_put_color(p_buf, g_ul_background_color);
+				}
 			}
-		}
 
-		for (row = 0; row < 6; row++) {
-			if ((p_uc_charset10x14[offset1] >> (7 - row)) & 0x1) {
-				ili9488_draw_pixel(ul_x + col, ul_y + row + 8);
+			if (i < ul_len - 1) {
+				p_buf = ili9488_put_color(p_buf, g_ul_background_color);
+				p_buf = ili9488_put_color(p_buf, g_ul_background_color);
 			}
 		}
+
+		ili9488_write_ram_buffer(g_ul_text_row[row & 1], ul_width * LCD_DATA_COLOR_UNIT);
+#ifdef ILI9488_XDMAC_ENABLED
+		g_ul_text_row_mark[row & 1] = ili9488_dma_mark();
+#endif
 	}
+
+	/* Reset the refresh window area */
+	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
 }
 
 /**
  * \brief Draw a string on LCD.
  *
+ * Characters are drawn opaque: the background color fills the character
+ * cells, so the area does not need to be cleared first.
+ *
  * \param ul_x X coordinate of string top-left corner.
  * \param ul_y Y coordinate of string top-left corner.
  * \param p_str String to display.
  */
 void ili9488_draw_string(uint32_t ul_x, uint32_t ul_y, const uint8_t *p_str)
 {
-	uint32_t xorg = ul_x;
-
-	while (*p_str != 0) {
-		/* If newline, jump to the next line (font height + 2) */
-		if (*p_str == '\n') {
+	const uint8_t *p_line = p_str;
+	ILI9488_STATS_ENTER(ILI9488_OP_STRING);
+
+	while (1) {
+		/* A newline jumps to the next line (font height + 2) */
+		if ((*p_str == '\n') || (*p_str == 0)) {
+			ili9488_draw_text_line(ul_x, ul_y, p_line, p_str - p_line);
+			if (*p_str == 0) {
+				break;
+			}
 			ul_y += gfont.height + 2;
-			ul_x = xorg;
-		} else {
-			/* Draw the character and place cursor right after (font width + 2) */
-			ili9488_draw_char(ul_x, ul_y, *p_str);
-			ul_x += gfont.width + 2;
+			p_line = p_str + 1;
 		}
 		p_str++;
 	}
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -1214,6 +1734,7 @@ void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 	dwY1 = ul_y;
 	dwX2 = ul_x + ul_width - 1;
 	dwY2 = ul_y + ul_height - 1;
+	ILI9488_STATS_ENTER(ILI9488_OP_PIXMAP);
 
 	/* Swap coordinates if necessary */
 	ili9488_check_box_coordinates(&dwX1, &dwY1, &dwX2, &dwY2);
@@ -1221,14 +1742,104 @@ void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 	/* Determine the refresh window area */
 	ili9488_set_window(dwX1, dwY1, (dwX2 - dwX1 + 1), (dwY2 - dwY1 + 1));
 
-	size = (dwX2 - dwX1) * (dwY2 - dwY1);
+	size = (dwX2 - dwX1 + 1) * (dwY2 - dwY1 + 1);
 
 	ili9488_write_register(ILI9488_CMD_MEMORY_WRITE, p_ul_pixmap, size * LCD_DATA_COLOR_UNIT);
 
 	/* Reset the refresh window area */
 	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
+	ILI9488_STATS_LEAVE();
+}
+
+/**
+ * \brief Check whether LCD transfers are still in progress.
+ *
+ * \return true while queued transfers are being sent to the LCD.
+ */
+bool ili9488_is_busy(void)
+{
+#ifdef ILI9488_XDMAC_ENABLED
+	return g_b_dma_busy;
+#else
+	return false;
+#endif
+}
+
+/**
+ * \brief Wait until every queued transfer has been sent to the LCD.
+ *
+ * Buffers handed to the drawing functions can be reused after this call.
+ */
+void ili9488_wait_for_idle(void)
+{
+#ifdef ILI9488_XDMAC_ENABLED
+	ILI9488_STATS_WAIT_QUEUED();
+	ILI9488_STATS_WAIT_BEGIN();
+	while (g_b_dma_busy) {
+	}
+	ILI9488_STATS_WAIT_END();
+	/* Last byte still in the shifter */
+	ili9488_wait_tx_empty();
+	ILI9488_STATS_WAIT_DONE();
+#endif
 }
 
+/**
+ * \brief Set the function called when all queued transfers are done.
+ *
+ * \note With the XDMAC enabled the callback runs in interrupt context.
+ * In polled mode every call returns after its transfer, so the callback is
+ * never used.
+ *
+ * \param callback function to call, or NULL.
+ */
+void ili9488_set_transfer_callback(ili9488_callback_t callback)
+{
+#ifdef ILI9488_XDMAC_ENABLED
+	g_dma_callback = callback;
+#else
+	UNUSED(callback);
+#endif
+}
+
+#ifdef ILI9488_STATS_ENABLED
+/**
+ * \brief Clear the wire cost of every operation and start the cycle counter.
+ */
+void ili9488_stats_reset(void)
+{
+	memset(g_stats, 0, sizeof(g_stats));
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * \brief Get the wire cost of an operation since ili9488_stats_reset().
+ *
+ * \param op operation.
+ * \param p_stats where the counters are copied.
+ */
+void ili9488_stats_get(enum ili9488_op op, struct ili9488_stats *p_stats)
+{
+	Assert(op < ILI9488_OP_COUNT);
+	*p_stats = g_stats[op];
+}
+
+/**
+ * \brief Get the name of an operation, for reports.
+ *
+ * \param op operation.
+ *
+ * \return lower case name, such as "filled_rectangle".
+ */
+const char *ili9488_stats_name(enum ili9488_op op)
+{
+	Assert(op < ILI9488_OP_COUNT);
+	return g_stats_names[op];
+}
+#endif
+
 /**
  * \brief Set display brightness
  *
@@ -1238,7 +1849,9 @@ void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
  */
 void ili9488_write_brightness(uint16_t us_value)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	ili9488_write_register(ILI9488_CMD_WRITE_DISPLAY_BRIGHTNESS, (ili9488_color_t *)&us_value, 1);
+	ILI9488_STATS_LEAVE();
 }
 
 
@@ -1305,6 +1918,7 @@ void ili9488_set_orientation(uint8_t flags)
 {
 	/* Flip X/Y and reverse X orientation and set BGR mode*/
 	ili9488_color_t madctl = 0x68;
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 
 	if (flags & ILI9488_FLIP_X) {
 		madctl &= ~(1 << 6);
@@ -1319,6 +1933,7 @@ void ili9488_set_orientation(uint8_t flags)
 	}
 
 	ili9488_write_register(ILI9488_CMD_MEMORY_ACCESS_CONTROL, &madctl, 1);
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -1358,6 +1973,7 @@ uint16_t ili9488_read_gram(void)
  */
 void ili9488_write_gram(uint16_t color)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	ili9488_set_cursor_position(limit_start_x, limit_start_y);
 	ili9488_write_ram_prepare();
 #ifdef ILI9488_EBIMODE
@@ -1369,6 +1985,7 @@ void ili9488_write_gram(uint16_t color)
 	ili9488_write_ram(color_666 >> 8);
 	ili9488_write_ram(color_666 & 0xFF);
 #endif
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -1388,6 +2005,7 @@ void ili9488_write_gram(uint16_t color)
  */
 void ili9488_copy_pixels_to_screen(const uint16_t *pixels, uint32_t count)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	ili9488_set_window(limit_start_x, limit_start_y, (limit_end_x - limit_start_x) + 1, (limit_end_y - limit_start_y) + 1);
 
 #ifdef ILI9488_EBIMODE
@@ -1404,6 +2022,7 @@ void ili9488_copy_pixels_to_screen(const uint16_t *pixels, uint32_t count)
 		pixels++;
 	}
 #endif
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -1424,6 +2043,7 @@ void ili9488_copy_pixels_to_screen(const uint16_t *pixels, uint32_t count)
  */
 void ili9488_duplicate_pixel(const uint16_t color, uint32_t count)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	ili9488_set_window(limit_start_x, limit_start_y, (limit_end_x - limit_start_x) + 1, (limit_end_y - limit_start_y) + 1);
 	ili9488_write_ram_prepare();
 
@@ -1440,6 +2060,7 @@ void ili9488_duplicate_pixel(const uint16_t color, uint32_t count)
 		ili9488_write_ram(color_666 & 0xFF);
 	}
 #endif
+	ILI9488_STATS_LEAVE();
 }
 
 /**
@@ -1459,6 +2080,7 @@ void ili9488_duplicate_pixel(const uint16_t color, uint32_t count)
  */
 void ili9488_copy_pixels_from_screen(uint16_t *pixels, uint32_t count)
 {
+	ILI9488_STATS_ENTER(ILI9488_OP_OTHER);
 	ili9488_set_window(limit_start_x, limit_start_y, (limit_end_x - limit_start_x) + 1, (limit_end_y - limit_start_y) + 1);
 	ili9488_write_register(ILI9488_CMD_MEMORY_READ, 0x0000, 0);
 #ifdef ILI9488_EBIMODE
@@ -1467,6 +2089,7 @@ void ili9488_copy_pixels_from_screen(uint16_t *pixels, uint32_t count)
 #endif
 #ifdef ILI9488_SPIMODE
 	ili9488_color_t grambuf[3];
+	ili9488_wait_for_idle();
 	pio_set_pin_high(LCD_SPI_CDS_PIO);
 	spi_read_packet(BOARD_ILI9488_SPI, grambuf, 1);
 	while (count--) {
@@ -1476,6 +2099,7 @@ void ili9488_copy_pixels_from_screen(uint16_t *pixels, uint32_t count)
 		pixels++;
 	}
 #endif
+	ILI9488_STATS_LEAVE();
 }
 
 /// @cond 0
@@ -63,6 +63,17 @@
 
 typedef int16_t ili9488_coord_t;
 
+#if defined(ILI9488_SPIMODE) && defined(CONF_ILI9488_XDMAC)
+#  define ILI9488_XDMAC_ENABLED
+#endif
+
+#if defined(ILI9488_SPIMODE) && defined(CONF_ILI9488_STATS)
+#  define ILI9488_STATS_ENABLED
+#endif
+
+/** Callback invoked (from interrupt context) when all queued LCD transfers are done. */
+typedef void (*ili9488_callback_t)(void);
+
 typedef union _union_type
 {
 	uint32_t value;
@@ -315,6 +326,12 @@ struct ili9488_font{
 	uint8_t height;
 };
 
+/** Font used by ili9488_draw_string() */
+extern const struct ili9488_font gfont;
+
+/** Charset used by ili9488_draw_string(), 10x14 pixels, from ' ' */
+extern const uint8_t p_uc_charset10x14[];
+
 /**
  * Display direction option
  */
@@ -323,6 +340,40 @@ enum ili9488_display_direction{
 	PORTRAIT   = 1
 };
 
+#ifdef ILI9488_STATS_ENABLED
+/**
+ * Operations the SPI traffic is charged to. A primitive called by another
+ * one (a rectangle drawn by a circle) is charged to the outer one. A call
+ * of ili9488_wait_for_idle() between primitives is not one of its own: the
+ * wait is charged to the primitive that queued the last transfer.
+ */
+enum ili9488_op{
+	ILI9488_OP_OTHER = 0,       //!< window, scroll and register calls
+	ILI9488_OP_INIT,
+	ILI9488_OP_FILL,
+	ILI9488_OP_PIXEL,
+	ILI9488_OP_LINE,
+	ILI9488_OP_RECTANGLE,
+	ILI9488_OP_FILLED_RECTANGLE,
+	ILI9488_OP_CIRCLE,
+	ILI9488_OP_FILLED_CIRCLE,
+	ILI9488_OP_STRING,
+	ILI9488_OP_PIXMAP,
+	ILI9488_OP_COUNT
+};
+
+/**
+ * Wire cost of an operation since ili9488_stats_reset().
+ */
+struct ili9488_stats{
+	uint32_t ul_calls;          //!< calls of the primitive
+	uint32_t ul_commands;       //!< command bytes (CDS low)
+	uint32_t ul_data_bytes;     //!< parameter and pixel bytes (CDS high)
+	uint32_t ul_windows;        //!< column/page address pairs set
+	uint32_t ul_busy_cycles;    //!< CPU cycles spent waiting for the SPI
+};
+#endif
+
 
 uint32_t ili9488_init(struct ili9488_opt_t *p_opt);
 void ili9488_set_display_direction(enum ili9488_display_direction direction);
@@ -330,6 +381,7 @@ void ili9488_set_window( uint16_t dwX, uint16_t dwY, uint16_t dwWidth, uint16_t
 void ili9488_display_on(void);
 void ili9488_display_off(void);
 void ili9488_set_foreground_color(uint32_t ul_color);
+void ili9488_set_background_color(uint32_t ul_color);
 void ili9488_fill(ili9488_color_t ul_color);
 void ili9488_set_cursor_position(uint16_t us_x, uint16_t us_y);
 void ili9488_scroll(uint16_t ul_tfa, uint16_t ul_lines, uint16_t ul_bfa);
@@ -362,6 +414,14 @@ void ili9488_copy_pixels_to_screen(const uint16_t *pixels,
 		uint32_t count);
 void ili9488_copy_pixels_from_screen(uint16_t *pixels, uint32_t count);
 void ili9488_duplicate_pixel(const uint16_t color, uint32_t count);
+bool ili9488_is_busy(void);
+void ili9488_wait_for_idle(void);
+void ili9488_set_transfer_callback(ili9488_callback_t callback);
+#ifdef ILI9488_STATS_ENABLED
+void ili9488_stats_reset(void);
+void ili9488_stats_get(enum ili9488_op op, struct ili9488_stats *p_stats);
+const char *ili9488_stats_name(enum ili9488_op op);
+#endif
 /// @cond 0
 /**INDENT-OFF**/
 #ifdef __cplusplus
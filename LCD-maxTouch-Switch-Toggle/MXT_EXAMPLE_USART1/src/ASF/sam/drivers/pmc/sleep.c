@@ -274,7 +274,16 @@ void pmc_sleep(int sleep_mode)
 	switch (sleep_mode) {
 	case SAM_PM_SMODE_SLEEP_WFI:
 	case SAM_PM_SMODE_SLEEP_WFE:
-#if (SAM4S || SAM4E || SAM4N || SAM4C || SAM4CM || SAM4CP || SAMG || SAMV71 || SAMV70 || SAMS70 || SAME70)
+#if (SAMV71 || SAMV70 || SAMS70 || SAME70)
+		/* WFI with the interrupts still masked: an interrupt that became
+		 * pending after the caller checked for work wakes the core at once,
+		 * and is served right after cpu_irq_enable(). */
+		SCB->SCR &= (uint32_t)~SCR_SLEEPDEEP;
+		__DSB();
+		__WFI();
+		cpu_irq_enable();
+		break;
+#elif (SAM4S || SAM4E || SAM4N || SAM4C || SAM4CM || SAM4CP || SAMG)
 		SCB->SCR &= (uint32_t)~SCR_SLEEPDEEP;
 		cpu_irq_enable();
 		__DSB();
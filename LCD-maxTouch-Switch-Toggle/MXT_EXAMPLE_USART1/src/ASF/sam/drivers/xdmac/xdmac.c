@@ -0,0 +1,99 @@
+/**
+ * \file
+ *
+ * \brief SAM Extensible Direct Memory Access Controller (XDMAC) driver.
+ *
+ * Copyright (c) 2015-2018 Microchip Technology Inc. and its subsidiaries.
+ *
+ * \asf_license_start
+ *
+ * \page License
+ *
+ * Subject to your compliance with these terms, you may use Microchip
+ * software and any derivatives exclusively with Microchip products.
+ * It is your responsibility to comply with third party license terms applicable
+ * to your use of third party software (including open source software) that
+ * may accompany Microchip software.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES,
+ * WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE,
+ * INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY,
+ * AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE
+ * LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL
+ * LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE
+ * SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE
+ * POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE FULLEST EXTENT
+ * ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN ANY WAY
+ * RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+ * THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * \asf_license_stop
+ *
+ */
+/*
+ * Support and FAQ: visit <a href="https://www.microchip.com/support/">Microchip Support</a>
+ */
+
+#include "xdmac.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/**
+ * \addtogroup sam_drivers_xdmac_group
+ *
+ * @{
+ */
+
+/**
+ * \brief Configure DMA for a transfer.
+ *
+ * The channel must be disabled before calling this function. Pending
+ * channel interrupt flags are cleared.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ * \param[in] channel_num XDMA Channel number (range 0 to 23)
+ * \param[in] p_cfg Pointer to a XDMAC channel configuration
+ */
+void xdmac_configure_transfer(Xdmac *xdmac, uint32_t channel_num,
+		xdmac_channel_config_t *p_cfg)
+{
+	XdmacChid *p_chid;
+
+	Assert(xdmac);
+	Assert(channel_num < XDMACCHID_NUMBER);
+	Assert(p_cfg);
+
+	p_chid = &xdmac->XDMAC_CHID[channel_num];
+
+	/* Clear any pending interrupt of the channel */
+	xdmac_channel_get_interrupt_status(xdmac, channel_num);
+
+	p_chid->XDMAC_CSA = p_cfg->mbr_sa;
+	p_chid->XDMAC_CDA = p_cfg->mbr_da;
+	p_chid->XDMAC_CUBC = XDMAC_CUBC_UBLEN(p_cfg->mbr_ubc);
+	p_chid->XDMAC_CBC = XDMAC_CBC_BLEN(p_cfg->mbr_bc);
+	p_chid->XDMAC_CDS_MSP = p_cfg->mbr_ds;
+	p_chid->XDMAC_CSUS = XDMAC_CSUS_SUBS(p_cfg->mbr_sus);
+	p_chid->XDMAC_CDUS = XDMAC_CDUS_DUBS(p_cfg->mbr_dus);
+	p_chid->XDMAC_CC = p_cfg->mbr_cfg;
+
+	/* No linked list: single block transfer */
+	p_chid->XDMAC_CNDC = 0;
+	p_chid->XDMAC_CNDA = 0;
+}
+
+/** @} */
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
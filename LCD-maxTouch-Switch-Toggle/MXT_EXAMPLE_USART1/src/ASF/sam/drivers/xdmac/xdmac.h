@@ -0,0 +1,229 @@
+/**
+ * \file
+ *
+ * \brief SAM Extensible Direct Memory Access Controller (XDMAC) driver.
+ *
+ * Copyright (c) 2015-2018 Microchip Technology Inc. and its subsidiaries.
+ *
+ * \asf_license_start
+ *
+ * \page License
+ *
+ * Subject to your compliance with these terms, you may use Microchip
+ * software and any derivatives exclusively with Microchip products.
+ * It is your responsibility to comply with third party license terms applicable
+ * to your use of third party software (including open source software) that
+ * may accompany Microchip software.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES,
+ * WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE,
+ * INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY,
+ * AND FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE
+ * LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL
+ * LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE
+ * SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS BEEN ADVISED OF THE
+ * POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE FULLEST EXTENT
+ * ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN ANY WAY
+ * RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+ * THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * \asf_license_stop
+ *
+ */
+/*
+ * Support and FAQ: visit <a href="https://www.microchip.com/support/">Microchip Support</a>
+ */
+
+#ifndef XDMAC_H_INCLUDED
+#define XDMAC_H_INCLUDED
+
+#include "compiler.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/**
+ * \defgroup sam_drivers_xdmac_group Extensible Direct Memory Access Controller (XDMAC)
+ *
+ * Driver for the XDMAC. Provides functions for configuring a single
+ * channel (microblock/block transfer), enabling/disabling it and handling
+ * its interrupts.
+ *
+ * @{
+ */
+
+/** XDMAC channel configuration (single block, no linked list) */
+typedef struct {
+	/** Microblock Control Member */
+	uint32_t mbr_ubc;
+	/** Source Address Member */
+	uint32_t mbr_sa;
+	/** Destination Address Member */
+	uint32_t mbr_da;
+	/** Configuration Register */
+	uint32_t mbr_cfg;
+	/** Block Control Member */
+	uint32_t mbr_bc;
+	/** Data Stride Member */
+	uint32_t mbr_ds;
+	/** Source Microblock Stride Member */
+	uint32_t mbr_sus;
+	/** Destination Microblock Stride Member */
+	uint32_t mbr_dus;
+} xdmac_channel_config_t;
+
+/** XDMAC hardware peripheral identifiers (SAME70 datasheet, XDMAC Channel Definitions) */
+#define XDMAC_CHANNEL_HWID_SPI0_TX   1
+#define XDMAC_CHANNEL_HWID_SPI0_RX   2
+#define XDMAC_CHANNEL_HWID_SPI1_TX   3
+#define XDMAC_CHANNEL_HWID_SPI1_RX   4
+#define XDMAC_CHANNEL_HWID_USART0_TX 7
+#define XDMAC_CHANNEL_HWID_USART1_TX 9
+#define XDMAC_CHANNEL_HWID_USART2_TX 11
+#define XDMAC_CHANNEL_HWID_TWIHS0_TX 14
+#define XDMAC_CHANNEL_HWID_TWIHS0_RX 15
+#define XDMAC_CHANNEL_HWID_UART0_TX  20
+#define XDMAC_CHANNEL_HWID_UART1_TX  22
+
+void xdmac_configure_transfer(Xdmac *xdmac, uint32_t channel_num,
+		xdmac_channel_config_t *p_cfg);
+
+/**
+ * \brief Enables the relevant channel of given XDMAC.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ * \param[in] channel_num  XDMA Channel number (range 0 to 23)
+ */
+static inline void xdmac_channel_enable(Xdmac *xdmac, uint32_t channel_num)
+{
+	Assert(xdmac);
+	Assert(channel_num < XDMACCHID_NUMBER);
+
+	/* Update DCache before DMA transmit */
+	__DSB();
+	xdmac->XDMAC_GE = (XDMAC_GE_EN0 << channel_num);
+}
+
+/**
+ * \brief Disables the relevant channel of given XDMAC.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ * \param[in] channel_num  XDMA Channel number (range 0 to 23)
+ */
+static inline void xdmac_channel_disable(Xdmac *xdmac, uint32_t channel_num)
+{
+	Assert(xdmac);
+	Assert(channel_num < XDMACCHID_NUMBER);
+
+	xdmac->XDMAC_GD = (XDMAC_GD_DI0 << channel_num);
+}
+
+/**
+ * \brief Get Global channel status of given XDMAC.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ *
+ * \return Channel status (one bit per enabled channel).
+ */
+static inline uint32_t xdmac_channel_get_status(Xdmac *xdmac)
+{
+	Assert(xdmac);
+
+	return xdmac->XDMAC_GS;
+}
+
+/**
+ * \brief Enable interrupt with mask on the relevant channel of given XDMA.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ * \param[in] channel_num  XDMA Channel number (range 0 to 23)
+ */
+static inline void xdmac_enable_interrupt(Xdmac *xdmac, uint32_t channel_num)
+{
+	Assert(xdmac);
+	Assert(channel_num < XDMACCHID_NUMBER);
+
+	xdmac->XDMAC_GIE = (XDMAC_GIE_IE0 << channel_num);
+}
+
+/**
+ * \brief Disable interrupt with mask on the relevant channel of given XDMA.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ * \param[in] channel_num  XDMA Channel number (range 0 to 23)
+ */
+static inline void xdmac_disable_interrupt(Xdmac *xdmac, uint32_t channel_num)
+{
+	Assert(xdmac);
+	Assert(channel_num < XDMACCHID_NUMBER);
+
+	xdmac->XDMAC_GID = (XDMAC_GID_ID0 << channel_num);
+}
+
+/**
+ * \brief Enable interrupt with mask on the relevant channel of given XDMA.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ * \param[in] channel_num  XDMA Channel number (range 0 to 23)
+ * \param[in] mask Interrupt mask (XDMAC_CIE_*)
+ */
+static inline void xdmac_channel_enable_interrupt(Xdmac *xdmac,
+		uint32_t channel_num, uint32_t mask)
+{
+	Assert(xdmac);
+	Assert(channel_num < XDMACCHID_NUMBER);
+
+	xdmac->XDMAC_CHID[channel_num].XDMAC_CIE = mask;
+}
+
+/**
+ * \brief Disable interrupt with mask on the relevant channel of given XDMA.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ * \param[in] channel_num  XDMA Channel number (range 0 to 23)
+ * \param[in] mask Interrupt mask (XDMAC_CID_*)
+ */
+static inline void xdmac_channel_disable_interrupt(Xdmac *xdmac,
+		uint32_t channel_num, uint32_t mask)
+{
+	Assert(xdmac);
+	Assert(channel_num < XDMACCHID_NUMBER);
+
+	xdmac->XDMAC_CHID[channel_num].XDMAC_CID = mask;
+}
+
+/**
+ * \brief Get interrupt status of the relevant channel of given XDMA.
+ *
+ * \note Reading the status register clears the pending flags.
+ *
+ * \param[out] xdmac Module hardware register base address pointer
+ * \param[in] channel_num  XDMA Channel number (range 0 to 23)
+ *
+ * \return Channel interrupt status (XDMAC_CIS_*).
+ */
+static inline uint32_t xdmac_channel_get_interrupt_status(Xdmac *xdmac,
+		uint32_t channel_num)
+{
+	Assert(xdmac);
+	Assert(channel_num < XDMACCHID_NUMBER);
+
+	return xdmac->XDMAC_CHID[channel_num].XDMAC_CIS;
+}
+
+/** @} */
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* XDMAC_H_INCLUDED */
@@ -103,6 +103,10 @@
 // From module: SPI - Serial Peripheral Interface
 #include <spi.h>
 
+// From module: Sleep manager - SAM implementation
+#include <sam/sleepmgr.h>
+#include <sleepmgr.h>
+
 // From module: Standard serial I/O (stdio) - SAM implementation
 #include <stdio_serial.h>
 
@@ -127,6 +131,9 @@
 // From module: USART - Univ. Syn Async Rec/Trans
 #include <usart.h>
 
+// From module: XDMAC - Extensible Direct Memory Access Controller
+#include <xdmac.h>
+
 // From module: maXTouch - ATMXT122S Controller
 #include <mxt_device_1.h>
 
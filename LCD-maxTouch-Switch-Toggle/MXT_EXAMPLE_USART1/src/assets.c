@@ -0,0 +1,79 @@
+/*
+ * assets.c
+ *
+ * Reader of the asset blob. The index is sorted by id, so a lookup is a
+ * binary search; the images point straight into the blob in flash.
+ */
+
+#include "assets.h"
+
+#define ASSETS_MAGIC   0x54455341u  /* "ASET" */
+#define ASSETS_VERSION 1
+
+enum {
+	ASSET_FORMAT_RGB888,
+	ASSET_FORMAT_RLE,
+	ASSET_FORMAT_INDEXED
+};
+
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t count;
+	uint32_t size;
+} asset_header;
+
+typedef struct {
+	uint32_t id;
+	uint16_t width;
+	uint16_t height;
+	uint8_t format;
+	uint8_t bpp;
+	uint16_t reserved;
+	/* Offsets from the start of the blob */
+	uint32_t data;
+	uint32_t aux;
+} asset_entry;
+
+#define HEADER ((const asset_header *)assets_blob)
+#define INDEX  ((const asset_entry *)(assets_blob + sizeof(asset_header)))
+
+bool asset_check(void)
+{
+	return HEADER->magic == ASSETS_MAGIC && HEADER->version == ASSETS_VERSION;
+}
+
+static const asset_entry *asset_find(uint32_t id)
+{
+	uint32_t lo = 0, hi = HEADER->count;
+
+	while (lo < hi) {
+		uint32_t mid = (lo + hi) / 2;
+		if (INDEX[mid].id == id) {
+			return &INDEX[mid];
+		}
+		if (INDEX[mid].id < id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return 0;
+}
+
+bool asset_get(uint32_t id, tImage *image)
+{
+	const asset_entry *e = asset_find(id);
+
+	if (e == 0) {
+		return false;
+	}
+	image->data = assets_blob + e->data;
+	image->width = e->width;
+	image->height = e->height;
+	image->dataSize = 8;
+	image->rows = (e->format == ASSET_FORMAT_RLE) ? (const uint16_t *)(assets_blob + e->aux) : 0;
+	image->bpp = (e->format == ASSET_FORMAT_INDEXED) ? e->bpp : 0;
+	image->palette = (e->format == ASSET_FORMAT_INDEXED) ? (const uint32_t *)(assets_blob + e->aux) : 0;
+	return true;
+}
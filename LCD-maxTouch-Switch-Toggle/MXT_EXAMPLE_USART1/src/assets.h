@@ -0,0 +1,24 @@
+/*
+ * assets.h
+ *
+ * Reader of the asset blob built by tools/pack_assets.py: every icon,
+ * looked up by id (see assets_id.h).
+ */
+
+
+#ifndef ASSETS_H_
+#define ASSETS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tipos.h"
+#include "assets_id.h"
+
+/* Linked by assets.S from assets.bin */
+extern const uint8_t assets_blob[];
+
+bool asset_check(void);
+bool asset_get(uint32_t id, tImage *image);
+
+
+#endif /* ASSETS_H_ */
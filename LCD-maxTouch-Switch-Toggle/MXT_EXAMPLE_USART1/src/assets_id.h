@@ -0,0 +1,25 @@
+/*
+ * assets_id.h
+ *
+ * Generated by tools/pack_assets.py, do not edit.
+ */
+
+
+#ifndef ASSETS_ID_H_
+#define ASSETS_ID_H_
+
+#define ASSET_RECYCLEWATER                        0x91c78279u
+#define ASSET_TUMBLEDRY                           0x08aa535bu
+#define ASSET_ICON_BACKWARD                       0xc59e2eccu
+#define ASSET_ICON_FORWARD                        0x58ffecb2u
+#define ASSET_LOCK                                0xef0d7842u
+#define ASSET_LOCKED                              0xce164093u
+#define ASSET_NEXT                                0xdce2da08u
+#define ASSET_FORWARDBUTTONFORMULTIMEDIA          0x7fa2d7e6u
+#define ASSET_PREVIOUS                            0xead1fb48u
+#define ASSET_UNLOCKED                            0xdd20481cu
+#define ASSET_WASH                                0xa0f6c56eu
+#define ASSET_WATER                               0x49c69a10u
+
+
+#endif /* ASSETS_ID_H_ */
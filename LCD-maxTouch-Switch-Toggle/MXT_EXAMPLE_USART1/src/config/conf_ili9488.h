@@ -43,6 +43,22 @@
 
 #define ILI9488_SPI_BAUDRATE 20000000
 
+/* Stream SPI data to the LCD with the XDMAC instead of polling the SPI
+ * (SPI mode only). Comment out to fall back to the polled driver. */
+#define CONF_ILI9488_XDMAC
+
+/* Count the commands, bytes, windows and SPI waits of each drawing
+ * primitive (SPI mode only, see ili9488_stats_get()), and of each kind of
+ * item of the tile renderer (tile_stats_get()); costs a few cycles per
+ * transfer, and per tile composited. */
+//#define CONF_ILI9488_STATS
+
+/* XDMAC channel used for the LCD transfers */
+#define ILI9488_XDMAC_CHANNEL    0
+
+/* Number of transfers that can be queued (must be a power of 2) */
+#define ILI9488_XDMAC_QUEUE_SIZE 16
+
 #if !defined(BOARD_ILI9488_ADDR)
 
 	#warning The ILI9488 EBI configuration does not exist in the board definition file. Using default settings.
@@ -0,0 +1,154 @@
+/*
+ * dirty_rect.c
+ *
+ * Invalidation layer between the application and the ILI9488 driver.
+ */
+
+#include "dirty_rect.h"
+#include "ili9488.h"
+
+static dirty_rect_t rects[DIRTY_MAX_RECTS];
+static uint32_t n_rects;
+static dirty_paint_t paint_cb;
+
+static uint32_t rect_area(const dirty_rect_t *r)
+{
+	return (uint32_t)(r->x2 - r->x1 + 1) * (uint32_t)(r->y2 - r->y1 + 1);
+}
+
+static void rect_union(dirty_rect_t *dst, const dirty_rect_t *src)
+{
+	if (src->x1 < dst->x1) dst->x1 = src->x1;
+	if (src->y1 < dst->y1) dst->y1 = src->y1;
+	if (src->x2 > dst->x2) dst->x2 = src->x2;
+	if (src->y2 > dst->y2) dst->y2 = src->y2;
+}
+
+static uint32_t overlap_area(const dirty_rect_t *a, const dirty_rect_t *b)
+{
+	dirty_rect_t o;
+
+	if (!dirty_intersects(a, b)) {
+		return 0;
+	}
+	o.x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+	o.y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+	o.x2 = a->x2 < b->x2 ? a->x2 : b->x2;
+	o.y2 = a->y2 < b->y2 ? a->y2 : b->y2;
+	return rect_area(&o);
+}
+
+/*
+ * Two rectangles are drawn as their union only when it covers little more
+ * than they do (DIRTY_MERGE_WASTE): one inside the other, or side by side
+ * along most of an edge. Rectangles that only touch at a corner, or cross,
+ * are kept apart: the pixels they share are drawn twice, which costs less
+ * than the empty corners of their union.
+ */
+static bool worth_merging(const dirty_rect_t *a, const dirty_rect_t *b)
+{
+	dirty_rect_t u = *a;
+	uint32_t covered = rect_area(a) + rect_area(b) - overlap_area(a, b);
+
+	rect_union(&u, b);
+	return rect_area(&u) - covered <= covered / DIRTY_MERGE_WASTE;
+}
+
+static void remove_rect(uint32_t i)
+{
+	rects[i] = rects[--n_rects];
+}
+
+void dirty_init(dirty_paint_t paint)
+{
+	paint_cb = paint;
+	n_rects = 0;
+}
+
+bool dirty_intersects(const dirty_rect_t *a, const dirty_rect_t *b)
+{
+	return (a->x1 <= b->x2) && (b->x1 <= a->x2) &&
+	       (a->y1 <= b->y2) && (b->y1 <= a->y2);
+}
+
+void dirty_invalidate_rect(const dirty_rect_t *rect)
+{
+	dirty_invalidate(rect->x1, rect->y1, rect->x2, rect->y2);
+}
+
+void dirty_invalidate(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2)
+{
+	dirty_rect_t r;
+	uint32_t i, best, growth, best_growth;
+	bool merged;
+
+	if (x1 > x2 || y1 > y2 || x1 >= ILI9488_LCD_WIDTH || y1 >= ILI9488_LCD_HEIGHT) {
+		return;
+	}
+	if (x2 >= ILI9488_LCD_WIDTH) x2 = ILI9488_LCD_WIDTH - 1;
+	if (y2 >= ILI9488_LCD_HEIGHT) y2 = ILI9488_LCD_HEIGHT - 1;
+
+	r.x1 = x1;
+	r.y1 = y1;
+	r.x2 = x2;
+	r.y2 = y2;
+
+	/* Absorb every rectangle worth merging with the new one; the union can
+	 * be worth merging with others that were not before, so repeat */
+	do {
+		merged = false;
+		for (i = 0; i < n_rects; i++) {
+			if (worth_merging(&r, &rects[i])) {
+				rect_union(&r, &rects[i]);
+				remove_rect(i);
+				merged = true;
+				break;
+			}
+		}
+	} while (merged);
+
+	if (n_rects < DIRTY_MAX_RECTS) {
+		rects[n_rects++] = r;
+		return;
+	}
+
+	/* List full: merge with the rectangle that grows the least */
+	best = 0;
+	best_growth = UINT32_MAX;
+	for (i = 0; i < n_rects; i++) {
+		dirty_rect_t u = rects[i];
+		rect_union(&u, &r);
+		growth = rect_area(&u) - rect_area(&rects[i]);
+		if (growth < best_growth) {
+			best_growth = growth;
+			best = i;
+		}
+	}
+	rect_union(&r, &rects[best]);
+	remove_rect(best);
+	dirty_invalidate(r.x1, r.y1, r.x2, r.y2);
+}
+
+bool dirty_pending(void)
+{
+	return n_rects > 0;
+}
+
+/*
+ * Redraw every dirty area once and start a new frame.
+ * Returns the number of pixels invalidated in the frame.
+ */
+uint32_t dirty_flush(void)
+{
+	uint32_t i, pixels = 0;
+
+	for (i = 0; i < n_rects; i++) {
+		pixels += rect_area(&rects[i]);
+		if (paint_cb) {
+			paint_cb(&rects[i]);
+		}
+	}
+	n_rects = 0;
+
+	return pixels;
+}
@@ -0,0 +1,42 @@
+/*
+ * dirty_rect.h
+ *
+ * Invalidation layer between the application and the ILI9488 driver:
+ * areas that changed are collected during a frame and redrawn once by
+ * dirty_flush().
+ */
+
+
+#ifndef DIRTY_RECT_H_
+#define DIRTY_RECT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Maximum number of separate areas kept per frame */
+#define DIRTY_MAX_RECTS 8
+
+/* Two areas are merged when their union draws at most 1/DIRTY_MERGE_WASTE
+ * more pixels than they cover */
+#define DIRTY_MERGE_WASTE 8
+
+/* Rectangle with inclusive corners, in LCD coordinates */
+typedef struct {
+	uint16_t x1;
+	uint16_t y1;
+	uint16_t x2;
+	uint16_t y2;
+} dirty_rect_t;
+
+/* Redraws everything that lies inside rect */
+typedef void (*dirty_paint_t)(const dirty_rect_t *rect);
+
+void dirty_init(dirty_paint_t paint);
+void dirty_invalidate(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2);
+void dirty_invalidate_rect(const dirty_rect_t *rect);
+bool dirty_intersects(const dirty_rect_t *a, const dirty_rect_t *b);
+bool dirty_pending(void);
+uint32_t dirty_flush(void);
+
+
+#endif /* DIRTY_RECT_H_ */
@@ -0,0 +1,48 @@
+/*
+ * event_loop.c
+ *
+ * Dispatcher of the events queued in an event_ring.
+ */
+
+#include <stddef.h>
+#include "event_loop.h"
+
+static event_ring_t *queue;
+static event_handler_t handlers[EVENT_N_TYPES];
+
+void event_loop_init(event_ring_t *ring)
+{
+	uint32_t i;
+
+	queue = ring;
+	for (i = 0; i < EVENT_N_TYPES; i++) {
+		handlers[i] = NULL;
+	}
+}
+
+/* A later call replaces the handler; NULL discards the events of the type */
+void event_register(uint8_t type, event_handler_t handler)
+{
+	if (type < EVENT_N_TYPES) {
+		handlers[type] = handler;
+	}
+}
+
+/*
+ * Drains the ring, including events pushed by the handlers themselves.
+ * Returns the number of events taken from it.
+ */
+uint32_t event_dispatch(void)
+{
+	event_t ev;
+	uint32_t n = 0;
+
+	while (event_pop(queue, &ev)) {
+		if (ev.type < EVENT_N_TYPES && handlers[ev.type] != NULL) {
+			handlers[ev.type](&ev);
+		}
+		n++;
+	}
+
+	return n;
+}
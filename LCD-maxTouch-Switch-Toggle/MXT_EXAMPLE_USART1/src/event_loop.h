@@ -0,0 +1,23 @@
+/*
+ * event_loop.h
+ *
+ * Dispatcher of the events queued in an event_ring: one handler per
+ * event type, called by the consumer of the ring in the order the
+ * events were pushed.
+ */
+
+
+#ifndef EVENT_LOOP_H_
+#define EVENT_LOOP_H_
+
+#include <stdint.h>
+#include "event_ring.h"
+
+typedef void (*event_handler_t)(const event_t *ev);
+
+void event_loop_init(event_ring_t *ring);
+void event_register(uint8_t type, event_handler_t handler);
+uint32_t event_dispatch(void);
+
+
+#endif /* EVENT_LOOP_H_ */
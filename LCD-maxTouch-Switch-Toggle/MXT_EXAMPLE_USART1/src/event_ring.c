@@ -0,0 +1,58 @@
+/*
+ * event_ring.c
+ *
+ * Single producer / single consumer queue of input events.
+ *
+ * head and tail run free and are reduced modulo EVENT_RING_SIZE on access,
+ * so a full ring is head - tail == EVENT_RING_SIZE and no slot is wasted.
+ * The release store of an index publishes the slot written before it.
+ */
+
+#include "event_ring.h"
+
+#define EVENT_RING_MASK (EVENT_RING_SIZE - 1)
+
+#if (EVENT_RING_SIZE & EVENT_RING_MASK) != 0
+#error "EVENT_RING_SIZE must be a power of 2"
+#endif
+
+void event_ring_init(event_ring_t *ring)
+{
+	ring->head = 0;
+	ring->tail = 0;
+	ring->dropped = 0;
+}
+
+bool event_push(event_ring_t *ring, const event_t *ev)
+{
+	uint32_t head = ring->head;
+	uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+	if (head - tail >= EVENT_RING_SIZE) {
+		ring->dropped++;
+		return false;
+	}
+
+	ring->slots[head & EVENT_RING_MASK] = *ev;
+	__atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+bool event_pop(event_ring_t *ring, event_t *ev)
+{
+	uint32_t tail = ring->tail;
+	uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+	if (head == tail) {
+		return false;
+	}
+
+	*ev = ring->slots[tail & EVENT_RING_MASK];
+	__atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+bool event_ring_empty(const event_ring_t *ring)
+{
+	return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == ring->tail;
+}
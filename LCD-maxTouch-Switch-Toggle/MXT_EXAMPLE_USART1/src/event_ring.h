@@ -0,0 +1,54 @@
+/*
+ * event_ring.h
+ *
+ * Single producer / single consumer queue of input events between the
+ * interrupt handlers and the main loop.
+ *
+ * Only one context may push and only one may pop. Interrupts that push
+ * into the same ring must share the same NVIC priority, so they never
+ * preempt each other; pushes from thread context must mask interrupts
+ * around event_push(). Neither side ever waits for the other: a full
+ * ring drops the new event and counts it.
+ */
+
+
+#ifndef EVENT_RING_H_
+#define EVENT_RING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Number of slots, must be a power of 2 */
+#define EVENT_RING_SIZE 16
+
+enum event_type {
+	EVENT_TOUCH,  /* touch on the panel: x, y, source = touch id, data = status */
+	EVENT_BUTTON, /* button of the UI, source = id given by the application */
+	EVENT_DOOR,   /* door button */
+	EVENT_RTT,    /* RTT alarm */
+	EVENT_N_TYPES
+};
+
+typedef struct {
+	uint32_t time;   /* timestamp of the producer */
+	uint16_t x;
+	uint16_t y;
+	uint8_t type;    /* enum event_type */
+	uint8_t source;
+	uint8_t data;
+} event_t;
+
+typedef struct {
+	event_t slots[EVENT_RING_SIZE];
+	uint32_t head;      /* written only by the producer */
+	uint32_t tail;      /* written only by the consumer */
+	uint32_t dropped;   /* events lost because the ring was full */
+} event_ring_t;
+
+void event_ring_init(event_ring_t *ring);
+bool event_push(event_ring_t *ring, const event_t *ev);
+bool event_pop(event_ring_t *ring, event_t *ev);
+bool event_ring_empty(const event_ring_t *ring);
+
+
+#endif /* EVENT_RING_H_ */
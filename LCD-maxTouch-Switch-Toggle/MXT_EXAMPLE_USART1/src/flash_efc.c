@@ -0,0 +1,102 @@
+/*
+ * flash_efc.c
+ *
+ * Erase and write commands of the EEFC on the nvlog region.
+ *
+ * A write fills the latch buffer of the page with ones, which leaves the
+ * other chunks of the page as they are, except for the chunk written.
+ * The blocks are erased with the "erase pages" command by 16 pages at a
+ * time, which the flash allows in any sector.
+ */
+
+#include <asf.h>
+#include "flash_efc.h"
+
+/* Start of the nvlog region, from the linker script */
+extern uint32_t _snvlog;
+
+#define NVLOG_ADDR  ((uint32_t)&_snvlog)
+
+#define EPA_16_PAGES 2
+
+/*
+ * Runs from RAM: the flash does not answer reads until the command is over,
+ * not even to fetch the code waiting for it.
+ */
+static RAMFUNC __no_inline uint32_t efc_command(uint32_t cmd, uint32_t arg)
+{
+	uint32_t fsr;
+
+	EFC->EEFC_FCR = EEFC_FCR_FKEY_PASSWD | EEFC_FCR_FARG(arg) | cmd;
+	do {
+		fsr = EFC->EEFC_FSR;
+	} while (!(fsr & EEFC_FSR_FRDY));
+
+	return fsr & (EEFC_FSR_FCMDE | EEFC_FSR_FLOCKE | EEFC_FSR_FLERR);
+}
+
+static uint32_t page_of(uint32_t offset)
+{
+	return (NVLOG_ADDR + offset - IFLASH_ADDR) / FLASH_EFC_PAGE_SIZE;
+}
+
+/* The region is cacheable: what the cache holds of it is stale now */
+static void drop_cache(void)
+{
+	if (SCB->CCR & SCB_CCR_DC_Msk) {
+		SCB_CleanInvalidateDCache();
+	}
+}
+
+const void *flash_efc_ptr(uint32_t offset)
+{
+	return (const void *)(NVLOG_ADDR + offset);
+}
+
+bool flash_efc_erase(uint32_t offset)
+{
+	irqflags_t flags;
+	uint32_t err;
+
+	if (offset % FLASH_EFC_BLOCK_SIZE || offset >= FLASH_EFC_SIZE) {
+		return false;
+	}
+
+	flags = cpu_irq_save();
+	err = efc_command(EEFC_FCR_FCMD_EPA, page_of(offset) | EPA_16_PAGES);
+	cpu_irq_restore(flags);
+	drop_cache();
+
+	return err == 0;
+}
+
+bool flash_efc_write(uint32_t offset, const void *data)
+{
+	uint32_t page = offset & ~(FLASH_EFC_PAGE_SIZE - 1);
+	volatile uint32_t *latch = (volatile uint32_t *)(NVLOG_ADDR + page);
+	const uint32_t *src = data;
+	irqflags_t flags;
+	uint32_t err;
+	uint32_t i;
+
+	if (offset % FLASH_EFC_CHUNK || offset >= FLASH_EFC_SIZE) {
+		return false;
+	}
+
+	flags = cpu_irq_save();
+	/* Any write to the page goes to the latch buffer, word by word */
+	for (i = 0; i < FLASH_EFC_PAGE_SIZE / 4; i++) {
+		uint32_t at = page + i * 4;
+		if (at >= offset && at < offset + FLASH_EFC_CHUNK) {
+			latch[i] = src[(at - offset) / 4];
+		} else {
+			latch[i] = 0xFFFFFFFF;
+		}
+	}
+	__DSB();
+	err = efc_command(EEFC_FCR_FCMD_WP, page_of(offset));
+	cpu_irq_restore(flags);
+	drop_cache();
+
+	return err == 0;
+}
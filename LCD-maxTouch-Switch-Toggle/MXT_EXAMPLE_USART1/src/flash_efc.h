@@ -0,0 +1,37 @@
+/*
+ * flash_efc.h
+ *
+ * Writing to the area at the end of the internal flash kept out of the
+ * program by the linker script (region nvlog). Offsets are from the start
+ * of that area; it is read straight from memory through flash_efc_ptr().
+ *
+ * Erasing goes by blocks of FLASH_EFC_BLOCK_SIZE bytes. Writing goes by
+ * chunks of FLASH_EFC_CHUNK bytes aligned to their size, each of which can
+ * be written only once between two erases: the flash keeps an ECC for
+ * every 128 bits, so only whole erased chunks can be programmed.
+ *
+ * The flash cannot be read while it is being written, so the interrupts
+ * are off during a command: a few ms for a write, tens of ms for an erase.
+ */
+
+
+#ifndef FLASH_EFC_H_
+#define FLASH_EFC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FLASH_EFC_PAGE_SIZE   512
+#define FLASH_EFC_BLOCK_PAGES 16
+#define FLASH_EFC_BLOCK_SIZE  (FLASH_EFC_BLOCK_PAGES * FLASH_EFC_PAGE_SIZE)
+#define FLASH_EFC_CHUNK       16
+
+/* Size of the nvlog region in flash.ld */
+#define FLASH_EFC_SIZE        (4 * FLASH_EFC_BLOCK_SIZE)
+
+const void *flash_efc_ptr(uint32_t offset);
+bool flash_efc_erase(uint32_t offset);
+bool flash_efc_write(uint32_t offset, const void *data);
+
+
+#endif /* FLASH_EFC_H_ */
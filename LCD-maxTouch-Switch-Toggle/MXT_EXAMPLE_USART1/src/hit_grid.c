@@ -0,0 +1,119 @@
+/*
+ * hit_grid.c
+ *
+ * Spatial index of the buttons of the screen.
+ *
+ * The cells are stored in compressed form: the buttons of cell c are
+ * entries[start[c]] .. entries[start[c + 1] - 1], in the order they were
+ * given to hit_grid_build(), so the first button listed wins on overlaps.
+ */
+
+#include "hit_grid.h"
+
+#define GRID_W (HIT_WIDTH / HIT_CELL + 1)
+#define GRID_H (HIT_HEIGHT / HIT_CELL + 1)
+#define N_CELLS (GRID_W * GRID_H)
+
+static botao *buttons[HIT_MAX_BUTTONS];
+static uint16_t start[N_CELLS + 1];
+static uint8_t entries[HIT_MAX_ENTRIES];
+
+/* Range of cells crossed by a button, edges included like the hit test */
+static void cell_range(const botao *b, uint32_t *cx1, uint32_t *cy1,
+                       uint32_t *cx2, uint32_t *cy2)
+{
+	uint32_t x2 = b->x + b->size_x;
+	uint32_t y2 = b->y + b->size_y;
+
+	*cx1 = b->x / HIT_CELL;
+	*cy1 = b->y / HIT_CELL;
+	*cx2 = (x2 < HIT_WIDTH ? x2 : HIT_WIDTH) / HIT_CELL;
+	*cy2 = (y2 < HIT_HEIGHT ? y2 : HIT_HEIGHT) / HIT_CELL;
+}
+
+static bool contains(const botao *b, uint32_t x, uint32_t y)
+{
+	return (x >= b->x) && (x <= b->x + b->size_x) &&
+	       (y >= b->y) && (y <= b->y + b->size_y);
+}
+
+/*
+ * Indexes the n buttons of botoes. Returns false, leaving the index
+ * empty, if they do not fit in HIT_MAX_BUTTONS / HIT_MAX_ENTRIES.
+ */
+bool hit_grid_build(botao *const *botoes, uint32_t n)
+{
+	uint16_t fill[N_CELLS];
+	uint32_t i, c, cx, cy, cx1, cy1, cx2, cy2;
+	uint32_t total = 0;
+
+	for (c = 0; c <= N_CELLS; c++) {
+		start[c] = 0;
+	}
+
+	if (n > HIT_MAX_BUTTONS) {
+		return false;
+	}
+
+	/* Count the buttons of each cell */
+	for (i = 0; i < n; i++) {
+		buttons[i] = botoes[i];
+		if (botoes[i]->x > HIT_WIDTH || botoes[i]->y > HIT_HEIGHT) {
+			continue;
+		}
+		cell_range(botoes[i], &cx1, &cy1, &cx2, &cy2);
+		for (cy = cy1; cy <= cy2; cy++) {
+			for (cx = cx1; cx <= cx2; cx++) {
+				start[cy * GRID_W + cx + 1]++;
+			}
+		}
+		total += (cx2 - cx1 + 1) * (cy2 - cy1 + 1);
+	}
+
+	if (total > HIT_MAX_ENTRIES) {
+		for (c = 0; c <= N_CELLS; c++) {
+			start[c] = 0;
+		}
+		return false;
+	}
+
+	for (c = 0; c < N_CELLS; c++) {
+		start[c + 1] += start[c];
+		fill[c] = start[c];
+	}
+
+	/* Fill them, keeping the order of botoes */
+	for (i = 0; i < n; i++) {
+		if (botoes[i]->x > HIT_WIDTH || botoes[i]->y > HIT_HEIGHT) {
+			continue;
+		}
+		cell_range(botoes[i], &cx1, &cy1, &cx2, &cy2);
+		for (cy = cy1; cy <= cy2; cy++) {
+			for (cx = cx1; cx <= cx2; cx++) {
+				entries[fill[cy * GRID_W + cx]++] = i;
+			}
+		}
+	}
+
+	return true;
+}
+
+/* Button under (x, y), NULL if there is none */
+botao *hit_grid_find(uint32_t x, uint32_t y)
+{
+	uint32_t c, i;
+
+	if (x > HIT_WIDTH || y > HIT_HEIGHT) {
+		return NULL;
+	}
+
+	c = (y / HIT_CELL) * GRID_W + x / HIT_CELL;
+	for (i = start[c]; i < start[c + 1]; i++) {
+		botao *b = buttons[entries[i]];
+		if (contains(b, x, y)) {
+			return b;
+		}
+	}
+
+	return NULL;
+}
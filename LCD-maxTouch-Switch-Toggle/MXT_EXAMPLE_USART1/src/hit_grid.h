@@ -0,0 +1,34 @@
+/*
+ * hit_grid.h
+ *
+ * Spatial index of the buttons of the screen: the panel is split into
+ * cells of HIT_CELL x HIT_CELL pixels, each listing the buttons that
+ * cross it, so a touch only tests the few buttons of its own cell.
+ * The index keeps pointers to the buttons and is rebuilt only when the
+ * layout changes.
+ */
+
+
+#ifndef HIT_GRID_H_
+#define HIT_GRID_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "tipos.h"
+
+/* Area covered by the index, edges included, in the coordinates of the touch events */
+#define HIT_WIDTH  480
+#define HIT_HEIGHT 320
+
+#define HIT_CELL   32
+
+#define HIT_MAX_BUTTONS 64
+/* Sum over all buttons of the number of cells each one crosses */
+#define HIT_MAX_ENTRIES 512
+
+bool hit_grid_build(botao *const *botoes, uint32_t n);
+botao *hit_grid_find(uint32_t x, uint32_t y);
+
+
+#endif /* HIT_GRID_H_ */
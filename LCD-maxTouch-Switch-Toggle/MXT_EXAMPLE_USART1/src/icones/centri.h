@@ -1,95 +1,379 @@
 
 /*******************************************************************************
 * image
-* filename: unsaved
-* name: recycle-water
+* name: recyclewater
 *
 * preset name: Color R8G8B8
 * data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Color, not_used not_used
+* RLE compression enabled: yes (tools/rle_icons.py, 10800 -> 8398 bytes)
 * bits per pixel: 24
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
 *******************************************************************************/
 
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
 #include <stdint.h>
+#include "tipos.h"
 
 
+static const uint8_t image_data_recyclewater[8398] = {
+    0x8f, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x82, 0xff, 0xff, 0xff, 0x01, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x00,
+    0xfe, 0xfe, 0xfe, 0x86, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0x81, 0xff,
+    0xff, 0xff, 0x02, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xfd, 0xfd, 0xfd, 0x8a, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff,
+    0x91, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x05, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xff, 0xff,
+    0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0x81, 0xfa, 0xfa, 0xfa, 0x00, 0xfc, 0xfc, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xfd, 0xfd, 0xf9,
+    0xf9, 0xf9, 0x81, 0xfa, 0xfa, 0xfa, 0x02, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfc, 0xfc, 0xfc,
+    0xf4, 0xf4, 0xf4, 0x88, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xfc,
+    0xfc, 0xfc, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x83, 0xff, 0xff, 0xff, 0x05, 0xfd, 0xfd, 0xfd,
+    0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xfa, 0xfa, 0xfa, 0x8c, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00,
+    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf8, 0xf8, 0x83, 0xff, 0xff, 0xff, 0x02, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa,
+    0xfa, 0x81, 0xfc, 0xfc, 0xfc, 0x00, 0xfd, 0xfd, 0xfd, 0x81, 0xfe, 0xfe, 0xfe, 0x08, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xfd,
+    0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe,
+    0xfe, 0xfb, 0xfb, 0xfb, 0x8a, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x91, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd,
+    0x81, 0xf8, 0xf8, 0xf8, 0x00, 0xfe, 0xfe, 0xfe, 0x82, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xe8, 0xe3, 0xe3,
+    0xe3, 0x82, 0xe1, 0xe1, 0xe1, 0x01, 0xe7, 0xe7, 0xe7, 0xf6, 0xf6, 0xf6, 0x84, 0xff, 0xff, 0xff, 0x02, 0xf9, 0xf9, 0xf9, 0xfc, 0xfc, 0xfc, 0xfd,
+    0xfd, 0xfd, 0x82, 0xff, 0xff, 0xff, 0x02, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0x88, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe,
+    0x00, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x84, 0xff, 0xff, 0xff, 0x10, 0xea, 0xea, 0xea, 0xd5, 0xd5, 0xd5, 0xaf,
+    0xaf, 0xaf, 0x9e, 0x9e, 0x9e, 0x84, 0x84, 0x84, 0x6e, 0x6e, 0x6e, 0x62, 0x62, 0x62, 0x60, 0x60, 0x60, 0x62, 0x62, 0x62, 0x65, 0x65, 0x65, 0x69,
+    0x69, 0x69, 0x81, 0x81, 0x81, 0xa0, 0xa0, 0xa0, 0xb9, 0xb9, 0xb9, 0xd1, 0xd1, 0xd1, 0xea, 0xea, 0xea, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff,
+    0x03, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x88, 0xff, 0xff,
+    0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf9, 0xf9, 0x81, 0xff, 0xff, 0xff, 0x07, 0xf1, 0xf1,
+    0xf1, 0xd2, 0xd2, 0xd2, 0xa6, 0xa6, 0xa6, 0x6f, 0x6f, 0x6f, 0x45, 0x45, 0x45, 0x1b, 0x1b, 0x1b, 0x12, 0x12, 0x12, 0x07, 0x07, 0x07, 0x84, 0x00,
+    0x00, 0x00, 0x08, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x08, 0x08, 0x08, 0x1e, 0x1e, 0x1e, 0x3f, 0x3f, 0x3f, 0x6d, 0x6d, 0x6d, 0xa7, 0xa7, 0xa7,
+    0xd4, 0xd4, 0xd4, 0xf0, 0xf0, 0xf0, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x88, 0xff,
+    0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0x1c, 0xf6, 0xf6, 0xf6, 0xcb, 0xcb, 0xcb, 0x87, 0x87, 0x87,
+    0x47, 0x47, 0x47, 0x1e, 0x1e, 0x1e, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x10, 0x10, 0x10, 0x24, 0x24, 0x24, 0x3b, 0x3b, 0x3b,
+    0x4c, 0x4c, 0x4c, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x46, 0x46, 0x46, 0x41, 0x41, 0x41, 0x24, 0x24, 0x24, 0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x0a,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x47, 0x47, 0x47, 0x8d, 0x8d, 0x8d, 0xc3, 0xc3, 0xc3, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff,
+    0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0x8a, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x20, 0xf6,
+    0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xe1, 0xe1, 0xe1, 0x95, 0x95, 0x95, 0x3e, 0x3e, 0x3e, 0x0b, 0x0b, 0x0b, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x04, 0x2a, 0x2a, 0x2a, 0x53, 0x53, 0x53, 0x7d, 0x7d, 0x7d, 0xa0, 0xa0, 0xa0, 0xb2, 0xb2, 0xb2, 0xc1, 0xc1, 0xc1, 0xda,
+    0xda, 0xda, 0xcc, 0xcc, 0xcc, 0xd7, 0xd7, 0xd7, 0xd0, 0xd0, 0xd0, 0xc2, 0xc2, 0xc2, 0xb4, 0xb4, 0xb4, 0xa0, 0xa0, 0xa0, 0x81, 0x81, 0x81, 0x52,
+    0x52, 0x52, 0x22, 0x22, 0x22, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x41, 0x41, 0x41, 0x8d, 0x8d, 0x8d, 0xdc, 0xdc, 0xdc, 0xff,
+    0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0x83, 0xff, 0xff, 0xff, 0x00, 0xf5, 0xf5, 0xf5, 0x81, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xf7, 0xf7, 0xff, 0xff,
+    0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x24, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf8,
+    0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xb9, 0xb9, 0xb9, 0x50, 0x50, 0x50, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x12,
+    0x12, 0x12, 0x46, 0x46, 0x46, 0x76, 0x76, 0x76, 0xab, 0xab, 0xab, 0xd8, 0xd8, 0xd8, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+    0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xe5,
+    0xe5, 0xe5, 0xce, 0xce, 0xce, 0xb6, 0xb6, 0xb6, 0x7f, 0x7f, 0x7f, 0x3f, 0x3f, 0x3f, 0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x08, 0x1d, 0x1d, 0x1d, 0x57,
+    0x57, 0x57, 0xaf, 0xaf, 0xaf, 0x81, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9,
+    0xf9, 0x81, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xf6, 0xf6, 0x81, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff,
+    0xff, 0x02, 0xf8, 0xf8, 0xf8, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x08, 0xed, 0xed, 0xed, 0x99, 0x99, 0x99, 0x37, 0x37,
+    0x37, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x30, 0x30, 0x30, 0x7e, 0x7e, 0x7e, 0xc9, 0xc9, 0xc9, 0xf2, 0xf2, 0xf2, 0x82, 0xff, 0xff, 0xff, 0x08,
+    0xf3, 0xf3, 0xf3, 0xfe, 0xfe, 0xfe, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff,
+    0xfd, 0xfd, 0xfd, 0x83, 0xff, 0xff, 0xff, 0x0b, 0xec, 0xec, 0xec, 0xc3, 0xc3, 0xc3, 0x87, 0x87, 0x87, 0x21, 0x21, 0x21, 0x00, 0x00, 0x00, 0x07,
+    0x07, 0x07, 0x29, 0x29, 0x29, 0x94, 0x94, 0x94, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf7, 0x83, 0xff, 0xff, 0xff,
+    0x00, 0xf7, 0xf7, 0xf7, 0x81, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x09, 0xe9, 0xe9, 0xe9,
+    0xf6, 0xf6, 0xf6, 0x88, 0x88, 0x88, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x65, 0x65, 0x65, 0xc5, 0xc5, 0xc5, 0xf1, 0xf1, 0xf1,
+    0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf7, 0x83, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xf6, 0xf6, 0xf8, 0xf8,
+    0xf8, 0x81, 0xff, 0xff, 0xff, 0x04, 0xf2, 0xf2, 0xf2, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0x81, 0xff, 0xff,
+    0xff, 0x09, 0xea, 0xea, 0xea, 0xd3, 0xd3, 0xd3, 0x5e, 0x5e, 0x5e, 0x00, 0x00, 0x00, 0x0d, 0x0d, 0x0d, 0x12, 0x12, 0x12, 0x76, 0x76, 0x76, 0xf5,
+    0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x81, 0xf9, 0xf9, 0xf9, 0x02, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff,
+    0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xfa, 0xfa, 0x81, 0xfc, 0xfc, 0xfc, 0x05, 0x6b,
+    0x6b, 0x6b, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x93, 0x93, 0x93, 0xd2, 0xd2, 0xd2, 0x81, 0xff, 0xff, 0xff, 0x08, 0xf8, 0xf8,
+    0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf7, 0xf7,
+    0xf7, 0x81, 0xff, 0xff, 0xff, 0x01, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x0e, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xff,
+    0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xe3, 0xe3, 0xe3, 0x99, 0x99, 0x99, 0x0a, 0x0a, 0x0a, 0x02, 0x02, 0x02, 0x0d,
+    0x0d, 0x0d, 0x78, 0x78, 0x78, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0x81, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xf4, 0xf4, 0x82, 0xff,
+    0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x06, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80,
+    0x09, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0xaf, 0xaf, 0xaf, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x82, 0xff, 0xff, 0xff,
+    0x02, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x03, 0xe8, 0xe8, 0xe8, 0x2f, 0x2f, 0x2f, 0x25, 0x25, 0x25,
+    0xe0, 0xe0, 0xe0, 0x81, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x0e, 0xfb, 0xfb, 0xfb, 0xf7, 0xf7,
+    0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xec, 0xec, 0xec, 0xc1, 0xc1, 0xc1, 0x0a, 0x0a, 0x0a, 0x0c, 0x0c, 0x0c, 0x01, 0x01, 0x01, 0x7d, 0x7d,
+    0x7d, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0x82, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe,
+    0x00, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x08, 0xf9, 0xf9, 0xf9, 0x95, 0x95, 0x95, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x0f, 0x0f, 0x0f,
+    0xcc, 0xcc, 0xcc, 0xfb, 0xfb, 0xfb, 0xf1, 0xf1, 0xf1, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x02, 0xfc, 0xfc, 0xfc, 0xf6, 0xf6, 0xf6, 0xfe,
+    0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x0d, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x44, 0x44, 0x44, 0x04, 0x04, 0x04, 0x06, 0x06,
+    0x06, 0x50, 0x50, 0x50, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf7, 0xf7,
+    0xf7, 0x81, 0xff, 0xff, 0xff, 0x0b, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xc1, 0xc1, 0xc1, 0x12, 0x12, 0x12,
+    0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x9a, 0x9a, 0x9a, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x01, 0xfb,
+    0xfb, 0xfb, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x07, 0xfd, 0xfd, 0xfd, 0xbd, 0xbd, 0xbd,
+    0x2f, 0x2f, 0x2f, 0x07, 0x07, 0x07, 0x0e, 0x0e, 0x0e, 0xab, 0xab, 0xab, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0x82, 0xff, 0xff, 0xff, 0x01, 0xf8,
+    0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x05, 0xfa, 0xfa, 0xfa, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0x97, 0x97,
+    0x97, 0x11, 0x11, 0x11, 0x81, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x0f, 0x0f, 0x9f, 0x9f, 0x9f, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa,
+    0x81, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf9, 0xf9, 0x82, 0xff, 0xff, 0xff, 0x07, 0xfc, 0xfc, 0xfc,
+    0xbe, 0xbe, 0xbe, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x23, 0x23, 0x23, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x83, 0xff, 0xff,
+    0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x0c, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc,
+    0xfc, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xe5, 0xe5, 0xe5, 0x4f, 0x4f, 0x4f, 0x0c, 0x0c, 0x0c, 0x01, 0x01, 0x01, 0x9a, 0x9a,
+    0x9a, 0x81, 0xfa, 0xfa, 0xfa, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x15, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+    0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfd, 0xfa, 0xcb, 0xc3, 0xc0, 0x31, 0x2d, 0x2c, 0x00, 0x01, 0x07, 0x00, 0x08, 0x14,
+    0x02, 0x07, 0x0d, 0x06, 0x00, 0x00, 0x2c, 0x22, 0x23, 0xca, 0xc8, 0xcb, 0xf9, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf2, 0xf7, 0xf0, 0xff, 0xff, 0xfb,
+    0xff, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0x81, 0xff, 0xff, 0xff, 0x0c, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xeb,
+    0xeb, 0xeb, 0x99, 0x99, 0x99, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x4b, 0x4b, 0x4b, 0xe5, 0xe5, 0xe5, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa,
+    0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x82, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x83, 0xff,
+    0xff, 0xff, 0x07, 0xf7, 0xf7, 0xf7, 0x90, 0x90, 0x90, 0x18, 0x18, 0x18, 0x05, 0x05, 0x05, 0x5e, 0x5e, 0x5e, 0xd9, 0xd9, 0xd9, 0xff, 0xff, 0xff,
+    0xf9, 0xf9, 0xf9, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfc, 0x83, 0xff, 0xff, 0xff, 0x13, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xfa, 0xe3, 0xec, 0xf3, 0x67, 0x6a, 0x6f, 0x15, 0x0c, 0x07, 0x00, 0x04, 0x13, 0x13, 0x49, 0x75, 0x19, 0x49, 0x6f, 0x00, 0x02, 0x0b, 0x11, 0x09,
+    0x07, 0x68, 0x66, 0x67, 0xe8, 0xec, 0xed, 0xf3, 0xf7, 0xf6, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf8, 0xfb, 0xff, 0xfe, 0xfe,
+    0xfe, 0xf9, 0xf9, 0xf9, 0x81, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf8, 0xf8, 0x81, 0xff, 0xff, 0xff, 0x08, 0xdc, 0xdc, 0xdc, 0x5e, 0x5e, 0x5e, 0x05,
+    0x05, 0x05, 0x1c, 0x1c, 0x1c, 0x8e, 0x8e, 0x8e, 0xf7, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff,
+    0x01, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0x02, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe,
+    0xfe, 0xff, 0xff, 0xff, 0xca, 0xca, 0xca, 0x3b, 0x3b, 0x3b, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0xc4, 0xc4, 0xc4, 0x81, 0xff, 0xff, 0xff, 0x00,
+    0xf6, 0xf6, 0xf6, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x14, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xf8, 0xf7, 0x98, 0xa8, 0xb7, 0x11, 0x18, 0x20, 0x04, 0x00, 0x00, 0x01, 0x28, 0x47, 0x24, 0x8a, 0xde, 0x26, 0x86, 0xd3, 0x00, 0x25,
+    0x46, 0x00, 0x01, 0x00, 0x1b, 0x1b, 0x19, 0x9c, 0x9a, 0x9b, 0xfb, 0xf9, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xfb, 0xfb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x0b, 0xc0,
+    0xc0, 0xc0, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0xd4, 0xd4, 0xd4, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe,
+    0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x07, 0xfd,
+    0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x86, 0x86, 0x86, 0x0c, 0x0c, 0x0c, 0x19, 0x19, 0x19, 0x7c, 0x7c, 0x7c, 0xf4, 0xf4, 0xf4, 0x81,
+    0xff, 0xff, 0xff, 0x81, 0xfc, 0xfc, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x14, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb,
+    0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xd0, 0xd7, 0xdf, 0x3f, 0x42, 0x47, 0x05, 0x01, 0x00, 0x00, 0x0b, 0x18, 0x1a, 0x62, 0x9c, 0x22, 0xa0,
+    0xff, 0x1f, 0x95, 0xf5, 0x19, 0x67, 0xa7, 0x00, 0x0f, 0x13, 0x00, 0x09, 0x0b, 0x42, 0x3e, 0x3f, 0xde, 0xd5, 0xd8, 0xff, 0xfa, 0xff, 0xfd, 0xfc,
+    0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xfa, 0x81, 0xff, 0xff, 0xff, 0x0e, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+    0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0x84, 0x84, 0x84, 0x05, 0x05, 0x05, 0x10, 0x10, 0x10, 0x8b, 0x8b, 0x8b, 0xf0, 0xf0, 0xf0,
+    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x0c, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa,
+    0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xd7, 0xd7, 0xd7, 0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x43, 0x43, 0x43, 0xcc, 0xcc, 0xcc, 0xfb,
+    0xfb, 0xfb, 0xf8, 0xf8, 0xf8, 0x81, 0xff, 0xff, 0xff, 0x1c, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff,
+    0xff, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0x75, 0x86, 0x96, 0x11, 0x03, 0x00, 0x0c, 0x03, 0x00, 0x18, 0x49,
+    0x72, 0x24, 0x8e, 0xe4, 0x1f, 0x97, 0xf6, 0x21, 0x92, 0xee, 0x23, 0x92, 0xec, 0x18, 0x46, 0x5e, 0x00, 0x08, 0x17, 0x0a, 0x0b, 0x10, 0x82, 0x77,
+    0x7b, 0xf8, 0xf1, 0xf8, 0xf4, 0xf5, 0xfa, 0xfc, 0xff, 0xff, 0xfa, 0xfd, 0xf4, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb,
+    0xfb, 0x81, 0xff, 0xff, 0xff, 0x82, 0xfd, 0xfd, 0xfd, 0x0a, 0xca, 0xca, 0xca, 0x3a, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0xd5, 0xd5,
+    0xd5, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0x0c, 0xfd, 0xfd, 0xfd, 0xfb,
+    0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xa7, 0xa7, 0xa7, 0x1c, 0x1c, 0x1c, 0x06, 0x06, 0x06, 0x73,
+    0x73, 0x73, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0x81, 0xff, 0xff, 0xff, 0x19, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff,
+    0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xbc, 0xbc, 0xbc, 0x1d, 0x2e, 0x3e, 0x11, 0x04,
+    0x00, 0x07, 0x11, 0x1a, 0x2c, 0x83, 0xca, 0x19, 0x98, 0xff, 0x22, 0x8e, 0xe6, 0x30, 0x96, 0xe8, 0x15, 0x94, 0xfb, 0x2b, 0x7a, 0xb3, 0x00, 0x24,
+    0x48, 0x00, 0x02, 0x0e, 0x37, 0x31, 0x31, 0xba, 0xb8, 0xb9, 0xfc, 0xff, 0xff, 0xf8, 0xfc, 0xfd, 0xff, 0xfe, 0xf9, 0xf7, 0xf7, 0xf7, 0x81, 0xff,
+    0xff, 0xff, 0x01, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0x83, 0xff, 0xff, 0xff, 0x07, 0xef, 0xef, 0xef, 0x7f, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x15,
+    0x15, 0x15, 0xa5, 0xa5, 0xa5, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0x82, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0xfa, 0xfa,
+    0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xeb, 0xeb, 0xeb, 0x6e, 0x6e, 0x6e, 0x08, 0x08, 0x08, 0x2d, 0x2d, 0x2d, 0xb0, 0xb0,
+    0xb0, 0x81, 0xff, 0xff, 0xff, 0x06, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff,
+    0xfa, 0xfa, 0xfa, 0x81, 0xff, 0xff, 0xff, 0x13, 0xfc, 0xfc, 0xfc, 0xd8, 0xd8, 0xd8, 0x69, 0x69, 0x69, 0x00, 0x05, 0x0e, 0x10, 0x1c, 0x28, 0x10,
+    0x46, 0x74, 0x27, 0x9a, 0xf7, 0x12, 0x97, 0xff, 0x24, 0x90, 0xe8, 0x33, 0x99, 0xed, 0x15, 0x91, 0xf5, 0x24, 0x90, 0xea, 0x15, 0x5b, 0x96, 0x00,
+    0x14, 0x25, 0x10, 0x12, 0x0f, 0x5f, 0x60, 0x5b, 0xe5, 0xea, 0xee, 0xf8, 0xf9, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff,
+    0x02, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0x82, 0xff, 0xff, 0xff, 0x05, 0xfb, 0xfb, 0xfb, 0xb6, 0xb6, 0xb6, 0x29, 0x29, 0x29,
+    0x07, 0x07, 0x07, 0x6f, 0x6f, 0x6f, 0xec, 0xec, 0xec, 0x81, 0xff, 0xff, 0xff, 0x02, 0xf9, 0xf9, 0xf9, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0x12,
+    0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xd8, 0xd8, 0xd8, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,
+    0x4d, 0x4d, 0x4d, 0xe0, 0xe0, 0xe0, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff,
+    0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x81, 0xff, 0xff, 0xff, 0x05, 0xf4, 0xf4, 0xf4, 0xb4, 0xb4, 0xb4, 0x23, 0x23, 0x23, 0x08,
+    0x06, 0x07, 0x00, 0x27, 0x48, 0x28, 0x85, 0xd2, 0x81, 0x17, 0x98, 0xff, 0x0d, 0x20, 0x93, 0xf0, 0x26, 0x94, 0xed, 0x23, 0x96, 0xf3, 0x14, 0x91,
+    0xff, 0x2e, 0x82, 0xca, 0x14, 0x37, 0x4d, 0x00, 0x03, 0x00, 0x27, 0x2c, 0x25, 0x97, 0x9f, 0xa1, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xff,
+    0xff, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0x83, 0xff, 0xff, 0xff, 0x07, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xd0, 0xd0, 0xd0,
+    0x57, 0x57, 0x57, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0xcd, 0xcd, 0xcd, 0x81, 0xff, 0xff, 0xff, 0x02, 0xc0, 0xc0, 0xc0, 0x93, 0x93, 0x93, 0xb7,
+    0xb7, 0xb7, 0x00, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x09, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xb0, 0xb0, 0xb0, 0x23, 0x23, 0x23, 0x00,
+    0x00, 0x00, 0x83, 0x83, 0x83, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0x81, 0xff, 0xff, 0xff, 0x03, 0xfa, 0xfa,
+    0xfa, 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xfc, 0xfc, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0xff, 0x12, 0xe2, 0xe2, 0xe2, 0x55, 0x54, 0x52, 0x07, 0x06, 0x04,
+    0x00, 0x18, 0x33, 0x1f, 0x66, 0x9e, 0x21, 0x94, 0xef, 0x10, 0x95, 0xfe, 0x1b, 0x99, 0xfd, 0x25, 0x98, 0xf3, 0x1f, 0x92, 0xed, 0x20, 0x9b, 0xfb,
+    0x1c, 0x93, 0xf1, 0x20, 0x97, 0xf5, 0x17, 0x65, 0xa3, 0x02, 0x12, 0x1f, 0x07, 0x00, 0x00, 0x58, 0x5f, 0x65, 0xca, 0xd8, 0xe3, 0xff, 0xff, 0xfd,
+    0x81, 0xff, 0xff, 0xff, 0x00, 0xf1, 0xf1, 0xf1, 0x81, 0xff, 0xff, 0xff, 0x0e, 0xf9, 0xf9, 0xf9, 0xc6, 0xc6, 0xc6, 0xb5, 0xb5, 0xb5, 0xfb, 0xfb,
+    0xfb, 0xfe, 0xfe, 0xfe, 0xf5, 0xf5, 0xf5, 0x83, 0x83, 0x83, 0x00, 0x00, 0x00, 0x21, 0x21, 0x21, 0xb0, 0xb0, 0xb0, 0xff, 0xff, 0xff, 0xef, 0xef,
+    0xef, 0x52, 0x52, 0x52, 0x0f, 0x0f, 0x0f, 0x2e, 0x2e, 0x2e, 0x08, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff,
+    0xff, 0xff, 0xa0, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0xa1, 0xa1, 0xa1, 0x81, 0xff, 0xff, 0xff, 0x81, 0xfa, 0xfa, 0xfa, 0x00, 0xfe,
+    0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x18, 0xfc, 0xfc, 0xfc, 0xfa, 0xfb, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf8, 0xf7, 0xf5, 0x9e, 0x9d,
+    0x9b, 0x23, 0x23, 0x23, 0x00, 0x01, 0x04, 0x0a, 0x3e, 0x66, 0x2a, 0x7b, 0xbc, 0x25, 0x9a, 0xf7, 0x16, 0x97, 0xfd, 0x1f, 0x9a, 0xfa, 0x25, 0x97,
+    0xf0, 0x1e, 0x91, 0xec, 0x1f, 0x9b, 0xfd, 0x1b, 0x92, 0xf0, 0x2a, 0x9d, 0xf8, 0x29, 0x81, 0xc8, 0x11, 0x3a, 0x5a, 0x00, 0x01, 0x05, 0x28, 0x27,
+    0x25, 0x9b, 0x9c, 0x9e, 0xf6, 0xfa, 0xfd, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x05, 0xf8, 0xf8, 0xf8, 0xfd, 0xfd, 0xfd, 0xd5, 0xd5, 0xd5,
+    0x37, 0x37, 0x37, 0x41, 0x41, 0x41, 0x9a, 0x9a, 0x9a, 0x81, 0xff, 0xff, 0xff, 0x08, 0xa0, 0xa0, 0xa0, 0x10, 0x10, 0x10, 0x03, 0x03, 0x03, 0xa7,
+    0xa7, 0xa7, 0xf6, 0xf6, 0xf6, 0x85, 0x85, 0x85, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x56, 0x56, 0x56, 0x0b, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe,
+    0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe9, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0xb0, 0xb0, 0xb0, 0xff, 0xff, 0xff,
+    0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x1a, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xfe, 0xff, 0xfc,
+    0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe4, 0xdf, 0xdb, 0x51, 0x50, 0x4e, 0x00, 0x01, 0x07, 0x03, 0x15, 0x23, 0x1d, 0x6b, 0xa9, 0x2b, 0x8f, 0xdd, 0x25,
+    0x9c, 0xfa, 0x1a, 0x96, 0xf8, 0x25, 0x98, 0xf3, 0x26, 0x94, 0xeb, 0x1e, 0x91, 0xec, 0x1f, 0x9b, 0xfd, 0x20, 0x93, 0xee, 0x2b, 0x9d, 0xf6, 0x2e,
+    0x97, 0xea, 0x1b, 0x69, 0xa7, 0x00, 0x1a, 0x32, 0x08, 0x00, 0x00, 0x5e, 0x51, 0x48, 0xd5, 0xde, 0xe5, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff,
+    0x10, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xd3, 0xd3, 0xd3, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x99, 0x99, 0x99, 0xf7, 0xf7,
+    0xf7, 0xb2, 0xb2, 0xb2, 0x28, 0x28, 0x28, 0x18, 0x18, 0x18, 0x74, 0x74, 0x74, 0xbf, 0xbf, 0xbf, 0x2a, 0x2a, 0x2a, 0x06, 0x06, 0x06, 0x16, 0x16,
+    0x16, 0xc2, 0xc2, 0xc2, 0x00, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x06, 0xf2, 0xf2, 0xf2, 0xbd, 0xbd, 0xbd, 0x22, 0x22, 0x22, 0x08, 0x08,
+    0x08, 0x0d, 0x0d, 0x0d, 0x7c, 0x7c, 0x7c, 0xdd, 0xdd, 0xdd, 0x81, 0xff, 0xff, 0xff, 0x1e, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff,
+    0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf4, 0xf3, 0xf1, 0xae, 0xa7, 0xa1, 0x1c, 0x1c, 0x1c, 0x00, 0x05, 0x14,
+    0x1a, 0x3f, 0x5c, 0x20, 0x89, 0xdc, 0x24, 0x96, 0xef, 0x1e, 0x96, 0xf5, 0x1c, 0x93, 0xf1, 0x28, 0x96, 0xed, 0x27, 0x94, 0xe9, 0x1f, 0x92, 0xed,
+    0x1d, 0x9b, 0xff, 0x25, 0x97, 0xf0, 0x25, 0x94, 0xed, 0x20, 0x98, 0xf7, 0x18, 0x8a, 0xe3, 0x0f, 0x48, 0x75, 0x07, 0x00, 0x00, 0x2e, 0x1b, 0x0c,
+    0x98, 0xa2, 0xab, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x0e, 0xf4, 0xf4, 0xf4, 0x8b, 0x8b, 0x8b, 0x15,
+    0x15, 0x15, 0x00, 0x00, 0x00, 0x2c, 0x2c, 0x2c, 0x9d, 0x9d, 0x9d, 0xcb, 0xcb, 0xcb, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x5d, 0x5d, 0x5d, 0x38,
+    0x38, 0x38, 0x0d, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x9c, 0x9c, 0x9c, 0xf6, 0xf6, 0xf6, 0x81, 0xff, 0xff, 0xff, 0x39, 0xfa, 0xfa, 0xfa, 0xe7, 0xe7,
+    0xe7, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x89, 0x89, 0x89, 0xf2, 0xf2, 0xf2, 0xff, 0xff,
+    0xff, 0xef, 0xef, 0xef, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfd, 0xf9, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xe0, 0xdf,
+    0xdd, 0x60, 0x57, 0x50, 0x00, 0x01, 0x04, 0x00, 0x20, 0x3d, 0x24, 0x66, 0x9a, 0x1e, 0x96, 0xf5, 0x1c, 0x97, 0xf7, 0x1a, 0x92, 0xf1, 0x1f, 0x92,
+    0xed, 0x28, 0x96, 0xed, 0x27, 0x95, 0xec, 0x1f, 0x94, 0xf1, 0x1d, 0x99, 0xfb, 0x25, 0x97, 0xf0, 0x1e, 0x90, 0xe9, 0x16, 0x96, 0xfb, 0x14, 0x97,
+    0xff, 0x1f, 0x70, 0xb1, 0x0d, 0x17, 0x20, 0x0c, 0x00, 0x00, 0x4e, 0x57, 0x5e, 0xe3, 0xe3, 0xe3, 0xfc, 0xfc, 0xfc, 0xf2, 0xf2, 0xf2, 0xff, 0xff,
+    0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x88, 0x88, 0x88, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x24, 0x24, 0x24, 0x6c, 0x6c,
+    0x6c, 0x46, 0x46, 0x46, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x01, 0x47, 0x47, 0x47, 0xee, 0xee, 0xee, 0xff, 0xff,
+    0xff, 0x06, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0x95, 0x95, 0x95, 0x01, 0x01, 0x01, 0x09, 0x09, 0x09, 0x07, 0x07, 0x07, 0x81,
+    0x00, 0x00, 0x00, 0x02, 0x12, 0x12, 0x12, 0x84, 0x84, 0x84, 0xec, 0xec, 0xec, 0x83, 0xff, 0xff, 0xff, 0x20, 0xff, 0xf8, 0xf2, 0xfc, 0xff, 0xff,
+    0xf9, 0xff, 0xff, 0xb9, 0xb9, 0xb9, 0x20, 0x19, 0x13, 0x00, 0x03, 0x0c, 0x08, 0x41, 0x6e, 0x24, 0x82, 0xcc, 0x1e, 0x9c, 0xff, 0x1d, 0x98, 0xf8,
+    0x1f, 0x94, 0xf1, 0x24, 0x96, 0xef, 0x25, 0x97, 0xf0, 0x24, 0x97, 0xf2, 0x1f, 0x96, 0xf4, 0x1d, 0x95, 0xf4, 0x24, 0x96, 0xef, 0x1e, 0x93, 0xf0,
+    0x1d, 0x9d, 0xff, 0x17, 0x98, 0xfe, 0x23, 0x84, 0xd1, 0x10, 0x3e, 0x62, 0x00, 0x02, 0x0b, 0x1a, 0x1a, 0x1a, 0xb8, 0xb8, 0xb8, 0xf9, 0xf9, 0xf9,
+    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0x92, 0x92, 0x92, 0x81, 0x00, 0x00,
+    0x00, 0x08, 0x1a, 0x1a, 0x1a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0xc4, 0xc4, 0xc4, 0xf5,
+    0xf5, 0xf5, 0xff, 0xff, 0xff, 0x32, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xcd, 0xcd, 0xcd, 0x16, 0x16, 0x16, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x86, 0x86, 0x86, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff,
+    0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf6, 0xfc, 0xff, 0xff, 0xea, 0xf3, 0xfa, 0x78, 0x79, 0x7b, 0x03, 0x00, 0x00, 0x02, 0x15, 0x24,
+    0x19, 0x61, 0x9b, 0x1f, 0x96, 0xf4, 0x22, 0x9a, 0xf9, 0x21, 0x96, 0xf3, 0x26, 0x98, 0xf1, 0x25, 0x98, 0xf3, 0x1f, 0x96, 0xf4, 0x20, 0x98, 0xf7,
+    0x22, 0x99, 0xf7, 0x1f, 0x92, 0xed, 0x23, 0x96, 0xf1, 0x1c, 0x97, 0xf7, 0x24, 0xa0, 0xff, 0x1e, 0x91, 0xec, 0x24, 0x8e, 0xe2, 0x13, 0x66, 0xa8,
+    0x00, 0x13, 0x30, 0x09, 0x00, 0x00, 0x76, 0x76, 0x76, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa,
+    0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x8c, 0x8c, 0x8c, 0x16, 0x16, 0x16, 0x82, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x07,
+    0x07, 0x07, 0x8f, 0x8f, 0x8f, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x0d, 0xf4, 0xf4, 0xf4, 0xee, 0xee, 0xee, 0x4d, 0x4d, 0x4d,
+    0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x63, 0x63, 0x63, 0x31, 0x31, 0x31, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x96, 0x96, 0x96, 0xee, 0xee, 0xee, 0x81, 0xff, 0xff, 0xff, 0x29, 0xff, 0xfd, 0xf4, 0xf5, 0xf9, 0xfc, 0xca, 0xd4, 0xdd, 0x3a,
+    0x3b, 0x3d, 0x01, 0x00, 0x00, 0x15, 0x2e, 0x42, 0x23, 0x76, 0xb8, 0x1a, 0x9f, 0xff, 0x22, 0x95, 0xf0, 0x24, 0x93, 0xec, 0x29, 0x97, 0xee, 0x24,
+    0x97, 0xf2, 0x19, 0x94, 0xf4, 0x1d, 0x99, 0xfb, 0x25, 0x9c, 0xfa, 0x21, 0x93, 0xec, 0x26, 0x99, 0xf4, 0x17, 0x95, 0xf9, 0x24, 0x9b, 0xf9, 0x21,
+    0x8a, 0xdd, 0x28, 0x96, 0xed, 0x1b, 0x88, 0xdd, 0x00, 0x2c, 0x56, 0x0f, 0x00, 0x00, 0x39, 0x39, 0x39, 0xd5, 0xd5, 0xd5, 0xfc, 0xfc, 0xfc, 0xf7,
+    0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xe8, 0x8a, 0x8a, 0x8a, 0x0a,
+    0x0a, 0x0a, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x59, 0x59, 0x59, 0xe2, 0xe2, 0xe2, 0xf8, 0xf8, 0xf8, 0x81, 0xff, 0xff, 0xff,
+    0x29, 0xdb, 0xdb, 0xdb, 0x95, 0x95, 0x95, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x36, 0x36, 0x36, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x39, 0x39,
+    0x39, 0xba, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x0d, 0x0d, 0x0d, 0x97, 0x97, 0x97, 0xe8, 0xe8, 0xe8, 0xff, 0xff,
+    0xff, 0xf6, 0xff, 0xff, 0xff, 0xf8, 0xef, 0xba, 0xbe, 0xc1, 0x00, 0x04, 0x12, 0x06, 0x0f, 0x16, 0x17, 0x43, 0x66, 0x23, 0x90, 0xe5, 0x18, 0x9b,
+    0xff, 0x2c, 0x92, 0xe6, 0x21, 0x99, 0xfa, 0x1d, 0x9c, 0xff, 0x18, 0x8d, 0xec, 0x24, 0x8e, 0xe4, 0x27, 0x99, 0xf2, 0x18, 0x96, 0xfc, 0x1c, 0xa0,
+    0xff, 0x29, 0x92, 0xe5, 0x23, 0x9a, 0xf8, 0x17, 0x93, 0xf5, 0x19, 0x91, 0xf0, 0x21, 0x9f, 0xff, 0x1c, 0x93, 0xf1, 0x0b, 0x4d, 0x81, 0x02, 0x06,
+    0x09, 0x07, 0x07, 0x07, 0xb0, 0xb0, 0xb0, 0x81, 0xff, 0xff, 0xff, 0x0c, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff,
+    0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0x7b, 0x7b, 0x7b, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2e, 0xba, 0xba, 0xba,
+    0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x2e, 0x61, 0x61, 0x61, 0x28, 0x28, 0x28, 0x01, 0x01, 0x01, 0x2a, 0x2a, 0x2a,
+    0xb4, 0xb4, 0xb4, 0x7b, 0x7b, 0x7b, 0x0a, 0x0a, 0x0a, 0x2d, 0x2d, 0x2d, 0xb6, 0xb6, 0xb6, 0xeb, 0xeb, 0xeb, 0xa3, 0xa3, 0xa3, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0xd7, 0xd7, 0xd7, 0xfb, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xf7, 0xee, 0xe7, 0x8e, 0x92, 0x95, 0x00, 0x02, 0x0b,
+    0x0a, 0x17, 0x20, 0x23, 0x62, 0x95, 0x22, 0x95, 0xf0, 0x1a, 0x89, 0xe2, 0x28, 0x77, 0xb9, 0x1d, 0x80, 0xd1, 0x22, 0x97, 0xf6, 0x20, 0x96, 0xf6,
+    0x22, 0x93, 0xef, 0x28, 0x96, 0xef, 0x1b, 0x8c, 0xe8, 0x19, 0x8e, 0xed, 0x26, 0x93, 0xe8, 0x21, 0x99, 0xf8, 0x1c, 0x97, 0xf7, 0x1c, 0x91, 0xee,
+    0x1f, 0x9b, 0xfd, 0x1f, 0x97, 0xf6, 0x17, 0x5f, 0x99, 0x09, 0x19, 0x26, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff,
+    0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x07, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xb7, 0xb7, 0xb7, 0x2d,
+    0x2d, 0x2d, 0x07, 0x07, 0x07, 0x6b, 0x6b, 0x6b, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x2a, 0x18,
+    0x18, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x8c, 0x8c, 0x8c, 0xfd, 0xfd, 0xfd, 0xa4, 0xa4, 0xa4, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x9d,
+    0x9d, 0x9d, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x99, 0x99, 0x99, 0x40, 0x40, 0x40, 0x27, 0x27, 0x27, 0xd9, 0xd9, 0xd9, 0xfb, 0xfb, 0xfb, 0xfc,
+    0xff, 0xff, 0xe9, 0xe8, 0xe6, 0x67, 0x6c, 0x70, 0x00, 0x00, 0x02, 0x0d, 0x1f, 0x2d, 0x22, 0x7d, 0xc4, 0x18, 0x96, 0xfa, 0x15, 0x6a, 0xad, 0x07,
+    0x32, 0x55, 0x06, 0x45, 0x7a, 0x1e, 0x7f, 0xce, 0x21, 0x9b, 0xfe, 0x19, 0x97, 0xfd, 0x25, 0x96, 0xf2, 0x2a, 0x94, 0xe8, 0x2d, 0x95, 0xea, 0x22,
+    0x95, 0xf0, 0x1e, 0x99, 0xf9, 0x22, 0x9a, 0xf9, 0x20, 0x92, 0xeb, 0x19, 0x94, 0xf4, 0x1f, 0x9b, 0xfd, 0x1e, 0x71, 0xb3, 0x0b, 0x29, 0x41, 0x00,
+    0x00, 0x00, 0x68, 0x68, 0x68, 0xe8, 0xe8, 0xe8, 0x82, 0xff, 0xff, 0xff, 0x0a, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8,
+    0xf8, 0xfc, 0xfc, 0xfc, 0xa9, 0xa9, 0xa9, 0x13, 0x13, 0x13, 0x07, 0x07, 0x07, 0xa2, 0xa2, 0xa2, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0x81, 0xfe,
+    0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x09, 0x34, 0x34, 0x34, 0x0e, 0x0e, 0x0e, 0x57, 0x57, 0x57, 0xe9, 0xe9, 0xe9, 0xf2, 0xf2, 0xf2, 0xbf, 0xbf,
+    0xbf, 0x1a, 0x1a, 0x1a, 0x01, 0x01, 0x01, 0x7b, 0x7b, 0x7b, 0xed, 0xed, 0xed, 0x81, 0xfb, 0xfb, 0xfb, 0x1f, 0xbe, 0xbe, 0xbe, 0xc2, 0xc2, 0xc2,
+    0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xe9, 0xea, 0xec, 0x63, 0x68, 0x6c, 0x05, 0x00, 0x00, 0x0c, 0x21, 0x32, 0x14, 0x81, 0xd6,
+    0x12, 0x95, 0xfd, 0x0e, 0x4d, 0x80, 0x00, 0x02, 0x0c, 0x00, 0x18, 0x2e, 0x22, 0x68, 0xa3, 0x22, 0x9d, 0xfd, 0x0e, 0x98, 0xff, 0x18, 0x94, 0xf6,
+    0x28, 0x97, 0xf0, 0x2c, 0x9d, 0xf9, 0x22, 0x99, 0xf7, 0x1a, 0x98, 0xfc, 0x24, 0x9b, 0xf9, 0x24, 0x92, 0xe9, 0x17, 0x8f, 0xee, 0x1e, 0x9c, 0xff,
+    0x1d, 0x78, 0xbf, 0x02, 0x29, 0x48, 0x06, 0x06, 0x06, 0x62, 0x62, 0x62, 0xea, 0xea, 0xea, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x83, 0xff,
+    0xff, 0xff, 0x06, 0xf5, 0xf5, 0xf5, 0x78, 0x78, 0x78, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x1d, 0xc1, 0xc1, 0xc1, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff,
+    0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x09, 0xb0, 0xb0, 0xb0, 0x87, 0x87, 0x87, 0xc6, 0xc6, 0xc6, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb,
+    0xce, 0xce, 0xce, 0x4a, 0x4a, 0x4a, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0xd4, 0xd4, 0xd4, 0x82, 0xff, 0xff, 0xff, 0x1f, 0xfa, 0xfa, 0xfa, 0xfe,
+    0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xec, 0xed, 0xef, 0x74, 0x78, 0x7b, 0x04, 0x00, 0x00, 0x09, 0x1c, 0x2b, 0x0b, 0x75, 0xc9, 0x1d,
+    0x9d, 0xff, 0x0f, 0x4c, 0x7b, 0x07, 0x08, 0x0c, 0x08, 0x0b, 0x10, 0x29, 0x54, 0x77, 0x27, 0x93, 0xeb, 0x14, 0x9c, 0xff, 0x1a, 0x96, 0xfa, 0x1a,
+    0x90, 0xf0, 0x0f, 0x93, 0xff, 0x22, 0x9a, 0xf9, 0x18, 0x96, 0xfa, 0x22, 0x99, 0xf7, 0x27, 0x94, 0xe9, 0x1d, 0x92, 0xef, 0x21, 0x9c, 0xfc, 0x1d,
+    0x72, 0xb5, 0x00, 0x20, 0x3c, 0x01, 0x01, 0x01, 0x6f, 0x6f, 0x6f, 0xf2, 0xf2, 0xf2, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0x82, 0xff, 0xff, 0xff,
+    0x06, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0x52, 0x52, 0x52, 0x04, 0x04, 0x04, 0x47, 0x47, 0x47, 0xca, 0xca, 0xca, 0x81, 0xff,
+    0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0x82, 0xff, 0xff, 0xff, 0x05, 0xe9, 0xe9,
+    0xe9, 0x6d, 0x6d, 0x6d, 0x04, 0x04, 0x04, 0x23, 0x23, 0x23, 0xc3, 0xc3, 0xc3, 0xf9, 0xf9, 0xf9, 0x81, 0xff, 0xff, 0xff, 0x1e, 0xf4, 0xf4, 0xf4,
+    0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xf2, 0xee, 0xeb, 0x8f, 0x90, 0x92, 0x01, 0x00, 0x00, 0x05, 0x12, 0x1b, 0x0d, 0x60, 0xa2,
+    0x2a, 0x9f, 0xfc, 0x1b, 0x67, 0xa3, 0x06, 0x1c, 0x31, 0x02, 0x00, 0x01, 0x17, 0x28, 0x38, 0x1f, 0x6e, 0xb0, 0x25, 0x94, 0xee, 0x36, 0x9b, 0xed,
+    0x28, 0x94, 0xec, 0x10, 0x9c, 0xff, 0x21, 0x96, 0xf3, 0x19, 0x95, 0xf7, 0x1f, 0x97, 0xf6, 0x28, 0x96, 0xed, 0x25, 0x98, 0xf3, 0x23, 0x96, 0xf1,
+    0x19, 0x61, 0x9b, 0x02, 0x14, 0x22, 0x00, 0x00, 0x00, 0x8c, 0x8c, 0x8c, 0xf6, 0xf6, 0xf6, 0xfd, 0xfd, 0xfd, 0x82, 0xff, 0xff, 0xff, 0x07, 0xfc,
+    0xfc, 0xfc, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xb8, 0xb8, 0xb8, 0x1e, 0x1e, 0x1e, 0x04, 0x04, 0x04, 0x76, 0x76, 0x76, 0xde, 0xde, 0xde, 0x81,
+    0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x0c, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6,
+    0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x25, 0x25, 0x25, 0x02, 0x02, 0x02, 0x83, 0x83, 0x83, 0xdc, 0xdc, 0xdc, 0xff, 0xff, 0xff,
+    0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x1c, 0xfe, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xf4, 0xeb, 0xb6, 0xb6, 0xb6, 0x15, 0x1a, 0x1e, 0x03,
+    0x07, 0x0a, 0x0a, 0x3f, 0x69, 0x26, 0x8c, 0xde, 0x24, 0x88, 0xd6, 0x00, 0x3f, 0x74, 0x00, 0x08, 0x12, 0x06, 0x04, 0x05, 0x06, 0x32, 0x57, 0x18,
+    0x5e, 0x99, 0x32, 0x6e, 0xa0, 0x2d, 0x7b, 0xbb, 0x22, 0x9e, 0xff, 0x22, 0x94, 0xed, 0x1c, 0x98, 0xfa, 0x1d, 0x98, 0xf8, 0x25, 0x97, 0xf0, 0x25,
+    0x98, 0xf3, 0x1c, 0x86, 0xda, 0x0f, 0x48, 0x75, 0x08, 0x04, 0x01, 0x12, 0x12, 0x12, 0xbb, 0xbb, 0xbb, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0x81,
+    0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x05, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0x7a, 0x7a, 0x7a, 0x01, 0x01, 0x01, 0x1b, 0x1b, 0x1b, 0xaa,
+    0xaa, 0xaa, 0x82, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff,
+    0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xd8, 0xd8, 0xd8, 0x41, 0x41, 0x41, 0x02, 0x02, 0x02, 0x34, 0x34, 0x34, 0xd1, 0xd1, 0xd1,
+    0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x14, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xff, 0xfb, 0xee, 0xdb, 0xda, 0xd8, 0x36,
+    0x40, 0x49, 0x01, 0x00, 0x00, 0x02, 0x22, 0x3b, 0x15, 0x73, 0xbd, 0x27, 0x9a, 0xf5, 0x15, 0x75, 0xc1, 0x16, 0x2c, 0x41, 0x0b, 0x01, 0x00, 0x00,
+    0x06, 0x17, 0x00, 0x1b, 0x3c, 0x0a, 0x24, 0x3b, 0x0d, 0x40, 0x6b, 0x17, 0x7f, 0xd4, 0x24, 0x92, 0xe9, 0x21, 0x9c, 0xfc, 0x1e, 0x99, 0xf9, 0x81,
+    0x22, 0x95, 0xf0, 0x09, 0x11, 0x76, 0xc6, 0x04, 0x32, 0x56, 0x0e, 0x00, 0x00, 0x35, 0x35, 0x35, 0xe4, 0xe4, 0xe4, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb,
+    0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0x81, 0xff, 0xff, 0xff, 0x07, 0xcb, 0xcb, 0xcb, 0x2f, 0x2f, 0x2f, 0x07, 0x07, 0x07,
+    0x48, 0x48, 0x48, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x29,
+    0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x8f, 0x8f, 0x8f,
+    0x13, 0x13, 0x13, 0x0a, 0x0a, 0x0a, 0x83, 0x83, 0x83, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xf8, 0xf9, 0xfa, 0xfc, 0xef, 0xf8, 0xff, 0x8f, 0x90, 0x92, 0x0f, 0x0e, 0x0c, 0x00, 0x05, 0x13, 0x0c, 0x49, 0x78, 0x24, 0x84, 0xd0,
+    0x26, 0x83, 0xe0, 0x29, 0x7a, 0xc9, 0x0d, 0x3f, 0x72, 0x04, 0x0d, 0x16, 0x12, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x26, 0x23, 0x6e, 0x96,
+    0x25, 0x92, 0xe7, 0x21, 0x99, 0xf8, 0x14, 0x99, 0xff, 0x17, 0x9a, 0xff, 0x1d, 0x87, 0xdb, 0x0c, 0x46, 0x74, 0x01, 0x0a, 0x11, 0x12, 0x00, 0x00,
+    0x94, 0x94, 0x94, 0xed, 0xed, 0xed, 0x81, 0xff, 0xff, 0xff, 0x0a, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xe9,
+    0xe9, 0xe9, 0x95, 0x95, 0x95, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09, 0x8c, 0x8c, 0x8c, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0x81, 0xff, 0xff, 0xff,
+    0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x26, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe,
+    0xfe, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x36, 0x36, 0x36, 0x01, 0x01, 0x01, 0x2c, 0x2c, 0x2c, 0xca, 0xca, 0xca, 0xfd, 0xfd, 0xfd, 0xff, 0xff,
+    0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xc7, 0xc7, 0xc7, 0x53, 0x4a, 0x43, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x26, 0x13, 0x50, 0x7f, 0x1b, 0x95, 0xe2, 0x20, 0x9a, 0xed, 0x14, 0x85, 0xd5, 0x14, 0x69, 0xaa, 0x19, 0x53, 0x83, 0x03, 0x35,
+    0x68, 0x03, 0x47, 0x8e, 0x2d, 0x86, 0xe0, 0x16, 0x94, 0xf8, 0x25, 0x9d, 0xfc, 0x1d, 0x8b, 0xe2, 0x23, 0x7f, 0xc8, 0x1f, 0x5e, 0x91, 0x00, 0x08,
+    0x21, 0x00, 0x01, 0x05, 0x5f, 0x52, 0x49, 0xd5, 0xd5, 0xd5, 0x81, 0xff, 0xff, 0xff, 0x09, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff,
+    0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xd1, 0xd1, 0xd1, 0x17, 0x17, 0x17, 0x08, 0x08, 0x08, 0x45, 0x45, 0x45, 0xc2, 0xc2, 0xc2, 0x81, 0xff, 0xff,
+    0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x2a, 0xf8, 0xf8, 0xf8,
+    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x89, 0x89, 0x89, 0x1c, 0x1c, 0x1c, 0x02, 0x02, 0x02,
+    0x56, 0x56, 0x56, 0xe9, 0xe9, 0xe9, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xf2, 0xf7, 0xfb, 0xf8, 0xff, 0xff,
+    0xfa, 0xfa, 0xfa, 0xb9, 0xab, 0xa0, 0x3c, 0x2e, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x1d, 0x2b, 0x09, 0x47, 0x80, 0x2a, 0x80, 0xcb, 0x2c, 0x9e, 0xfe,
+    0x15, 0x93, 0xf9, 0x10, 0x8b, 0xeb, 0x18, 0x8f, 0xe9, 0x18, 0x95, 0xf2, 0x13, 0x99, 0xfc, 0x11, 0x91, 0xf6, 0x36, 0xa0, 0xf4, 0x35, 0x80, 0xba,
+    0x18, 0x41, 0x61, 0x00, 0x0c, 0x19, 0x00, 0x01, 0x04, 0x37, 0x37, 0x37, 0xa6, 0xa7, 0xa9, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa,
+    0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0x81, 0xff, 0xff, 0xff, 0x05, 0xef, 0xef, 0xef, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x9d,
+    0x9d, 0x9d, 0xed, 0xed, 0xed, 0x83, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x02, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff,
+    0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf9, 0xf9, 0x81, 0xff, 0xff, 0xff, 0x2d, 0xe2, 0xe2, 0xe2, 0x5d, 0x5d, 0x5d, 0x08, 0x08,
+    0x08, 0x03, 0x03, 0x03, 0x92, 0x92, 0x92, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfe, 0xfa, 0xfc, 0xfd, 0xff, 0xf6, 0xff,
+    0xff, 0xfc, 0xff, 0xff, 0xf8, 0xf1, 0xeb, 0xa5, 0x97, 0x8c, 0x33, 0x2a, 0x23, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x10, 0x35, 0x0f, 0x4b,
+    0x87, 0x2f, 0x87, 0xd1, 0x37, 0x9b, 0xe6, 0x2d, 0x94, 0xd9, 0x28, 0x91, 0xd3, 0x2a, 0x97, 0xda, 0x2f, 0x87, 0xce, 0x05, 0x4a, 0x81, 0x00, 0x22,
+    0x3f, 0x02, 0x0b, 0x12, 0x06, 0x00, 0x00, 0x33, 0x2a, 0x23, 0x9c, 0x9c, 0x9c, 0xe7, 0xf0, 0xf7, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff,
+    0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xfc, 0xfc, 0xfc, 0x88, 0x88, 0x88, 0x03, 0x03, 0x03, 0x14, 0x14, 0x14, 0x4f, 0x4f,
+    0x4f, 0xdf, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf7,
+    0xf7, 0xf7, 0x81, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x1e,
+    0xac, 0xac, 0xac, 0x29, 0x29, 0x29, 0x10, 0x10, 0x10, 0x02, 0x02, 0x02, 0xca, 0xca, 0xca, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf2,
+    0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xa8, 0xa8, 0xa8, 0x35, 0x36, 0x38, 0x0c, 0x13, 0x03,
+    0x00, 0x0f, 0x0a, 0x00, 0x0e, 0x15, 0x00, 0x0b, 0x1f, 0x00, 0x13, 0x2e, 0x12, 0x2b, 0x4a, 0x14, 0x2c, 0x50, 0x00, 0x13, 0x3c, 0x00, 0x0e, 0x24,
+    0x00, 0x04, 0x15, 0x00, 0x02, 0x0b, 0x00, 0x01, 0x03, 0x2e, 0x2a, 0x27, 0xa3, 0xa2, 0xa0, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x81, 0xff, 0xff,
+    0xff, 0x01, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xfa, 0x81, 0xff, 0xff, 0xff, 0x0a, 0xac, 0xac, 0xac, 0x18, 0x18, 0x18, 0x03, 0x03, 0x03, 0x25, 0x25,
+    0x25, 0xba, 0xba, 0xba, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0x81, 0xfe,
+    0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x02, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff,
+    0x82, 0xfe, 0xfe, 0xfe, 0x0a, 0xfd, 0xfd, 0xfd, 0x99, 0x99, 0x99, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0xc2, 0xc2, 0xc2, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xf8, 0xf9, 0xfb, 0xfa, 0xff, 0xff, 0x82, 0xf8, 0xff, 0xff, 0x0d, 0xcc, 0xd5, 0xdc, 0x52, 0x57,
+    0x53, 0x1b, 0x1c, 0x17, 0x03, 0x00, 0x00, 0x08, 0x05, 0x00, 0x09, 0x08, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x17, 0x08, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x1e, 0x1d, 0x1b, 0x71, 0x75, 0x78, 0xd6, 0xdb, 0xdf, 0x81, 0xfb, 0xff, 0xff, 0x02, 0xfb, 0xfc, 0xfe, 0xfd, 0xfd, 0xfd,
+    0xef, 0xef, 0xef, 0x81, 0xff, 0xff, 0xff, 0x06, 0xfb, 0xfb, 0xfb, 0xcb, 0xcb, 0xcb, 0x0d, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x95,
+    0x95, 0x95, 0xf6, 0xf6, 0xf6, 0x83, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff,
+    0x02, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x81, 0xfd, 0xfd, 0xfd, 0x01, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff,
+    0xff, 0x1d, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x6e, 0x6e, 0x6e, 0x13, 0x13, 0x13, 0x0b, 0x0b, 0x0b, 0x0e, 0x0e, 0x0e, 0xbc, 0xbc, 0xbc, 0xee,
+    0xf5, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xec, 0xf1, 0xf5, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xfa, 0xff, 0xe3, 0xd4, 0xd9, 0x95, 0x87, 0x86, 0x4c, 0x44, 0x42, 0x1d, 0x21, 0x20, 0x0b, 0x19, 0x19, 0x0c, 0x1f, 0x1d, 0x11, 0x24, 0x20, 0x4d,
+    0x43, 0x3a, 0x97, 0x90, 0x8a, 0xd4, 0xd0, 0xcd, 0xf2, 0xf2, 0xf2, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xf6, 0xf7, 0xf9, 0x82, 0xff, 0xff, 0xff,
+    0x08, 0xf7, 0xf7, 0xf7, 0xe6, 0xe6, 0xe6, 0xc0, 0xc0, 0xc0, 0x03, 0x03, 0x03, 0x0a, 0x0a, 0x0a, 0x0d, 0x0d, 0x0d, 0x6f, 0x6f, 0x6f, 0xff, 0xff,
+    0xff, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x82, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff,
+    0x01, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0x82, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+    0x81, 0xfb, 0xfb, 0xfb, 0x01, 0xf9, 0xf9, 0xf9, 0x6f, 0x6f, 0x6f, 0x81, 0x08, 0x08, 0x08, 0x27, 0x04, 0x04, 0x04, 0x80, 0x92, 0xa0, 0xe7, 0xee,
+    0xf4, 0xff, 0xfe, 0xfb, 0xfc, 0xf3, 0xec, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfa, 0xf7, 0xf0, 0xea, 0xf4, 0xff, 0xf7, 0xf9, 0xff,
+    0xf8, 0xfb, 0xff, 0xf9, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf2, 0xef, 0xf6, 0xfb, 0xeb, 0xec, 0xff, 0xf7, 0xf3, 0xf9, 0xff, 0xff, 0xf8, 0xfc,
+    0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xff, 0xfb, 0xf5, 0xff, 0xfb, 0xf7, 0xff, 0xff, 0xfd, 0xf8, 0xf9, 0xfb, 0xff, 0xff, 0xff, 0xf0, 0xf0,
+    0xf0, 0xee, 0xee, 0xee, 0x9b, 0x9b, 0x9b, 0x02, 0x02, 0x02, 0x0d, 0x0d, 0x0d, 0x13, 0x13, 0x13, 0x6d, 0x6d, 0x6d, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa,
+    0xfa, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe,
+    0x00, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x0b, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0,
+    0x83, 0x83, 0x83, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x5f, 0xc0, 0xc0, 0xc0, 0xf4, 0xf4, 0xf4, 0x83, 0xff, 0xff,
+    0xff, 0x00, 0xfc, 0xfc, 0xfc, 0x85, 0xff, 0xff, 0xff, 0x03, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0x81, 0xfe,
+    0xfe, 0xfe, 0x0a, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xc4, 0xc4, 0xc4, 0x5e, 0x5e, 0x5e, 0x0a, 0x0a, 0x0a,
+    0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x79, 0x79, 0x79, 0xf8, 0xf8, 0xf8, 0x88, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff,
+    0x89, 0xff, 0xff, 0xff, 0x0c, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0x95, 0x95, 0x95, 0x32, 0x32, 0x32, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x06, 0x34, 0x34, 0x34, 0x87, 0x87, 0x87, 0xcc, 0xcc, 0xcc, 0xec, 0xec, 0xec, 0xf9, 0xf9, 0xf9, 0x83, 0xff, 0xff, 0xff,
+    0x02, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfd,
+    0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x09, 0xed, 0xed, 0xed, 0xc9, 0xc9, 0xc9, 0x8c, 0x8c, 0x8c, 0x26, 0x26, 0x26, 0x02, 0x02, 0x02, 0x0b, 0x0b,
+    0x0b, 0x25, 0x25, 0x25, 0x9d, 0x9d, 0x9d, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x88, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff,
+    0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0x81, 0xff, 0xff, 0xff, 0x05, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf5,
+    0xf5, 0xf5, 0xbd, 0xbd, 0xbd, 0x4d, 0x4d, 0x4d, 0x1e, 0x1e, 0x1e, 0x81, 0x00, 0x00, 0x00, 0x05, 0x3e, 0x3e, 0x3e, 0x88, 0x88, 0x88, 0xb9, 0xb9,
+    0xb9, 0xcb, 0xcb, 0xcb, 0xed, 0xed, 0xed, 0xf7, 0xf7, 0xf7, 0x85, 0xff, 0xff, 0xff, 0x0e, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+    0xeb, 0xeb, 0xeb, 0xd7, 0xd7, 0xd7, 0xb5, 0xb5, 0xb5, 0x76, 0x76, 0x76, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x15, 0x15, 0x15, 0x0d, 0x0d, 0x0d,
+    0x46, 0x46, 0x46, 0xc9, 0xc9, 0xc9, 0xfc, 0xfc, 0xfc, 0xf0, 0xf0, 0xf0, 0x89, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff,
+    0x88, 0xff, 0xff, 0xff, 0x0a, 0xf3, 0xf3, 0xf3, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfe,
+    0xfe, 0xfe, 0xe1, 0xe1, 0xe1, 0x8e, 0x8e, 0x8e, 0x3d, 0x3d, 0x3d, 0x17, 0x17, 0x17, 0x81, 0x00, 0x00, 0x00, 0x16, 0x24, 0x24, 0x24, 0x61, 0x61,
+    0x61, 0x89, 0x89, 0x89, 0x9b, 0x9b, 0x9b, 0xb4, 0xb4, 0xb4, 0xc9, 0xc9, 0xc9, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xcf, 0xcf,
+    0xcf, 0xc5, 0xc5, 0xc5, 0xb5, 0xb5, 0xb5, 0xa1, 0xa1, 0xa1, 0x86, 0x86, 0x86, 0x5b, 0x5b, 0x5b, 0x28, 0x28, 0x28, 0x05, 0x05, 0x05, 0x00, 0x00,
+    0x00, 0x0e, 0x0e, 0x0e, 0x3c, 0x3c, 0x3c, 0x98, 0x98, 0x98, 0xe5, 0xe5, 0xe5, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xfa, 0xfa,
+    0x88, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff,
+    0x00, 0xfc, 0xfc, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x14, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xd3, 0xd3, 0xd3, 0x87, 0x87, 0x87,
+    0x43, 0x43, 0x43, 0x1f, 0x1f, 0x1f, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x0f, 0x0f, 0x0f, 0x22, 0x22, 0x22, 0x38, 0x38, 0x38,
+    0x49, 0x49, 0x49, 0x4f, 0x4f, 0x4f, 0x4e, 0x4e, 0x4e, 0x4b, 0x4b, 0x4b, 0x3e, 0x3e, 0x3e, 0x23, 0x23, 0x23, 0x0c, 0x0c, 0x0c, 0x03, 0x03, 0x03,
+    0x81, 0x00, 0x00, 0x00, 0x06, 0x22, 0x22, 0x22, 0x54, 0x54, 0x54, 0x8d, 0x8d, 0x8d, 0xc1, 0xc1, 0xc1, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf8,
+    0xf8, 0xf8, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x88, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x87, 0xff,
+    0xff, 0xff, 0x00, 0xf1, 0xf1, 0xf1, 0x81, 0xff, 0xff, 0xff, 0x03, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0x81,
+    0xff, 0xff, 0xff, 0x09, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf5, 0xf5, 0xf5, 0xd8, 0xd8, 0xd8, 0xa0, 0xa0, 0xa0, 0x6b, 0x6b, 0x6b, 0x51, 0x51,
+    0x51, 0x1c, 0x1c, 0x1c, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x84, 0x00, 0x00, 0x00, 0x08, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x0e, 0x0e, 0x0e,
+    0x24, 0x24, 0x24, 0x43, 0x43, 0x43, 0x6f, 0x6f, 0x6f, 0xa4, 0xa4, 0xa4, 0xcc, 0xcc, 0xcc, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x81, 0xfb,
+    0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xfa, 0xfa, 0x88, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x89, 0xff,
+    0xff, 0xff, 0x01, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xf8, 0x81, 0xff, 0xff, 0xff, 0x02, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x81,
+    0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfb, 0x81, 0xff, 0xff, 0xff, 0x14, 0xeb, 0xeb, 0xeb, 0xc8, 0xc8, 0xc8, 0xb2, 0xb2, 0xb2, 0x9f, 0x9f, 0x9f,
+    0x86, 0x86, 0x86, 0x73, 0x73, 0x73, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c, 0x5f, 0x5f, 0x5f, 0x70, 0x70, 0x70, 0x85, 0x85, 0x85,
+    0xa0, 0xa0, 0xa0, 0xba, 0xba, 0xba, 0xd5, 0xd5, 0xd5, 0xef, 0xef, 0xef, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa,
+    0xf5, 0xf5, 0xf5, 0x82, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf8, 0xf8, 0x89, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x87,
+    0xff, 0xff, 0xff, 0x01, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0x84, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfb, 0x83, 0xff, 0xff, 0xff, 0x02, 0xfd,
+    0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x09, 0xfb, 0xfb, 0xfb, 0xf0, 0xf0, 0xf0, 0xe8, 0xe8, 0xe8, 0xe0, 0xe0,
+    0xe0, 0xdb, 0xdb, 0xdb, 0xdd, 0xdd, 0xdd, 0xe4, 0xe4, 0xe4, 0xeb, 0xeb, 0xeb, 0xf2, 0xf2, 0xf2, 0xf9, 0xf9, 0xf9, 0x81, 0xfb, 0xfb, 0xfb, 0x03,
+    0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0x82, 0xff, 0xff, 0xff, 0x03, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xff,
+    0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x88, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0x01, 0xf9, 0xf9,
+    0xf9, 0xff, 0xff, 0xff, 0xb7, 0xfd, 0xfd, 0xfd, 0x00, 0xf7, 0xf7, 0xf7, 0x81, 0xff, 0xff, 0xff, 0x00, 0xf3, 0xf3, 0xf3, 0xb8, 0xff, 0xff, 0xff,
+    0x02, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xb7, 0xfd, 0xfd, 0xfd, 0x00, 0xfc, 0xfc, 0xfc, 0x82, 0xfd, 0xfd, 0xfd
+};
 
-static const uint8_t image_data_recyclewater[10800] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf2, 0xf2, 0xf2, 0xe8, 0xe8, 0xe8, 0xe3, 0xe3, 0xe3, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe7, 0xe7, 0xe7, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xea, 0xea, 0xd5, 0xd5, 0xd5, 0xaf, 0xaf, 0xaf, 0x9e, 0x9e, 0x9e, 0x84, 0x84, 0x84, 0x6e, 0x6e, 0x6e, 0x62, 0x62, 0x62, 0x60, 0x60, 0x60, 0x62, 0x62, 0x62, 0x65, 0x65, 0x65, 0x69, 0x69, 0x69, 0x81, 0x81, 0x81, 0xa0, 0xa0, 0xa0, 0xb9, 0xb9, 0xb9, 0xd1, 0xd1, 0xd1, 0xea, 0xea, 0xea, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xd2, 0xd2, 0xd2, 0xa6, 0xa6, 0xa6, 0x6f, 0x6f, 0x6f, 0x45, 0x45, 0x45, 0x1b, 0x1b, 0x1b, 0x12, 0x12, 0x12, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x01, 0x01, 0x01, 0x08, 0x08, 0x08, 0x1e, 0x1e, 0x1e, 0x3f, 0x3f, 0x3f, 0x6d, 0x6d, 0x6d, 0xa7, 0xa7, 0xa7, 0xd4, 0xd4, 0xd4, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xcb, 0xcb, 0xcb, 0x87, 0x87, 0x87, 0x47, 0x47, 0x47, 0x1e, 0x1e, 0x1e, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x10, 0x10, 0x10, 0x24, 0x24, 0x24, 0x3b, 0x3b, 0x3b, 0x4c, 0x4c, 0x4c, 0x51, 0x51, 0x51, 0x4d, 0x4d, 0x4d, 0x46, 0x46, 0x46, 0x41, 0x41, 0x41, 0x24, 0x24, 0x24, 0x0e, 0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x47, 0x47, 0x47, 0x8d, 0x8d, 0x8d, 0xc3, 0xc3, 0xc3, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xe1, 0xe1, 0xe1, 0x95, 0x95, 0x95, 0x3e, 0x3e, 0x3e, 0x0b, 0x0b, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x2a, 0x2a, 0x2a, 0x53, 0x53, 0x53, 0x7d, 0x7d, 0x7d, 0xa0, 0xa0, 0xa0, 0xb2, 0xb2, 0xb2, 0xc1, 0xc1, 0xc1, 0xda, 0xda, 0xda, 0xcc, 0xcc, 0xcc, 0xd7, 0xd7, 0xd7, 0xd0, 0xd0, 0xd0, 0xc2, 0xc2, 0xc2, 0xb4, 0xb4, 0xb4, 0xa0, 0xa0, 0xa0, 0x81, 0x81, 0x81, 0x52, 0x52, 0x52, 0x22, 0x22, 0x22, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x41, 0x41, 0x41, 0x8d, 0x8d, 0x8d, 0xdc, 0xdc, 0xdc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xb9, 0xb9, 0xb9, 0x50, 0x50, 0x50, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x46, 0x46, 0x46, 0x76, 0x76, 0x76, 0xab, 0xab, 0xab, 0xd8, 0xd8, 0xd8, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xe5, 0xe5, 0xe5, 0xce, 0xce, 0xce, 0xb6, 0xb6, 0xb6, 0x7f, 0x7f, 0x7f, 0x3f, 0x3f, 0x3f, 0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x08, 0x1d, 0x1d, 0x1d, 0x57, 0x57, 0x57, 0xaf, 0xaf, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0x99, 0x99, 0x99, 0x37, 0x37, 0x37, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x30, 0x30, 0x30, 0x7e, 0x7e, 0x7e, 0xc9, 0xc9, 0xc9, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xfe, 0xfe, 0xfe, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xc3, 0xc3, 0xc3, 0x87, 0x87, 0x87, 0x21, 0x21, 0x21, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x29, 0x29, 0x29, 0x94, 0x94, 0x94, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe9, 0xf6, 0xf6, 0xf6, 0x88, 0x88, 0x88, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x65, 0x65, 0x65, 0xc5, 0xc5, 0xc5, 0xf1, 0xf1, 0xf1, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xea, 0xea, 0xd3, 0xd3, 0xd3, 0x5e, 0x5e, 0x5e, 0x00, 0x00, 0x00, 0x0d, 0x0d, 0x0d, 0x12, 0x12, 0x12, 0x76, 0x76, 0x76, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x6b, 0x6b, 0x6b, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x93, 0x93, 0x93, 0xd2, 0xd2, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xe3, 0xe3, 0xe3, 0x99, 0x99, 0x99, 0x0a, 0x0a, 0x0a, 0x02, 0x02, 0x02, 0x0d, 0x0d, 0x0d, 0x78, 0x78, 0x78, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0x09, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0xaf, 0xaf, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xe8, 0x2f, 0x2f, 0x2f, 0x25, 0x25, 0x25, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xec, 0xec, 0xec, 0xc1, 0xc1, 0xc1, 0x0a, 0x0a, 0x0a, 0x0c, 0x0c, 0x0c, 0x01, 0x01, 0x01, 0x7d, 0x7d, 0x7d, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x95, 0x95, 0x95, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x0f, 0x0f, 0x0f, 0xcc, 0xcc, 0xcc, 0xfb, 0xfb, 0xfb, 0xf1, 0xf1, 0xf1, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf6, 0xf6, 0xf6, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x44, 0x44, 0x44, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x50, 0x50, 0x50, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xc1, 0xc1, 0xc1, 0x12, 0x12, 0x12, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x9a, 0x9a, 0x9a, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xbd, 0xbd, 0xbd, 0x2f, 0x2f, 0x2f, 0x07, 0x07, 0x07, 0x0e, 0x0e, 0x0e, 0xab, 0xab, 0xab, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0x97, 0x97, 0x97, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x9f, 0x9f, 0x9f, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xbe, 0xbe, 0xbe, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x23, 0x23, 0x23, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xe5, 0xe5, 0xe5, 0x4f, 0x4f, 0x4f, 0x0c, 0x0c, 0x0c, 0x01, 0x01, 0x01, 0x9a, 0x9a, 0x9a, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfd, 0xfa, 0xcb, 0xc3, 0xc0, 0x31, 0x2d, 0x2c, 0x00, 0x01, 0x07, 0x00, 0x08, 0x14, 0x02, 0x07, 0x0d, 0x06, 0x00, 0x00, 0x2c, 0x22, 0x23, 0xca, 0xc8, 0xcb, 0xf9, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf2, 0xf7, 0xf0, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0x99, 0x99, 0x99, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x4b, 0x4b, 0x4b, 0xe5, 0xe5, 0xe5, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0x90, 0x90, 0x90, 0x18, 0x18, 0x18, 0x05, 0x05, 0x05, 0x5e, 0x5e, 0x5e, 0xd9, 0xd9, 0xd9, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xe3, 0xec, 0xf3, 0x67, 0x6a, 0x6f, 0x15, 0x0c, 0x07, 0x00, 0x04, 0x13, 0x13, 0x49, 0x75, 0x19, 0x49, 0x6f, 0x00, 0x02, 0x0b, 0x11, 0x09, 0x07, 0x68, 0x66, 0x67, 0xe8, 0xec, 0xed, 0xf3, 0xf7, 0xf6, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf8, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xdc, 0xdc, 0x5e, 0x5e, 0x5e, 0x05, 0x05, 0x05, 0x1c, 0x1c, 0x1c, 0x8e, 0x8e, 0x8e, 0xf7, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 
-    0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xca, 0xca, 0xca, 0x3b, 0x3b, 0x3b, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0xc4, 0xc4, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf7, 0x98, 0xa8, 0xb7, 0x11, 0x18, 0x20, 0x04, 0x00, 0x00, 0x01, 0x28, 0x47, 0x24, 0x8a, 0xde, 0x26, 0x86, 0xd3, 0x00, 0x25, 0x46, 0x00, 0x01, 0x00, 0x1b, 0x1b, 0x19, 0x9c, 0x9a, 0x9b, 0xfb, 0xf9, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0xd4, 0xd4, 0xd4, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x86, 0x86, 0x86, 0x0c, 0x0c, 0x0c, 0x19, 0x19, 0x19, 0x7c, 0x7c, 0x7c, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xd0, 0xd7, 0xdf, 0x3f, 0x42, 0x47, 0x05, 0x01, 0x00, 0x00, 0x0b, 0x18, 0x1a, 0x62, 0x9c, 0x22, 0xa0, 0xff, 0x1f, 0x95, 0xf5, 0x19, 0x67, 0xa7, 0x00, 0x0f, 0x13, 0x00, 0x09, 0x0b, 0x42, 0x3e, 0x3f, 0xde, 0xd5, 0xd8, 0xff, 0xfa, 0xff, 0xfd, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0x84, 0x84, 0x84, 0x05, 0x05, 0x05, 0x10, 0x10, 0x10, 0x8b, 0x8b, 0x8b, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xd7, 0xd7, 0xd7, 0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x43, 0x43, 0x43, 0xcc, 0xcc, 0xcc, 0xfb, 0xfb, 0xfb, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0x75, 0x86, 0x96, 0x11, 0x03, 0x00, 0x0c, 0x03, 0x00, 0x18, 0x49, 0x72, 0x24, 0x8e, 0xe4, 0x1f, 0x97, 0xf6, 0x21, 0x92, 0xee, 0x23, 0x92, 0xec, 0x18, 0x46, 0x5e, 0x00, 0x08, 0x17, 0x0a, 0x0b, 0x10, 0x82, 0x77, 0x7b, 0xf8, 0xf1, 0xf8, 0xf4, 0xf5, 0xfa, 0xfc, 0xff, 0xff, 0xfa, 0xfd, 0xf4, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0xca, 0xca, 0x3a, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0xd5, 0xd5, 0xd5, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 
-    0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xa7, 0xa7, 0xa7, 0x1c, 0x1c, 0x1c, 0x06, 0x06, 0x06, 0x73, 0x73, 0x73, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xbc, 0xbc, 0xbc, 0x1d, 0x2e, 0x3e, 0x11, 0x04, 0x00, 0x07, 0x11, 0x1a, 0x2c, 0x83, 0xca, 0x19, 0x98, 0xff, 0x22, 0x8e, 0xe6, 0x30, 0x96, 0xe8, 0x15, 0x94, 0xfb, 0x2b, 0x7a, 0xb3, 0x00, 0x24, 0x48, 0x00, 0x02, 0x0e, 0x37, 0x31, 0x31, 0xba, 0xb8, 0xb9, 0xfc, 0xff, 0xff, 0xf8, 0xfc, 0xfd, 0xff, 0xfe, 0xf9, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0x7f, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x15, 0x15, 0x15, 0xa5, 0xa5, 0xa5, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xeb, 0xeb, 0xeb, 0x6e, 0x6e, 0x6e, 0x08, 0x08, 0x08, 0x2d, 0x2d, 0x2d, 0xb0, 0xb0, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xd8, 0xd8, 0xd8, 0x69, 0x69, 0x69, 0x00, 0x05, 0x0e, 0x10, 0x1c, 0x28, 0x10, 0x46, 0x74, 0x27, 0x9a, 0xf7, 0x12, 0x97, 0xff, 0x24, 0x90, 0xe8, 0x33, 0x99, 0xed, 0x15, 0x91, 0xf5, 0x24, 0x90, 0xea, 0x15, 0x5b, 0x96, 0x00, 0x14, 0x25, 0x10, 0x12, 0x0f, 0x5f, 0x60, 0x5b, 0xe5, 0xea, 0xee, 0xf8, 0xf9, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xb6, 0xb6, 0xb6, 0x29, 0x29, 0x29, 0x07, 0x07, 0x07, 0x6f, 0x6f, 0x6f, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xd8, 0xd8, 0xd8, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x4d, 0x4d, 0x4d, 0xe0, 0xe0, 0xe0, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xb4, 0xb4, 0xb4, 0x23, 0x23, 0x23, 0x08, 0x06, 0x07, 0x00, 0x27, 0x48, 0x28, 0x85, 0xd2, 0x17, 0x98, 0xff, 0x17, 0x98, 0xff, 0x20, 0x93, 0xf0, 0x26, 0x94, 0xed, 0x23, 0x96, 0xf3, 0x14, 0x91, 0xff, 0x2e, 0x82, 0xca, 0x14, 0x37, 0x4d, 0x00, 0x03, 0x00, 0x27, 0x2c, 0x25, 0x97, 0x9f, 0xa1, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xd0, 0xd0, 0xd0, 0x57, 0x57, 0x57, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0xcd, 0xcd, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0x93, 0x93, 0x93, 0xb7, 0xb7, 0xb7, 
-    0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xb0, 0xb0, 0xb0, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 0x83, 0x83, 0x83, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xfc, 0xfc, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xe2, 0xe2, 0xe2, 0x55, 0x54, 0x52, 0x07, 0x06, 0x04, 0x00, 0x18, 0x33, 0x1f, 0x66, 0x9e, 0x21, 0x94, 0xef, 0x10, 0x95, 0xfe, 0x1b, 0x99, 0xfd, 0x25, 0x98, 0xf3, 0x1f, 0x92, 0xed, 0x20, 0x9b, 0xfb, 0x1c, 0x93, 0xf1, 0x20, 0x97, 0xf5, 0x17, 0x65, 0xa3, 0x02, 0x12, 0x1f, 0x07, 0x00, 0x00, 0x58, 0x5f, 0x65, 0xca, 0xd8, 0xe3, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xc6, 0xc6, 0xc6, 0xb5, 0xb5, 0xb5, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xf5, 0xf5, 0xf5, 0x83, 0x83, 0x83, 0x00, 0x00, 0x00, 0x21, 0x21, 0x21, 0xb0, 0xb0, 0xb0, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0x52, 0x52, 0x52, 0x0f, 0x0f, 0x0f, 0x2e, 0x2e, 0x2e, 
-    0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xa0, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0xa1, 0xa1, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfa, 0xfb, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf8, 0xf7, 0xf5, 0x9e, 0x9d, 0x9b, 0x23, 0x23, 0x23, 0x00, 0x01, 0x04, 0x0a, 0x3e, 0x66, 0x2a, 0x7b, 0xbc, 0x25, 0x9a, 0xf7, 0x16, 0x97, 0xfd, 0x1f, 0x9a, 0xfa, 0x25, 0x97, 0xf0, 0x1e, 0x91, 0xec, 0x1f, 0x9b, 0xfd, 0x1b, 0x92, 0xf0, 0x2a, 0x9d, 0xf8, 0x29, 0x81, 0xc8, 0x11, 0x3a, 0x5a, 0x00, 0x01, 0x05, 0x28, 0x27, 0x25, 0x9b, 0x9c, 0x9e, 0xf6, 0xfa, 0xfd, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfd, 0xfd, 0xfd, 0xd5, 0xd5, 0xd5, 0x37, 0x37, 0x37, 0x41, 0x41, 0x41, 0x9a, 0x9a, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xa0, 0xa0, 0x10, 0x10, 0x10, 0x03, 0x03, 0x03, 0xa7, 0xa7, 0xa7, 0xf6, 0xf6, 0xf6, 0x85, 0x85, 0x85, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x56, 0x56, 0x56, 
-    0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe9, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0xb0, 0xb0, 0xb0, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe4, 0xdf, 0xdb, 0x51, 0x50, 0x4e, 0x00, 0x01, 0x07, 0x03, 0x15, 0x23, 0x1d, 0x6b, 0xa9, 0x2b, 0x8f, 0xdd, 0x25, 0x9c, 0xfa, 0x1a, 0x96, 0xf8, 0x25, 0x98, 0xf3, 0x26, 0x94, 0xeb, 0x1e, 0x91, 0xec, 0x1f, 0x9b, 0xfd, 0x20, 0x93, 0xee, 0x2b, 0x9d, 0xf6, 0x2e, 0x97, 0xea, 0x1b, 0x69, 0xa7, 0x00, 0x1a, 0x32, 0x08, 0x00, 0x00, 0x5e, 0x51, 0x48, 0xd5, 0xde, 0xe5, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xd3, 0xd3, 0xd3, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x99, 0x99, 0x99, 0xf7, 0xf7, 0xf7, 0xb2, 0xb2, 0xb2, 0x28, 0x28, 0x28, 0x18, 0x18, 0x18, 0x74, 0x74, 0x74, 0xbf, 0xbf, 0xbf, 0x2a, 0x2a, 0x2a, 0x06, 0x06, 0x06, 0x16, 0x16, 0x16, 0xc2, 0xc2, 0xc2, 
-    0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xbd, 0xbd, 0xbd, 0x22, 0x22, 0x22, 0x08, 0x08, 0x08, 0x0d, 0x0d, 0x0d, 0x7c, 0x7c, 0x7c, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf4, 0xf3, 0xf1, 0xae, 0xa7, 0xa1, 0x1c, 0x1c, 0x1c, 0x00, 0x05, 0x14, 0x1a, 0x3f, 0x5c, 0x20, 0x89, 0xdc, 0x24, 0x96, 0xef, 0x1e, 0x96, 0xf5, 0x1c, 0x93, 0xf1, 0x28, 0x96, 0xed, 0x27, 0x94, 0xe9, 0x1f, 0x92, 0xed, 0x1d, 0x9b, 0xff, 0x25, 0x97, 0xf0, 0x25, 0x94, 0xed, 0x20, 0x98, 0xf7, 0x18, 0x8a, 0xe3, 0x0f, 0x48, 0x75, 0x07, 0x00, 0x00, 0x2e, 0x1b, 0x0c, 0x98, 0xa2, 0xab, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x8b, 0x8b, 0x8b, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x2c, 0x2c, 0x2c, 0x9d, 0x9d, 0x9d, 0xcb, 0xcb, 0xcb, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x5d, 0x5d, 0x5d, 0x38, 0x38, 0x38, 0x0d, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x9c, 0x9c, 0x9c, 0xf6, 0xf6, 0xf6, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xe7, 0xe7, 0xe7, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x89, 0x89, 0x89, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfd, 0xf9, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xe0, 0xdf, 0xdd, 0x60, 0x57, 0x50, 0x00, 0x01, 0x04, 0x00, 0x20, 0x3d, 0x24, 0x66, 0x9a, 0x1e, 0x96, 0xf5, 0x1c, 0x97, 0xf7, 0x1a, 0x92, 0xf1, 0x1f, 0x92, 0xed, 0x28, 0x96, 0xed, 0x27, 0x95, 0xec, 0x1f, 0x94, 0xf1, 0x1d, 0x99, 0xfb, 0x25, 0x97, 0xf0, 0x1e, 0x90, 0xe9, 0x16, 0x96, 0xfb, 0x14, 0x97, 0xff, 0x1f, 0x70, 0xb1, 0x0d, 0x17, 0x20, 0x0c, 0x00, 0x00, 0x4e, 0x57, 0x5e, 0xe3, 0xe3, 0xe3, 0xfc, 0xfc, 0xfc, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x88, 0x88, 0x88, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x24, 0x24, 0x24, 0x6c, 0x6c, 0x6c, 0x46, 0x46, 0x46, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x01, 0x47, 0x47, 0x47, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 
-    0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0x95, 0x95, 0x95, 0x01, 0x01, 0x01, 0x09, 0x09, 0x09, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x84, 0x84, 0x84, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf2, 0xfc, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xb9, 0xb9, 0xb9, 0x20, 0x19, 0x13, 0x00, 0x03, 0x0c, 0x08, 0x41, 0x6e, 0x24, 0x82, 0xcc, 0x1e, 0x9c, 0xff, 0x1d, 0x98, 0xf8, 0x1f, 0x94, 0xf1, 0x24, 0x96, 0xef, 0x25, 0x97, 0xf0, 0x24, 0x97, 0xf2, 0x1f, 0x96, 0xf4, 0x1d, 0x95, 0xf4, 0x24, 0x96, 0xef, 0x1e, 0x93, 0xf0, 0x1d, 0x9d, 0xff, 0x17, 0x98, 0xfe, 0x23, 0x84, 0xd1, 0x10, 0x3e, 0x62, 0x00, 0x02, 0x0b, 0x1a, 0x1a, 0x1a, 0xb8, 0xb8, 0xb8, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0x92, 0x92, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0xc4, 0xc4, 0xc4, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xcd, 0xcd, 0xcd, 0x16, 0x16, 0x16, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x86, 0x86, 0x86, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf6, 0xfc, 0xff, 0xff, 0xea, 0xf3, 0xfa, 0x78, 0x79, 0x7b, 0x03, 0x00, 0x00, 0x02, 0x15, 0x24, 0x19, 0x61, 0x9b, 0x1f, 0x96, 0xf4, 0x22, 0x9a, 0xf9, 0x21, 0x96, 0xf3, 0x26, 0x98, 0xf1, 0x25, 0x98, 0xf3, 0x1f, 0x96, 0xf4, 0x20, 0x98, 0xf7, 0x22, 0x99, 0xf7, 0x1f, 0x92, 0xed, 0x23, 0x96, 0xf1, 0x1c, 0x97, 0xf7, 0x24, 0xa0, 0xff, 0x1e, 0x91, 0xec, 0x24, 0x8e, 0xe2, 0x13, 0x66, 0xa8, 0x00, 0x13, 0x30, 0x09, 0x00, 0x00, 0x76, 0x76, 0x76, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x8c, 0x8c, 0x8c, 0x16, 0x16, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x8f, 0x8f, 0x8f, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 
-    0xf4, 0xf4, 0xf4, 0xee, 0xee, 0xee, 0x4d, 0x4d, 0x4d, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x63, 0x63, 0x63, 0x31, 0x31, 0x31, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x96, 0x96, 0x96, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf4, 0xf5, 0xf9, 0xfc, 0xca, 0xd4, 0xdd, 0x3a, 0x3b, 0x3d, 0x01, 0x00, 0x00, 0x15, 0x2e, 0x42, 0x23, 0x76, 0xb8, 0x1a, 0x9f, 0xff, 0x22, 0x95, 0xf0, 0x24, 0x93, 0xec, 0x29, 0x97, 0xee, 0x24, 0x97, 0xf2, 0x19, 0x94, 0xf4, 0x1d, 0x99, 0xfb, 0x25, 0x9c, 0xfa, 0x21, 0x93, 0xec, 0x26, 0x99, 0xf4, 0x17, 0x95, 0xf9, 0x24, 0x9b, 0xf9, 0x21, 0x8a, 0xdd, 0x28, 0x96, 0xed, 0x1b, 0x88, 0xdd, 0x00, 0x2c, 0x56, 0x0f, 0x00, 0x00, 0x39, 0x39, 0x39, 0xd5, 0xd5, 0xd5, 0xfc, 0xfc, 0xfc, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xe8, 0x8a, 0x8a, 0x8a, 0x0a, 0x0a, 0x0a, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x59, 0x59, 0x59, 0xe2, 0xe2, 0xe2, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xdb, 0xdb, 0xdb, 0x95, 0x95, 0x95, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x36, 0x36, 0x36, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0xba, 0xba, 0xba, 0xaa, 0xaa, 0xaa, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x0d, 0x0d, 0x0d, 0x97, 0x97, 0x97, 0xe8, 0xe8, 0xe8, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xf8, 0xef, 0xba, 0xbe, 0xc1, 0x00, 0x04, 0x12, 0x06, 0x0f, 0x16, 0x17, 0x43, 0x66, 0x23, 0x90, 0xe5, 0x18, 0x9b, 0xff, 0x2c, 0x92, 0xe6, 0x21, 0x99, 0xfa, 0x1d, 0x9c, 0xff, 0x18, 0x8d, 0xec, 0x24, 0x8e, 0xe4, 0x27, 0x99, 0xf2, 0x18, 0x96, 0xfc, 0x1c, 0xa0, 0xff, 0x29, 0x92, 0xe5, 0x23, 0x9a, 0xf8, 0x17, 0x93, 0xf5, 0x19, 0x91, 0xf0, 0x21, 0x9f, 0xff, 0x1c, 0x93, 0xf1, 0x0b, 0x4d, 0x81, 0x02, 0x06, 0x09, 0x07, 0x07, 0x07, 0xb0, 0xb0, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0x7b, 0x7b, 0x7b, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2e, 0xba, 0xba, 0xba, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0x61, 0x61, 0x61, 0x28, 0x28, 0x28, 0x01, 0x01, 0x01, 0x2a, 0x2a, 0x2a, 0xb4, 0xb4, 0xb4, 0x7b, 0x7b, 0x7b, 0x0a, 0x0a, 0x0a, 0x2d, 0x2d, 0x2d, 0xb6, 0xb6, 0xb6, 0xeb, 0xeb, 0xeb, 0xa3, 0xa3, 0xa3, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0xd7, 0xd7, 0xd7, 0xfb, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xf7, 0xee, 0xe7, 0x8e, 0x92, 0x95, 0x00, 0x02, 0x0b, 0x0a, 0x17, 0x20, 0x23, 0x62, 0x95, 0x22, 0x95, 0xf0, 0x1a, 0x89, 0xe2, 0x28, 0x77, 0xb9, 0x1d, 0x80, 0xd1, 0x22, 0x97, 0xf6, 0x20, 0x96, 0xf6, 0x22, 0x93, 0xef, 0x28, 0x96, 0xef, 0x1b, 0x8c, 0xe8, 0x19, 0x8e, 0xed, 0x26, 0x93, 0xe8, 0x21, 0x99, 0xf8, 0x1c, 0x97, 0xf7, 0x1c, 0x91, 0xee, 0x1f, 0x9b, 0xfd, 0x1f, 0x97, 0xf6, 0x17, 0x5f, 0x99, 0x09, 0x19, 0x26, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xb7, 0xb7, 0xb7, 0x2d, 0x2d, 0x2d, 0x07, 0x07, 0x07, 0x6b, 0x6b, 0x6b, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x8c, 0x8c, 0x8c, 0xfd, 0xfd, 0xfd, 0xa4, 0xa4, 0xa4, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x9d, 0x9d, 0x9d, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x99, 0x99, 0x99, 0x40, 0x40, 0x40, 0x27, 0x27, 0x27, 0xd9, 0xd9, 0xd9, 0xfb, 0xfb, 0xfb, 0xfc, 0xff, 0xff, 0xe9, 0xe8, 0xe6, 0x67, 0x6c, 0x70, 0x00, 0x00, 0x02, 0x0d, 0x1f, 0x2d, 0x22, 0x7d, 0xc4, 0x18, 0x96, 0xfa, 0x15, 0x6a, 0xad, 0x07, 0x32, 0x55, 0x06, 0x45, 0x7a, 0x1e, 0x7f, 0xce, 0x21, 0x9b, 0xfe, 0x19, 0x97, 0xfd, 0x25, 0x96, 0xf2, 0x2a, 0x94, 0xe8, 0x2d, 0x95, 0xea, 0x22, 0x95, 0xf0, 0x1e, 0x99, 0xf9, 0x22, 0x9a, 0xf9, 0x20, 0x92, 0xeb, 0x19, 0x94, 0xf4, 0x1f, 0x9b, 0xfd, 0x1e, 0x71, 0xb3, 0x0b, 0x29, 0x41, 0x00, 0x00, 0x00, 0x68, 0x68, 0x68, 0xe8, 0xe8, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xa9, 0xa9, 0xa9, 0x13, 0x13, 0x13, 0x07, 0x07, 0x07, 0xa2, 0xa2, 0xa2, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0x34, 0x34, 0x34, 0x0e, 0x0e, 0x0e, 0x57, 0x57, 0x57, 0xe9, 0xe9, 0xe9, 0xf2, 0xf2, 0xf2, 0xbf, 0xbf, 0xbf, 0x1a, 0x1a, 0x1a, 0x01, 0x01, 0x01, 0x7b, 0x7b, 0x7b, 0xed, 0xed, 0xed, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xbe, 0xbe, 0xbe, 0xc2, 0xc2, 0xc2, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xe9, 0xea, 0xec, 0x63, 0x68, 0x6c, 0x05, 0x00, 0x00, 0x0c, 0x21, 0x32, 0x14, 0x81, 0xd6, 0x12, 0x95, 0xfd, 0x0e, 0x4d, 0x80, 0x00, 0x02, 0x0c, 0x00, 0x18, 0x2e, 0x22, 0x68, 0xa3, 0x22, 0x9d, 0xfd, 0x0e, 0x98, 0xff, 0x18, 0x94, 0xf6, 0x28, 0x97, 0xf0, 0x2c, 0x9d, 0xf9, 0x22, 0x99, 0xf7, 0x1a, 0x98, 0xfc, 0x24, 0x9b, 0xf9, 0x24, 0x92, 0xe9, 0x17, 0x8f, 0xee, 0x1e, 0x9c, 0xff, 0x1d, 0x78, 0xbf, 0x02, 0x29, 0x48, 0x06, 0x06, 0x06, 0x62, 0x62, 0x62, 0xea, 0xea, 0xea, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x78, 0x78, 0x78, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x1d, 0xc1, 0xc1, 0xc1, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xb0, 0xb0, 0xb0, 0x87, 0x87, 0x87, 0xc6, 0xc6, 0xc6, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xce, 0xce, 0xce, 0x4a, 0x4a, 0x4a, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0xd4, 0xd4, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xec, 0xed, 0xef, 0x74, 0x78, 0x7b, 0x04, 0x00, 0x00, 0x09, 0x1c, 0x2b, 0x0b, 0x75, 0xc9, 0x1d, 0x9d, 0xff, 0x0f, 0x4c, 0x7b, 0x07, 0x08, 0x0c, 0x08, 0x0b, 0x10, 0x29, 0x54, 0x77, 0x27, 0x93, 0xeb, 0x14, 0x9c, 0xff, 0x1a, 0x96, 0xfa, 0x1a, 0x90, 0xf0, 0x0f, 0x93, 0xff, 0x22, 0x9a, 0xf9, 0x18, 0x96, 0xfa, 0x22, 0x99, 0xf7, 0x27, 0x94, 0xe9, 0x1d, 0x92, 0xef, 0x21, 0x9c, 0xfc, 0x1d, 0x72, 0xb5, 0x00, 0x20, 0x3c, 0x01, 0x01, 0x01, 0x6f, 0x6f, 0x6f, 0xf2, 0xf2, 0xf2, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0x52, 0x52, 0x52, 0x04, 0x04, 0x04, 0x47, 0x47, 0x47, 0xca, 0xca, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe9, 0x6d, 0x6d, 0x6d, 0x04, 0x04, 0x04, 0x23, 0x23, 0x23, 0xc3, 0xc3, 0xc3, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xf2, 0xee, 0xeb, 0x8f, 0x90, 0x92, 0x01, 0x00, 0x00, 0x05, 0x12, 0x1b, 0x0d, 0x60, 0xa2, 0x2a, 0x9f, 0xfc, 0x1b, 0x67, 0xa3, 0x06, 0x1c, 0x31, 0x02, 0x00, 0x01, 0x17, 0x28, 0x38, 0x1f, 0x6e, 0xb0, 0x25, 0x94, 0xee, 0x36, 0x9b, 0xed, 0x28, 0x94, 0xec, 0x10, 0x9c, 0xff, 0x21, 0x96, 0xf3, 0x19, 0x95, 0xf7, 0x1f, 0x97, 0xf6, 0x28, 0x96, 0xed, 0x25, 0x98, 0xf3, 0x23, 0x96, 0xf1, 0x19, 0x61, 0x9b, 0x02, 0x14, 0x22, 0x00, 0x00, 0x00, 0x8c, 0x8c, 0x8c, 0xf6, 0xf6, 0xf6, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xb8, 0xb8, 0xb8, 0x1e, 0x1e, 0x1e, 0x04, 0x04, 0x04, 0x76, 0x76, 0x76, 0xde, 0xde, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x25, 0x25, 0x25, 0x02, 0x02, 0x02, 0x83, 0x83, 0x83, 0xdc, 0xdc, 0xdc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xf4, 0xeb, 0xb6, 0xb6, 0xb6, 0x15, 0x1a, 0x1e, 0x03, 0x07, 0x0a, 0x0a, 0x3f, 0x69, 0x26, 0x8c, 0xde, 0x24, 0x88, 0xd6, 0x00, 0x3f, 0x74, 0x00, 0x08, 0x12, 0x06, 0x04, 0x05, 0x06, 0x32, 0x57, 0x18, 0x5e, 0x99, 0x32, 0x6e, 0xa0, 0x2d, 0x7b, 0xbb, 0x22, 0x9e, 0xff, 0x22, 0x94, 0xed, 0x1c, 0x98, 0xfa, 0x1d, 0x98, 0xf8, 0x25, 0x97, 0xf0, 0x25, 0x98, 0xf3, 0x1c, 0x86, 0xda, 0x0f, 0x48, 0x75, 0x08, 0x04, 0x01, 0x12, 0x12, 0x12, 0xbb, 0xbb, 0xbb, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0x7a, 0x7a, 0x7a, 0x01, 0x01, 0x01, 0x1b, 0x1b, 0x1b, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xd8, 0xd8, 0xd8, 0x41, 0x41, 0x41, 0x02, 0x02, 0x02, 0x34, 0x34, 0x34, 0xd1, 0xd1, 0xd1, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xff, 0xfb, 0xee, 0xdb, 0xda, 0xd8, 0x36, 0x40, 0x49, 0x01, 0x00, 0x00, 0x02, 0x22, 0x3b, 0x15, 0x73, 0xbd, 0x27, 0x9a, 0xf5, 0x15, 0x75, 0xc1, 0x16, 0x2c, 0x41, 0x0b, 0x01, 0x00, 0x00, 0x06, 0x17, 0x00, 0x1b, 0x3c, 0x0a, 0x24, 0x3b, 0x0d, 0x40, 0x6b, 0x17, 0x7f, 0xd4, 0x24, 0x92, 0xe9, 0x21, 0x9c, 0xfc, 0x1e, 0x99, 0xf9, 0x22, 0x95, 0xf0, 0x22, 0x95, 0xf0, 0x11, 0x76, 0xc6, 0x04, 0x32, 0x56, 0x0e, 0x00, 0x00, 0x35, 0x35, 0x35, 0xe4, 0xe4, 0xe4, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xcb, 0xcb, 0x2f, 0x2f, 0x2f, 0x07, 0x07, 0x07, 0x48, 0x48, 0x48, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x8f, 0x8f, 0x8f, 0x13, 0x13, 0x13, 0x0a, 0x0a, 0x0a, 0x83, 0x83, 0x83, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xf9, 0xfa, 0xfc, 0xef, 0xf8, 0xff, 0x8f, 0x90, 0x92, 0x0f, 0x0e, 0x0c, 0x00, 0x05, 0x13, 0x0c, 0x49, 0x78, 0x24, 0x84, 0xd0, 0x26, 0x83, 0xe0, 0x29, 0x7a, 0xc9, 0x0d, 0x3f, 0x72, 0x04, 0x0d, 0x16, 0x12, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x26, 0x23, 0x6e, 0x96, 0x25, 0x92, 0xe7, 0x21, 0x99, 0xf8, 0x14, 0x99, 0xff, 0x17, 0x9a, 0xff, 0x1d, 0x87, 0xdb, 0x0c, 0x46, 0x74, 0x01, 0x0a, 0x11, 0x12, 0x00, 0x00, 0x94, 0x94, 0x94, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xe9, 0xe9, 0xe9, 0x95, 0x95, 0x95, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09, 0x8c, 0x8c, 0x8c, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x36, 0x36, 0x36, 0x01, 0x01, 0x01, 0x2c, 0x2c, 0x2c, 0xca, 0xca, 0xca, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xc7, 0xc7, 0xc7, 0x53, 0x4a, 0x43, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x26, 0x13, 0x50, 0x7f, 0x1b, 0x95, 0xe2, 0x20, 0x9a, 0xed, 0x14, 0x85, 0xd5, 0x14, 0x69, 0xaa, 0x19, 0x53, 0x83, 0x03, 0x35, 0x68, 0x03, 0x47, 0x8e, 0x2d, 0x86, 0xe0, 0x16, 0x94, 0xf8, 0x25, 0x9d, 0xfc, 0x1d, 0x8b, 0xe2, 0x23, 0x7f, 0xc8, 0x1f, 0x5e, 0x91, 0x00, 0x08, 0x21, 0x00, 0x01, 0x05, 0x5f, 0x52, 0x49, 0xd5, 0xd5, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xd1, 0xd1, 0xd1, 0x17, 0x17, 0x17, 0x08, 0x08, 0x08, 0x45, 0x45, 0x45, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x89, 0x89, 0x89, 0x1c, 0x1c, 0x1c, 0x02, 0x02, 0x02, 0x56, 0x56, 0x56, 0xe9, 0xe9, 0xe9, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xf2, 0xf7, 0xfb, 0xf8, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xb9, 0xab, 0xa0, 0x3c, 0x2e, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x1d, 0x2b, 0x09, 0x47, 0x80, 0x2a, 0x80, 0xcb, 0x2c, 0x9e, 0xfe, 0x15, 0x93, 0xf9, 0x10, 0x8b, 0xeb, 0x18, 0x8f, 0xe9, 0x18, 0x95, 0xf2, 0x13, 0x99, 0xfc, 0x11, 0x91, 0xf6, 0x36, 0xa0, 0xf4, 0x35, 0x80, 0xba, 0x18, 0x41, 0x61, 0x00, 0x0c, 0x19, 0x00, 0x01, 0x04, 0x37, 0x37, 0x37, 0xa6, 0xa7, 0xa9, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x9d, 0x9d, 0x9d, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xe2, 0xe2, 0x5d, 0x5d, 0x5d, 0x08, 0x08, 0x08, 0x03, 0x03, 0x03, 0x92, 0x92, 0x92, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfe, 0xfa, 0xfc, 0xfd, 0xff, 0xf6, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf8, 0xf1, 0xeb, 0xa5, 0x97, 0x8c, 0x33, 0x2a, 0x23, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x10, 0x35, 0x0f, 0x4b, 0x87, 0x2f, 0x87, 0xd1, 0x37, 0x9b, 0xe6, 0x2d, 0x94, 0xd9, 0x28, 0x91, 0xd3, 0x2a, 0x97, 0xda, 0x2f, 0x87, 0xce, 0x05, 0x4a, 0x81, 0x00, 0x22, 0x3f, 0x02, 0x0b, 0x12, 0x06, 0x00, 0x00, 0x33, 0x2a, 0x23, 0x9c, 0x9c, 0x9c, 0xe7, 0xf0, 0xf7, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xfc, 0xfc, 0xfc, 0x88, 0x88, 0x88, 0x03, 0x03, 0x03, 0x14, 0x14, 0x14, 0x4f, 0x4f, 0x4f, 0xdf, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xac, 0xac, 0x29, 0x29, 0x29, 0x10, 0x10, 0x10, 0x02, 0x02, 0x02, 0xca, 0xca, 0xca, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf2, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xa8, 0xa8, 0xa8, 0x35, 0x36, 0x38, 0x0c, 0x13, 0x03, 0x00, 0x0f, 0x0a, 0x00, 0x0e, 0x15, 0x00, 0x0b, 0x1f, 0x00, 0x13, 0x2e, 0x12, 0x2b, 0x4a, 0x14, 0x2c, 0x50, 0x00, 0x13, 0x3c, 0x00, 0x0e, 0x24, 0x00, 0x04, 0x15, 0x00, 0x02, 0x0b, 0x00, 0x01, 0x03, 0x2e, 0x2a, 0x27, 0xa3, 0xa2, 0xa0, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xac, 0xac, 0x18, 0x18, 0x18, 0x03, 0x03, 0x03, 0x25, 0x25, 0x25, 0xba, 0xba, 0xba, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0x99, 0x99, 0x99, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xf8, 0xf9, 0xfb, 0xfa, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xcc, 0xd5, 0xdc, 0x52, 0x57, 0x53, 0x1b, 0x1c, 0x17, 0x03, 0x00, 0x00, 0x08, 0x05, 0x00, 0x09, 0x08, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x17, 0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x1e, 0x1d, 0x1b, 0x71, 0x75, 0x78, 0xd6, 0xdb, 0xdf, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfc, 0xfe, 0xfd, 0xfd, 0xfd, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xcb, 0xcb, 0xcb, 0x0d, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x95, 0x95, 0x95, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x6e, 0x6e, 0x6e, 0x13, 0x13, 0x13, 0x0b, 0x0b, 0x0b, 0x0e, 0x0e, 0x0e, 0xbc, 0xbc, 0xbc, 0xee, 0xf5, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xec, 0xf1, 0xf5, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xe3, 0xd4, 0xd9, 0x95, 0x87, 0x86, 0x4c, 0x44, 0x42, 0x1d, 0x21, 0x20, 0x0b, 0x19, 0x19, 0x0c, 0x1f, 0x1d, 0x11, 0x24, 0x20, 0x4d, 0x43, 0x3a, 0x97, 0x90, 0x8a, 0xd4, 0xd0, 0xcd, 0xf2, 0xf2, 0xf2, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xf6, 0xf7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xe6, 0xe6, 0xe6, 0xc0, 0xc0, 0xc0, 0x03, 0x03, 0x03, 0x0a, 0x0a, 0x0a, 0x0d, 0x0d, 0x0d, 0x6f, 0x6f, 0x6f, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0x6f, 0x6f, 0x6f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x80, 0x92, 0xa0, 0xe7, 0xee, 0xf4, 0xff, 0xfe, 0xfb, 0xfc, 0xf3, 0xec, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfa, 0xf7, 0xf0, 0xea, 0xf4, 0xff, 0xf7, 0xf9, 0xff, 0xf8, 0xfb, 0xff, 0xf9, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf2, 0xef, 0xf6, 0xfb, 0xeb, 0xec, 0xff, 0xf7, 0xf3, 0xf9, 0xff, 0xff, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xff, 0xfb, 0xf5, 0xff, 0xfb, 0xf7, 0xff, 0xff, 0xfd, 0xf8, 0xf9, 0xfb, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xee, 0xee, 0xee, 0x9b, 0x9b, 0x9b, 0x02, 0x02, 0x02, 0x0d, 0x0d, 0x0d, 0x13, 0x13, 0x13, 0x6d, 0x6d, 0x6d, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x83, 0x83, 0x83, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x5f, 0x5f, 0x5f, 0xc0, 0xc0, 0xc0, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xc4, 0xc4, 0xc4, 0x5e, 0x5e, 0x5e, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x79, 0x79, 0x79, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0x95, 0x95, 0x95, 0x32, 0x32, 0x32, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x34, 0x34, 0x34, 0x87, 0x87, 0x87, 0xcc, 0xcc, 0xcc, 0xec, 0xec, 0xec, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xc9, 0xc9, 0xc9, 0x8c, 0x8c, 0x8c, 0x26, 0x26, 0x26, 0x02, 0x02, 0x02, 0x0b, 0x0b, 0x0b, 0x25, 0x25, 0x25, 0x9d, 0x9d, 0x9d, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xbd, 0xbd, 0xbd, 0x4d, 0x4d, 0x4d, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x88, 0x88, 0x88, 0xb9, 0xb9, 0xb9, 0xcb, 0xcb, 0xcb, 0xed, 0xed, 0xed, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xeb, 0xeb, 0xeb, 0xd7, 0xd7, 0xd7, 0xb5, 0xb5, 0xb5, 0x76, 0x76, 0x76, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x15, 0x15, 0x15, 0x0d, 0x0d, 0x0d, 0x46, 0x46, 0x46, 0xc9, 0xc9, 0xc9, 0xfc, 0xfc, 0xfc, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe1, 0xe1, 0xe1, 0x8e, 0x8e, 0x8e, 0x3d, 0x3d, 0x3d, 0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x61, 0x61, 0x61, 0x89, 0x89, 0x89, 0x9b, 0x9b, 0x9b, 0xb4, 0xb4, 0xb4, 0xc9, 0xc9, 0xc9, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd2, 0xd2, 0xd2, 0xcf, 0xcf, 0xcf, 0xc5, 0xc5, 0xc5, 0xb5, 0xb5, 0xb5, 0xa1, 0xa1, 0xa1, 0x86, 0x86, 0x86, 0x5b, 0x5b, 0x5b, 0x28, 0x28, 0x28, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x3c, 0x3c, 0x3c, 0x98, 0x98, 0x98, 0xe5, 0xe5, 0xe5, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xd3, 0xd3, 0xd3, 0x87, 0x87, 0x87, 0x43, 0x43, 0x43, 0x1f, 0x1f, 0x1f, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x0f, 0x0f, 0x0f, 0x22, 0x22, 0x22, 0x38, 0x38, 0x38, 0x49, 0x49, 0x49, 0x4f, 0x4f, 0x4f, 0x4e, 0x4e, 0x4e, 0x4b, 0x4b, 0x4b, 0x3e, 0x3e, 0x3e, 0x23, 0x23, 0x23, 0x0c, 0x0c, 0x0c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x54, 0x54, 0x54, 0x8d, 0x8d, 0x8d, 0xc1, 0xc1, 0xc1, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf5, 0xf5, 0xf5, 0xd8, 0xd8, 0xd8, 0xa0, 0xa0, 0xa0, 0x6b, 0x6b, 0x6b, 0x51, 0x51, 0x51, 0x1c, 0x1c, 0x1c, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x0e, 0x0e, 0x0e, 0x24, 0x24, 0x24, 0x43, 0x43, 0x43, 0x6f, 0x6f, 0x6f, 0xa4, 0xa4, 0xa4, 0xcc, 0xcc, 0xcc, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xc8, 0xc8, 0xc8, 0xb2, 0xb2, 0xb2, 0x9f, 0x9f, 0x9f, 0x86, 0x86, 0x86, 0x73, 0x73, 0x73, 0x66, 0x66, 0x66, 0x5d, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c, 0x5f, 0x5f, 0x5f, 0x70, 0x70, 0x70, 0x85, 0x85, 0x85, 0xa0, 0xa0, 0xa0, 0xba, 0xba, 0xba, 0xd5, 0xd5, 0xd5, 0xef, 0xef, 0xef, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf0, 0xf0, 0xf0, 0xe8, 0xe8, 0xe8, 0xe0, 0xe0, 0xe0, 0xdb, 0xdb, 0xdb, 0xdd, 0xdd, 0xdd, 0xe4, 0xe4, 0xe4, 0xeb, 0xeb, 0xeb, 0xf2, 0xf2, 0xf2, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd
+static const uint16_t image_rows_recyclewater[60] = {
+    0x0000, 0x0048, 0x009f, 0x00db, 0x0130, 0x0184, 0x01e9, 0x024a, 0x02b2, 0x0339, 0x03d5, 0x0460,
+    0x04ea, 0x057a, 0x0604, 0x069d, 0x0729, 0x07d4, 0x0877, 0x0923, 0x09cd, 0x0a7b, 0x0b22, 0x0bcf,
+    0x0c7a, 0x0d2a, 0x0dd9, 0x0e8c, 0x0f3e, 0x0ff1, 0x109d, 0x114e, 0x1200, 0x12b3, 0x1366, 0x1416,
+    0x14c0, 0x156a, 0x1613, 0x16be, 0x176f, 0x1820, 0x18d0, 0x1979, 0x1a26, 0x1ad6, 0x1b78, 0x1c20,
+    0x1ccc, 0x1d40, 0x1db9, 0x1e30, 0x1eb4, 0x1f36, 0x1fae, 0x2027, 0x2099, 0x20a4, 0x20b4, 0x20c2
 };
+
 const tImage recyclewater = { image_data_recyclewater, 60, 60,
-    8 };
+    8, image_rows_recyclewater };
 
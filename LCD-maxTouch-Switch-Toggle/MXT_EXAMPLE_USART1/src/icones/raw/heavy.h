@@ -0,0 +1,95 @@
+
+/*******************************************************************************
+* image
+* filename: unsaved
+* name: tumble-dry
+*
+* preset name: Color R8G8B8
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: no
+* conversion type: Color, not_used not_used
+* bits per pixel: 24
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: no
+*******************************************************************************/
+
+/*
+ typedef struct {
+     const uint8_t *data;
+     uint16_t width;
+     uint16_t height;
+     uint8_t dataSize;
+     } tImage;
+*/
+#include <stdint.h>
+
+
+
+static const uint8_t image_data_tumbledry[10800] = {
+    0x05, 0x05, 0x05, 0x2e, 0x2e, 0x2e, 0x9f, 0x9f, 0x9f, 0xea, 0xea, 0xea, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xdb, 0xdb, 0xdb, 0x4e, 0x4e, 0x4e, 0x08, 0x08, 0x08, 0x3b, 0x3b, 0x3b, 
+    0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0xa1, 0xa1, 0xa1, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf6, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xf8, 0xf4, 0xf4, 0xf4, 0xf7, 0xf7, 0xf7, 0xfa, 0xfa, 0xfa, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xf1, 0xf1, 0xf1, 0xf3, 0xf3, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf3, 0xf3, 0xf3, 0xf5, 0xf5, 0xf5, 0xf9, 0xf9, 0xf9, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf7, 0xf7, 0xf7, 0xf4, 0xf4, 0xf4, 0xf1, 0xf1, 0xf1, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf4, 0xf4, 0xf4, 0xee, 0xee, 0xee, 0xed, 0xed, 0xed, 0xf2, 0xf2, 0xf2, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xf5, 0xf5, 0xf5, 0xf1, 0xf1, 0xf1, 0xef, 0xef, 0xef, 0xf5, 0xf5, 0xf5, 0x9d, 0x9d, 0x9d, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 
+    0x9c, 0x9c, 0x9c, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0x74, 0x74, 0x74, 0x85, 0x85, 0x85, 0x95, 0x95, 0x95, 0x93, 0x93, 0x93, 0x90, 0x90, 0x90, 0x8e, 0x8e, 0x8e, 0x8f, 0x8f, 0x8f, 0x92, 0x92, 0x92, 0x8f, 0x8f, 0x8f, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8c, 0x8c, 0x8c, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8c, 0x8c, 0x8c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x91, 0x91, 0x91, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x91, 0x91, 0x91, 0x8e, 0x8e, 0x8e, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x8f, 0x8f, 0x8f, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x90, 0x90, 0x90, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x92, 0x92, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x92, 0x92, 0x92, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x8a, 0x8a, 0x8a, 0x86, 0x86, 0x86, 0x2a, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0xb2, 0xb2, 0xb2, 
+    0xf5, 0xf5, 0xf5, 0xa5, 0xa5, 0xa5, 0x2c, 0x2c, 0x2c, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x09, 0x09, 0x09, 0x06, 0x06, 0x06, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x1d, 0x9a, 0x9a, 0x9a, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0x73, 0x73, 0x73, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x25, 0x25, 0x25, 0x30, 0x30, 0x30, 0x34, 0x34, 0x34, 0x2d, 0x2d, 0x2d, 0x29, 0x29, 0x29, 0x32, 0x32, 0x32, 0x34, 0x34, 0x34, 0x2f, 0x2f, 0x2f, 0x32, 0x32, 0x32, 0x2e, 0x2e, 0x2e, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x2f, 0x2f, 0x30, 0x30, 0x30, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x36, 0x36, 0x36, 0x32, 0x32, 0x32, 0x25, 0x25, 0x25, 0x14, 0x14, 0x14, 0x09, 0x09, 0x09, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x0c, 0x0c, 0x14, 0x14, 0x14, 0x23, 0x23, 0x23, 0x33, 0x33, 0x33, 0x38, 0x38, 0x38, 0x35, 0x35, 0x35, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x39, 0x39, 0x39, 0x36, 0x36, 0x36, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x32, 0x32, 0x32, 0x37, 0x37, 0x37, 0x33, 0x33, 0x33, 0x3d, 0x3d, 0x3d, 0x2f, 0x2f, 0x2f, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0xf8, 0xf8, 0xf8, 0xef, 0xef, 0xef, 
+    0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0x8b, 0x8b, 0x8b, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x02, 0x02, 0x02, 0x17, 0x17, 0x17, 0x78, 0x78, 0x78, 0xb6, 0xb6, 0xb6, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0xc6, 0xc6, 0xc6, 0xcb, 0xcb, 0xcb, 0xcc, 0xcc, 0xcc, 0xc7, 0xc7, 0xc7, 0xcb, 0xcb, 0xcb, 0xc9, 0xc9, 0xc9, 0xcb, 0xcb, 0xcb, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xbe, 0xbe, 0xbe, 0xa2, 0xa2, 0xa2, 0x88, 0x88, 0x88, 0x67, 0x67, 0x67, 0x52, 0x52, 0x52, 0x32, 0x32, 0x32, 0x19, 0x19, 0x19, 0x0c, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x19, 0x19, 0x19, 0x28, 0x28, 0x28, 0x46, 0x46, 0x46, 0x6b, 0x6b, 0x6b, 0x88, 0x88, 0x88, 0xa0, 0xa0, 0xa0, 0xb9, 0xb9, 0xb9, 0xcd, 0xcd, 0xcd, 0xcc, 0xcc, 0xcc, 0xc6, 0xc6, 0xc6, 0xbe, 0xbe, 0xbe, 0xbc, 0xbc, 0xbc, 0xc2, 0xc2, 0xc2, 0xca, 0xca, 0xca, 0xcb, 0xcb, 0xcb, 0xc7, 0xc7, 0xc7, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc1, 0xc1, 0xc1, 0xb5, 0xb5, 0xb5, 0x6b, 0x6b, 0x6b, 0x17, 0x17, 0x17, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xf5, 0xf5, 0xf5, 0x98, 0x98, 0x98, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0x9b, 0x9b, 0x9b, 0xe1, 0xe1, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xe2, 0xe2, 0xe2, 0xbd, 0xbd, 0xbd, 0x8b, 0x8b, 0x8b, 0x51, 0x51, 0x51, 0x26, 0x26, 0x26, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x28, 0x28, 0x28, 0x52, 0x52, 0x52, 0x8c, 0x8c, 0x8c, 0xba, 0xba, 0xba, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xa4, 0xa4, 0xa4, 0x2e, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x84, 0x84, 0x84, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0x96, 0x96, 0x96, 0x00, 0x00, 0x00, 0x25, 0x25, 0x25, 0x76, 0x76, 0x76, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0xa3, 0xa3, 0xa3, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xea, 0xea, 0xb6, 0xb6, 0xb6, 0x6c, 0x6c, 0x6c, 0x2e, 0x2e, 0x2e, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x07, 0x05, 0x05, 0x05, 0x24, 0x24, 0x24, 0x3b, 0x3b, 0x3b, 0x5b, 0x5b, 0x5b, 0x74, 0x74, 0x74, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7b, 0x7b, 0x7b, 0x79, 0x79, 0x79, 0x6b, 0x6b, 0x6b, 0x59, 0x59, 0x59, 0x3f, 0x3f, 0x3f, 0x22, 0x22, 0x22, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x2a, 0x2a, 0x2a, 0x68, 0x68, 0x68, 0xaa, 0xaa, 0xaa, 0xeb, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x9a, 0x9a, 0x9a, 0x37, 0x37, 0x37, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x69, 0x69, 0x69, 0x26, 0x26, 0x26, 0x00, 0x00, 0x00, 0x96, 0x96, 0x96, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0x8e, 0x8e, 0x8e, 0x03, 0x03, 0x03, 0x2e, 0x2e, 0x2e, 0xba, 0xba, 0xba, 0xa2, 0xa2, 0xa2, 0x37, 0x37, 0x37, 0x0a, 0x0a, 0x0a, 0x25, 0x25, 0x25, 0xa0, 0xa0, 0xa0, 0xf4, 0xf4, 0xf4, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x71, 0x71, 0x71, 0x30, 0x30, 0x30, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x29, 0x29, 0x29, 0x55, 0x55, 0x55, 0x85, 0x85, 0x85, 0xb5, 0xb5, 0xb5, 0xc3, 0xc3, 0xc3, 0xda, 0xda, 0xda, 0xef, 0xef, 0xef, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf1, 0xf1, 0xf1, 0xe3, 0xe3, 0xe3, 0xc8, 0xc8, 0xc8, 0xa7, 0xa7, 0xa7, 0x87, 0x87, 0x87, 0x5f, 0x5f, 0x5f, 0x29, 0x29, 0x29, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x22, 0x22, 0x22, 0x68, 0x68, 0x68, 0xc7, 0xc7, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xa8, 0xa8, 0xa8, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x37, 0x37, 0x37, 0x90, 0x90, 0x90, 0xc0, 0xc0, 0xc0, 0x33, 0x33, 0x33, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xf3, 0xf3, 0xf3, 0x8f, 0x8f, 0x8f, 0x04, 0x04, 0x04, 0x31, 0x31, 0x31, 0xcf, 0xcf, 0xcf, 0xe0, 0xe0, 0xe0, 0x9c, 0x9c, 0x9c, 0x1f, 0x1f, 0x1f, 0x0b, 0x0b, 0x0b, 0x2b, 0x2b, 0x2b, 0x9a, 0x9a, 0x9a, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0x9a, 0x9a, 0x9a, 0x3e, 0x3e, 0x3e, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x71, 0x71, 0x71, 0xb7, 0xb7, 0xb7, 0xdd, 0xdd, 0xdd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xfa, 0xf6, 0xf6, 0xf6, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xd9, 0xd9, 0xd9, 0xa8, 0xa8, 0xa8, 0x7e, 0x7e, 0x7e, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x3c, 0x3c, 0x3c, 0x88, 0x88, 0x88, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xf3, 0xf3, 0xf3, 0xa3, 0xa3, 0xa3, 0x23, 0x23, 0x23, 0x02, 0x02, 0x02, 0x29, 0x29, 0x29, 0x98, 0x98, 0x98, 0xf9, 0xf9, 0xf9, 0xca, 0xca, 0xca, 0x37, 0x37, 0x37, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0x92, 0x92, 0x92, 0x03, 0x03, 0x03, 0x2c, 0x2c, 0x2c, 0xd1, 0xd1, 0xd1, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xa3, 0xa3, 0xa3, 0x31, 0x31, 0x31, 0x03, 0x03, 0x03, 0x28, 0x28, 0x28, 0x9d, 0x9d, 0x9d, 0xde, 0xde, 0xde, 0x6e, 0x6e, 0x6e, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x21, 0x21, 0x21, 0x6d, 0x6d, 0x6d, 0xb5, 0xb5, 0xb5, 0xe8, 0xe8, 0xe8, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xeb, 0xeb, 0xeb, 0xc7, 0xc7, 0xc7, 0x68, 0x68, 0x68, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x73, 0x73, 0x73, 0xef, 0xef, 0xef, 0x9d, 0x9d, 0x9d, 0x2e, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0xa5, 0xa5, 0xa5, 0xf7, 0xf7, 0xf7, 0xfd, 0xfd, 0xfd, 0xcb, 0xcb, 0xcb, 0x27, 0x27, 0x27, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x93, 0x93, 0x93, 0x04, 0x04, 0x04, 0x29, 0x29, 0x29, 0xc7, 0xc7, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xea, 0xea, 0xa0, 0xa0, 0xa0, 0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x4f, 0x4f, 0x4f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x8d, 0x8d, 0x8d, 0xe5, 0xe5, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xf8, 0xf8, 0xf8, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xe2, 0xe2, 0xe2, 0xb3, 0xb3, 0xb3, 0x2c, 0x2c, 0x2c, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x47, 0x47, 0x47, 0x1d, 0x1d, 0x1d, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0xa7, 0xa7, 0xa7, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xba, 0xba, 0xba, 0x3e, 0x3e, 0x3e, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x8f, 0x8f, 0x8f, 0x05, 0x05, 0x05, 0x30, 0x30, 0x30, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x9e, 0x9e, 0x32, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0xcc, 0xcc, 0xcc, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 0xf8, 0xf8, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xd7, 0xd7, 0xd7, 0x3a, 0x3a, 0x3a, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x9e, 0x9e, 0x9e, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xce, 0xce, 0x38, 0x38, 0x38, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0x8a, 0x8a, 0x8a, 0x01, 0x01, 0x01, 0x34, 0x34, 0x34, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfb, 0xfb, 0xfb, 0xdd, 0xdd, 0xdd, 0x39, 0x39, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x8e, 0x8e, 0x8e, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xa0, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x0b, 0x3c, 0x3c, 0x3c, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xde, 0xde, 0xde, 0x22, 0x22, 0x22, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x8b, 0x8b, 0x8b, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0xcb, 0xcb, 0xcb, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0x76, 0x76, 0x76, 0x13, 0x13, 0x13, 0x08, 0x08, 0x08, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x13, 0x13, 0x13, 0xad, 0xad, 0xad, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xb2, 0xb2, 0xb2, 0x11, 0x11, 0x11, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x70, 0x70, 0x70, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xc7, 0xc7, 0xc7, 0x3a, 0x3a, 0x3a, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0x8f, 0x8f, 0x8f, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0xcc, 0xcc, 0xcc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xa0, 0xa0, 0xa0, 0x15, 0x15, 0x15, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x96, 0x96, 0x96, 0x0d, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0xab, 0xab, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xa7, 0xa7, 0xa7, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x9d, 0x9d, 0x9d, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x1b, 0x98, 0x98, 0x98, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xcc, 0xcc, 0xcc, 0x32, 0x32, 0x32, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xf7, 0xf7, 0xf7, 0x92, 0x92, 0x92, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xc4, 0xc4, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0xcf, 0xcf, 0xcf, 0xfa, 0xfa, 0xfa, 0xad, 0xad, 0xad, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0xa5, 0xa5, 0xa5, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xa0, 0xa0, 0xa0, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0xa4, 0xa4, 0xa4, 0xff, 0xff, 0xff, 0xce, 0xce, 0xce, 0x31, 0x31, 0x31, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0xc4, 0xc4, 0xc4, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xcd, 0xcd, 0xcd, 0x31, 0x31, 0x31, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xe8, 0x6d, 0x6d, 0x6d, 0x06, 0x06, 0x06, 0x1e, 0x1e, 0x1e, 0x92, 0x92, 0x92, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xae, 0xae, 0xae, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0xa3, 0xa3, 0xa3, 0xef, 0xef, 0xef, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xa2, 0xa2, 0xa2, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0xa1, 0xa1, 0xa1, 0xfc, 0xfc, 0xfc, 0xf3, 0xf3, 0xf3, 0xfb, 0xfb, 0xfb, 0x95, 0x95, 0x95, 0x20, 0x20, 0x20, 0x0a, 0x0a, 0x0a, 0x77, 0x77, 0x77, 0xe6, 0xe6, 0xe6, 0xff, 0xff, 0xff, 0xcf, 0xcf, 0xcf, 0x2f, 0x2f, 0x2f, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0x8d, 0x8d, 0x8d, 0x03, 0x03, 0x03, 0x33, 0x33, 0x33, 0xcd, 0xcd, 0xcd, 0xfc, 0xfc, 0xfc, 0xb2, 0xb2, 0xb2, 0x2e, 0x2e, 0x2e, 0x01, 0x01, 0x01, 0x69, 0x69, 0x69, 0xee, 0xee, 0xee, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xa4, 0xa4, 0xa4, 0x1f, 0x1f, 0x1f, 0x01, 0x01, 0x01, 0x2e, 0x2e, 0x2e, 0x9b, 0x9b, 0x9b, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xa3, 0xa3, 0xa3, 0x2e, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0xa1, 0xa1, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x64, 0x64, 0x64, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0xb5, 0xb5, 0xb5, 0xfd, 0xfd, 0xfd, 0xcd, 0xcd, 0xcd, 0x33, 0x33, 0x33, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0x8d, 0x8d, 0x8d, 0x03, 0x03, 0x03, 0x2f, 0x2f, 0x2f, 0xd0, 0xd0, 0xd0, 0xe5, 0xe5, 0xe5, 0x69, 0x69, 0x69, 0x05, 0x05, 0x05, 0x2b, 0x2b, 0x2b, 0xb3, 0xb3, 0xb3, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xa5, 0xa5, 0xa5, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x2d, 0x9d, 0x9d, 0x9d, 0xee, 0xee, 0xee, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x9d, 0x9d, 0x9d, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0xb1, 0xb1, 0xb1, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xb1, 0xb1, 0x2f, 0x2f, 0x2f, 0x06, 0x06, 0x06, 0x75, 0x75, 0x75, 0xde, 0xde, 0xde, 0xcb, 0xcb, 0xcb, 0x39, 0x39, 0x39, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0x8e, 0x8e, 0x8e, 0x01, 0x01, 0x01, 0x2e, 0x2e, 0x2e, 0xce, 0xce, 0xce, 0xbe, 0xbe, 0xbe, 0x2c, 0x2c, 0x2c, 0x03, 0x03, 0x03, 0x6f, 0x6f, 0x6f, 0xeb, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0x9d, 0x9d, 0x9d, 0x2d, 0x2d, 0x2d, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0xa2, 0xa2, 0xa2, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0x9f, 0x9f, 0x9f, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0xa6, 0xa6, 0xa6, 0xf0, 0xf0, 0xf0, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xec, 0xec, 0xec, 0x7a, 0x7a, 0x7a, 0x04, 0x04, 0x04, 0x36, 0x36, 0x36, 0xb6, 0xb6, 0xb6, 0xca, 0xca, 0xca, 0x38, 0x38, 0x38, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0x8e, 0x8e, 0x8e, 0x01, 0x01, 0x01, 0x30, 0x30, 0x30, 0xc0, 0xc0, 0xc0, 0x8a, 0x8a, 0x8a, 0x0e, 0x0e, 0x0e, 0x29, 0x29, 0x29, 0xb1, 0xb1, 0xb1, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0x9a, 0x9a, 0x9a, 0x32, 0x32, 0x32, 0x09, 0x09, 0x09, 0x25, 0x25, 0x25, 0xa3, 0xa3, 0xa3, 0xeb, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xa1, 0xa1, 0xa1, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x9d, 0x9d, 0x9d, 0xf7, 0xf7, 0xf7, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xaf, 0x1b, 0x1b, 0x1b, 0x0b, 0x0b, 0x0b, 0x89, 0x89, 0x89, 0xc0, 0xc0, 0xc0, 0x31, 0x31, 0x31, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfc, 0xfc, 0xfc, 0xf7, 0xf7, 0xf7, 0x8d, 0x8d, 0x8d, 0x03, 0x03, 0x03, 0x31, 0x31, 0x31, 0xa3, 0xa3, 0xa3, 0x4f, 0x4f, 0x4f, 0x06, 0x06, 0x06, 0x54, 0x54, 0x54, 0xd8, 0xd8, 0xd8, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xeb, 0xeb, 0xeb, 0xa1, 0xa1, 0xa1, 0x25, 0x25, 0x25, 0x07, 0x07, 0x07, 0x29, 0x29, 0x29, 0x9a, 0x9a, 0x9a, 0xdf, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xe8, 0x9b, 0x9b, 0x9b, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0xa1, 0xa1, 0xa1, 0xfe, 0xfe, 0xfe, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd9, 0xd9, 0x56, 0x56, 0x56, 0x00, 0x00, 0x00, 0x52, 0x52, 0x52, 0xa5, 0xa5, 0xa5, 0x30, 0x30, 0x30, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x8c, 0x8c, 0x8c, 0x04, 0x04, 0x04, 0x2f, 0x2f, 0x2f, 0x89, 0x89, 0x89, 0x25, 0x25, 0x25, 0x07, 0x07, 0x07, 0x86, 0x86, 0x86, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0xa5, 0xa5, 0xa5, 0x29, 0x29, 0x29, 0x09, 0x09, 0x09, 0x34, 0x34, 0x34, 0xa2, 0xa2, 0xa2, 0xf0, 0xf0, 0xf0, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xa1, 0xa1, 0xa1, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x9f, 0x9f, 0x9f, 0xee, 0xee, 0xee, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xf9, 0xf9, 0xf9, 0x92, 0x92, 0x92, 0x05, 0x05, 0x05, 0x26, 0x26, 0x26, 0x89, 0x89, 0x89, 0x35, 0x35, 0x35, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x94, 0x94, 0x94, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x64, 0x64, 0x64, 0x04, 0x04, 0x04, 0x27, 0x27, 0x27, 0xb4, 0xb4, 0xb4, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xed, 0xed, 0xed, 0xa0, 0xa0, 0xa0, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x9a, 0x9a, 0x9a, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0x9c, 0x9c, 0x9c, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0xa8, 0xa8, 0xa8, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xb8, 0xb8, 0xb8, 0x26, 0x26, 0x26, 0x06, 0x06, 0x06, 0x6a, 0x6a, 0x6a, 0x32, 0x32, 0x32, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0x96, 0x96, 0x96, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x4f, 0x4f, 0x4f, 0x03, 0x03, 0x03, 0x3b, 0x3b, 0x3b, 0xc3, 0xc3, 0xc3, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0x9d, 0x9d, 0x9d, 0x3a, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0xa1, 0xa1, 0xa1, 0xf1, 0xf1, 0xf1, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x9d, 0x9d, 0x9d, 0x26, 0x26, 0x26, 0x01, 0x01, 0x01, 0x3e, 0x3e, 0x3e, 0x99, 0x99, 0x99, 0xe3, 0xe3, 0xe3, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0x3d, 0x3d, 0x3d, 0x04, 0x04, 0x04, 0x50, 0x50, 0x50, 0x1e, 0x1e, 0x1e, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x97, 0x97, 0x97, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x58, 0x58, 0x58, 0xda, 0xda, 0xda, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0xa5, 0xa5, 0xa5, 0x20, 0x20, 0x20, 0x06, 0x06, 0x06, 0x2a, 0x2a, 0x2a, 0xad, 0xad, 0xad, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xa5, 0xa5, 0xa5, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0xa6, 0xa6, 0xa6, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xe2, 0xe2, 0xe2, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x30, 0x30, 0x30, 0x0f, 0x0f, 0x0f, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x94, 0x94, 0x94, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x6f, 0x6f, 0x6f, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x9a, 0x9a, 0x9a, 0x30, 0x30, 0x30, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0xb0, 0xb0, 0xb0, 0xa4, 0xa4, 0xa4, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0xa1, 0xa1, 0xa1, 0xec, 0xec, 0xec, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xef, 0xef, 0xef, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x0d, 0x0d, 0x0d, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xaa, 0xaa, 0xaa, 0x06, 0x06, 0x06, 0x0e, 0x0e, 0x0e, 0x17, 0x17, 0x17, 0x1a, 0x1a, 0x1a, 0x01, 0x01, 0x01, 0x1b, 0x1b, 0x1b, 0xa2, 0xa2, 0xa2, 0xf6, 0xf6, 0xf6, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0x7a, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x8d, 0x8d, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xbc, 0xbc, 0xbc, 0x0b, 0x0b, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x0d, 0x0d, 0x0d, 0xa3, 0xa3, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0x8d, 0x8d, 0x8d, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xf6, 0xf6, 0xf6, 0xa2, 0xa2, 0xa2, 0x1b, 0x1b, 0x1b, 0x05, 0x05, 0x05, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0xa7, 0xa7, 0xa7, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0x7e, 0x7e, 0x7e, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0x8e, 0x8e, 0x8e, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xa8, 0xa8, 0xa8, 0x13, 0x13, 0x13, 0x07, 0x07, 0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x09, 0x09, 0x19, 0x19, 0x19, 0xa5, 0xa5, 0xa5, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0x76, 0x76, 0x76, 0x05, 0x05, 0x05, 0x0b, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0x8e, 0x8e, 0x8e, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x19, 0x19, 0x19, 0x02, 0x02, 0x02, 0x6a, 0x6a, 0x6a, 0xf0, 0xf0, 0xf0, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x9b, 0x9b, 0x9b, 0x29, 0x29, 0x29, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x1d, 0xac, 0xac, 0xac, 0xa7, 0xa7, 0xa7, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0x9a, 0x9a, 0x9a, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe6, 0xe6, 0x6d, 0x6d, 0x6d, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x0d, 0x0d, 0x0d, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0x8e, 0x8e, 0x8e, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x2a, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x59, 0x59, 0x59, 0xe3, 0xe3, 0xe3, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0x98, 0x98, 0x98, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0xa0, 0xa0, 0xa0, 0xf6, 0xf6, 0xf6, 0xf5, 0xf5, 0xf5, 0xa7, 0xa7, 0xa7, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2e, 0x9b, 0x9b, 0x9b, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xde, 0xde, 0xde, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0x15, 0x15, 0x15, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x8f, 0x8f, 0x8f, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0x48, 0x48, 0x48, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xa2, 0xa2, 0xa2, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2e, 0x9c, 0x9c, 0x9c, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x9a, 0x9a, 0x9a, 0x2f, 0x2f, 0x2f, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0xa1, 0xa1, 0xa1, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xcd, 0xcd, 0xcd, 0x45, 0x45, 0x45, 0x01, 0x01, 0x01, 0x46, 0x46, 0x46, 0x25, 0x25, 0x25, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0x8f, 0x8f, 0x8f, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x6b, 0x6b, 0x6b, 0x0d, 0x0d, 0x0d, 0x22, 0x22, 0x22, 0xa9, 0xa9, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x9e, 0x9e, 0x9e, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0xa3, 0xa3, 0xa3, 0xe6, 0xe6, 0xe6, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0x9d, 0x9d, 0x9d, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x2c, 0x2c, 0x2c, 0xa1, 0xa1, 0xa1, 0xea, 0xea, 0xea, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xb0, 0xb0, 0xb0, 0x22, 0x22, 0x22, 0x0d, 0x0d, 0x0d, 0x68, 0x68, 0x68, 0x33, 0x33, 0x33, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x3a, 0x87, 0x87, 0x87, 0x25, 0x25, 0x25, 0x07, 0x07, 0x07, 0x88, 0x88, 0x88, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xa0, 0xa0, 0xa0, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x2d, 0x9b, 0x9b, 0x9b, 0xeb, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xa2, 0xa2, 0xa2, 0x2c, 0x2c, 0x2c, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x9d, 0x9d, 0x9d, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x87, 0x87, 0x87, 0x06, 0x06, 0x06, 0x25, 0x25, 0x25, 0x86, 0x86, 0x86, 0x37, 0x37, 0x37, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0x8f, 0x8f, 0x8f, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x9e, 0x9e, 0x9e, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0xd5, 0xd5, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xa1, 0xa1, 0xa1, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0xa9, 0xa9, 0xa9, 0xea, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xa1, 0xa1, 0xa1, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x31, 0x31, 0x31, 0x9d, 0x9d, 0x9d, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0x54, 0x54, 0x54, 0x01, 0x01, 0x01, 0x52, 0x52, 0x52, 0xa1, 0xa1, 0xa1, 0x33, 0x33, 0x33, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0x8d, 0x8d, 0x8d, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0xb8, 0xb8, 0xb8, 0x8a, 0x8a, 0x8a, 0x13, 0x13, 0x13, 0x29, 0x29, 0x29, 0xa4, 0xa4, 0xa4, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xe8, 0x9b, 0x9b, 0x9b, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0xa1, 0xa1, 0xa1, 0xeb, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0x9b, 0x9b, 0x9b, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x2e, 0x2e, 0x2e, 0x9a, 0x9a, 0x9a, 0xe1, 0xe1, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xaa, 0xaa, 0xaa, 0x23, 0x23, 0x23, 0x14, 0x14, 0x14, 0x8b, 0x8b, 0x8b, 0xbc, 0xbc, 0xbc, 0x31, 0x31, 0x31, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0x8b, 0x8b, 0x8b, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0xcc, 0xcc, 0xcc, 0xb7, 0xb7, 0xb7, 0x2d, 0x2d, 0x2d, 0x00, 0x00, 0x00, 0x7b, 0x7b, 0x7b, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xa2, 0xa2, 0xa2, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x2f, 0x9d, 0x9d, 0x9d, 0xeb, 0xeb, 0xeb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0x9d, 0x9d, 0x9d, 0x2f, 0x2f, 0x2f, 0x04, 0x04, 0x04, 0x31, 0x31, 0x31, 0xa7, 0xa7, 0xa7, 0xf5, 0xf5, 0xf5, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0x7f, 0x7f, 0x7f, 0x03, 0x03, 0x03, 0x28, 0x28, 0x28, 0xb6, 0xb6, 0xb6, 0xd0, 0xd0, 0xd0, 0x34, 0x34, 0x34, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0x8f, 0x8f, 0x8f, 0x02, 0x02, 0x02, 0x34, 0x34, 0x34, 0xcd, 0xcd, 0xcd, 0xea, 0xea, 0xea, 0x6c, 0x6c, 0x6c, 0x02, 0x02, 0x02, 0x25, 0x25, 0x25, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x9b, 0x9b, 0x2a, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xa4, 0xa4, 0xa4, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf2, 0xf2, 0xf2, 0xa2, 0xa2, 0xa2, 0x2d, 0x2d, 0x2d, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xa1, 0xa1, 0xa1, 0xf1, 0xf1, 0xf1, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xc4, 0xc4, 0xc4, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0xe4, 0xe4, 0xe4, 0xce, 0xce, 0xce, 0x33, 0x33, 0x33, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0x8b, 0x8b, 0x8b, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0xc7, 0xc7, 0xc7, 0xfb, 0xfb, 0xfb, 0xad, 0xad, 0xad, 0x24, 0x24, 0x24, 0x0b, 0x0b, 0x0b, 0x60, 0x60, 0x60, 0xdc, 0xdc, 0xdc, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x97, 0x97, 0x2a, 0x2a, 0x2a, 0x08, 0x08, 0x08, 0x28, 0x28, 0x28, 0x9d, 0x9d, 0x9d, 0xfa, 0xfa, 0xfa, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xe2, 0xe2, 0x9f, 0x9f, 0x9f, 0x25, 0x25, 0x25, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0xb4, 0xb4, 0xb4, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xfd, 0xfd, 0xfd, 0xe4, 0xe4, 0xe4, 0x6f, 0x6f, 0x6f, 0x0c, 0x0c, 0x0c, 0x27, 0x27, 0x27, 0xb9, 0xb9, 0xb9, 0xf5, 0xf5, 0xf5, 0xd4, 0xd4, 0xd4, 0x35, 0x35, 0x35, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0x89, 0x89, 0x89, 0x01, 0x01, 0x01, 0x36, 0x36, 0x36, 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0x6f, 0x6f, 0x6f, 0x18, 0x18, 0x18, 0x0a, 0x0a, 0x0a, 0xa6, 0xa6, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x9e, 0x9e, 0x9e, 0x2e, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0xa8, 0xa8, 0xa8, 0xf5, 0xf5, 0xf5, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xac, 0xac, 0xac, 0x1a, 0x1a, 0x1a, 0x05, 0x05, 0x05, 0x16, 0x16, 0x16, 0x99, 0x99, 0x99, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xa3, 0xa3, 0xa3, 0x14, 0x14, 0x14, 0x03, 0x03, 0x03, 0x6d, 0x6d, 0x6d, 0xec, 0xec, 0xec, 0xfb, 0xfb, 0xfb, 0xc6, 0xc6, 0xc6, 0x32, 0x32, 0x32, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfc, 0xfc, 0xfc, 0xf7, 0xf7, 0xf7, 0x8b, 0x8b, 0x8b, 0x03, 0x03, 0x03, 0x3b, 0x3b, 0x3b, 0xbf, 0xbf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xc7, 0xc7, 0x2f, 0x2f, 0x2f, 0x00, 0x00, 0x00, 0x2c, 0x2c, 0x2c, 0xe0, 0xe0, 0xe0, 0xe9, 0xe9, 0xe9, 0xaf, 0xaf, 0xaf, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x21, 0x21, 0x21, 0xa6, 0xa6, 0xa6, 0xfb, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xb0, 0xb0, 0xb0, 0x15, 0x15, 0x15, 0x03, 0x03, 0x03, 0x2c, 0x2c, 0x2c, 0x9a, 0x9a, 0x9a, 0xff, 0xff, 0xff, 0xce, 0xce, 0xce, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x3b, 0xcb, 0xcb, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xc2, 0xc2, 0x39, 0x39, 0x39, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfb, 0xfb, 0xfb, 0xf9, 0xf9, 0xf9, 0x8d, 0x8d, 0x8d, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0xc4, 0xc4, 0xc4, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0x95, 0x95, 0x95, 0x2d, 0x2d, 0x2d, 0x0b, 0x0b, 0x0b, 0x32, 0x32, 0x32, 0xa0, 0xa0, 0xa0, 0x0e, 0x0e, 0x0e, 0x01, 0x01, 0x01, 0x13, 0x13, 0x13, 0xa8, 0xa8, 0xa8, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x16, 0x16, 0x16, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x95, 0x95, 0x95, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x9b, 0x9b, 0x9b, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xca, 0xca, 0xca, 0x32, 0x32, 0x32, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xf9, 0xf9, 0xf9, 0x8f, 0x8f, 0x8f, 0x00, 0x00, 0x00, 0x37, 0x37, 0x37, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x60, 0x60, 0x60, 0x01, 0x01, 0x01, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0xa7, 0xa7, 0xa7, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x9e, 0x9e, 0x0d, 0x0d, 0x0d, 0x07, 0x07, 0x07, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0x79, 0x79, 0x79, 0xf6, 0xf6, 0xf6, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xd4, 0xd4, 0xd4, 0x2b, 0x2b, 0x2b, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x93, 0x93, 0x93, 0x00, 0x00, 0x00, 0x31, 0x31, 0x31, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x97, 0x97, 0x97, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x8b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x46, 0x46, 0x46, 0xc4, 0xc4, 0xc4, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xd7, 0xd7, 0xd7, 0x35, 0x35, 0x35, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xf1, 0xf1, 0xf1, 0x97, 0x97, 0x97, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x2f, 0xc4, 0xc4, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xa1, 0xa1, 0xa1, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0xca, 0xca, 0xca, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xd4, 0xd4, 0xd4, 0x43, 0x43, 0x43, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0xb2, 0xb2, 0xb2, 0xec, 0xec, 0xec, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x32, 0x32, 0x32, 0x02, 0x02, 0x02, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x96, 0x96, 0x96, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0xce, 0xce, 0xce, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xa3, 0xa3, 0xa3, 0x26, 0x26, 0x26, 0x03, 0x03, 0x03, 0x25, 0x25, 0x25, 0x38, 0x38, 0x38, 0x0a, 0x0a, 0x0a, 0x03, 0x03, 0x03, 0x32, 0x32, 0x32, 0x95, 0x95, 0x95, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe4, 0xe4, 0xa1, 0xa1, 0xa1, 0x31, 0x31, 0x31, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x4d, 0x4d, 0x4d, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0xa4, 0xa4, 0xa4, 0xf1, 0xf1, 0xf1, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xcc, 0xcc, 0xcc, 0x36, 0x36, 0x36, 0x02, 0x02, 0x02, 0x8d, 0x8d, 0x8d, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x97, 0x97, 0x97, 0x07, 0x07, 0x07, 0x35, 0x35, 0x35, 0xc8, 0xc8, 0xc8, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xa2, 0xa2, 0xa2, 0x2a, 0x2a, 0x2a, 0x01, 0x01, 0x01, 0x1f, 0x1f, 0x1f, 0x9f, 0x9f, 0x9f, 0xe5, 0xe5, 0xe5, 0x75, 0x75, 0x75, 0x1a, 0x1a, 0x1a, 0x00, 0x00, 0x00, 0x21, 0x21, 0x21, 0x69, 0x69, 0x69, 0xb3, 0xb3, 0xb3, 0xe9, 0xe9, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xe5, 0xe5, 0xe5, 0xb7, 0xb7, 0xb7, 0x71, 0x71, 0x71, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x75, 0x75, 0x75, 0xcd, 0xcd, 0xcd, 0xae, 0xae, 0xae, 0x2a, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x9f, 0x9f, 0x9f, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xcb, 0xcb, 0xcb, 0x2f, 0x2f, 0x2f, 0x00, 0x00, 0x00, 0x8b, 0x8b, 0x8b, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 
+    0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0xc6, 0xc6, 0xc6, 0xf3, 0xf3, 0xf3, 0xa1, 0xa1, 0xa1, 0x27, 0x27, 0x27, 0x07, 0x07, 0x07, 0x2e, 0x2e, 0x2e, 0x9f, 0x9f, 0x9f, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xed, 0xed, 0xed, 0x9c, 0x9c, 0x9c, 0x37, 0x37, 0x37, 0x0b, 0x0b, 0x0b, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x78, 0x78, 0x78, 0xaf, 0xaf, 0xaf, 0xda, 0xda, 0xda, 0xfa, 0xfa, 0xfa, 0xf5, 0xf5, 0xf5, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf7, 0xf7, 0xf7, 0xe0, 0xe0, 0xe0, 0xae, 0xae, 0xae, 0x7f, 0x7f, 0x7f, 0x29, 0x29, 0x29, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x37, 0x37, 0x37, 0x99, 0x99, 0x99, 0xe5, 0xe5, 0xe5, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0x9e, 0x9e, 0x9e, 0x29, 0x29, 0x29, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0xa3, 0xa3, 0xa3, 0xee, 0xee, 0xee, 0xcc, 0xcc, 0xcc, 0x32, 0x32, 0x32, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0xf7, 0xf7, 0xf7, 0xfe, 0xfe, 0xfe, 
+    0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0x8b, 0x8b, 0x8b, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x3b, 0xb7, 0xb7, 0xb7, 0xa3, 0xa3, 0xa3, 0x35, 0x35, 0x35, 0x03, 0x03, 0x03, 0x25, 0x25, 0x25, 0xa1, 0xa1, 0xa1, 0xec, 0xec, 0xec, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xc5, 0xc5, 0xc5, 0x75, 0x75, 0x75, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x1d, 0x1d, 0x1d, 0x57, 0x57, 0x57, 0x8f, 0x8f, 0x8f, 0xb9, 0xb9, 0xb9, 0xce, 0xce, 0xce, 0xe3, 0xe3, 0xe3, 0xef, 0xef, 0xef, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xe9, 0xe9, 0xe9, 0xe2, 0xe2, 0xe2, 0xce, 0xce, 0xce, 0xaf, 0xaf, 0xaf, 0x89, 0x89, 0x89, 0x5c, 0x5c, 0x5c, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x33, 0x33, 0x33, 0x6d, 0x6d, 0x6d, 0xcd, 0xcd, 0xcd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xfa, 0xfa, 0xfa, 0xa0, 0xa0, 0xa0, 0x3b, 0x3b, 0x3b, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x9e, 0x9e, 0x9e, 0xb8, 0xb8, 0xb8, 0x3f, 0x3f, 0x3f, 0x01, 0x01, 0x01, 0x8c, 0x8c, 0x8c, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0x95, 0x95, 0x95, 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x2d, 0x6b, 0x6b, 0x6b, 0x29, 0x29, 0x29, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x98, 0x98, 0x98, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xb1, 0xb1, 0xb1, 0x72, 0x72, 0x72, 0x37, 0x37, 0x37, 0x0f, 0x0f, 0x0f, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x20, 0x20, 0x20, 0x38, 0x38, 0x38, 0x55, 0x55, 0x55, 0x6b, 0x6b, 0x6b, 0x7a, 0x7a, 0x7a, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x7b, 0x7b, 0x7b, 0x75, 0x75, 0x75, 0x5f, 0x5f, 0x5f, 0x40, 0x40, 0x40, 0x21, 0x21, 0x21, 0x09, 0x09, 0x09, 0x03, 0x03, 0x03, 0x13, 0x13, 0x13, 0x29, 0x29, 0x29, 0x6d, 0x6d, 0x6d, 0xab, 0xab, 0xab, 0xd7, 0xd7, 0xd7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xea, 0xea, 0x9f, 0x9f, 0x9f, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x65, 0x65, 0x65, 0x28, 0x28, 0x28, 0x03, 0x03, 0x03, 0x8e, 0x8e, 0x8e, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xf1, 0xf1, 0xf1, 0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x1d, 0x1d, 0x1d, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x91, 0x91, 0x91, 0xf6, 0xf6, 0xf6, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe0, 0xe0, 0xe0, 0xb7, 0xb7, 0xb7, 0x89, 0x89, 0x89, 0x52, 0x52, 0x52, 0x26, 0x26, 0x26, 0x0b, 0x0b, 0x0b, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x25, 0x25, 0x25, 0x4a, 0x4a, 0x4a, 0x88, 0x88, 0x88, 0xbe, 0xbe, 0xbe, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0x9f, 0x9f, 0x9f, 0x3e, 0x3e, 0x3e, 0x06, 0x06, 0x06, 0x14, 0x14, 0x14, 0x05, 0x05, 0x05, 0x02, 0x02, 0x02, 0x8d, 0x8d, 0x8d, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0x8c, 0x8c, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x08, 0x08, 0x08, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0xc7, 0xc7, 0xc7, 0xc6, 0xc6, 0xc6, 0xce, 0xce, 0xce, 0xc8, 0xc8, 0xc8, 0xcb, 0xcb, 0xcb, 0xd0, 0xd0, 0xd0, 0xbf, 0xbf, 0xbf, 0xd2, 0xd2, 0xd2, 0xc6, 0xc6, 0xc6, 0xcd, 0xcd, 0xcd, 0xd1, 0xd1, 0xd1, 0xce, 0xce, 0xce, 0xcb, 0xcb, 0xcb, 0xc1, 0xc1, 0xc1, 0xa6, 0xa6, 0xa6, 0x8b, 0x8b, 0x8b, 0x66, 0x66, 0x66, 0x4d, 0x4d, 0x4d, 0x2f, 0x2f, 0x2f, 0x1a, 0x1a, 0x1a, 0x0c, 0x0c, 0x0c, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x0d, 0x0d, 0x0d, 0x1e, 0x1e, 0x1e, 0x2d, 0x2d, 0x2d, 0x4b, 0x4b, 0x4b, 0x6c, 0x6c, 0x6c, 0x87, 0x87, 0x87, 0xa0, 0xa0, 0xa0, 0xbe, 0xbe, 0xbe, 0xd7, 0xd7, 0xd7, 0xcc, 0xcc, 0xcc, 0xce, 0xce, 0xce, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xca, 0xca, 0xca, 0xd2, 0xd2, 0xd2, 0xc5, 0xc5, 0xc5, 0xbd, 0xbd, 0xbd, 0xc8, 0xc8, 0xc8, 0xc6, 0xc6, 0xc6, 0xcd, 0xcd, 0xcd, 0xb2, 0xb2, 0xb2, 0x6a, 0x6a, 0x6a, 0x11, 0x11, 0x11, 0x06, 0x06, 0x06, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0xf5, 0xf5, 0xf5, 0xfe, 0xfe, 0xfe, 
+    0xfc, 0xfc, 0xfc, 0xf4, 0xf4, 0xf4, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x0a, 0x0a, 0x27, 0x27, 0x27, 0x32, 0x32, 0x32, 0x37, 0x37, 0x37, 0x2d, 0x2d, 0x2d, 0x34, 0x34, 0x34, 0x3c, 0x3c, 0x3c, 0x26, 0x26, 0x26, 0x42, 0x42, 0x42, 0x2f, 0x2f, 0x2f, 0x37, 0x37, 0x37, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x35, 0x35, 0x35, 0x36, 0x36, 0x36, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x32, 0x32, 0x32, 0x34, 0x34, 0x34, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0a, 0x0a, 0x0a, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x0b, 0x0b, 0x0b, 0x16, 0x16, 0x16, 0x23, 0x23, 0x23, 0x2e, 0x2e, 0x2e, 0x37, 0x37, 0x37, 0x3a, 0x3a, 0x3a, 0x34, 0x34, 0x34, 0x2c, 0x2c, 0x2c, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x32, 0x32, 0x2c, 0x2c, 0x2c, 0x35, 0x35, 0x35, 0x38, 0x38, 0x38, 0x39, 0x39, 0x39, 0x35, 0x35, 0x35, 0x30, 0x30, 0x30, 0x39, 0x39, 0x39, 0x3a, 0x3a, 0x3a, 0x2c, 0x2c, 0x2c, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x85, 0x85, 0xf2, 0xf2, 0xf2, 0xfb, 0xfb, 0xfb, 
+    0xe1, 0xe1, 0xe1, 0x9e, 0x9e, 0x9e, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0xa6, 0xa6, 0xa6, 0xf8, 0xf8, 0xf8, 
+    0x4e, 0x4e, 0x4e, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x70, 0x70, 0x70, 0x9b, 0x9b, 0x9b, 0x8e, 0x8e, 0x8e, 0x8a, 0x8a, 0x8a, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8f, 0x8f, 0x8f, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8e, 0x8e, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8b, 0x8b, 0x8b, 0x87, 0x87, 0x87, 0x18, 0x18, 0x18, 0x05, 0x05, 0x05, 0x0e, 0x0e, 0x0e, 0xb0, 0xb0, 0xb0, 
+    0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0xa0, 0xa0, 0xa0, 0xe8, 0xe8, 0xe8, 0xed, 0xed, 0xed, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0xf8, 0xf8, 0xf7, 0xf7, 0xf7, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf9, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf5, 0xf5, 0xf5, 0xf2, 0xf2, 0xf2, 0xb6, 0xb6, 0xb6, 0x0b, 0x0b, 0x0b, 0x0d, 0x0d, 0x0d, 0x19, 0x19, 0x19, 
+    0x46, 0x46, 0x46, 0x15, 0x15, 0x15, 0xa4, 0xa4, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xec, 0xec, 0xec, 0xb3, 0xb3, 0xb3, 0x1f, 0x1f, 0x1f, 0x5e, 0x5e, 0x5e
+};
+const tImage tumbledry = { image_data_tumbledry, 60, 60,
+    8 };
+
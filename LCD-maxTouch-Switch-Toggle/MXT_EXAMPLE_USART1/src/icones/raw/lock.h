@@ -0,0 +1,95 @@
+
+/*******************************************************************************
+* image
+* filename: unsaved
+* name: lock
+*
+* preset name: Color R8G8B8
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: no
+* conversion type: Color, not_used not_used
+* bits per pixel: 24
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: no
+*******************************************************************************/
+
+/*
+ typedef struct {
+     const uint8_t *data;
+     uint16_t width;
+     uint16_t height;
+     uint8_t dataSize;
+     } tImage;
+*/
+#include <stdint.h>
+
+
+
+static const uint8_t image_data_lock[10800] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xf7, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf5, 0xf4, 0xf2, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xdd, 0xe7, 0xe9, 0xb2, 0xbf, 0xc7, 0x85, 0x92, 0x9a, 0x5b, 0x69, 0x72, 0x51, 0x5f, 0x68, 0x4f, 0x60, 0x6a, 0x48, 0x5a, 0x66, 0x47, 0x59, 0x65, 0x4b, 0x5e, 0x6c, 0x4c, 0x64, 0x68, 0x6d, 0x82, 0x87, 0x9b, 0xad, 0xb1, 0xc7, 0xd5, 0xd8, 0xe9, 0xf1, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xfa, 0xf4, 0xf8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0xf8, 0xf3, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf3, 0xf9, 0xf9, 0xcb, 0xd5, 0xd7, 0x94, 0xa1, 0xa7, 0x5a, 0x69, 0x70, 0x4c, 0x5b, 0x62, 0x43, 0x54, 0x5c, 0x47, 0x58, 0x62, 0x47, 0x59, 0x63, 0x41, 0x55, 0x60, 0x41, 0x55, 0x60, 0x47, 0x5a, 0x68, 0x4a, 0x63, 0x68, 0x3c, 0x53, 0x59, 0x3e, 0x51, 0x57, 0x63, 0x72, 0x77, 0x9b, 0xa6, 0xaa, 0xce, 0xd6, 0xd9, 0xf1, 0xf5, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf5, 0xf3, 0xf6, 0xfb, 0xfa, 0xf8, 0xff, 0xff, 0xfb, 0xf9, 0xfa, 0xf5, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf8, 0xfa, 0xf9, 0xd9, 0xde, 0xe1, 0x9d, 0xa6, 0xab, 0x67, 0x76, 0x7d, 0x4b, 0x5c, 0x64, 0x47, 0x5a, 0x61, 0x47, 0x5a, 0x61, 0x48, 0x5c, 0x63, 0x4b, 0x5f, 0x68, 0x4a, 0x5e, 0x67, 0x45, 0x5c, 0x64, 0x45, 0x5b, 0x66, 0x49, 0x5f, 0x6a, 0x44, 0x5f, 0x68, 0x42, 0x5b, 0x62, 0x44, 0x5b, 0x63, 0x48, 0x5b, 0x62, 0x4d, 0x5c, 0x63, 0x67, 0x72, 0x78, 0xa0, 0xa9, 0xae, 0xd8, 0xdf, 0xe5, 0xfe, 0xff, 0xff, 0xf6, 0xf7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf8, 0xf9, 0xf4, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xfa, 0xfb, 0xc6, 0xce, 0xd0, 0x88, 0x93, 0x97, 0x51, 0x60, 0x67, 0x3c, 0x4e, 0x58, 0x42, 0x58, 0x63, 0x48, 0x5f, 0x65, 0x46, 0x5d, 0x65, 0x42, 0x59, 0x61, 0x40, 0x57, 0x5f, 0x42, 0x59, 0x61, 0x45, 0x5c, 0x64, 0x42, 0x59, 0x61, 0x3c, 0x55, 0x5c, 0x3e, 0x59, 0x64, 0x3f, 0x5a, 0x65, 0x45, 0x5d, 0x67, 0x47, 0x5b, 0x64, 0x40, 0x52, 0x5c, 0x41, 0x52, 0x5a, 0x5a, 0x68, 0x71, 0x76, 0x84, 0x8d, 0xc2, 0xc9, 0xd1, 0xf6, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xfb, 0xfb, 0xff, 0xff, 0xc8, 0xd0, 0xd3, 0x76, 0x81, 0x87, 0x44, 0x55, 0x5c, 0x43, 0x57, 0x60, 0x4a, 0x60, 0x6b, 0x49, 0x61, 0x6b, 0x3e, 0x57, 0x5e, 0x42, 0x59, 0x61, 0x43, 0x5a, 0x62, 0x43, 0x5a, 0x62, 0x47, 0x5e, 0x66, 0x4b, 0x62, 0x6a, 0x49, 0x60, 0x68, 0x43, 0x5a, 0x60, 0x45, 0x5d, 0x69, 0x43, 0x5b, 0x67, 0x41, 0x59, 0x65, 0x42, 0x58, 0x63, 0x47, 0x5b, 0x66, 0x49, 0x5d, 0x68, 0x47, 0x59, 0x63, 0x42, 0x54, 0x5e, 0x71, 0x7f, 0x88, 0xbf, 0xca, 0xd0, 0xf3, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xbb, 0xc3, 0xc6, 0x6a, 0x77, 0x7d, 0x42, 0x53, 0x5b, 0x3f, 0x53, 0x5c, 0x45, 0x5b, 0x66, 0x46, 0x5c, 0x67, 0x40, 0x56, 0x61, 0x47, 0x5d, 0x68, 0x4a, 0x60, 0x6b, 0x49, 0x60, 0x68, 0x45, 0x59, 0x62, 0x3e, 0x52, 0x5b, 0x3e, 0x52, 0x59, 0x43, 0x56, 0x5d, 0x46, 0x59, 0x60, 0x40, 0x56, 0x61, 0x4c, 0x62, 0x6d, 0x51, 0x67, 0x72, 0x49, 0x5f, 0x6a, 0x40, 0x56, 0x61, 0x41, 0x57, 0x62, 0x46, 0x5a, 0x65, 0x48, 0x5c, 0x67, 0x46, 0x5a, 0x63, 0x6b, 0x79, 0x82, 0xc0, 0xc9, 0xce, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xf8, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xe7, 0xeb, 0x7b, 0x88, 0x8e, 0x3d, 0x50, 0x57, 0x46, 0x5c, 0x67, 0x4f, 0x67, 0x73, 0x44, 0x5c, 0x66, 0x40, 0x57, 0x5f, 0x44, 0x58, 0x5f, 0x46, 0x59, 0x67, 0x44, 0x58, 0x63, 0x44, 0x58, 0x63, 0x46, 0x58, 0x62, 0x48, 0x59, 0x63, 0x48, 0x59, 0x61, 0x4c, 0x5b, 0x62, 0x50, 0x5f, 0x66, 0x4a, 0x5c, 0x66, 0x42, 0x54, 0x5e, 0x3b, 0x4f, 0x58, 0x3f, 0x53, 0x5c, 0x46, 0x5a, 0x63, 0x4a, 0x5e, 0x69, 0x46, 0x5c, 0x67, 0x44, 0x5a, 0x65, 0x42, 0x5a, 0x66, 0x3f, 0x51, 0x5b, 0x7f, 0x8a, 0x90, 0xdc, 0xdd, 0xe2, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x93, 0x9b, 0x56, 0x67, 0x6f, 0x45, 0x59, 0x64, 0x47, 0x5f, 0x6b, 0x3e, 0x56, 0x62, 0x3f, 0x57, 0x61, 0x4b, 0x5f, 0x66, 0x46, 0x59, 0x5f, 0x46, 0x59, 0x67, 0x48, 0x5a, 0x66, 0x59, 0x6b, 0x77, 0x7b, 0x8c, 0x96, 0x99, 0xa7, 0xb0, 0xa0, 0xae, 0xb7, 0x99, 0xa6, 0xae, 0x91, 0x9e, 0xa6, 0x77, 0x88, 0x90, 0x60, 0x71, 0x79, 0x4c, 0x5f, 0x66, 0x49, 0x5b, 0x65, 0x48, 0x5c, 0x65, 0x42, 0x56, 0x5f, 0x3f, 0x56, 0x5e, 0x46, 0x5d, 0x65, 0x47, 0x62, 0x6d, 0x40, 0x54, 0x5f, 0x4e, 0x58, 0x61, 0x99, 0x9c, 0xa1, 0xf4, 0xf2, 0xf7, 0xff, 0xfe, 0xff, 0xf7, 0xf7, 0xf9, 0xf8, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfd, 0xfd, 0xff, 0xfb, 0xfa, 0xfe, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xc4, 0xcf, 0xd1, 0x51, 0x68, 0x6e, 0x36, 0x4d, 0x55, 0x46, 0x5c, 0x67, 0x46, 0x59, 0x67, 0x3c, 0x4f, 0x5d, 0x4d, 0x63, 0x6e, 0x4a, 0x61, 0x67, 0x3a, 0x53, 0x57, 0x57, 0x61, 0x63, 0x8d, 0x97, 0x99, 0xc3, 0xcb, 0xcd, 0xdb, 0xe0, 0xe3, 0xeb, 0xec, 0xee, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xff, 0xf6, 0xf5, 0xf3, 0xe4, 0xe5, 0xe9, 0xc0, 0xc3, 0xc8, 0x96, 0x9f, 0xa4, 0x5a, 0x69, 0x70, 0x39, 0x4c, 0x53, 0x47, 0x60, 0x67, 0x48, 0x63, 0x6c, 0x39, 0x56, 0x5e, 0x4a, 0x5e, 0x65, 0x40, 0x57, 0x5d, 0x42, 0x5b, 0x62, 0x54, 0x6b, 0x71, 0xba, 0xc9, 0xd0, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf9, 0xff, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xf0, 0xf8, 0xfa, 0x83, 0x8e, 0x90, 0x47, 0x5e, 0x64, 0x3d, 0x54, 0x5c, 0x46, 0x5c, 0x67, 0x47, 0x5a, 0x68, 0x45, 0x58, 0x66, 0x45, 0x59, 0x62, 0x45, 0x59, 0x60, 0x5e, 0x76, 0x7a, 0xb2, 0xbc, 0xbe, 0xd6, 0xde, 0xe0, 0xf4, 0xfc, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfe, 0xff, 0xee, 0xef, 0xf3, 0xd9, 0xe0, 0xe6, 0xa5, 0xb0, 0xb6, 0x66, 0x77, 0x7f, 0x47, 0x5b, 0x64, 0x3b, 0x51, 0x5c, 0x44, 0x5c, 0x66, 0x47, 0x5b, 0x62, 0x46, 0x5d, 0x65, 0x45, 0x5e, 0x65, 0x3f, 0x56, 0x5c, 0x81, 0x92, 0x99, 0xf0, 0xf7, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xfe, 0xfa, 0xfb, 0xff, 0xfd, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xd3, 0xdd, 0xdf, 0x4b, 0x59, 0x5c, 0x40, 0x57, 0x5d, 0x46, 0x5d, 0x65, 0x45, 0x5b, 0x66, 0x42, 0x58, 0x65, 0x4b, 0x5f, 0x6a, 0x43, 0x55, 0x5f, 0x56, 0x69, 0x6f, 0xa2, 0xb4, 0xb8, 0xe7, 0xef, 0xf1, 0xf5, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfb, 0xf9, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xe8, 0xef, 0xf5, 0xa9, 0xb4, 0xba, 0x60, 0x6e, 0x77, 0x3a, 0x4c, 0x56, 0x4f, 0x63, 0x6e, 0x46, 0x5a, 0x61, 0x46, 0x5d, 0x65, 0x45, 0x5e, 0x65, 0x39, 0x50, 0x58, 0x51, 0x62, 0x69, 0xcf, 0xd6, 0xdc, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xfa, 0xfb, 0xfc, 0xff, 0xff, 0xa2, 0xad, 0xb1, 0x45, 0x54, 0x59, 0x42, 0x59, 0x61, 0x48, 0x5f, 0x67, 0x44, 0x5a, 0x65, 0x3f, 0x55, 0x60, 0x46, 0x5a, 0x63, 0x51, 0x62, 0x6a, 0x8a, 0x97, 0x9d, 0xe5, 0xf0, 0xf4, 0xf9, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xfd, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfa, 0xf8, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xe2, 0xe7, 0xed, 0x94, 0x9e, 0xa7, 0x4f, 0x5d, 0x68, 0x4c, 0x5e, 0x6a, 0x49, 0x5d, 0x66, 0x3f, 0x56, 0x5e, 0x3f, 0x57, 0x61, 0x48, 0x5f, 0x67, 0x47, 0x5a, 0x61, 0x98, 0xa1, 0xa6, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xfa, 0xfc, 0xfb, 0xff, 0xff, 0x69, 0x76, 0x7c, 0x4f, 0x60, 0x67, 0x46, 0x5a, 0x63, 0x44, 0x5b, 0x63, 0x44, 0x5c, 0x66, 0x42, 0x58, 0x63, 0x42, 0x54, 0x5e, 0x6e, 0x7d, 0x84, 0xc4, 0xcd, 0xd2, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xfc, 0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc7, 0xce, 0xd4, 0x6c, 0x79, 0x82, 0x43, 0x53, 0x60, 0x48, 0x5c, 0x65, 0x41, 0x57, 0x62, 0x3d, 0x55, 0x5f, 0x4e, 0x66, 0x70, 0x4c, 0x5f, 0x66, 0x66, 0x71, 0x77, 0xfc, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf9, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xf4, 0xfb, 0xff, 0x46, 0x55, 0x5c, 0x4a, 0x5c, 0x66, 0x45, 0x59, 0x62, 0x40, 0x56, 0x61, 0x45, 0x5d, 0x67, 0x47, 0x5d, 0x68, 0x47, 0x5a, 0x61, 0x8c, 0x97, 0x9d, 0xeb, 0xee, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xfd, 0xf8, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xe7, 0xec, 0xf0, 0x8a, 0x97, 0x9f, 0x47, 0x57, 0x64, 0x44, 0x56, 0x62, 0x4b, 0x5f, 0x6a, 0x41, 0x59, 0x65, 0x43, 0x5b, 0x65, 0x46, 0x5a, 0x63, 0x4d, 0x5a, 0x60, 0xf8, 0xfd, 0xff, 0xfa, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfb, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xd8, 0xdf, 0xe5, 0x48, 0x59, 0x61, 0x42, 0x56, 0x5f, 0x45, 0x59, 0x62, 0x43, 0x59, 0x64, 0x41, 0x59, 0x63, 0x45, 0x5c, 0x64, 0x53, 0x66, 0x6d, 0xa1, 0xaa, 0xaf, 0xfc, 0xfb, 0xff, 0xff, 0xf9, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xfe, 0xf9, 0xfd, 0xfc, 0xff, 0xff, 0xfb, 0xfd, 0xfc, 0xf7, 0xff, 0xff, 0xfd, 0xf5, 0xfa, 0xfd, 0xa4, 0xb1, 0xb9, 0x51, 0x63, 0x6f, 0x44, 0x56, 0x62, 0x4c, 0x5f, 0x6d, 0x44, 0x5c, 0x68, 0x3e, 0x56, 0x62, 0x42, 0x56, 0x5f, 0x4e, 0x5d, 0x64, 0xdc, 0xe4, 0xe7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xb9, 0xc2, 0xc9, 0x5c, 0x6d, 0x75, 0x42, 0x58, 0x63, 0x47, 0x5b, 0x64, 0x4a, 0x60, 0x6b, 0x3b, 0x53, 0x5d, 0x3e, 0x57, 0x5e, 0x5c, 0x6f, 0x76, 0xac, 0xb5, 0xba, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xf9, 0xfd, 0xfd, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xfd, 0xfb, 0xff, 0xff, 0xfa, 0xfe, 0xfe, 0xf6, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xb1, 0xc0, 0xc7, 0x57, 0x69, 0x75, 0x47, 0x59, 0x65, 0x44, 0x57, 0x65, 0x45, 0x5d, 0x69, 0x45, 0x5d, 0x69, 0x44, 0x5b, 0x63, 0x57, 0x66, 0x6d, 0xc1, 0xc8, 0xce, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xce, 0xd3, 0x4c, 0x5d, 0x64, 0x44, 0x5b, 0x63, 0x46, 0x5a, 0x63, 0x43, 0x59, 0x64, 0x45, 0x5d, 0x67, 0x41, 0x58, 0x60, 0x5c, 0x6f, 0x75, 0xb6, 0xc1, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xb9, 0xc2, 0xc7, 0x5b, 0x6e, 0x74, 0x43, 0x5b, 0x65, 0x44, 0x58, 0x63, 0x47, 0x59, 0x67, 0x45, 0x59, 0x64, 0x44, 0x5d, 0x64, 0x48, 0x5d, 0x62, 0xc7, 0xcf, 0xd2, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xce, 0xd3, 0x4c, 0x5d, 0x64, 0x44, 0x5b, 0x63, 0x46, 0x5a, 0x63, 0x43, 0x59, 0x64, 0x45, 0x5d, 0x67, 0x41, 0x58, 0x60, 0x5c, 0x6f, 0x75, 0xb6, 0xc1, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xb9, 0xc2, 0xc7, 0x5b, 0x6e, 0x74, 0x43, 0x5b, 0x65, 0x44, 0x58, 0x63, 0x47, 0x59, 0x67, 0x45, 0x59, 0x64, 0x44, 0x5d, 0x64, 0x48, 0x5d, 0x62, 0xc7, 0xcf, 0xd2, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xce, 0xd3, 0x4c, 0x5d, 0x64, 0x44, 0x5b, 0x63, 0x46, 0x5a, 0x63, 0x43, 0x59, 0x64, 0x45, 0x5d, 0x67, 0x41, 0x58, 0x60, 0x5c, 0x6f, 0x75, 0xb6, 0xc1, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xb9, 0xc2, 0xc7, 0x5b, 0x6e, 0x74, 0x43, 0x5b, 0x65, 0x44, 0x58, 0x63, 0x47, 0x59, 0x67, 0x45, 0x59, 0x64, 0x44, 0x5d, 0x64, 0x48, 0x5d, 0x62, 0xc7, 0xcf, 0xd2, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xce, 0xd3, 0x4c, 0x5d, 0x64, 0x44, 0x5b, 0x63, 0x46, 0x5a, 0x63, 0x43, 0x59, 0x64, 0x45, 0x5d, 0x67, 0x41, 0x58, 0x60, 0x5c, 0x6f, 0x75, 0xb6, 0xc1, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xb9, 0xc2, 0xc7, 0x5b, 0x6e, 0x74, 0x43, 0x5b, 0x65, 0x44, 0x58, 0x63, 0x47, 0x59, 0x67, 0x45, 0x59, 0x64, 0x44, 0x5d, 0x64, 0x48, 0x5d, 0x62, 0xc7, 0xcf, 0xd2, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xce, 0xd3, 0x4c, 0x5d, 0x64, 0x44, 0x5b, 0x63, 0x46, 0x5a, 0x63, 0x43, 0x59, 0x64, 0x45, 0x5d, 0x67, 0x41, 0x58, 0x60, 0x5c, 0x6f, 0x75, 0xb6, 0xc1, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xb9, 0xc2, 0xc7, 0x5b, 0x6e, 0x74, 0x43, 0x5b, 0x65, 0x44, 0x58, 0x63, 0x47, 0x59, 0x67, 0x45, 0x59, 0x64, 0x44, 0x5d, 0x64, 0x48, 0x5d, 0x62, 0xc7, 0xcf, 0xd2, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xce, 0xd3, 0x4c, 0x5d, 0x64, 0x44, 0x5b, 0x63, 0x46, 0x5a, 0x63, 0x43, 0x59, 0x64, 0x45, 0x5d, 0x67, 0x41, 0x58, 0x60, 0x5c, 0x6f, 0x75, 0xb6, 0xc1, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xb9, 0xc2, 0xc7, 0x5b, 0x6e, 0x74, 0x43, 0x5b, 0x65, 0x44, 0x58, 0x63, 0x47, 0x59, 0x67, 0x45, 0x59, 0x64, 0x44, 0x5d, 0x64, 0x48, 0x5d, 0x62, 0xc7, 0xcf, 0xd2, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xce, 0xd3, 0x4c, 0x5d, 0x64, 0x44, 0x5b, 0x63, 0x46, 0x5a, 0x63, 0x43, 0x59, 0x64, 0x45, 0x5d, 0x67, 0x41, 0x58, 0x60, 0x5c, 0x6f, 0x75, 0xb6, 0xc1, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xb9, 0xc2, 0xc7, 0x5b, 0x6e, 0x74, 0x43, 0x5b, 0x65, 0x44, 0x58, 0x63, 0x47, 0x59, 0x67, 0x45, 0x59, 0x64, 0x44, 0x5d, 0x64, 0x48, 0x5d, 0x62, 0xc7, 0xcf, 0xd2, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xce, 0xd3, 0x4c, 0x5d, 0x64, 0x44, 0x5b, 0x63, 0x46, 0x5a, 0x63, 0x43, 0x59, 0x64, 0x45, 0x5d, 0x67, 0x41, 0x58, 0x60, 0x5c, 0x6f, 0x75, 0xb6, 0xc1, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xb9, 0xc2, 0xc7, 0x5b, 0x6e, 0x74, 0x43, 0x5b, 0x65, 0x44, 0x58, 0x63, 0x47, 0x59, 0x67, 0x45, 0x59, 0x64, 0x44, 0x5d, 0x64, 0x48, 0x5d, 0x62, 0xc7, 0xcf, 0xd2, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xfb, 0xff, 0xfa, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xcc, 0xc0, 0xc0, 0x80, 0x78, 0x6b, 0x6a, 0x6a, 0x48, 0x69, 0x6c, 0x4d, 0x70, 0x71, 0x51, 0x70, 0x6d, 0x4e, 0x71, 0x6b, 0x4b, 0x90, 0x85, 0x65, 0xc9, 0xba, 0x9b, 0xf5, 0xe5, 0xc4, 0xff, 0xf4, 0xd4, 0xff, 0xf0, 0xce, 0xff, 0xf0, 0xce, 0xff, 0xf0, 0xce, 0xff, 0xf0, 0xce, 0xff, 0xf0, 0xce, 0xff, 0xf0, 0xce, 0xff, 0xf0, 0xce, 0xff, 0xf0, 0xce, 0xff, 0xee, 0xd0, 0xff, 0xf0, 0xd2, 0xfd, 0xec, 0xce, 0xfd, 0xec, 0xce, 0xff, 0xf3, 0xd5, 0xfa, 0xe9, 0xcb, 0xc8, 0xb7, 0x99, 0x92, 0x81, 0x63, 0x66, 0x6c, 0x4a, 0x69, 0x6f, 0x4b, 0x6e, 0x74, 0x4e, 0x6b, 0x71, 0x4d, 0x62, 0x67, 0x49, 0x76, 0x79, 0x68, 0xbc, 0xbd, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xfd, 0xff, 0xf4, 0xff, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xfe, 0xf6, 0xff, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfe, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xf1, 0xc0, 0xfe, 0xe9, 0x80, 0xe7, 0xd0, 0x46, 0xc4, 0xad, 0x23, 0xc5, 0xae, 0x2e, 0xcd, 0xad, 0x1a, 0xd1, 0xb1, 0x1e, 0xd0, 0xae, 0x19, 0xcc, 0xa6, 0x13, 0xd6, 0xae, 0x19, 0xed, 0xc4, 0x2e, 0xff, 0xd1, 0x3d, 0xff, 0xd2, 0x3e, 0xff, 0xd3, 0x3c, 0xff, 0xd3, 0x3c, 0xff, 0xd3, 0x3c, 0xff, 0xd3, 0x3c, 0xff, 0xd3, 0x3c, 0xff, 0xd3, 0x3c, 0xff, 0xd3, 0x3c, 0xff, 0xd3, 0x3c, 0xfa, 0xce, 0x39, 0xff, 0xd4, 0x3f, 0xff, 0xd5, 0x40, 0xfe, 0xd2, 0x3d, 0xff, 0xd3, 0x3e, 0xfe, 0xd2, 0x3d, 0xed, 0xc1, 0x2c, 0xd8, 0xac, 0x17, 0xd8, 0xb5, 0x23, 0xd2, 0xb0, 0x1b, 0xcf, 0xad, 0x16, 0xd0, 0xae, 0x17, 0xce, 0xab, 0x1b, 0xd4, 0xb0, 0x28, 0xef, 0xc9, 0x4c, 0xff, 0xe6, 0x6f, 0xff, 0xef, 0xc5, 0xff, 0xf9, 0xf0, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xf6, 0xff, 0xfd, 0xf6, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xe9, 0xff, 0xf3, 0xb7, 0xfa, 0xd3, 0x5e, 0xfa, 0xc9, 0x15, 0xff, 0xcd, 0x00, 0xfa, 0xc5, 0x00, 0xff, 0xcd, 0x05, 0xff, 0xc2, 0x00, 0xff, 0xc5, 0x02, 0xff, 0xc7, 0x04, 0xff, 0xc4, 0x00, 0xff, 0xc4, 0x00, 0xff, 0xc4, 0x00, 0xff, 0xc1, 0x00, 0xff, 0xbd, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xc2, 0x00, 0xff, 0xc2, 0x00, 0xff, 0xbd, 0x00, 0xfc, 0xba, 0x00, 0xff, 0xbd, 0x00, 0xff, 0xc1, 0x00, 0xff, 0xc2, 0x00, 0xff, 0xc2, 0x04, 0xff, 0xbd, 0x00, 0xff, 0xbb, 0x00, 0xff, 0xbf, 0x00, 0xff, 0xc3, 0x01, 0xff, 0xc1, 0x05, 0xff, 0xbc, 0x08, 0xff, 0xb9, 0x0a, 0xf9, 0xd4, 0x62, 0xff, 0xeb, 0xae, 0xff, 0xfe, 0xed, 0xff, 0xff, 0xf8, 0xfb, 0xfe, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfa, 0xfb, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf2, 0xb1, 0xff, 0xde, 0x54, 0xfa, 0xbd, 0x15, 0xff, 0xb6, 0x07, 0xff, 0xc1, 0x06, 0xff, 0xbc, 0x00, 0xff, 0xbc, 0x00, 0xf8, 0xb9, 0x0a, 0xf8, 0xb9, 0x0a, 0xfb, 0xbc, 0x0d, 0xff, 0xc0, 0x11, 0xff, 0xc3, 0x13, 0xfd, 0xc0, 0x10, 0xfc, 0xbf, 0x0f, 0xfd, 0xc0, 0x10, 0xfe, 0xc1, 0x10, 0xfe, 0xc1, 0x10, 0xfe, 0xc1, 0x10, 0xfe, 0xc1, 0x10, 0xfe, 0xc1, 0x10, 0xfe, 0xc1, 0x10, 0xfe, 0xc1, 0x10, 0xfe, 0xc1, 0x10, 0xff, 0xc7, 0x17, 0xfe, 0xc1, 0x11, 0xfa, 0xbd, 0x0d, 0xfb, 0xbe, 0x0e, 0xfc, 0xbf, 0x0f, 0xfc, 0xbf, 0x0f, 0xfc, 0xbf, 0x0f, 0xfd, 0xc0, 0x10, 0xfc, 0xb8, 0x0f, 0xff, 0xbb, 0x10, 0xff, 0xbe, 0x0f, 0xff, 0xbf, 0x0e, 0xff, 0xc0, 0x11, 0xff, 0xc0, 0x13, 0xff, 0xbe, 0x15, 0xfd, 0xb8, 0x12, 0xf7, 0xc0, 0x0e, 0xff, 0xd5, 0x62, 0xff, 0xee, 0xc0, 0xff, 0xfd, 0xf2, 0xfb, 0xff, 0xfd, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf2, 0xf7, 0xdb, 0x77, 0xfb, 0xc8, 0x15, 0xff, 0xb9, 0x01, 0xff, 0xbc, 0x11, 0xff, 0xc6, 0x18, 0xfe, 0xbd, 0x0d, 0xfd, 0xb7, 0x17, 0xff, 0xc8, 0x0f, 0xfd, 0xc3, 0x0a, 0xfc, 0xc2, 0x09, 0xfc, 0xc4, 0x0d, 0xfb, 0xc3, 0x0c, 0xf6, 0xc0, 0x08, 0xf7, 0xc1, 0x09, 0xf8, 0xc4, 0x0c, 0xfa, 0xc4, 0x0c, 0xfa, 0xc4, 0x0c, 0xfa, 0xc4, 0x0c, 0xfa, 0xc4, 0x0c, 0xfa, 0xc4, 0x0c, 0xfa, 0xc4, 0x0c, 0xfa, 0xc4, 0x0c, 0xfa, 0xc4, 0x0c, 0xfc, 0xc6, 0x0e, 0xf6, 0xc0, 0x08, 0xf5, 0xbf, 0x07, 0xfb, 0xc5, 0x0d, 0xff, 0xc9, 0x11, 0xfc, 0xc6, 0x0e, 0xf9, 0xc3, 0x0b, 0xf9, 0xc3, 0x0b, 0xf8, 0xc1, 0x0c, 0xfe, 0xc8, 0x10, 0xff, 0xc9, 0x0f, 0xfa, 0xc4, 0x08, 0xf6, 0xc0, 0x04, 0xfa, 0xc4, 0x08, 0xfd, 0xc7, 0x0d, 0xfe, 0xc8, 0x10, 0xff, 0xbf, 0x00, 0xfc, 0xc4, 0x25, 0xfe, 0xd9, 0x88, 0xff, 0xf6, 0xe1, 0xfc, 0xff, 0xfd, 0xf8, 0xff, 0xfb, 0xfc, 0xfe, 0xf9, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xc7, 0xf2, 0xcc, 0x51, 0xfc, 0xc0, 0x0a, 0xff, 0xbd, 0x06, 0xff, 0xc2, 0x01, 0xfc, 0xcc, 0x00, 0xf7, 0xc5, 0x00, 0xff, 0xc2, 0x21, 0xff, 0xc5, 0x02, 0xff, 0xc4, 0x00, 0xff, 0xc1, 0x00, 0xff, 0xc2, 0x01, 0xff, 0xc1, 0x01, 0xff, 0xc0, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xc1, 0x00, 0xff, 0xc0, 0x02, 0xff, 0xc0, 0x02, 0xff, 0xc0, 0x02, 0xff, 0xc0, 0x02, 0xff, 0xc0, 0x02, 0xff, 0xc0, 0x02, 0xff, 0xc0, 0x02, 0xff, 0xc0, 0x02, 0xfe, 0xbe, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xc3, 0x02, 0xff, 0xc4, 0x03, 0xff, 0xc1, 0x00, 0xfe, 0xbe, 0x00, 0xff, 0xc1, 0x00, 0xff, 0xc6, 0x05, 0xff, 0xc3, 0x01, 0xfe, 0xc2, 0x00, 0xfc, 0xc0, 0x00, 0xf9, 0xbd, 0x00, 0xfa, 0xbe, 0x00, 0xfd, 0xc1, 0x00, 0xfd, 0xc1, 0x00, 0xfc, 0xc0, 0x00, 0xff, 0xc4, 0x00, 0xfb, 0xbf, 0x07, 0xfa, 0xcd, 0x56, 0xff, 0xef, 0xc6, 0xff, 0xff, 0xfd, 0xf7, 0xff, 0xfe, 0xf6, 0xfb, 0xf5, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xb2, 0xf3, 0xc9, 0x37, 0xff, 0xc4, 0x00, 0xff, 0xc0, 0x08, 0xf7, 0xbf, 0x06, 0xf2, 0xc7, 0x00, 0xf5, 0xc4, 0x00, 0xff, 0xbf, 0x11, 0xfe, 0xba, 0x00, 0xff, 0xbc, 0x01, 0xff, 0xbd, 0x04, 0xff, 0xbd, 0x04, 0xff, 0xbd, 0x06, 0xff, 0xbe, 0x0a, 0xff, 0xbf, 0x0b, 0xff, 0xbd, 0x09, 0xff, 0xbe, 0x0c, 0xff, 0xbe, 0x0c, 0xff, 0xbe, 0x0c, 0xff, 0xbe, 0x0c, 0xff, 0xbe, 0x0c, 0xff, 0xbe, 0x0c, 0xff, 0xbe, 0x0c, 0xff, 0xbe, 0x0c, 0xff, 0xbc, 0x08, 0xff, 0xc0, 0x0c, 0xff, 0xc2, 0x0e, 0xff, 0xbe, 0x0a, 0xff, 0xba, 0x06, 0xff, 0xba, 0x06, 0xff, 0xbd, 0x09, 0xff, 0xbe, 0x0a, 0xff, 0xc1, 0x09, 0xff, 0xbd, 0x05, 0xfd, 0xbb, 0x03, 0xff, 0xbe, 0x06, 0xff, 0xc2, 0x0a, 0xff, 0xc2, 0x0a, 0xff, 0xc1, 0x09, 0xff, 0xc0, 0x08, 0xff, 0xc4, 0x0a, 0xfb, 0xc0, 0x00, 0xfd, 0xcb, 0x36, 0xff, 0xe6, 0xa9, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xff, 0xf9, 0xfe, 0xfa, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xb4, 0xf0, 0xca, 0x21, 0xff, 0xc8, 0x00, 0xff, 0xc2, 0x05, 0xf8, 0xbb, 0x2c, 0xfa, 0xc6, 0x22, 0xff, 0xc2, 0x07, 0xff, 0xb8, 0x0a, 0xfa, 0xc8, 0x05, 0xfd, 0xcb, 0x08, 0xfb, 0xc9, 0x08, 0xf7, 0xc2, 0x04, 0xf7, 0xc0, 0x03, 0xfb, 0xc4, 0x08, 0xfe, 0xc4, 0x0b, 0xfa, 0xc0, 0x07, 0xfa, 0xbf, 0x09, 0xfa, 0xbf, 0x09, 0xfa, 0xbf, 0x09, 0xfa, 0xbf, 0x09, 0xfa, 0xbf, 0x09, 0xfa, 0xbf, 0x09, 0xfa, 0xbf, 0x09, 0xfa, 0xbf, 0x09, 0xf9, 0xbf, 0x04, 0xfb, 0xc1, 0x06, 0xfa, 0xc0, 0x05, 0xf8, 0xbe, 0x03, 0xfd, 0xc3, 0x08, 0xff, 0xc8, 0x0d, 0xff, 0xc5, 0x0a, 0xf6, 0xbc, 0x01, 0xfb, 0xc1, 0x05, 0xf9, 0xbf, 0x03, 0xfb, 0xc1, 0x06, 0xfe, 0xc4, 0x0b, 0xfb, 0xc1, 0x08, 0xf7, 0xbd, 0x04, 0xf9, 0xbf, 0x06, 0xff, 0xc7, 0x0c, 0xfb, 0xbe, 0x18, 0xfb, 0xc2, 0x00, 0xff, 0xcd, 0x26, 0xff, 0xe2, 0x98, 0xff, 0xf8, 0xf8, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xbf, 0x07, 0xff, 0xc4, 0x07, 0xff, 0xc1, 0x02, 0xfe, 0xc1, 0x06, 0xff, 0xc3, 0x0e, 0xfd, 0xbf, 0x0c, 0xfb, 0xbb, 0x01, 0xff, 0xc4, 0x01, 0xff, 0xb0, 0x14, 0xff, 0xb8, 0x11, 0xf1, 0xc4, 0x09, 0xd4, 0xba, 0x03, 0xb7, 0x9c, 0x17, 0xb0, 0x8c, 0x3e, 0xba, 0x98, 0x41, 0xbf, 0xa4, 0x23, 0xd7, 0xab, 0x26, 0xed, 0xba, 0x07, 0xff, 0xc6, 0x00, 0xff, 0xbe, 0x0d, 0xfe, 0xb6, 0x0a, 0xff, 0xc3, 0x00, 0xff, 0xc8, 0x00, 0xfb, 0xbb, 0x04, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xbe, 0x08, 0xff, 0xc2, 0x08, 0xff, 0xc1, 0x04, 0xfe, 0xc1, 0x06, 0xff, 0xc3, 0x0c, 0xff, 0xc1, 0x0a, 0xfc, 0xbf, 0x04, 0xff, 0xc4, 0x04, 0xff, 0xcd, 0x00, 0xd5, 0xae, 0x13, 0xa3, 0x92, 0x3a, 0x79, 0x78, 0x4a, 0x59, 0x5c, 0x55, 0x4d, 0x4d, 0x69, 0x4d, 0x52, 0x66, 0x4c, 0x58, 0x4e, 0x83, 0x76, 0x32, 0xa5, 0x8e, 0x1e, 0xda, 0xb1, 0x17, 0xfd, 0xc5, 0x16, 0xff, 0xc3, 0x08, 0xfd, 0xbf, 0x00, 0xff, 0xc1, 0x00, 0xff, 0xc2, 0x11, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xbe, 0x0a, 0xff, 0xc0, 0x09, 0xff, 0xbf, 0x06, 0xff, 0xbf, 0x05, 0xff, 0xc3, 0x08, 0xff, 0xc4, 0x0a, 0xff, 0xc3, 0x09, 0xfd, 0xc3, 0x08, 0xce, 0xbe, 0x00, 0x94, 0x8a, 0x2b, 0x5d, 0x60, 0x65, 0x42, 0x56, 0x77, 0x38, 0x56, 0x70, 0x36, 0x5a, 0x70, 0x37, 0x61, 0x71, 0x33, 0x63, 0x67, 0x3a, 0x53, 0x57, 0x59, 0x63, 0x48, 0x9b, 0x8d, 0x34, 0xdd, 0xbb, 0x1b, 0xfe, 0xc9, 0x07, 0xfe, 0xbf, 0x00, 0xff, 0xbb, 0x06, 0xff, 0xc5, 0x0f, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc1, 0x0a, 0xff, 0xbf, 0x0b, 0xff, 0xc0, 0x0c, 0xff, 0xc0, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xc6, 0x08, 0xff, 0xc4, 0x0e, 0xf4, 0xbb, 0x0a, 0xa6, 0x96, 0x34, 0x72, 0x67, 0x53, 0x4a, 0x4d, 0x70, 0x44, 0x56, 0x6c, 0x46, 0x62, 0x53, 0x47, 0x64, 0x4e, 0x45, 0x64, 0x55, 0x3f, 0x64, 0x53, 0x32, 0x5b, 0x77, 0x3d, 0x55, 0x6f, 0x67, 0x67, 0x4b, 0xae, 0x98, 0x1e, 0xef, 0xc0, 0x0e, 0xff, 0xc3, 0x13, 0xfe, 0xbd, 0x0b, 0xfc, 0xc2, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc4, 0x0a, 0xff, 0xbf, 0x0b, 0xff, 0xc1, 0x10, 0xff, 0xc0, 0x08, 0xfd, 0xbe, 0x00, 0xff, 0xc6, 0x06, 0xfb, 0xc4, 0x12, 0xe5, 0xaf, 0x0e, 0x79, 0x79, 0x55, 0x55, 0x5a, 0x5e, 0x42, 0x51, 0x68, 0x48, 0x5c, 0x63, 0x4c, 0x5c, 0x5c, 0x4b, 0x50, 0x66, 0x49, 0x4c, 0x6f, 0x46, 0x4b, 0x68, 0x44, 0x64, 0x6f, 0x45, 0x59, 0x7a, 0x51, 0x54, 0x5d, 0x88, 0x74, 0x2b, 0xd9, 0xaa, 0x1c, 0xff, 0xc3, 0x1e, 0xfe, 0xc2, 0x0a, 0xf5, 0xc3, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc5, 0x05, 0xff, 0xbe, 0x0a, 0xff, 0xc2, 0x13, 0xff, 0xc1, 0x09, 0xfb, 0xbd, 0x00, 0xff, 0xc7, 0x06, 0xf8, 0xc2, 0x18, 0xd8, 0xa4, 0x12, 0x53, 0x6d, 0x50, 0x3e, 0x5d, 0x58, 0x36, 0x5b, 0x61, 0x42, 0x63, 0x68, 0x47, 0x5c, 0x71, 0x4a, 0x52, 0x80, 0x50, 0x58, 0x7c, 0x4f, 0x61, 0x63, 0x48, 0x59, 0x51, 0x4c, 0x5d, 0x6f, 0x4c, 0x55, 0x66, 0x72, 0x66, 0x3e, 0xc5, 0x9c, 0x2a, 0xfb, 0xc0, 0x1a, 0xff, 0xc5, 0x05, 0xfa, 0xc8, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xfe, 0xc4, 0x00, 0xfb, 0xbe, 0x04, 0xff, 0xc2, 0x13, 0xff, 0xc1, 0x08, 0xfa, 0xbc, 0x00, 0xff, 0xc8, 0x07, 0xf6, 0xc0, 0x1f, 0xcf, 0x9b, 0x14, 0x55, 0x6d, 0x55, 0x43, 0x60, 0x5e, 0x3b, 0x5e, 0x64, 0x3d, 0x5f, 0x5e, 0x3e, 0x57, 0x5c, 0x42, 0x55, 0x66, 0x44, 0x5d, 0x5a, 0x3e, 0x63, 0x38, 0x45, 0x51, 0x4f, 0x46, 0x5f, 0x66, 0x3f, 0x5a, 0x63, 0x63, 0x67, 0x4c, 0xb9, 0x9d, 0x32, 0xf7, 0xc0, 0x0d, 0xff, 0xc1, 0x00, 0xff, 0xc3, 0x11, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xfc, 0xc3, 0x00, 0xf9, 0xbc, 0x01, 0xff, 0xc2, 0x13, 0xff, 0xc1, 0x08, 0xf9, 0xbb, 0x00, 0xff, 0xc8, 0x09, 0xf6, 0xc1, 0x23, 0xca, 0x97, 0x18, 0x64, 0x64, 0x5a, 0x54, 0x57, 0x68, 0x49, 0x55, 0x6b, 0x47, 0x59, 0x5b, 0x49, 0x57, 0x58, 0x4c, 0x58, 0x6e, 0x4a, 0x5c, 0x74, 0x3b, 0x5a, 0x5f, 0x4a, 0x57, 0x68, 0x41, 0x62, 0x69, 0x31, 0x5b, 0x5a, 0x57, 0x6b, 0x4f, 0xb6, 0xa4, 0x34, 0xf6, 0xc4, 0x01, 0xff, 0xbd, 0x00, 0xff, 0xb9, 0x21, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc3, 0x06, 0xfe, 0xc2, 0x02, 0xfd, 0xc1, 0x01, 0xff, 0xc2, 0x05, 0xff, 0xc3, 0x09, 0xfe, 0xc0, 0x0d, 0xf8, 0xb9, 0x0c, 0xf2, 0xb1, 0x0b, 0x6e, 0x6d, 0x59, 0x34, 0x5b, 0x56, 0x3a, 0x6c, 0x60, 0x4b, 0x59, 0x66, 0x55, 0x4c, 0x81, 0x40, 0x54, 0x5b, 0x3e, 0x63, 0x44, 0x46, 0x53, 0x64, 0x4f, 0x4f, 0x6b, 0x43, 0x6f, 0x56, 0x36, 0x58, 0x64, 0x7f, 0x65, 0x66, 0xe3, 0xb0, 0x1f, 0xf4, 0xc9, 0x00, 0xf1, 0xbd, 0x05, 0xff, 0xc2, 0x05, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc2, 0x07, 0xfd, 0xc0, 0x03, 0xfc, 0xbf, 0x02, 0xfe, 0xc1, 0x04, 0xff, 0xc4, 0x0a, 0xff, 0xc2, 0x0d, 0xfb, 0xbc, 0x0d, 0xf7, 0xb8, 0x0b, 0x96, 0x89, 0x3b, 0x4d, 0x5d, 0x52, 0x3e, 0x5c, 0x64, 0x46, 0x53, 0x5c, 0x54, 0x55, 0x73, 0x42, 0x5b, 0x62, 0x42, 0x61, 0x59, 0x4c, 0x58, 0x72, 0x4f, 0x58, 0x77, 0x3c, 0x61, 0x69, 0x48, 0x60, 0x52, 0xa0, 0x86, 0x3b, 0xf3, 0xba, 0x15, 0xff, 0xc8, 0x03, 0xfe, 0xc2, 0x0c, 0xff, 0xb8, 0x02, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xfe, 0xc1, 0x07, 0xfd, 0xc0, 0x06, 0xfc, 0xbf, 0x04, 0xfe, 0xc1, 0x06, 0xff, 0xc3, 0x08, 0xff, 0xc3, 0x0c, 0xff, 0xc1, 0x0c, 0xfc, 0xbe, 0x0b, 0xd0, 0xaa, 0x19, 0x7c, 0x6e, 0x3d, 0x53, 0x5a, 0x60, 0x44, 0x4f, 0x51, 0x4c, 0x5a, 0x63, 0x3f, 0x5c, 0x64, 0x41, 0x5c, 0x67, 0x4c, 0x54, 0x78, 0x45, 0x53, 0x6e, 0x47, 0x5b, 0x64, 0x75, 0x78, 0x35, 0xce, 0xaa, 0x0e, 0xff, 0xbf, 0x06, 0xff, 0xbe, 0x0a, 0xff, 0xc5, 0x12, 0xff, 0xbb, 0x06, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc1, 0x0a, 0xfe, 0xc0, 0x09, 0xfd, 0xc0, 0x06, 0xfe, 0xc1, 0x07, 0xff, 0xc3, 0x08, 0xff, 0xc4, 0x09, 0xff, 0xc3, 0x09, 0xff, 0xc2, 0x08, 0xff, 0xc1, 0x0c, 0xbf, 0x96, 0x20, 0x89, 0x7d, 0x49, 0x51, 0x5b, 0x53, 0x43, 0x5b, 0x65, 0x3c, 0x5a, 0x62, 0x42, 0x5a, 0x66, 0x49, 0x54, 0x70, 0x4c, 0x54, 0x61, 0x80, 0x7f, 0x46, 0xbd, 0xa3, 0x1a, 0xf6, 0xbe, 0x07, 0xff, 0xc0, 0x01, 0xfd, 0xb6, 0x02, 0xff, 0xc2, 0x0f, 0xff, 0xc8, 0x08, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc4, 0x0a, 0xff, 0xc2, 0x0b, 0xff, 0xc2, 0x08, 0xfe, 0xc1, 0x07, 0xff, 0xc2, 0x08, 0xff, 0xc3, 0x08, 0xff, 0xc3, 0x06, 0xff, 0xc2, 0x05, 0xff, 0xc4, 0x0f, 0xf7, 0xc1, 0x00, 0xc5, 0xae, 0x2e, 0x65, 0x6c, 0x5c, 0x40, 0x5b, 0x76, 0x3e, 0x5d, 0x60, 0x46, 0x5f, 0x5c, 0x49, 0x59, 0x69, 0x69, 0x64, 0x5e, 0xc9, 0xb6, 0x1a, 0xfc, 0xc6, 0x02, 0xff, 0xbb, 0x19, 0xff, 0xc5, 0x0b, 0xf9, 0xbd, 0x00, 0xf2, 0xbb, 0x08, 0xf7, 0xcd, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc4, 0x09, 0xff, 0xc3, 0x08, 0xff, 0xc3, 0x09, 0xff, 0xc2, 0x08, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x06, 0xfe, 0xc1, 0x04, 0xff, 0xc3, 0x03, 0xff, 0xbb, 0x0f, 0xff, 0xce, 0x00, 0xdf, 0xbd, 0x1d, 0x6a, 0x6d, 0x5c, 0x3a, 0x57, 0x75, 0x3e, 0x5c, 0x5c, 0x49, 0x5e, 0x59, 0x46, 0x5a, 0x63, 0x6d, 0x67, 0x57, 0xe1, 0xc1, 0x00, 0xff, 0xc3, 0x00, 0xff, 0xae, 0x1a, 0xff, 0xc8, 0x12, 0xfd, 0xc8, 0x00, 0xf4, 0xbd, 0x08, 0xf2, 0xc7, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xff, 0xc3, 0x01, 0xff, 0xc3, 0x03, 0xff, 0xc2, 0x07, 0xff, 0xc1, 0x0a, 0xfe, 0xc0, 0x09, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x04, 0xff, 0xc3, 0x03, 0xf5, 0xbc, 0x0a, 0xff, 0xc5, 0x00, 0xd8, 0xa9, 0x25, 0x60, 0x60, 0x56, 0x39, 0x59, 0x64, 0x42, 0x5c, 0x59, 0x49, 0x57, 0x62, 0x41, 0x56, 0x67, 0x58, 0x63, 0x53, 0xcc, 0xa7, 0x11, 0xff, 0xb7, 0x00, 0xfe, 0xb6, 0x0a, 0xf7, 0xc6, 0x08, 0xfe, 0xc6, 0x00, 0xff, 0xc1, 0x0c, 0xff, 0xbd, 0x0a, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9c, 0xfb, 0xc9, 0x2c, 0xff, 0xc0, 0x04, 0xfe, 0xc0, 0x0b, 0xf6, 0xc4, 0x03, 0xff, 0xc1, 0x09, 0xff, 0xba, 0x0e, 0xff, 0xc5, 0x02, 0xfc, 0xc0, 0x00, 0xfd, 0xc1, 0x00, 0xff, 0xc2, 0x07, 0xff, 0xc2, 0x08, 0xfe, 0xc0, 0x09, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x06, 0xff, 0xc2, 0x05, 0xf6, 0xcb, 0x0a, 0xfd, 0xbd, 0x03, 0xcd, 0x95, 0x3e, 0x5d, 0x59, 0x56, 0x3f, 0x63, 0x57, 0x4c, 0x62, 0x5f, 0x4b, 0x54, 0x73, 0x40, 0x56, 0x6e, 0x4f, 0x68, 0x62, 0xbe, 0x96, 0x3f, 0xff, 0xbd, 0x0e, 0xff, 0xce, 0x01, 0xee, 0xc4, 0x00, 0xf7, 0xbb, 0x00, 0xff, 0xc0, 0x0d, 0xff, 0xb5, 0x19, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf7, 0xc5, 0x06, 0xff, 0xc0, 0x03, 0xff, 0xc4, 0x2e, 0xfd, 0xe9, 0xa0, 0xfb, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xa3, 0xfd, 0xca, 0x31, 0xff, 0xbf, 0x05, 0xfe, 0xc0, 0x0d, 0xf7, 0xc5, 0x04, 0xff, 0xc3, 0x0b, 0xff, 0xbc, 0x0c, 0xff, 0xc5, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xff, 0xba, 0x10, 0xfc, 0xce, 0x06, 0xa2, 0x8f, 0x31, 0x56, 0x58, 0x64, 0x47, 0x61, 0x56, 0x43, 0x59, 0x64, 0x4a, 0x4a, 0x88, 0x5a, 0x50, 0x72, 0x52, 0x5c, 0x53, 0xa4, 0x8b, 0x27, 0xff, 0xbb, 0x0b, 0xff, 0xbc, 0x04, 0xff, 0xb9, 0x15, 0xfd, 0xc7, 0x1c, 0xfa, 0xc5, 0x05, 0xff, 0xc4, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfc, 0xc2, 0x09, 0xff, 0xc1, 0x06, 0xfe, 0xc8, 0x32, 0xfd, 0xed, 0xa2, 0xff, 0xff, 0xf6, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xea, 0x9e, 0xfc, 0xca, 0x2d, 0xff, 0xbf, 0x03, 0xfe, 0xc0, 0x0b, 0xf7, 0xc5, 0x02, 0xff, 0xc4, 0x0a, 0xff, 0xba, 0x0d, 0xfe, 0xc4, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xff, 0xba, 0x00, 0xee, 0xc9, 0x00, 0x96, 0x87, 0x28, 0x4d, 0x57, 0x61, 0x41, 0x67, 0x58, 0x3d, 0x68, 0x55, 0x3f, 0x5e, 0x63, 0x48, 0x63, 0x40, 0x49, 0x5e, 0x73, 0x9c, 0x8f, 0x40, 0xfa, 0xc2, 0x15, 0xff, 0xc3, 0x01, 0xfe, 0xbc, 0x04, 0xfa, 0xc4, 0x0c, 0xfa, 0xc0, 0x05, 0xff, 0xc0, 0x0c, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfc, 0xc2, 0x07, 0xff, 0xc1, 0x04, 0xfd, 0xc7, 0x2f, 0xfc, 0xec, 0xa1, 0xfe, 0xff, 0xf3, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xfd, 0xf8, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe8, 0x9b, 0xfa, 0xc8, 0x27, 0xff, 0xbf, 0x00, 0xfe, 0xc1, 0x07, 0xf7, 0xc6, 0x00, 0xff, 0xc4, 0x0a, 0xff, 0xba, 0x0d, 0xfd, 0xc3, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xff, 0xc4, 0x0d, 0xec, 0xc4, 0x0d, 0x91, 0x7f, 0x3f, 0x4b, 0x4f, 0x7c, 0x3b, 0x5d, 0x78, 0x34, 0x60, 0x6b, 0x34, 0x5b, 0x6a, 0x36, 0x5e, 0x44, 0x39, 0x50, 0x72, 0x89, 0x84, 0x40, 0xe9, 0xbf, 0x15, 0xff, 0xc6, 0x00, 0xf9, 0xc0, 0x00, 0xf8, 0xc4, 0x00, 0xfc, 0xbe, 0x09, 0xff, 0xbe, 0x1c, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfc, 0xc3, 0x04, 0xff, 0xc1, 0x01, 0xfc, 0xc7, 0x2d, 0xfb, 0xeb, 0x9e, 0xfd, 0xff, 0xf2, 0xff, 0xfa, 0xfe, 0xff, 0xfe, 0xfb, 0xf8, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xe7, 0x98, 0xfa, 0xc8, 0x27, 0xff, 0xbf, 0x00, 0xfe, 0xc1, 0x04, 0xf7, 0xc6, 0x00, 0xff, 0xc4, 0x08, 0xff, 0xba, 0x0d, 0xfd, 0xc2, 0x02, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xff, 0xc4, 0x0e, 0xe7, 0xbe, 0x0c, 0x99, 0x7e, 0x31, 0x5e, 0x50, 0x67, 0x50, 0x57, 0x6a, 0x49, 0x57, 0x62, 0x4a, 0x55, 0x67, 0x4c, 0x56, 0x57, 0x57, 0x58, 0x52, 0x98, 0x85, 0x29, 0xea, 0xbc, 0x11, 0xff, 0xc6, 0x03, 0xfd, 0xc3, 0x00, 0xfc, 0xc6, 0x01, 0xfa, 0xbd, 0x03, 0xff, 0xbc, 0x1b, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfc, 0xc3, 0x02, 0xff, 0xc1, 0x00, 0xfc, 0xc7, 0x2d, 0xfa, 0xea, 0x9f, 0xfc, 0xfe, 0xf1, 0xff, 0xfa, 0xfe, 0xff, 0xfe, 0xfa, 0xf8, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe9, 0x9d, 0xfb, 0xc9, 0x2a, 0xff, 0xbf, 0x00, 0xfe, 0xc1, 0x04, 0xf7, 0xc6, 0x00, 0xff, 0xc4, 0x08, 0xff, 0xba, 0x0e, 0xfe, 0xc3, 0x03, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc5, 0x00, 0xf5, 0xc9, 0x00, 0xc7, 0xa3, 0x07, 0xa9, 0x8b, 0x2b, 0xa4, 0x8d, 0x2d, 0xa0, 0x8d, 0x26, 0xa8, 0x8d, 0x36, 0xac, 0x8b, 0x3e, 0xad, 0x8e, 0x34, 0xd2, 0xa5, 0x18, 0xff, 0xc3, 0x12, 0xff, 0xc4, 0x14, 0xff, 0xc2, 0x12, 0xfd, 0xc6, 0x07, 0xf7, 0xbe, 0x00, 0xfe, 0xbd, 0x0d, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfc, 0xc3, 0x02, 0xff, 0xc1, 0x00, 0xfd, 0xc7, 0x2f, 0xfb, 0xea, 0xa2, 0xfd, 0xfe, 0xf6, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xfa, 0xf8, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xa9, 0xfd, 0xca, 0x33, 0xff, 0xbf, 0x01, 0xfd, 0xc0, 0x05, 0xf6, 0xc5, 0x00, 0xff, 0xc3, 0x07, 0xff, 0xba, 0x0e, 0xff, 0xc4, 0x04, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xff, 0xc0, 0x10, 0xff, 0xcf, 0x08, 0xf7, 0xc5, 0x04, 0xf5, 0xc3, 0x14, 0xf7, 0xc7, 0x0b, 0xf2, 0xc4, 0x00, 0xfa, 0xc4, 0x02, 0xfb, 0xbe, 0x16, 0xf6, 0xbc, 0x1c, 0xfa, 0xbd, 0x03, 0xff, 0xc4, 0x0a, 0xff, 0xbb, 0x17, 0xff, 0xbc, 0x16, 0xff, 0xc6, 0x07, 0xf9, 0xc1, 0x00, 0xff, 0xc3, 0x09, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfc, 0xc3, 0x02, 0xff, 0xc2, 0x02, 0xfe, 0xc8, 0x34, 0xfe, 0xed, 0xa8, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xfb, 0xf8, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb4, 0xff, 0xcb, 0x3d, 0xff, 0xc0, 0x09, 0xfd, 0xbf, 0x08, 0xf6, 0xc5, 0x00, 0xff, 0xc3, 0x07, 0xff, 0xbb, 0x0f, 0xff, 0xc5, 0x05, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xf9, 0xb5, 0x16, 0xff, 0xc1, 0x11, 0xff, 0xbf, 0x08, 0xff, 0xc5, 0x15, 0xff, 0xc6, 0x0c, 0xfe, 0xc1, 0x00, 0xff, 0xc4, 0x00, 0xff, 0xbc, 0x0c, 0xff, 0xc7, 0x0c, 0xff, 0xc0, 0x00, 0xff, 0xc1, 0x00, 0xfd, 0xb9, 0x10, 0xfb, 0xbc, 0x0f, 0xff, 0xc6, 0x02, 0xfb, 0xc2, 0x00, 0xff, 0xc5, 0x10, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfb, 0xc2, 0x03, 0xff, 0xc1, 0x06, 0xff, 0xc9, 0x39, 0xff, 0xee, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xbd, 0xff, 0xcd, 0x43, 0xff, 0xc0, 0x0c, 0xfd, 0xbf, 0x0a, 0xf5, 0xc4, 0x00, 0xff, 0xc3, 0x07, 0xff, 0xbb, 0x0e, 0xff, 0xc6, 0x06, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xff, 0xc0, 0x00, 0xff, 0xc3, 0x01, 0xfd, 0xbd, 0x00, 0xff, 0xbf, 0x12, 0xff, 0xbe, 0x18, 0xfc, 0xbd, 0x00, 0xff, 0xc6, 0x04, 0xff, 0xc0, 0x22, 0xfe, 0xc6, 0x0f, 0xf9, 0xc1, 0x00, 0xff, 0xc7, 0x02, 0xfd, 0xc2, 0x0e, 0xff, 0xc3, 0x0b, 0xff, 0xc8, 0x00, 0xfc, 0xbc, 0x00, 0xff, 0xbc, 0x14, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfb, 0xc1, 0x05, 0xff, 0xc1, 0x08, 0xff, 0xca, 0x3c, 0xff, 0xef, 0xb4, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xdb, 0xfa, 0xe6, 0x76, 0xf7, 0xd1, 0x0c, 0xff, 0xc1, 0x00, 0xff, 0xbc, 0x12, 0xff, 0xbe, 0x29, 0xfe, 0xc4, 0x0b, 0xed, 0xc8, 0x00, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xfe, 0xc1, 0x07, 0xff, 0xc0, 0x01, 0xff, 0xc0, 0x03, 0xff, 0xc0, 0x07, 0xff, 0xc2, 0x0b, 0xff, 0xc2, 0x0c, 0xff, 0xc3, 0x07, 0xff, 0xc1, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xbf, 0x00, 0xfb, 0xc5, 0x24, 0xf8, 0xdf, 0x8f, 0xff, 0xff, 0xe8, 0xfb, 0xff, 0xfd, 0xfb, 0xfd, 0xfa, 0xfd, 0xf9, 0xf6, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xf6, 0xff, 0xfd, 0xe9, 0xc8, 0xf5, 0xd3, 0x4b, 0xf6, 0xc2, 0x00, 0xfe, 0xbc, 0x00, 0xff, 0xbb, 0x08, 0xff, 0xc1, 0x23, 0xff, 0xc3, 0x2f, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc3, 0x03, 0xff, 0xc5, 0x08, 0xff, 0xc3, 0x09, 0xff, 0xc1, 0x07, 0xff, 0xbf, 0x05, 0xfd, 0xbd, 0x04, 0xfc, 0xbc, 0x03, 0xfc, 0xbc, 0x02, 0xfc, 0xbc, 0x02, 0xfb, 0xbd, 0x10, 0xfd, 0xd1, 0x58, 0xff, 0xec, 0xb7, 0xff, 0xfd, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfe, 0xfe, 0xfb, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xec, 0xff, 0xeb, 0xb1, 0xfd, 0xd9, 0x61, 0xfa, 0xcb, 0x1d, 0xf9, 0xc1, 0x00, 0xfa, 0xbb, 0x00, 0xfa, 0xb8, 0x0c, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfc, 0xc0, 0x06, 0xfd, 0xbe, 0x0f, 0xfe, 0xbf, 0x0f, 0xfc, 0xc0, 0x0a, 0xf9, 0xbf, 0x06, 0xf8, 0xbd, 0x09, 0xf8, 0xbe, 0x12, 0xfd, 0xc4, 0x1f, 0xff, 0xc8, 0x29, 0xf9, 0xd3, 0x70, 0xff, 0xec, 0xad, 0xff, 0xfd, 0xec, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0xfd, 0xfd, 0xfe, 0xfb, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xed, 0xdf, 0xfc, 0xe2, 0x8b, 0xf5, 0xd9, 0x3a, 0xf1, 0xd1, 0x0a, 0xf2, 0xcf, 0x00, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xc1, 0x08, 0xff, 0xbb, 0x0d, 0xff, 0xbf, 0x09, 0xff, 0xc3, 0x06, 0xff, 0xc4, 0x04, 0xff, 0xc4, 0x08, 0xff, 0xc7, 0x18, 0xff, 0xcd, 0x2d, 0xff, 0xd2, 0x3c, 0xfe, 0xf0, 0xcd, 0xff, 0xfe, 0xed, 0xff, 0xfd, 0xff, 0xfe, 0xf7, 0xff, 0xfd, 0xf2, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd
+};
+const tImage lock = { image_data_lock, 60, 60,
+    8 };
+
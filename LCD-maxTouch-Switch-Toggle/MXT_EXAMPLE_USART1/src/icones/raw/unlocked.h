@@ -0,0 +1,95 @@
+
+/*******************************************************************************
+* image
+* filename: unsaved
+* name: unlocked
+*
+* preset name: Color R8G8B8
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: no
+* conversion type: Color, not_used not_used
+* bits per pixel: 24
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: no
+*******************************************************************************/
+
+/*
+ typedef struct {
+     const uint8_t *data;
+     uint16_t width;
+     uint16_t height;
+     uint8_t dataSize;
+     } tImage;
+*/
+#include <stdint.h>
+
+
+
+static const uint8_t image_data_unlocked[10800] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf8, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xfa, 0xf6, 0xf3, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xdd, 0xe7, 0x97, 0x9f, 0xac, 0x6e, 0x76, 0x83, 0x4c, 0x53, 0x63, 0x47, 0x4e, 0x5e, 0x49, 0x50, 0x62, 0x44, 0x4b, 0x5e, 0x44, 0x4a, 0x60, 0x4c, 0x52, 0x68, 0x61, 0x69, 0x7c, 0x8a, 0x91, 0xa3, 0xbf, 0xc5, 0xd3, 0xe6, 0xea, 0xf3, 0xf9, 0xfa, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xf8, 0xfb, 0xff, 0xfe, 0xff, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf3, 0xf4, 0xef, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xf2, 0xf1, 0xf7, 0xb5, 0xb7, 0xc3, 0x7e, 0x81, 0x90, 0x4e, 0x56, 0x6b, 0x41, 0x49, 0x5e, 0x3c, 0x44, 0x5b, 0x42, 0x4a, 0x61, 0x43, 0x4b, 0x62, 0x3d, 0x44, 0x5e, 0x3d, 0x44, 0x5e, 0x45, 0x4c, 0x66, 0x3a, 0x42, 0x57, 0x3e, 0x46, 0x59, 0x51, 0x58, 0x68, 0x82, 0x86, 0x92, 0xc7, 0xca, 0xd1, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf3, 0xfc, 0xfa, 0xfb, 0xfb, 0xf9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xf9, 0xff, 0xd1, 0xcf, 0xda, 0x93, 0x95, 0xa4, 0x60, 0x65, 0x79, 0x46, 0x4c, 0x62, 0x43, 0x4a, 0x67, 0x43, 0x4a, 0x67, 0x44, 0x4b, 0x68, 0x45, 0x4c, 0x68, 0x44, 0x4b, 0x67, 0x41, 0x48, 0x64, 0x41, 0x48, 0x62, 0x44, 0x4b, 0x65, 0x4a, 0x52, 0x69, 0x44, 0x4c, 0x61, 0x3f, 0x46, 0x59, 0x43, 0x4a, 0x5a, 0x5d, 0x63, 0x6f, 0x92, 0x96, 0xa1, 0xd2, 0xd5, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfd, 0xfb, 0xfb, 0xfa, 0xff, 0xc9, 0xc9, 0xd5, 0x6e, 0x6f, 0x81, 0x43, 0x48, 0x5e, 0x45, 0x4b, 0x65, 0x3e, 0x45, 0x61, 0x3f, 0x46, 0x60, 0x44, 0x4b, 0x65, 0x49, 0x51, 0x68, 0x4d, 0x55, 0x6a, 0x53, 0x5b, 0x6e, 0x58, 0x60, 0x73, 0x54, 0x5d, 0x6e, 0x4c, 0x55, 0x66, 0x41, 0x49, 0x5e, 0x43, 0x4b, 0x60, 0x49, 0x51, 0x64, 0x47, 0x4e, 0x61, 0x36, 0x3d, 0x4f, 0x3f, 0x46, 0x56, 0x7f, 0x85, 0x95, 0xc5, 0xcb, 0xdb, 0xfc, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xf4, 0xf6, 0xf3, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xf8, 0xf8, 0xfa, 0xc6, 0xc6, 0xd0, 0x73, 0x76, 0x87, 0x42, 0x46, 0x5f, 0x43, 0x49, 0x63, 0x48, 0x4f, 0x69, 0x3d, 0x44, 0x5e, 0x52, 0x58, 0x66, 0x6b, 0x71, 0x7d, 0x88, 0x8e, 0x9a, 0x9d, 0xa4, 0xae, 0xad, 0xb4, 0xbc, 0xb5, 0xbc, 0xc2, 0xad, 0xb5, 0xb8, 0x9f, 0xa7, 0xaa, 0x83, 0x89, 0x99, 0x66, 0x6c, 0x7c, 0x4b, 0x52, 0x62, 0x44, 0x4b, 0x5d, 0x44, 0x4b, 0x5e, 0x44, 0x4c, 0x5f, 0x51, 0x59, 0x6e, 0x61, 0x69, 0x7e, 0xc6, 0xcb, 0xcf, 0xfb, 0xff, 0xff, 0xf9, 0xfd, 0xfc, 0xfc, 0xfe, 0xfb, 0xfe, 0xff, 0xfd, 0xfa, 0xfa, 0xfc, 0xfc, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xd5, 0xd8, 0xdd, 0x74, 0x77, 0x86, 0x3a, 0x40, 0x56, 0x48, 0x4f, 0x69, 0x45, 0x4d, 0x64, 0x44, 0x4b, 0x5e, 0x6c, 0x73, 0x83, 0xac, 0xb0, 0xb1, 0xcb, 0xcf, 0xd0, 0xed, 0xf1, 0xf2, 0xfb, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xf9, 0xfe, 0xfa, 0xf3, 0xf6, 0xfd, 0xd6, 0xd9, 0xe2, 0xa1, 0xa5, 0xb0, 0x67, 0x6d, 0x79, 0x44, 0x4b, 0x5b, 0x3e, 0x45, 0x58, 0x41, 0x49, 0x5e, 0x44, 0x4c, 0x63, 0x74, 0x7b, 0x85, 0xd3, 0xda, 0xe0, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf1, 0xf5, 0x8f, 0x96, 0xa0, 0x40, 0x47, 0x5a, 0x39, 0x43, 0x5c, 0x49, 0x53, 0x6c, 0x4c, 0x54, 0x67, 0x78, 0x7f, 0x89, 0xc6, 0xcb, 0xcf, 0xf0, 0xf0, 0xee, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xf8, 0xf9, 0xfd, 0xc6, 0xc9, 0xd0, 0x7e, 0x82, 0x8e, 0x47, 0x4e, 0x5e, 0x3c, 0x44, 0x57, 0x48, 0x50, 0x65, 0x45, 0x4c, 0x5c, 0x91, 0x97, 0xa3, 0xe5, 0xed, 0xf0, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xf8, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xc4, 0xcc, 0x54, 0x5c, 0x69, 0x38, 0x43, 0x57, 0x4a, 0x56, 0x70, 0x41, 0x4b, 0x64, 0x7a, 0x81, 0x91, 0xdd, 0xe2, 0xe6, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xfa, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf8, 0xfa, 0xf9, 0xf4, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xd3, 0xd7, 0xe0, 0x7e, 0x84, 0x92, 0x48, 0x4f, 0x61, 0x42, 0x4a, 0x5d, 0x43, 0x4a, 0x5d, 0x58, 0x60, 0x6d, 0xc1, 0xc8, 0xce, 0xfb, 0xff, 0xfd, 0xfb, 0xfe, 0xf7, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xff, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf9, 0xfa, 0xfc, 0xfb, 0xfc, 0xff, 0x74, 0x7d, 0x8e, 0x41, 0x49, 0x60, 0x46, 0x4b, 0x69, 0x42, 0x44, 0x5d, 0x6d, 0x6f, 0x7b, 0xda, 0xdb, 0xdd, 0xf9, 0xf9, 0xf9, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xf7, 0xf5, 0xfa, 0xd2, 0xd2, 0xdc, 0x75, 0x79, 0x85, 0x3e, 0x44, 0x54, 0x41, 0x48, 0x62, 0x48, 0x50, 0x65, 0x76, 0x7d, 0x8d, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf9, 0xfa, 0xfc, 0xe4, 0xe5, 0xe9, 0x51, 0x5a, 0x6b, 0x3c, 0x44, 0x5b, 0x41, 0x46, 0x63, 0x51, 0x53, 0x6a, 0xa4, 0xa6, 0xb2, 0xf2, 0xf3, 0xf5, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xec, 0xec, 0xf4, 0xa2, 0xa6, 0xb2, 0x53, 0x59, 0x67, 0x40, 0x47, 0x61, 0x42, 0x4a, 0x5f, 0x61, 0x68, 0x78, 0xdd, 0xe1, 0xea, 0xf8, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xfa, 0xfe, 0xbf, 0xc0, 0xc5, 0x3e, 0x47, 0x58, 0x43, 0x4b, 0x62, 0x43, 0x48, 0x65, 0x67, 0x69, 0x7e, 0xdf, 0xe2, 0xeb, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xd2, 0xd6, 0xe1, 0x67, 0x6d, 0x7b, 0x41, 0x48, 0x62, 0x3e, 0x46, 0x5b, 0x48, 0x4f, 0x5f, 0xb9, 0xbd, 0xc6, 0xf6, 0xfa, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xfa, 0xfe, 0xff, 0xff, 0xf9, 0xfa, 0xfe, 0x9a, 0x9b, 0xa0, 0x41, 0x4a, 0x5b, 0x49, 0x51, 0x68, 0x48, 0x4e, 0x68, 0x7b, 0x7e, 0x91, 0xfa, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xef, 0xf3, 0xfc, 0x77, 0x7e, 0x88, 0x44, 0x4b, 0x65, 0x40, 0x48, 0x5d, 0x3d, 0x44, 0x54, 0x9f, 0xa3, 0xac, 0xf9, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xf8, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0x81, 0x81, 0x89, 0x42, 0x4a, 0x5d, 0x41, 0x49, 0x60, 0x4a, 0x50, 0x68, 0x8d, 0x90, 0xa1, 0xfc, 0xff, 0xff, 0xfa, 0xfc, 0xf7, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfa, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0x89, 0x90, 0x98, 0x44, 0x4b, 0x65, 0x44, 0x4c, 0x61, 0x3d, 0x44, 0x54, 0x91, 0x95, 0x9e, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xf9, 0xfa, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0x77, 0x77, 0x81, 0x43, 0x4b, 0x5e, 0x3c, 0x44, 0x5b, 0x4f, 0x55, 0x6b, 0x9c, 0xa0, 0xac, 0xfa, 0xfe, 0xff, 0xf9, 0xfc, 0xf5, 0xff, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xf6, 0xf7, 0xf9, 0xfb, 0xff, 0xff, 0x95, 0x9c, 0xa2, 0x44, 0x4b, 0x65, 0x45, 0x4d, 0x62, 0x42, 0x49, 0x59, 0x8a, 0x8e, 0x97, 0xfc, 0xff, 0xff, 0xfb, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x78, 0x78, 0x82, 0x44, 0x4c, 0x61, 0x41, 0x49, 0x60, 0x50, 0x56, 0x6c, 0x9e, 0xa2, 0xad, 0xfa, 0xfe, 0xfd, 0xfe, 0xff, 0xfa, 0xf6, 0xf6, 0xf4, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0xf5, 0xff, 0xff, 0xfd, 0xf9, 0xfb, 0xfa, 0xf8, 0xfd, 0xff, 0x95, 0x9d, 0xa0, 0x46, 0x4d, 0x67, 0x44, 0x4c, 0x61, 0x45, 0x4c, 0x5c, 0x86, 0x8a, 0x93, 0xfc, 0xff, 0xff, 0xf8, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfc, 0xfa, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0x7c, 0x7c, 0x88, 0x40, 0x48, 0x5d, 0x44, 0x4c, 0x63, 0x4b, 0x52, 0x65, 0x97, 0x9b, 0xa6, 0xfb, 0xff, 0xfc, 0xfe, 0xff, 0xfa, 0xf1, 0xf1, 0xef, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf3, 0xf1, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf6, 0xfb, 0xfe, 0x92, 0x9a, 0x9d, 0x49, 0x50, 0x6a, 0x43, 0x4b, 0x60, 0x47, 0x4e, 0x5e, 0x84, 0x88, 0x91, 0xfc, 0xff, 0xff, 0xf9, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0x7d, 0x7d, 0x7d, 0x47, 0x4d, 0x67, 0x45, 0x4b, 0x63, 0x4e, 0x53, 0x67, 0x9a, 0x9d, 0xac, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf5, 0xf3, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0x97, 0x97, 0x9f, 0x47, 0x4f, 0x62, 0x44, 0x4c, 0x63, 0x40, 0x46, 0x5c, 0x8b, 0x8f, 0x9b, 0xf6, 0xfa, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xb0, 0xb0, 0x48, 0x4f, 0x62, 0x3a, 0x3f, 0x52, 0x5f, 0x65, 0x73, 0xbc, 0xbe, 0xca, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xf6, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0x97, 0x97, 0x9f, 0x47, 0x4f, 0x62, 0x44, 0x4c, 0x63, 0x40, 0x46, 0x5c, 0x8b, 0x8f, 0x9b, 0xf6, 0xfa, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe9, 0x98, 0x9f, 0xa9, 0x83, 0x8a, 0x94, 0xb0, 0xb4, 0xbd, 0xf1, 0xf4, 0xf9, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfa, 0xf9, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0x97, 0x97, 0x9f, 0x47, 0x4f, 0x62, 0x44, 0x4c, 0x63, 0x40, 0x46, 0x5c, 0x8b, 0x8f, 0x9b, 0xf6, 0xfa, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xf5, 0xfa, 0xfd, 0xec, 0xf0, 0xf1, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0x97, 0x97, 0x9f, 0x47, 0x4f, 0x62, 0x44, 0x4c, 0x63, 0x40, 0x46, 0x5c, 0x8b, 0x8f, 0x9b, 0xf6, 0xfa, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xf9, 0xfb, 0xfa, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0x97, 0x97, 0x9f, 0x47, 0x4f, 0x62, 0x44, 0x4c, 0x63, 0x40, 0x46, 0x5c, 0x8b, 0x8f, 0x9b, 0xf6, 0xfa, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xfd, 0xfa, 0xfa, 0xf8, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0x97, 0x97, 0x9f, 0x47, 0x4f, 0x62, 0x44, 0x4c, 0x63, 0x40, 0x46, 0x5c, 0x8b, 0x8f, 0x9b, 0xf6, 0xfa, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0x97, 0x97, 0x9f, 0x47, 0x4f, 0x62, 0x44, 0x4c, 0x63, 0x40, 0x46, 0x5c, 0x8b, 0x8f, 0x9b, 0xf6, 0xfa, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xfa, 0xfc, 0xf7, 0xf7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0x97, 0x97, 0x9f, 0x47, 0x4f, 0x62, 0x44, 0x4c, 0x63, 0x40, 0x46, 0x5c, 0x8b, 0x8f, 0x9b, 0xf6, 0xfa, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xfd, 0xfc, 0xf8, 0xfe, 0xff, 0xfa, 0xfc, 0xff, 0xfd, 0xf9, 0xfc, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xf5, 0xff, 0xff, 0xf5, 0xff, 0xf9, 0xf6, 0xff, 0xf4, 0xfb, 0xff, 0xf6, 0xfb, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xf7, 0xff, 0xfb, 0xf8, 0xff, 0xf8, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf8, 0xff, 0xfa, 0xf9, 0xff, 0xfb, 0xf4, 0xfe, 0xf6, 0xf9, 0xff, 0xfb, 0xf9, 0xff, 0xfb, 0xf9, 0xff, 0xfb, 0xf8, 0xff, 0xfa, 0x8f, 0x99, 0x91, 0x49, 0x54, 0x68, 0x3d, 0x46, 0x57, 0x41, 0x49, 0x56, 0x80, 0x87, 0x8f, 0xf8, 0xfe, 0xfe, 0xfc, 0xff, 0xfb, 0xf6, 0xf9, 0xf0, 0xfd, 0xff, 0xf4, 0xf0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf9, 0xfe, 0xfa, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xfd, 0xfc, 0xf8, 0xfe, 0xff, 0xfa, 0xfc, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xf0, 0xff, 0xfa, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xfa, 0xfa, 0xff, 0xf8, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf6, 0xfc, 0xff, 0xf9, 0xff, 0xff, 0xf4, 0xfa, 0xff, 0xf8, 0xfe, 0xff, 0xf1, 0xf7, 0xff, 0xf5, 0xfb, 0xff, 0xee, 0xf4, 0xaf, 0x9e, 0xa4, 0x4d, 0x52, 0x66, 0x47, 0x4c, 0x5f, 0x55, 0x58, 0x67, 0x8c, 0x8f, 0x98, 0xee, 0xef, 0xf4, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xf8, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xfb, 0xf1, 0xff, 0xf8, 0xf0, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xf9, 0xf6, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xfc, 0xfb, 0xf9, 0xfd, 0xff, 0xf9, 0xfe, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf3, 0xf7, 0xf6, 0xe1, 0xec, 0xd4, 0x74, 0xeb, 0xd0, 0x67, 0xe9, 0xce, 0x5b, 0xed, 0xcd, 0x5c, 0xed, 0xcc, 0x61, 0xec, 0xcb, 0x64, 0xeb, 0xcc, 0x62, 0xeb, 0xd0, 0x5f, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xe9, 0xca, 0x5e, 0xeb, 0xcc, 0x60, 0xf9, 0xda, 0x6e, 0xef, 0xd0, 0x64, 0xf1, 0xd2, 0x66, 0xed, 0xce, 0x62, 0xee, 0xcf, 0x63, 0xf1, 0xd2, 0x66, 0xc9, 0xaa, 0x3e, 0xb4, 0x98, 0x35, 0xaf, 0x91, 0x2f, 0xb3, 0x96, 0x32, 0xc9, 0xa9, 0x44, 0xf1, 0xd0, 0x67, 0xf3, 0xd1, 0x66, 0xf2, 0xcd, 0x62, 0xf3, 0xcf, 0x61, 0xe6, 0xcb, 0x58, 0xef, 0xd0, 0x5c, 0xee, 0xcf, 0x63, 0xef, 0xd8, 0x8a, 0xfd, 0xef, 0xca, 0xff, 0xfc, 0xf9, 0xff, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfe, 0xff, 0xfc, 0xfa, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xea, 0xf2, 0xf1, 0xd2, 0xed, 0xc8, 0x2f, 0xea, 0xc3, 0x1e, 0xe7, 0xbf, 0x10, 0xe9, 0xbe, 0x0f, 0xea, 0xbe, 0x15, 0xe9, 0xbc, 0x18, 0xe8, 0xbd, 0x16, 0xe9, 0xc1, 0x14, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xeb, 0xc1, 0x17, 0xdc, 0xb2, 0x08, 0xeb, 0xc1, 0x17, 0xe3, 0xb9, 0x0f, 0xe5, 0xbb, 0x11, 0xe8, 0xbe, 0x14, 0xe6, 0xbc, 0x12, 0xed, 0xc3, 0x19, 0xe4, 0xba, 0x10, 0xf1, 0xbc, 0x18, 0xeb, 0xb6, 0x12, 0xee, 0xb7, 0x14, 0xee, 0xb7, 0x12, 0xf1, 0xb8, 0x13, 0xef, 0xb6, 0x11, 0xf1, 0xb6, 0x10, 0xed, 0xb2, 0x0c, 0xe6, 0xbd, 0x00, 0xeb, 0xc0, 0x02, 0xe7, 0xbf, 0x12, 0xea, 0xcd, 0x4f, 0xf9, 0xe9, 0xab, 0xff, 0xfc, 0xf0, 0xff, 0xfd, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfe, 0xf9, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfd, 0xe6, 0xf0, 0xee, 0xc8, 0xf0, 0xc1, 0x33, 0xe9, 0xbb, 0x20, 0xe6, 0xb6, 0x0e, 0xe8, 0xb5, 0x0a, 0xeb, 0xb6, 0x12, 0xe9, 0xb4, 0x16, 0xe7, 0xb5, 0x14, 0xe8, 0xb9, 0x13, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xf5, 0xc1, 0x1f, 0xec, 0xb8, 0x16, 0xec, 0xb8, 0x16, 0xf2, 0xbe, 0x1c, 0xec, 0xb8, 0x16, 0xed, 0xb9, 0x17, 0xf2, 0xbe, 0x1c, 0xe1, 0xbb, 0x10, 0xdf, 0xb9, 0x0e, 0xe2, 0xbc, 0x13, 0xe7, 0xbe, 0x16, 0xdf, 0xb6, 0x0e, 0xe7, 0xbe, 0x16, 0xee, 0xc3, 0x1e, 0xea, 0xbf, 0x1a, 0xf3, 0xb8, 0x2c, 0xf3, 0xba, 0x22, 0xea, 0xbb, 0x27, 0xeb, 0xc9, 0x5b, 0xfb, 0xeb, 0xb7, 0xff, 0xff, 0xf6, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfd, 0xe7, 0xf1, 0xed, 0xc8, 0xf6, 0xc9, 0x38, 0xef, 0xc1, 0x23, 0xeb, 0xbd, 0x10, 0xef, 0xbd, 0x0e, 0xf1, 0xbe, 0x13, 0xf1, 0xbd, 0x19, 0xee, 0xbd, 0x18, 0xee, 0xc0, 0x15, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xeb, 0xbb, 0x13, 0xec, 0xbc, 0x14, 0xe7, 0xb7, 0x0f, 0xe8, 0xb8, 0x10, 0xed, 0xbd, 0x15, 0xe8, 0xb8, 0x10, 0xe5, 0xb5, 0x0d, 0xea, 0xba, 0x12, 0xee, 0xc0, 0x13, 0xec, 0xbe, 0x11, 0xe9, 0xbb, 0x0e, 0xed, 0xbf, 0x12, 0xe1, 0xb3, 0x08, 0xe9, 0xbb, 0x10, 0xe8, 0xba, 0x0f, 0xe6, 0xb8, 0x0d, 0xe9, 0xb1, 0x16, 0xe8, 0xb4, 0x09, 0xe1, 0xb5, 0x0e, 0xe4, 0xc6, 0x4a, 0xf6, 0xea, 0xb0, 0xff, 0xff, 0xf6, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfd, 0xea, 0xf3, 0xed, 0xcb, 0xed, 0xbd, 0x3f, 0xe6, 0xb7, 0x2b, 0xe3, 0xb2, 0x17, 0xe6, 0xb4, 0x13, 0xeb, 0xb6, 0x1a, 0xe9, 0xb6, 0x1f, 0xe6, 0xb4, 0x1d, 0xe6, 0xb5, 0x1b, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xeb, 0xb8, 0x1f, 0xec, 0xb9, 0x20, 0xe6, 0xb3, 0x1a, 0xe9, 0xb6, 0x1d, 0xeb, 0xb8, 0x1f, 0xed, 0xba, 0x21, 0xee, 0xbb, 0x22, 0xeb, 0xb8, 0x1f, 0xed, 0xba, 0x21, 0xf5, 0xb3, 0x1f, 0xf7, 0xb5, 0x21, 0xef, 0xaf, 0x1a, 0xf9, 0xb9, 0x24, 0xf1, 0xb1, 0x1c, 0xf7, 0xb7, 0x22, 0xf0, 0xb0, 0x1b, 0xf4, 0xb4, 0x1f, 0xf5, 0xc4, 0x06, 0xf4, 0xc5, 0x00, 0xea, 0xc2, 0x00, 0xea, 0xce, 0x3e, 0xfa, 0xea, 0xac, 0xff, 0xfd, 0xf9, 0xfe, 0xfd, 0xff, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xee, 0xf7, 0xee, 0xcf, 0xf2, 0xc3, 0x37, 0xeb, 0xbd, 0x22, 0xe7, 0xb9, 0x0e, 0xed, 0xbc, 0x0a, 0xf0, 0xbe, 0x11, 0xf0, 0xbd, 0x16, 0xec, 0xbb, 0x16, 0xea, 0xbb, 0x13, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xea, 0xba, 0x12, 0xef, 0xbf, 0x17, 0xe6, 0xb6, 0x0e, 0xec, 0xbc, 0x14, 0xed, 0xbd, 0x15, 0xe9, 0xb9, 0x11, 0xed, 0xbd, 0x15, 0xea, 0xba, 0x12, 0xe9, 0xb9, 0x11, 0xe4, 0xbb, 0x11, 0xe9, 0xc0, 0x16, 0xdd, 0xb7, 0x0c, 0xea, 0xc4, 0x19, 0xe5, 0xbf, 0x12, 0xe9, 0xc3, 0x16, 0xdd, 0xb7, 0x0a, 0xe6, 0xc2, 0x14, 0xee, 0xb6, 0x2f, 0xee, 0xb7, 0x1c, 0xe8, 0xb8, 0x1a, 0xeb, 0xc6, 0x54, 0xfe, 0xe5, 0xbc, 0xff, 0xf9, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xc0, 0x1d, 0xe5, 0xb6, 0x20, 0xf2, 0xbc, 0x28, 0xe9, 0xb8, 0x15, 0xde, 0xb4, 0x08, 0xe7, 0xbc, 0x17, 0xeb, 0xb6, 0x1c, 0xef, 0xb2, 0x1b, 0xf0, 0xb6, 0x16, 0xed, 0xba, 0x11, 0xe9, 0xb6, 0x25, 0xf1, 0xbd, 0x2c, 0xef, 0xbb, 0x0d, 0xeb, 0xb4, 0x11, 0xf0, 0xbc, 0x28, 0xe2, 0xbb, 0x08, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xec, 0xbc, 0x1a, 0xe7, 0xb2, 0x0e, 0xf2, 0xbc, 0x12, 0xef, 0xc0, 0x12, 0xe6, 0xc0, 0x13, 0xe6, 0xc4, 0x1a, 0xe8, 0xc0, 0x13, 0xf1, 0xc3, 0x0e, 0xf0, 0xbc, 0x18, 0xef, 0xc1, 0x0b, 0xe8, 0xb8, 0x16, 0xee, 0xbb, 0x21, 0xee, 0xbb, 0x08, 0xec, 0xb7, 0x13, 0xf1, 0xbd, 0x2c, 0xe3, 0xb9, 0x0d, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xf0, 0xb9, 0x16, 0xed, 0xb6, 0x03, 0xf2, 0xc0, 0x0b, 0xdf, 0xb6, 0x1c, 0xc4, 0xa4, 0x2d, 0xb4, 0x9a, 0x2c, 0xb2, 0x95, 0x1d, 0xc5, 0xa5, 0x1e, 0xe0, 0xb7, 0x1f, 0xeb, 0xc4, 0x07, 0xe8, 0xbb, 0x08, 0xec, 0xb8, 0x16, 0xed, 0xba, 0x07, 0xec, 0xb8, 0x14, 0xf1, 0xbd, 0x2c, 0xe5, 0xb8, 0x14, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xed, 0xb3, 0x13, 0xf1, 0xbf, 0x06, 0xe9, 0xc0, 0x16, 0xb5, 0x94, 0x33, 0x7e, 0x68, 0x50, 0x65, 0x55, 0x55, 0x64, 0x53, 0x49, 0x7d, 0x69, 0x51, 0xba, 0x99, 0x30, 0xdc, 0xba, 0x12, 0xe9, 0xbc, 0x0b, 0xee, 0xb8, 0x18, 0xed, 0xbb, 0x0e, 0xea, 0xba, 0x12, 0xf0, 0xbd, 0x26, 0xe9, 0xb8, 0x13, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xb0, 0x1f, 0xed, 0xc3, 0x15, 0xd0, 0xb1, 0x22, 0x80, 0x6e, 0x40, 0x4b, 0x45, 0x69, 0x3e, 0x41, 0x74, 0x3d, 0x41, 0x67, 0x4e, 0x4d, 0x6f, 0x8a, 0x6e, 0x47, 0xc7, 0xa9, 0x23, 0xea, 0xbb, 0x15, 0xf1, 0xb8, 0x23, 0xee, 0xba, 0x18, 0xe6, 0xba, 0x11, 0xec, 0xbc, 0x1c, 0xed, 0xb9, 0x0e, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xea, 0xb6, 0x2c, 0xe9, 0xc1, 0x21, 0xb6, 0x9e, 0x24, 0x5f, 0x54, 0x40, 0x3b, 0x43, 0x6a, 0x3e, 0x54, 0x6b, 0x36, 0x4e, 0x52, 0x3c, 0x49, 0x59, 0x64, 0x50, 0x59, 0xb9, 0x9f, 0x2e, 0xeb, 0xbc, 0x16, 0xf3, 0xb7, 0x25, 0xef, 0xba, 0x1e, 0xe5, 0xbb, 0x0f, 0xeb, 0xbc, 0x16, 0xf1, 0xb9, 0x0e, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xf0, 0xb9, 0x20, 0xe9, 0xc0, 0x1a, 0xb0, 0x96, 0x28, 0x5a, 0x4f, 0x4b, 0x3e, 0x46, 0x6a, 0x40, 0x5a, 0x57, 0x36, 0x4d, 0x3d, 0x40, 0x47, 0x57, 0x54, 0x4b, 0x60, 0xb5, 0xa2, 0x2a, 0xeb, 0xbe, 0x09, 0xf1, 0xb4, 0x1b, 0xec, 0xba, 0x1d, 0xe5, 0xbd, 0x10, 0xeb, 0xbc, 0x18, 0xf3, 0xb8, 0x14, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xed, 0xb4, 0x02, 0xea, 0xbd, 0x0a, 0xb8, 0x97, 0x30, 0x67, 0x53, 0x5f, 0x44, 0x46, 0x76, 0x3d, 0x50, 0x57, 0x39, 0x44, 0x4a, 0x50, 0x49, 0x7f, 0x53, 0x50, 0x61, 0xb7, 0xa9, 0x24, 0xeb, 0xc1, 0x00, 0xed, 0xb2, 0x0e, 0xeb, 0xb9, 0x18, 0xe7, 0xbf, 0x12, 0xec, 0xbc, 0x1a, 0xf5, 0xb6, 0x19, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe8, 0xb5, 0x0a, 0xe8, 0xbb, 0x22, 0xbb, 0x99, 0x3f, 0x5f, 0x4c, 0x45, 0x46, 0x4b, 0x69, 0x3d, 0x52, 0x67, 0x38, 0x4d, 0x5e, 0x41, 0x4e, 0x70, 0x58, 0x53, 0x3d, 0xbd, 0x9b, 0x2f, 0xf0, 0xb8, 0x23, 0xe6, 0xba, 0x1b, 0xe0, 0xbe, 0x07, 0xeb, 0xb7, 0x0b, 0xf6, 0xb6, 0x21, 0xec, 0xb7, 0x19, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xbb, 0x0f, 0xe4, 0xbd, 0x17, 0xb7, 0x9b, 0x30, 0x5c, 0x4e, 0x41, 0x43, 0x47, 0x60, 0x39, 0x4b, 0x4d, 0x3a, 0x45, 0x3f, 0x47, 0x44, 0x59, 0x57, 0x58, 0x50, 0xba, 0x9a, 0x33, 0xed, 0xb6, 0x1b, 0xec, 0xbc, 0x1a, 0xe7, 0xbf, 0x0f, 0xeb, 0xb4, 0x11, 0xf2, 0xb4, 0x21, 0xe8, 0xbc, 0x13, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xee, 0xbc, 0x0f, 0xe3, 0xbf, 0x07, 0xb5, 0x9f, 0x28, 0x5c, 0x50, 0x52, 0x44, 0x47, 0x7e, 0x42, 0x4d, 0x69, 0x49, 0x49, 0x61, 0x57, 0x43, 0x82, 0x54, 0x58, 0x63, 0xb5, 0x99, 0x35, 0xec, 0xb7, 0x13, 0xef, 0xbf, 0x17, 0xec, 0xc0, 0x15, 0xec, 0xb4, 0x19, 0xee, 0xb5, 0x20, 0xe4, 0xc0, 0x0a, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xf4, 0xb9, 0x1d, 0xe9, 0xc0, 0x0c, 0xb9, 0xa3, 0x29, 0x56, 0x4d, 0x4e, 0x35, 0x3e, 0x75, 0x37, 0x4b, 0x63, 0x41, 0x4a, 0x59, 0x46, 0x3c, 0x71, 0x4b, 0x51, 0x5d, 0xb5, 0x9a, 0x33, 0xef, 0xb9, 0x0f, 0xf0, 0xbc, 0x11, 0xec, 0xbd, 0x17, 0xee, 0xb4, 0x22, 0xf0, 0xb8, 0x25, 0xe1, 0xc0, 0x03, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xf1, 0xad, 0x26, 0xea, 0xb8, 0x17, 0xc2, 0xa6, 0x2b, 0x5c, 0x54, 0x3d, 0x35, 0x44, 0x5b, 0x37, 0x55, 0x53, 0x41, 0x5c, 0x49, 0x3f, 0x4d, 0x4e, 0x53, 0x51, 0x45, 0xc0, 0x9f, 0x2b, 0xf6, 0xbc, 0x12, 0xeb, 0xb8, 0x11, 0xe6, 0xb9, 0x15, 0xef, 0xb7, 0x22, 0xf3, 0xbb, 0x26, 0xdf, 0xbd, 0x03, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xf2, 0xb3, 0x1a, 0xeb, 0xb6, 0x18, 0xd2, 0xab, 0x32, 0x7a, 0x65, 0x3a, 0x4a, 0x46, 0x5d, 0x3c, 0x48, 0x72, 0x41, 0x4d, 0x73, 0x40, 0x45, 0x6b, 0x75, 0x69, 0x2f, 0xd5, 0xaa, 0x20, 0xf9, 0xbc, 0x14, 0xe5, 0xb5, 0x17, 0xe0, 0xbb, 0x12, 0xed, 0xbb, 0x1a, 0xf3, 0xbc, 0x24, 0xe3, 0xba, 0x0a, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xf4, 0xc7, 0x14, 0xeb, 0xba, 0x17, 0xe7, 0xb8, 0x2c, 0xac, 0x88, 0x28, 0x7a, 0x60, 0x45, 0x56, 0x41, 0x60, 0x54, 0x43, 0x63, 0x5c, 0x4d, 0x50, 0xaf, 0x94, 0x29, 0xee, 0xb8, 0x1a, 0xf7, 0xb5, 0x16, 0xe3, 0xb5, 0x21, 0xdf, 0xc4, 0x15, 0xe8, 0xbd, 0x0e, 0xf3, 0xb8, 0x1e, 0xe9, 0xb7, 0x16, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf3, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xf5, 0xee, 0xb7, 0xf1, 0xc4, 0x35, 0xe7, 0xba, 0x1f, 0xe9, 0xba, 0x14, 0xed, 0xbd, 0x13, 0xeb, 0xb7, 0x15, 0xea, 0xb8, 0x19, 0xec, 0xbc, 0x1a, 0xe7, 0xbb, 0x12, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe4, 0xc2, 0x0b, 0xdb, 0xb0, 0x0c, 0xf5, 0xc5, 0x1b, 0xe7, 0xbe, 0x0a, 0xc9, 0xa8, 0x1b, 0xa4, 0x86, 0x2e, 0xac, 0x95, 0x2b, 0xc6, 0xb8, 0x0f, 0xdb, 0xb7, 0x2b, 0xfe, 0xc2, 0x14, 0xf6, 0xaf, 0x15, 0xe2, 0xb7, 0x2a, 0xe1, 0xca, 0x18, 0xe6, 0xbe, 0x06, 0xf0, 0xb3, 0x1a, 0xf0, 0xb7, 0x20, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xeb, 0xba, 0x17, 0xe7, 0xbd, 0x13, 0xed, 0xb8, 0x1a, 0xed, 0xb8, 0x10, 0xed, 0xc8, 0x44, 0xfa, 0xe7, 0xbd, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xfb, 0xfd, 0xfc, 0xfc, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xfe, 0xef, 0xf4, 0xe6, 0xc9, 0xf0, 0xc6, 0x34, 0xe3, 0xb8, 0x1b, 0xec, 0xbd, 0x15, 0xec, 0xb9, 0x0e, 0xea, 0xb5, 0x11, 0xf0, 0xba, 0x1c, 0xed, 0xb7, 0x19, 0xec, 0xb8, 0x16, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xec, 0xbc, 0x14, 0xe3, 0xbf, 0x20, 0xe4, 0xb6, 0x08, 0xe9, 0xb6, 0x0b, 0xed, 0xcb, 0x50, 0xf1, 0xea, 0xb6, 0xf6, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xfc, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xec, 0xf4, 0xe9, 0xc9, 0xf0, 0xc6, 0x34, 0xe3, 0xb7, 0x1a, 0xec, 0xbe, 0x13, 0xed, 0xbb, 0x0e, 0xeb, 0xb6, 0x10, 0xf1, 0xbb, 0x1a, 0xeb, 0xb7, 0x15, 0xec, 0xb9, 0x12, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xea, 0xba, 0x10, 0xeb, 0xbd, 0x21, 0xed, 0xb7, 0x0d, 0xef, 0xb9, 0x11, 0xf2, 0xcb, 0x52, 0xf6, 0xea, 0xb6, 0xf9, 0xfe, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfa, 0xfb, 0xfd, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0xea, 0xf4, 0xec, 0xc8, 0xf4, 0xc5, 0x41, 0xe5, 0xb4, 0x27, 0xee, 0xbb, 0x21, 0xef, 0xba, 0x1c, 0xee, 0xb7, 0x1e, 0xf3, 0xbb, 0x26, 0xee, 0xb7, 0x1e, 0xee, 0xb9, 0x1b, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb9, 0x1f, 0xec, 0xb4, 0x15, 0xf2, 0xb4, 0x0b, 0xf1, 0xb6, 0x12, 0xf1, 0xc7, 0x4f, 0xf9, 0xe8, 0xb0, 0xfc, 0xfc, 0xf4, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xfd, 0xfa, 0xfc, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xea, 0xf0, 0xec, 0xc7, 0xf6, 0xc7, 0x39, 0xe4, 0xb6, 0x1b, 0xec, 0xbb, 0x16, 0xf0, 0xbb, 0x15, 0xee, 0xb9, 0x15, 0xf2, 0xbc, 0x1b, 0xec, 0xb9, 0x12, 0xec, 0xbd, 0x0f, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xec, 0xbb, 0x16, 0xf3, 0xba, 0x15, 0xf8, 0xbe, 0x12, 0xf1, 0xbc, 0x18, 0xf1, 0xca, 0x51, 0xff, 0xec, 0xb2, 0xff, 0xfd, 0xf3, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xfb, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xed, 0xe7, 0xe6, 0xc7, 0xf1, 0xcc, 0x35, 0xdd, 0xb7, 0x16, 0xe3, 0xba, 0x10, 0xe5, 0xbb, 0x0f, 0xe4, 0xb9, 0x14, 0xe8, 0xbd, 0x18, 0xdf, 0xb9, 0x0c, 0xe2, 0xbd, 0x0a, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe2, 0xbc, 0x11, 0xe4, 0xb9, 0x1f, 0xe9, 0xbe, 0x21, 0xdb, 0xb7, 0x23, 0xdf, 0xc4, 0x59, 0xff, 0xed, 0xbb, 0xff, 0xfd, 0xf6, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xfb, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf4, 0xdb, 0xdd, 0xc7, 0xb8, 0xa1, 0x55, 0xa1, 0x88, 0x34, 0xa3, 0x88, 0x2d, 0xa7, 0x89, 0x31, 0xa6, 0x87, 0x35, 0xa7, 0x8b, 0x38, 0xa1, 0x88, 0x2e, 0xa4, 0x8d, 0x2d, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0xa2, 0x88, 0x31, 0x9d, 0x85, 0x21, 0xa1, 0x8e, 0x25, 0x95, 0x88, 0x22, 0xa8, 0x9e, 0x56, 0xe7, 0xdc, 0xbc, 0xff, 0xfc, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfe, 0xf8, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xfc, 0xf9, 0xcf, 0xd3, 0xc5, 0x69, 0x67, 0x6c, 0x4f, 0x4b, 0x4a, 0x4e, 0x49, 0x43, 0x51, 0x49, 0x47, 0x4e, 0x47, 0x4e, 0x50, 0x4b, 0x52, 0x4a, 0x48, 0x49, 0x4e, 0x4f, 0x49, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x4d, 0x49, 0x48, 0x50, 0x4d, 0x3e, 0x54, 0x57, 0x3c, 0x4b, 0x52, 0x30, 0x70, 0x74, 0x5b, 0xcd, 0xca, 0xc3, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xfd, 0xf7, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xf8, 0xf9, 0xfd, 0xc7, 0xcc, 0xc6, 0x51, 0x6a, 0x6f, 0x34, 0x4c, 0x4c, 0x33, 0x47, 0x46, 0x34, 0x47, 0x4b, 0x33, 0x45, 0x53, 0x35, 0x48, 0x57, 0x2e, 0x46, 0x50, 0x32, 0x4e, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x33, 0x4b, 0x4f, 0x37, 0x3f, 0x70, 0x39, 0x48, 0x69, 0x2e, 0x41, 0x50, 0x5a, 0x67, 0x70, 0xc4, 0xc6, 0xd3, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xc6, 0xc6, 0xc6, 0x57, 0x65, 0x70, 0x34, 0x42, 0x4d, 0x34, 0x42, 0x4d, 0x41, 0x4f, 0x5a, 0x35, 0x43, 0x4e, 0x31, 0x3f, 0x4a, 0x3a, 0x48, 0x53, 0x36, 0x44, 0x4f, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x34, 0x44, 0x51, 0x3b, 0x49, 0x54, 0x31, 0x3e, 0x47, 0x5d, 0x66, 0x6d, 0xc5, 0xca, 0xce, 0xfc, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 
+    0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xc8, 0xc8, 0x5b, 0x69, 0x74, 0x38, 0x46, 0x51, 0x33, 0x41, 0x4c, 0x3e, 0x4c, 0x57, 0x36, 0x44, 0x4f, 0x34, 0x42, 0x4d, 0x3b, 0x49, 0x54, 0x36, 0x44, 0x4f, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x38, 0x46, 0x51, 0x31, 0x3f, 0x4a, 0x3b, 0x48, 0x51, 0x39, 0x43, 0x4c, 0x61, 0x6a, 0x71, 0xc0, 0xc5, 0xc9, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xc8, 0xc8, 0xc8, 0x5c, 0x66, 0x6f, 0x3c, 0x46, 0x4f, 0x33, 0x3d, 0x46, 0x3c, 0x46, 0x4f, 0x38, 0x42, 0x4b, 0x38, 0x42, 0x4b, 0x3c, 0x46, 0x4f, 0x36, 0x40, 0x49, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x39, 0x43, 0x4c, 0x3e, 0x4b, 0x54, 0x3d, 0x47, 0x50, 0x34, 0x3d, 0x44, 0x5e, 0x65, 0x6b, 0xc1, 0xc5, 0xc8, 0xfc, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xf7, 0xf7, 0xf7, 0xd2, 0xd2, 0xd2, 0x57, 0x5e, 0x64, 0x41, 0x48, 0x4e, 0x3b, 0x42, 0x48, 0x41, 0x48, 0x4e, 0x3e, 0x45, 0x4b, 0x3d, 0x44, 0x4a, 0x40, 0x47, 0x4d, 0x3d, 0x44, 0x4a, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x3f, 0x46, 0x4c, 0x36, 0x3f, 0x46, 0x37, 0x40, 0x47, 0x38, 0x3f, 0x45, 0x67, 0x6c, 0x70, 0xc0, 0xc4, 0xc7, 0xfb, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd
+};
+const tImage unlocked = { image_data_unlocked, 60, 60,
+    8 };
+
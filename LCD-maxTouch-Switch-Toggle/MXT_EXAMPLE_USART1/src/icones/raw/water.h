@@ -0,0 +1,95 @@
+
+/*******************************************************************************
+* image
+* filename: unsaved
+* name: water
+*
+* preset name: Color R8G8B8
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: no
+* conversion type: Color, not_used not_used
+* bits per pixel: 24
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: no
+*******************************************************************************/
+
+/*
+ typedef struct {
+     const uint8_t *data;
+     uint16_t width;
+     uint16_t height;
+     uint8_t dataSize;
+     } tImage;
+*/
+#include <stdint.h>
+
+
+
+static const uint8_t image_data_water[10800] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xf3, 0xf1, 0xf6, 0xf2, 0xf0, 0xf5, 0xf0, 0xf0, 0xf2, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfe, 0xf7, 0xf8, 0xfe, 0xf4, 0xf7, 0xfd, 0xf3, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0xf4, 0xff, 0xfd, 0xf2, 0xfb, 0xfd, 0xfa, 0xfb, 0xfd, 0xfa, 0xfc, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf8, 0xff, 0xfc, 0xfb, 0xff, 0xfd, 0xfb, 0xff, 0xfb, 0xf9, 0xff, 0xf9, 0xf7, 0xff, 0xf9, 0xf9, 0xff, 0xfd, 0xf7, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xe9, 0xf2, 0xf1, 0xe6, 0xf5, 0xf2, 0xf8, 0xff, 0xff, 
+    0xa3, 0xb2, 0xb7, 0xa6, 0xb4, 0xb7, 0xaf, 0xba, 0xbc, 0xd2, 0xdc, 0xde, 0xfa, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfd, 0xfe, 0xf9, 0xfd, 0xfe, 0xf9, 0xfd, 0xf9, 0xf8, 0xff, 0xfc, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfd, 0xfe, 0xf6, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xfa, 0xfc, 0xfb, 0xfb, 0xfd, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xfd, 0xf9, 0xfe, 0xfd, 0xf9, 0xff, 0xfd, 0xf8, 0xff, 0xfc, 0xf7, 0xff, 0xfc, 0xf7, 0xff, 0xfa, 0xff, 0xff, 0xf5, 0xfa, 0xff, 0xf9, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xd1, 0xd8, 0xde, 0xae, 0xbc, 0xbf, 0xa7, 0xb9, 0xb9, 0xc4, 0xd0, 0xd0, 
+    0x73, 0x92, 0x97, 0x73, 0x90, 0x96, 0x7b, 0x94, 0x99, 0xa6, 0xb9, 0xc0, 0xe4, 0xf1, 0xfa, 0xf8, 0xff, 0xff, 0xf6, 0xfa, 0xff, 0xf6, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0xfd, 0xff, 0xfb, 0xfc, 0xff, 0xfb, 0xfb, 0xfd, 0xfe, 0xf9, 0xfb, 0xff, 0xfa, 0xf9, 0xff, 0xfb, 0xf7, 0xff, 0xfb, 0xf5, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xf8, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xfb, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xf6, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xfa, 0xf8, 0xff, 0xfa, 0xf9, 0xff, 0xfc, 0xfb, 0xff, 0xf5, 0xf4, 0xff, 0xa0, 0xb1, 0xbb, 0x7e, 0x92, 0x9b, 0x77, 0x8f, 0x93, 0x93, 0xa2, 0xa5, 
+    0x7e, 0x9a, 0xa5, 0x74, 0x90, 0x9b, 0x70, 0x8c, 0x98, 0x8a, 0xa4, 0xb1, 0xc1, 0xdb, 0xea, 0xdc, 0xf3, 0xff, 0xcf, 0xe6, 0xf8, 0xd4, 0xe9, 0xfc, 0xdd, 0xf3, 0xfe, 0xde, 0xf5, 0xfd, 0xe2, 0xf6, 0xfd, 0xe5, 0xf8, 0xfe, 0xeb, 0xfa, 0xff, 0xef, 0xfd, 0xfe, 0xf2, 0xfe, 0xfe, 0xf4, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 0xfd, 0xfe, 0xf9, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfa, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xff, 0xfa, 0xfd, 0xff, 0xfa, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xee, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xe0, 0xf9, 0xfe, 0xcb, 0xf6, 0xfd, 0xc3, 0xef, 0xfa, 0xbf, 0xed, 0xfa, 0xba, 0xeb, 0xfa, 0xb3, 0xe4, 0xf5, 0xb3, 0xe4, 0xf5, 0xb0, 0xe1, 0xf2, 0xa6, 0xd5, 0xe7, 0x86, 0x9d, 0xad, 0x71, 0x8d, 0x99, 0x72, 0x8d, 0x96, 0x8a, 0x9b, 0xa2, 
+    0x8b, 0x9b, 0xab, 0x7b, 0x8c, 0x9c, 0x76, 0x8b, 0x9c, 0x7e, 0x99, 0xac, 0xa3, 0xc6, 0xd9, 0xbc, 0xe5, 0xf7, 0xb0, 0xdf, 0xf1, 0xb8, 0xe8, 0xfc, 0xb8, 0xe1, 0xf5, 0xb9, 0xe2, 0xf6, 0xbd, 0xe3, 0xf6, 0xc1, 0xe6, 0xf8, 0xc7, 0xe8, 0xf7, 0xca, 0xea, 0xf7, 0xce, 0xec, 0xf7, 0xcf, 0xed, 0xf7, 0xe6, 0xf8, 0xfc, 0xed, 0xfc, 0xff, 0xf6, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf8, 0xfa, 0xff, 0xf3, 0xf6, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xf8, 0xff, 0xff, 0xf9, 0xff, 0xfd, 0xf7, 0xf8, 0xf3, 0xfa, 0xf7, 0xf0, 0xff, 0xfb, 0xf1, 0xff, 0xfe, 0xf6, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xf8, 0xfb, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xe7, 0xfa, 0xff, 0xd6, 0xf3, 0xff, 0xc3, 0xec, 0xfe, 0xb2, 0xe6, 0xfe, 0xa3, 0xdf, 0xfb, 0x9a, 0xd9, 0xf8, 0x8e, 0xdb, 0xed, 0x88, 0xd6, 0xec, 0x85, 0xd7, 0xef, 0x82, 0xd6, 0xf2, 0x80, 0xd3, 0xf1, 0x85, 0xd6, 0xf3, 0x82, 0xd2, 0xed, 0x76, 0xc3, 0xdd, 0x7c, 0x97, 0xa8, 0x75, 0x92, 0xa0, 0x78, 0x93, 0x9e, 0x97, 0xa8, 0xb0, 
+    0x98, 0x9e, 0xae, 0x7d, 0x86, 0x97, 0x7d, 0x8e, 0xa0, 0x7d, 0x9a, 0xac, 0x95, 0xbb, 0xce, 0xb3, 0xe3, 0xf7, 0xab, 0xe4, 0xf8, 0xac, 0xea, 0xff, 0xaf, 0xe2, 0xfd, 0xaf, 0xe2, 0xfd, 0xb0, 0xe2, 0xfb, 0xb1, 0xe3, 0xfa, 0xb4, 0xe4, 0xfa, 0xb6, 0xe4, 0xfb, 0xb7, 0xe4, 0xf9, 0xb7, 0xe4, 0xf9, 0xbe, 0xe6, 0xf2, 0xc5, 0xe9, 0xf5, 0xd2, 0xee, 0xfa, 0xe1, 0xf3, 0xff, 0xf0, 0xf8, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf7, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfb, 0xfb, 0xff, 0xfd, 0xf2, 0xfc, 0xfd, 0xe7, 0xf5, 0xf8, 0xcb, 0xec, 0xfb, 0xc0, 0xe7, 0xf6, 0xaf, 0xde, 0xf2, 0x9e, 0xd6, 0xf1, 0x90, 0xd2, 0xf4, 0x84, 0xd2, 0xf9, 0x7d, 0xd1, 0xfd, 0x7a, 0xd2, 0xff, 0x89, 0xd5, 0xf7, 0x83, 0xd3, 0xf6, 0x82, 0xd4, 0xfc, 0x82, 0xd5, 0xff, 0x82, 0xd3, 0xfe, 0x8b, 0xd6, 0xff, 0x8a, 0xcf, 0xf6, 0x7b, 0xbd, 0xe0, 0x79, 0x95, 0xa3, 0x77, 0x93, 0x9f, 0x75, 0x8d, 0x97, 0xb0, 0xbd, 0xc5, 
+    0xad, 0xba, 0xc3, 0x7e, 0x8c, 0x97, 0x7d, 0x93, 0xa0, 0x7b, 0x98, 0xa8, 0x8c, 0xb1, 0xc4, 0xb5, 0xe3, 0xfa, 0xb4, 0xe8, 0xff, 0xaf, 0xe5, 0xff, 0xb5, 0xe9, 0xff, 0xb5, 0xe9, 0xff, 0xb4, 0xe8, 0xff, 0xb4, 0xe8, 0xff, 0xb4, 0xe8, 0xff, 0xb3, 0xe7, 0xfd, 0xb3, 0xe7, 0xfd, 0xb3, 0xe7, 0xfd, 0xad, 0xe4, 0xf9, 0xad, 0xe1, 0xf6, 0xb1, 0xe0, 0xf4, 0xba, 0xe0, 0xf3, 0xc8, 0xe8, 0xf7, 0xd8, 0xf2, 0xff, 0xe9, 0xfc, 0xff, 0xf1, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf9, 0xfa, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xb6, 0xe6, 0xfd, 0xa6, 0xdd, 0xfb, 0x8d, 0xd4, 0xf4, 0x88, 0xd1, 0xf1, 0x81, 0xcd, 0xef, 0x7d, 0xcb, 0xef, 0x7c, 0xce, 0xf4, 0x7e, 0xd3, 0xfc, 0x7f, 0xd6, 0xff, 0x80, 0xd9, 0xff, 0x89, 0xd5, 0xf9, 0x82, 0xd1, 0xf8, 0x82, 0xd3, 0xfe, 0x81, 0xd2, 0xff, 0x83, 0xd0, 0xfc, 0x8c, 0xd1, 0xfa, 0x89, 0xc5, 0xea, 0x76, 0xae, 0xcf, 0x79, 0x91, 0x9b, 0x7b, 0x93, 0x9d, 0x75, 0x89, 0x90, 0xcf, 0xd8, 0xdf, 
+    0xbf, 0xd4, 0xd7, 0x7c, 0x93, 0x99, 0x76, 0x91, 0x9a, 0x73, 0x90, 0x9e, 0x83, 0xa6, 0xb9, 0xbb, 0xe1, 0xf8, 0xbf, 0xe8, 0xff, 0xb6, 0xdf, 0xfd, 0xb3, 0xe3, 0xf7, 0xb3, 0xe3, 0xf7, 0xb3, 0xe3, 0xf7, 0xb1, 0xe4, 0xf9, 0xb1, 0xe4, 0xf9, 0xb0, 0xe4, 0xfa, 0xb1, 0xe5, 0xfb, 0xb1, 0xe5, 0xfb, 0xae, 0xeb, 0xff, 0xae, 0xea, 0xff, 0xad, 0xe7, 0xff, 0xae, 0xe5, 0xfa, 0xb1, 0xe6, 0xf6, 0xb6, 0xe7, 0xf5, 0xbb, 0xeb, 0xf5, 0xbe, 0xed, 0xf5, 0xf9, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfe, 0xff, 0xf3, 0xf8, 0xfc, 0xd8, 0xea, 0xf4, 0xb4, 0xda, 0xef, 0x93, 0xcf, 0xf1, 0x7f, 0xcd, 0xfb, 0x74, 0xd0, 0xff, 0x76, 0xd8, 0xff, 0x77, 0xd8, 0xff, 0x79, 0xd9, 0xff, 0x7d, 0xd9, 0xff, 0x81, 0xd9, 0xff, 0x84, 0xd8, 0xfc, 0x84, 0xd4, 0xf7, 0x82, 0xd1, 0xf2, 0x7d, 0xd6, 0xf4, 0x7a, 0xd4, 0xf6, 0x7a, 0xd6, 0xfb, 0x7a, 0xd6, 0xfb, 0x7f, 0xd4, 0xf9, 0x8a, 0xd6, 0xf6, 0x85, 0xc8, 0xe2, 0x73, 0xaf, 0xc7, 0x75, 0x8c, 0x94, 0x7d, 0x94, 0x9a, 0x79, 0x8c, 0x92, 0xe4, 0xeb, 0xf1, 
+    0xdd, 0xe6, 0xe5, 0x81, 0x92, 0x99, 0x73, 0x8d, 0x9a, 0x74, 0x94, 0xa3, 0x82, 0xa4, 0xb0, 0xaf, 0xd4, 0xe4, 0xb8, 0xe8, 0xfe, 0xad, 0xe6, 0xff, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb1, 0xdf, 0xef, 0xc9, 0xef, 0xfc, 0xe3, 0xfc, 0xff, 0xf1, 0xfc, 0xfe, 0xfa, 0xfc, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xe1, 0xff, 0xff, 0xc6, 0xf3, 0xff, 0xa2, 0xdf, 0xfb, 0x85, 0xd3, 0xf7, 0x7c, 0xd3, 0xfe, 0x7b, 0xd6, 0xff, 0x7f, 0xd5, 0xff, 0x80, 0xd4, 0xff, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x80, 0xd3, 0xfd, 0x7f, 0xd1, 0xf7, 0x85, 0xd7, 0xfd, 0x82, 0xd7, 0xfe, 0x79, 0xd0, 0xfb, 0x85, 0xd5, 0xfa, 0x87, 0xc5, 0xde, 0x71, 0xa0, 0xb0, 0x71, 0x8e, 0x9c, 0x7c, 0x94, 0x9e, 0x85, 0x94, 0x99, 0xf4, 0xf9, 0xfc, 
+    0xe6, 0xec, 0xec, 0x96, 0xa5, 0xac, 0x75, 0x8f, 0x9c, 0x78, 0x98, 0xa7, 0x7d, 0x9d, 0xaa, 0xa7, 0xcc, 0xdc, 0xb6, 0xe6, 0xfc, 0xae, 0xe7, 0xff, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xad, 0xe1, 0xf9, 0xb7, 0xe4, 0xf9, 0xc2, 0xe6, 0xf6, 0xd3, 0xeb, 0xf7, 0xe5, 0xf8, 0xff, 0xf0, 0xff, 0xff, 0xe8, 0xf8, 0xff, 0xd8, 0xea, 0xf8, 0xa6, 0xdc, 0xf6, 0x99, 0xd6, 0xf3, 0x86, 0xd1, 0xf1, 0x7d, 0xd1, 0xf6, 0x7d, 0xd5, 0xfd, 0x82, 0xd7, 0xff, 0x85, 0xd4, 0xfb, 0x85, 0xd0, 0xf7, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd4, 0xfe, 0x7f, 0xd1, 0xf7, 0x84, 0xd6, 0xfc, 0x82, 0xd7, 0xfe, 0x7b, 0xd3, 0xfb, 0x85, 0xd3, 0xf7, 0x85, 0xc1, 0xdb, 0x70, 0x9e, 0xad, 0x75, 0x92, 0xa0, 0x79, 0x8f, 0x9a, 0x96, 0xa5, 0xaa, 0xf7, 0xfd, 0xfd, 
+    0xf0, 0xf6, 0xf6, 0xb2, 0xc1, 0xc8, 0x77, 0x8e, 0x9c, 0x7e, 0x9b, 0xa9, 0x75, 0x95, 0xa2, 0x9d, 0xc1, 0xd1, 0xb5, 0xe3, 0xfa, 0xb1, 0xe9, 0xff, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb0, 0xe9, 0xff, 0xb0, 0xe3, 0xff, 0xb0, 0xde, 0xf6, 0xb7, 0xe0, 0xf6, 0xc7, 0xeb, 0xff, 0xcc, 0xf2, 0xff, 0xbe, 0xe6, 0xff, 0xaa, 0xd4, 0xed, 0x84, 0xce, 0xf5, 0x80, 0xce, 0xf5, 0x7b, 0xd0, 0xf9, 0x7b, 0xd4, 0xfe, 0x7f, 0xd7, 0xff, 0x84, 0xd6, 0xfb, 0x87, 0xd3, 0xf3, 0x88, 0xcf, 0xed, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd4, 0xfe, 0x7f, 0xd1, 0xf7, 0x81, 0xd3, 0xf8, 0x7f, 0xd7, 0xfd, 0x7e, 0xd6, 0xfe, 0x87, 0xd3, 0xf7, 0x83, 0xbb, 0xd4, 0x71, 0x98, 0xa7, 0x79, 0x95, 0xa1, 0x74, 0x8a, 0x95, 0xb2, 0xbf, 0xc5, 0xfb, 0xff, 0xff, 
+    0xf9, 0xfd, 0xfc, 0xca, 0xd7, 0xdd, 0x75, 0x8b, 0x98, 0x7d, 0x99, 0xa7, 0x72, 0x90, 0x9b, 0x98, 0xb9, 0xc8, 0xb5, 0xe2, 0xf7, 0xb3, 0xe9, 0xff, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb1, 0xe6, 0xff, 0xb4, 0xe7, 0xff, 0xb4, 0xe6, 0xff, 0xb3, 0xe2, 0xfc, 0xb3, 0xe2, 0xfc, 0xb0, 0xe3, 0xff, 0xa7, 0xde, 0xfc, 0x9d, 0xd5, 0xf6, 0x8c, 0xda, 0xff, 0x89, 0xd8, 0xff, 0x83, 0xd6, 0xfe, 0x7d, 0xd5, 0xfd, 0x7c, 0xd4, 0xfc, 0x7e, 0xd3, 0xf8, 0x81, 0xd4, 0xf6, 0x85, 0xd4, 0xf5, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x82, 0xd3, 0xfe, 0x7f, 0xd1, 0xf7, 0x7e, 0xd2, 0xf6, 0x7e, 0xd6, 0xfc, 0x81, 0xd9, 0xff, 0x85, 0xcf, 0xf2, 0x7f, 0xb3, 0xcb, 0x72, 0x93, 0xa2, 0x7b, 0x92, 0xa0, 0x73, 0x87, 0x90, 0xcd, 0xd8, 0xdc, 0xfc, 0xff, 0xff, 
+    0xfe, 0xff, 0xff, 0xdb, 0xe6, 0xec, 0x77, 0x8d, 0x9a, 0x79, 0x93, 0xa0, 0x72, 0x8e, 0x9a, 0x93, 0xb3, 0xc2, 0xb3, 0xdd, 0xf3, 0xb4, 0xe7, 0xff, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb2, 0xe0, 0xfa, 0xb6, 0xe4, 0xfc, 0xb8, 0xe6, 0xfe, 0xb6, 0xe4, 0xfc, 0xb1, 0xe3, 0xfc, 0xaf, 0xe5, 0xff, 0xae, 0xe5, 0xff, 0xaa, 0xe5, 0xff, 0x9e, 0xde, 0xf9, 0x99, 0xdc, 0xf9, 0x8e, 0xd7, 0xf7, 0x85, 0xd3, 0xf7, 0x7d, 0xd0, 0xf8, 0x7a, 0xd2, 0xfa, 0x7c, 0xd5, 0xff, 0x7c, 0xd8, 0xff, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x82, 0xd3, 0xfe, 0x80, 0xd2, 0xf8, 0x7d, 0xd1, 0xf5, 0x7e, 0xd6, 0xfa, 0x84, 0xd9, 0xff, 0x83, 0xc9, 0xeb, 0x7b, 0xa9, 0xc1, 0x74, 0x90, 0x9e, 0x79, 0x8f, 0x9c, 0x7a, 0x8b, 0x95, 0xdf, 0xe8, 0xed, 0xfe, 0xff, 0xff, 
+    0xff, 0xff, 0xfd, 0xe5, 0xee, 0xf3, 0x86, 0x9a, 0xa5, 0x77, 0x8e, 0x9c, 0x74, 0x8e, 0x9b, 0x8f, 0xac, 0xba, 0xac, 0xd5, 0xe9, 0xb4, 0xe6, 0xff, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xbb, 0xe6, 0xf9, 0xb8, 0xe2, 0xf8, 0xb5, 0xe2, 0xf7, 0xb5, 0xe4, 0xf8, 0xb7, 0xe7, 0xfd, 0xb7, 0xe9, 0xff, 0xb4, 0xe8, 0xff, 0xae, 0xe4, 0xfc, 0xaf, 0xe2, 0xf5, 0xaa, 0xe1, 0xf5, 0xa4, 0xdd, 0xf8, 0x99, 0xda, 0xf8, 0x8e, 0xd6, 0xfc, 0x83, 0xd5, 0xfd, 0x7b, 0xd4, 0xff, 0x77, 0xd4, 0xff, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd2, 0xff, 0x82, 0xd4, 0xfc, 0x7d, 0xd1, 0xf5, 0x7d, 0xd5, 0xf9, 0x83, 0xd8, 0xfd, 0x7e, 0xc3, 0xe4, 0x77, 0xa1, 0xb9, 0x79, 0x8f, 0x9d, 0x79, 0x8c, 0x9a, 0x8b, 0x99, 0xa2, 0xe8, 0xf0, 0xf3, 0xfe, 0xff, 0xff, 
+    0xff, 0xff, 0xfd, 0xed, 0xf4, 0xfa, 0x9d, 0xaf, 0xbb, 0x77, 0x8e, 0x9c, 0x78, 0x90, 0x9c, 0x87, 0xa4, 0xb2, 0xa3, 0xc9, 0xde, 0xb3, 0xe5, 0xff, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xbb, 0xea, 0xfe, 0xb6, 0xe6, 0xfa, 0xb4, 0xe4, 0xf8, 0xb5, 0xe5, 0xfb, 0xb5, 0xe8, 0xfd, 0xb4, 0xe6, 0xfd, 0xb1, 0xe3, 0xfa, 0xae, 0xe0, 0xf7, 0xb8, 0xe8, 0xfc, 0xb6, 0xe6, 0xfc, 0xb2, 0xe4, 0xfb, 0xad, 0xe3, 0xff, 0xa5, 0xe0, 0xff, 0x9a, 0xdc, 0xfe, 0x8d, 0xd7, 0xfc, 0x84, 0xd4, 0xf9, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x82, 0xd0, 0xfe, 0x83, 0xd5, 0xfd, 0x7e, 0xd2, 0xf6, 0x7c, 0xd4, 0xf8, 0x82, 0xd7, 0xfc, 0x7b, 0xbd, 0xdd, 0x75, 0x9b, 0xb2, 0x7f, 0x8f, 0x9e, 0x7c, 0x8e, 0x9c, 0xa0, 0xae, 0xb7, 0xec, 0xf4, 0xf7, 0xff, 0xff, 0xfd, 
+    0xff, 0xff, 0xfd, 0xf2, 0xf9, 0xff, 0xad, 0xbf, 0xcb, 0x7a, 0x90, 0x9d, 0x79, 0x91, 0x9d, 0x81, 0x9d, 0xab, 0x9a, 0xc0, 0xd5, 0xb4, 0xe3, 0xfd, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xad, 0xe1, 0xf6, 0xae, 0xe5, 0xfa, 0xb2, 0xe9, 0xfe, 0xb2, 0xe8, 0xff, 0xb1, 0xe5, 0xfd, 0xaf, 0xe3, 0xfb, 0xb3, 0xe5, 0xfc, 0xba, 0xea, 0xff, 0xb0, 0xe6, 0xfe, 0xb1, 0xe3, 0xfc, 0xb2, 0xe1, 0xfb, 0xb4, 0xe2, 0xfc, 0xb4, 0xe3, 0xff, 0xad, 0xe3, 0xff, 0xa3, 0xe0, 0xfc, 0x9b, 0xdd, 0xf7, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xd5, 0xfa, 0x81, 0xcf, 0xfd, 0x84, 0xd6, 0xfe, 0x7e, 0xd2, 0xf6, 0x7b, 0xd5, 0xf8, 0x82, 0xd6, 0xfa, 0x79, 0xba, 0xda, 0x73, 0x97, 0xad, 0x82, 0x8f, 0x9f, 0x7e, 0x90, 0x9e, 0xaf, 0xbc, 0xc5, 0xef, 0xf4, 0xf8, 0xff, 0xff, 0xfd, 
+    0xff, 0xfd, 0xfe, 0xf7, 0xf8, 0xfa, 0xd3, 0xdd, 0xdf, 0x6d, 0x80, 0x87, 0x78, 0x94, 0x9f, 0x77, 0x9b, 0xa9, 0x8b, 0xb6, 0xc6, 0xb6, 0xe5, 0xf7, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xa2, 0xe1, 0xf3, 0x9f, 0xe0, 0xf2, 0x9b, 0xdd, 0xf3, 0x95, 0xdb, 0xf4, 0x8d, 0xd9, 0xf3, 0x87, 0xd6, 0xf4, 0x83, 0xd3, 0xf4, 0x80, 0xd3, 0xf3, 0x80, 0xd4, 0xf6, 0x80, 0xd6, 0xf9, 0x79, 0xd1, 0xf7, 0x80, 0xd4, 0xf9, 0x88, 0xd1, 0xf1, 0x76, 0xb0, 0xc6, 0x67, 0x93, 0x9e, 0x75, 0x96, 0x9b, 0x78, 0x8a, 0x94, 0xc9, 0xd6, 0xde, 0xf1, 0xf6, 0xfc, 0xff, 0xfd, 0xff, 
+    0xff, 0xfe, 0xff, 0xfa, 0xfb, 0xfd, 0xd8, 0xe2, 0xe4, 0x76, 0x87, 0x8e, 0x77, 0x92, 0x9d, 0x74, 0x98, 0xa6, 0x88, 0xb2, 0xc2, 0xb3, 0xe0, 0xf3, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb0, 0xe7, 0xfc, 0xaf, 0xe5, 0xfd, 0xac, 0xe6, 0xfe, 0xa8, 0xe4, 0xfe, 0xa4, 0xe1, 0xfd, 0x9f, 0xe0, 0xfe, 0x9d, 0xdf, 0xff, 0x9c, 0xde, 0xfe, 0x95, 0xda, 0xfb, 0x92, 0xdb, 0xfc, 0x8e, 0xd6, 0xfc, 0x93, 0xd9, 0xfd, 0x95, 0xd2, 0xf1, 0x7e, 0xae, 0xc5, 0x6f, 0x90, 0x9f, 0x7a, 0x93, 0x9a, 0x7e, 0x90, 0x9a, 0xd1, 0xde, 0xe6, 0xf7, 0xfc, 0xff, 0xff, 0xfe, 0xff, 
+    0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfe, 0xe1, 0xe9, 0xec, 0x85, 0x96, 0x9d, 0x76, 0x8e, 0x98, 0x72, 0x93, 0xa2, 0x83, 0xaa, 0xbb, 0xae, 0xd9, 0xea, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb7, 0xe5, 0xfd, 0xb7, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb5, 0xe4, 0xfe, 0xb2, 0xe4, 0xff, 0xb2, 0xe4, 0xff, 0xb1, 0xe2, 0xff, 0xb0, 0xe3, 0xff, 0xac, 0xe2, 0xfe, 0xaa, 0xe1, 0xff, 0xa7, 0xdf, 0xff, 0xa9, 0xdf, 0xff, 0xa2, 0xd1, 0xef, 0x86, 0xaa, 0xc2, 0x76, 0x8d, 0x9d, 0x7e, 0x8f, 0x99, 0x8c, 0x9a, 0xa3, 0xdd, 0xe8, 0xee, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 
+    0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xe8, 0xf0, 0xf2, 0x9b, 0xaa, 0xb1, 0x75, 0x8b, 0x96, 0x71, 0x91, 0x9e, 0x7e, 0xa3, 0xb3, 0xaa, 0xd0, 0xe3, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb4, 0xe2, 0xfa, 0xb4, 0xe2, 0xfa, 0xb4, 0xe2, 0xfa, 0xb4, 0xe2, 0xfa, 0xb5, 0xe1, 0xfa, 0xb5, 0xe2, 0xf9, 0xb5, 0xe2, 0xf9, 0xb5, 0xe2, 0xf9, 0xb8, 0xe6, 0xfd, 0xb5, 0xe4, 0xfe, 0xb5, 0xe7, 0xff, 0xb6, 0xe5, 0xff, 0xa4, 0xce, 0xe7, 0x85, 0xa5, 0xba, 0x77, 0x8c, 0x9d, 0x7c, 0x8c, 0x99, 0x9b, 0xa5, 0xae, 0xe7, 0xee, 0xf4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xfb, 0xfd, 0xfd, 0xfd, 0xef, 0xf4, 0xf7, 0xb1, 0xbe, 0xc4, 0x77, 0x8b, 0x94, 0x74, 0x90, 0x9e, 0x7c, 0x9d, 0xae, 0xa4, 0xc9, 0xdb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb1, 0xe5, 0xfb, 0xb1, 0xe5, 0xfb, 0xb1, 0xe5, 0xfb, 0xb2, 0xe5, 0xfa, 0xb4, 0xe4, 0xfa, 0xb4, 0xe4, 0xf8, 0xb4, 0xe4, 0xf8, 0xb5, 0xe4, 0xf6, 0xb7, 0xe7, 0xfb, 0xb2, 0xe5, 0xfa, 0xb7, 0xe9, 0xff, 0xb7, 0xe7, 0xfe, 0x9d, 0xc7, 0xdd, 0x7d, 0xa1, 0xb1, 0x73, 0x8f, 0x9b, 0x78, 0x8f, 0x97, 0xad, 0xb4, 0xba, 0xef, 0xf4, 0xf8, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 
+    0xff, 0xfe, 0xfb, 0xfc, 0xfc, 0xfa, 0xf4, 0xfa, 0xfa, 0xc6, 0xd1, 0xd7, 0x7a, 0x8c, 0x96, 0x77, 0x91, 0x9e, 0x78, 0x97, 0xa9, 0x9d, 0xbe, 0xd1, 0xb1, 0xe3, 0xfa, 0xb1, 0xe3, 0xfa, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb4, 0xe6, 0xfd, 0xb4, 0xe6, 0xfd, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb0, 0xe9, 0xfd, 0xb1, 0xe8, 0xfd, 0xb0, 0xe7, 0xfb, 0xb0, 0xe7, 0xfb, 0xb0, 0xe7, 0xfb, 0xb2, 0xe7, 0xf9, 0xb1, 0xe6, 0xf8, 0xb1, 0xe6, 0xf8, 0xb0, 0xe8, 0xf9, 0xab, 0xe2, 0xf6, 0xb5, 0xe9, 0xfe, 0xb2, 0xe5, 0xf8, 0x94, 0xbf, 0xd0, 0x75, 0x99, 0xa7, 0x71, 0x8f, 0x99, 0x79, 0x92, 0x99, 0xc3, 0xc6, 0xcb, 0xf8, 0xf9, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfa, 
+    0xff, 0xff, 0xfa, 0xfc, 0xfc, 0xfa, 0xf8, 0xfc, 0xfd, 0xd5, 0xe0, 0xe4, 0x7c, 0x8d, 0x97, 0x7b, 0x92, 0xa0, 0x76, 0x91, 0xa2, 0x94, 0xb3, 0xc5, 0xb1, 0xe3, 0xfa, 0xb1, 0xe3, 0xfa, 0xb2, 0xe4, 0xfb, 0xb2, 0xe4, 0xfb, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb4, 0xe6, 0xfd, 0xb4, 0xe6, 0xfd, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb2, 0xe5, 0xfa, 0xb2, 0xe5, 0xfa, 0xb2, 0xe5, 0xfa, 0xb1, 0xe5, 0xfb, 0xb1, 0xe5, 0xfb, 0xb1, 0xe5, 0xfb, 0xb0, 0xe4, 0xfa, 0xb0, 0xe4, 0xfa, 0xb1, 0xe8, 0xfd, 0xac, 0xe0, 0xf6, 0xb5, 0xe8, 0xfd, 0xb2, 0xe1, 0xf5, 0x8f, 0xb6, 0xc7, 0x73, 0x93, 0xa0, 0x76, 0x8e, 0x98, 0x7e, 0x92, 0x99, 0xda, 0xd9, 0xde, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfe, 0xf9, 
+    0xff, 0xff, 0xfa, 0xfc, 0xfc, 0xfa, 0xfb, 0xff, 0xff, 0xde, 0xe7, 0xec, 0x7d, 0x8e, 0x96, 0x7d, 0x93, 0xa1, 0x72, 0x8d, 0x9e, 0x90, 0xad, 0xbf, 0xb1, 0xe3, 0xfa, 0xb1, 0xe3, 0xfa, 0xb1, 0xe3, 0xfa, 0xb2, 0xe4, 0xfb, 0xb3, 0xe5, 0xfc, 0xb4, 0xe6, 0xfd, 0xb4, 0xe6, 0xfd, 0xb4, 0xe6, 0xfd, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb6, 0xe3, 0xfa, 0xb6, 0xe3, 0xfa, 0xb5, 0xe3, 0xfa, 0xb6, 0xe4, 0xfc, 0xb5, 0xe4, 0xfe, 0xb3, 0xe5, 0xfe, 0xb3, 0xe5, 0xff, 0xb3, 0xe5, 0xff, 0xb4, 0xe7, 0xff, 0xad, 0xdf, 0xf8, 0xb8, 0xe6, 0xfe, 0xb5, 0xde, 0xf4, 0x8f, 0xb0, 0xc3, 0x74, 0x8e, 0x9b, 0x7b, 0x8d, 0x97, 0x84, 0x92, 0x9b, 0xe8, 0xe7, 0xec, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xf9, 0xfe, 0xff, 0xfa, 
+    0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xe7, 0xec, 0xf0, 0x9a, 0xa5, 0xab, 0x7d, 0x8f, 0x99, 0x77, 0x8e, 0x9c, 0x8a, 0xa5, 0xb6, 0x9e, 0xd0, 0xe7, 0xb5, 0xe5, 0xfc, 0xb3, 0xe2, 0xfe, 0xb4, 0xe3, 0xff, 0xb6, 0xe5, 0xff, 0xaf, 0xe1, 0xfa, 0xb4, 0xe7, 0xfc, 0xb2, 0xe7, 0xf9, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xaf, 0xe5, 0xff, 0xb5, 0xe9, 0xff, 0xb2, 0xe1, 0xf5, 0xac, 0xd5, 0xe7, 0x8c, 0xad, 0xbc, 0x6c, 0x88, 0x93, 0x7c, 0x93, 0x9b, 0x94, 0xa8, 0xaf, 0xed, 0xed, 0xed, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
+    0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xec, 0xf1, 0xf5, 0xaa, 0xb5, 0xbb, 0x7c, 0x8e, 0x98, 0x78, 0x8f, 0x9d, 0x83, 0x9e, 0xaf, 0x9e, 0xce, 0xe4, 0xb4, 0xe4, 0xfb, 0xb4, 0xe3, 0xfd, 0xb5, 0xe4, 0xff, 0xb6, 0xe5, 0xff, 0xaf, 0xe1, 0xfa, 0xb4, 0xe7, 0xfc, 0xb3, 0xe6, 0xf9, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xaf, 0xe5, 0xfd, 0xb4, 0xe6, 0xfd, 0xb2, 0xe1, 0xf5, 0xa8, 0xce, 0xe1, 0x82, 0xa3, 0xb2, 0x70, 0x8b, 0x96, 0x7b, 0x92, 0x9a, 0xa3, 0xb6, 0xbd, 0xf0, 0xf0, 0xf0, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xf3, 0xf8, 0xfb, 0xc0, 0xcb, 0xd1, 0x7b, 0x8c, 0x96, 0x7a, 0x91, 0x9f, 0x7a, 0x95, 0xa6, 0x9a, 0xc7, 0xdc, 0xb3, 0xe1, 0xf8, 0xb6, 0xe4, 0xfe, 0xb6, 0xe5, 0xff, 0xb5, 0xe7, 0xff, 0xb0, 0xe2, 0xfb, 0xb5, 0xe8, 0xfd, 0xb2, 0xe5, 0xf8, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xaf, 0xe5, 0xfd, 0xb2, 0xe4, 0xfb, 0xb3, 0xe0, 0xf5, 0xa0, 0xc7, 0xd8, 0x75, 0x95, 0xa2, 0x75, 0x8d, 0x99, 0x7c, 0x90, 0x99, 0xb7, 0xc8, 0xd0, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
+    0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xfe, 0xfa, 0xfe, 0xff, 0xd1, 0xda, 0xdf, 0x79, 0x8a, 0x92, 0x7c, 0x92, 0x9f, 0x76, 0x90, 0x9f, 0x95, 0xbe, 0xd2, 0xb3, 0xdd, 0xf3, 0xb6, 0xe4, 0xfc, 0xb7, 0xe6, 0xff, 0xb5, 0xe7, 0xff, 0xb0, 0xe2, 0xfb, 0xb5, 0xe7, 0xfe, 0xb4, 0xe4, 0xfa, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xae, 0xe4, 0xfc, 0xb1, 0xe3, 0xfa, 0xb3, 0xe0, 0xf5, 0x98, 0xbd, 0xcf, 0x6f, 0x8c, 0x9a, 0x79, 0x8f, 0x9a, 0x7f, 0x90, 0x98, 0xca, 0xd7, 0xdf, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
+    0xfd, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xda, 0xe3, 0xe8, 0x80, 0x8e, 0x97, 0x7b, 0x91, 0x9e, 0x77, 0x91, 0xa0, 0x8e, 0xb3, 0xc6, 0xaf, 0xd8, 0xec, 0xb7, 0xe4, 0xfb, 0xb5, 0xe7, 0xfe, 0xb4, 0xe8, 0xff, 0xaf, 0xe3, 0xfb, 0xb5, 0xe7, 0xfe, 0xb3, 0xe3, 0xf9, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb0, 0xe4, 0xfa, 0xb2, 0xe5, 0xfa, 0xb3, 0xde, 0xf1, 0x8e, 0xb2, 0xc2, 0x6f, 0x8b, 0x97, 0x7c, 0x90, 0x9b, 0x89, 0x96, 0x9f, 0xd7, 0xe1, 0xea, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
+    0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xe0, 0xe8, 0xeb, 0x91, 0xa0, 0xa7, 0x7b, 0x8e, 0x9c, 0x7a, 0x91, 0x9f, 0x87, 0xa8, 0xbb, 0xab, 0xd1, 0xe4, 0xb5, 0xe2, 0xf7, 0xb4, 0xe6, 0xfd, 0xb3, 0xe7, 0xff, 0xaf, 0xe3, 0xfb, 0xb7, 0xe7, 0xfe, 0xb3, 0xe1, 0xf8, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb0, 0xe4, 0xfa, 0xb5, 0xe5, 0xfb, 0xad, 0xd8, 0xeb, 0x82, 0xa6, 0xb6, 0x76, 0x90, 0x9d, 0x7c, 0x8d, 0x97, 0x99, 0xa3, 0xac, 0xe1, 0xe8, 0xf0, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfc, 0xfb, 0xf9, 0xfe, 0xff, 0xff, 0xe5, 0xed, 0xf0, 0xa9, 0xb8, 0xbf, 0x7a, 0x8e, 0x99, 0x79, 0x90, 0x9e, 0x7f, 0x9e, 0xb0, 0xa8, 0xcb, 0xde, 0xb3, 0xe0, 0xf3, 0xb3, 0xe6, 0xfb, 0xb0, 0xe7, 0xfc, 0xaf, 0xe3, 0xfb, 0xb7, 0xe7, 0xfe, 0xb3, 0xe1, 0xf8, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb1, 0xe5, 0xfa, 0xb6, 0xe6, 0xfa, 0xa4, 0xcf, 0xe0, 0x76, 0x97, 0xa8, 0x80, 0x97, 0xa5, 0x7c, 0x8a, 0x95, 0xab, 0xb4, 0xbd, 0xec, 0xf0, 0xf9, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 
+    0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xfb, 0xfa, 0xf8, 0xfe, 0xff, 0xff, 0xe9, 0xf1, 0xf4, 0xbd, 0xca, 0xd2, 0x79, 0x8d, 0x98, 0x77, 0x8e, 0x9c, 0x7c, 0x99, 0xa9, 0xa5, 0xc8, 0xdb, 0xb4, 0xdf, 0xf2, 0xb3, 0xe6, 0xfb, 0xb0, 0xe7, 0xfc, 0xaf, 0xe3, 0xf9, 0xb7, 0xe7, 0xfe, 0xb2, 0xe0, 0xf8, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb3, 0xe5, 0xfc, 0xb2, 0xe6, 0xfb, 0xb6, 0xe6, 0xfa, 0x9e, 0xc7, 0xd9, 0x6d, 0x8e, 0x9d, 0x84, 0x9c, 0xa8, 0x7a, 0x88, 0x93, 0xb9, 0xc0, 0xca, 0xf2, 0xf5, 0xfe, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xfa, 0xfa, 0xfa, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xfa, 0xfa, 0xf9, 0xfe, 0xd0, 0xd4, 0xdf, 0x7b, 0x8d, 0x9b, 0x71, 0x91, 0xa0, 0x72, 0x92, 0x9f, 0x97, 0xbb, 0xcb, 0xb8, 0xe3, 0xf4, 0xb2, 0xe1, 0xf5, 0xb2, 0xe2, 0xf9, 0xbc, 0xea, 0xff, 0xb6, 0xe2, 0xfb, 0xbc, 0xe4, 0xfd, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb0, 0xe7, 0xfc, 0xb2, 0xea, 0xff, 0xaf, 0xde, 0xf0, 0xa3, 0xc7, 0xd3, 0x76, 0x92, 0x9e, 0x7a, 0x94, 0xa1, 0x77, 0x8b, 0x96, 0xc9, 0xd0, 0xd6, 0xfa, 0xf8, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xfb, 0xfb, 0xfd, 0xfc, 0xff, 0xfd, 0xfc, 0xfe, 0xfb, 0xfe, 0xfe, 0xff, 0xd6, 0xda, 0xe3, 0x83, 0x95, 0xa1, 0x75, 0x92, 0xa0, 0x77, 0x94, 0xa4, 0x92, 0xb6, 0xc6, 0xb8, 0xe1, 0xf5, 0xb7, 0xe7, 0xfd, 0xb1, 0xe3, 0xfa, 0xb6, 0xe8, 0xff, 0xb3, 0xe1, 0xf9, 0xb4, 0xe0, 0xf9, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xb5, 0xe4, 0xfe, 0xae, 0xe6, 0xff, 0xaa, 0xd7, 0xea, 0x96, 0xb8, 0xc4, 0x71, 0x8d, 0x98, 0x75, 0x8f, 0x9c, 0x83, 0x95, 0xa1, 0xd1, 0xd8, 0xde, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xfc, 0xfc, 0xfe, 0xfc, 0xff, 0xfd, 0xfd, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xe1, 0xe4, 0xed, 0x91, 0xa1, 0xae, 0x77, 0x93, 0x9f, 0x77, 0x92, 0xa3, 0x84, 0xa5, 0xb8, 0xac, 0xd5, 0xe9, 0xb7, 0xe7, 0xfe, 0xac, 0xe0, 0xf8, 0xaf, 0xe5, 0xfd, 0xb1, 0xe5, 0xfd, 0xb3, 0xe2, 0xfc, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb6, 0xe2, 0xfd, 0xb5, 0xe8, 0xff, 0xac, 0xd7, 0xea, 0x8d, 0xad, 0xba, 0x75, 0x90, 0x9b, 0x77, 0x8f, 0x9b, 0x95, 0xa7, 0xb3, 0xd9, 0xe0, 0xe6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xfd, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xfe, 0xfe, 0xfc, 0xff, 0xfe, 0xff, 0xeb, 0xeb, 0xf3, 0xa0, 0xae, 0xb9, 0x77, 0x92, 0x9d, 0x80, 0x9a, 0xab, 0x7f, 0x9e, 0xb2, 0xa9, 0xcf, 0xe4, 0xba, 0xea, 0xff, 0xab, 0xe1, 0xf9, 0xb0, 0xe6, 0xfe, 0xb5, 0xeb, 0xff, 0xb7, 0xeb, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb6, 0xe5, 0xff, 0xb5, 0xe7, 0xff, 0xa9, 0xd2, 0xe4, 0x83, 0xa1, 0xac, 0x7a, 0x92, 0x9e, 0x78, 0x8e, 0x9b, 0xa7, 0xb9, 0xc3, 0xe0, 0xe8, 0xeb, 0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xfd, 0xfe, 0xf9, 0xff, 0xfe, 0xff, 0xf2, 0xf1, 0xf7, 0xae, 0xbb, 0xc3, 0x78, 0x90, 0x9a, 0x7a, 0x91, 0xa3, 0x77, 0x94, 0xa6, 0xa1, 0xc6, 0xd9, 0xb8, 0xe6, 0xfd, 0xad, 0xe1, 0xf7, 0xaf, 0xe3, 0xfb, 0xb0, 0xe4, 0xfa, 0xb0, 0xe2, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xaf, 0xe3, 0xf9, 0xb3, 0xe1, 0xfb, 0xa3, 0xc8, 0xdb, 0x78, 0x92, 0x9f, 0x75, 0x8b, 0x96, 0x74, 0x8a, 0x97, 0xb3, 0xc4, 0xce, 0xea, 0xf2, 0xf5, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xfd, 0xfe, 0xf9, 0xff, 0xfe, 0xfd, 0xf9, 0xf7, 0xfc, 0xbe, 0xc9, 0xcf, 0x7e, 0x95, 0x9d, 0x72, 0x88, 0x96, 0x74, 0x90, 0x9e, 0x9d, 0xc0, 0xd3, 0xb8, 0xe3, 0xf6, 0xb8, 0xe8, 0xfc, 0xba, 0xea, 0xff, 0xb6, 0xe5, 0xf9, 0xb7, 0xe4, 0xf9, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb4, 0xe8, 0xfd, 0xb5, 0xe1, 0xfa, 0xa1, 0xc4, 0xd7, 0x7a, 0x92, 0x9e, 0x76, 0x8a, 0x95, 0x78, 0x8c, 0x97, 0xb9, 0xca, 0xd2, 0xf6, 0xfb, 0xfe, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfc, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xfd, 0xfe, 0xf9, 0xff, 0xfd, 0xfd, 0xfe, 0xfc, 0xff, 0xcd, 0xd6, 0xdd, 0x87, 0x9b, 0xa2, 0x7a, 0x90, 0x9b, 0x7e, 0x99, 0xa4, 0x99, 0xba, 0xc9, 0xa8, 0xd2, 0xe2, 0xb0, 0xdb, 0xec, 0xb4, 0xdf, 0xf2, 0xaf, 0xd5, 0xe8, 0xb6, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xb0, 0xdb, 0xee, 0xa4, 0xcc, 0xe6, 0x96, 0xb5, 0xc9, 0x7d, 0x93, 0xa0, 0x7d, 0x8f, 0x99, 0x85, 0x97, 0xa3, 0xc3, 0xd1, 0xda, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfa, 0xf7, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfb, 0xff, 0xfd, 0xff, 0xd6, 0xdf, 0xe4, 0x8f, 0xa2, 0xa8, 0x75, 0x8c, 0x92, 0x75, 0x90, 0x99, 0x7b, 0x9d, 0xa7, 0x78, 0xa0, 0xac, 0x7d, 0xa7, 0xb7, 0x81, 0xa8, 0xb9, 0x7b, 0x9e, 0xb1, 0x89, 0xa8, 0xbc, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x80, 0xa3, 0xb6, 0x7c, 0xa4, 0xbe, 0x77, 0x96, 0xaa, 0x75, 0x8b, 0x98, 0x7f, 0x91, 0x9b, 0x91, 0xa3, 0xaf, 0xcb, 0xd9, 0xe2, 0xfb, 0xff, 0xff, 0xfe, 0xfb, 0xf6, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xfa, 0xfd, 0xfc, 0xf7, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfd, 0xf7, 0xfb, 0xfc, 0xfb, 0xff, 0xff, 0xe2, 0xea, 0xed, 0xa5, 0xad, 0xb0, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x75, 0x91, 0x9d, 0x73, 0x90, 0xa2, 0x7c, 0x97, 0xa8, 0x7a, 0x91, 0x9f, 0x7c, 0x8e, 0x9a, 0xa4, 0xae, 0xb8, 0xe0, 0xe5, 0xeb, 0xfe, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xfa, 0xfd, 0xfc, 0xf8, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xf8, 0xfc, 0xfd, 0xfb, 0xff, 0xff, 0xe9, 0xee, 0xf1, 0xb5, 0xbd, 0xc0, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x79, 0x8f, 0x9a, 0x70, 0x87, 0x97, 0x76, 0x8c, 0x9a, 0x77, 0x89, 0x97, 0x82, 0x90, 0x9b, 0xad, 0xb6, 0xbd, 0xe5, 0xea, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfe, 0xfb, 0xfc, 0xfb, 0xf7, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xf1, 0xf6, 0xf9, 0xd0, 0xd5, 0xd8, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0x9e, 0xab, 0xb3, 0xa1, 0xaf, 0xbc, 0x9f, 0xab, 0xb7, 0x9f, 0xa9, 0xb3, 0xaa, 0xb3, 0xba, 0xcc, 0xd1, 0xd5, 0xf1, 0xf5, 0xf6, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xfb, 0xfb, 0xfa, 0xf8, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfd, 0xfe, 0xea, 0xee, 0xf1, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe2, 0xe7, 0xeb, 0xe7, 0xeb, 0xf4, 0xe1, 0xe4, 0xeb, 0xdc, 0xdf, 0xe6, 0xe1, 0xe5, 0xe8, 0xef, 0xf3, 0xf4, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xfd, 0xfd, 0xfc, 0xfa, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xfc, 0xfa, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfa, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xfb, 0xfa, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfc, 0xfc, 0xfe, 0xfb, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xfe, 0xfa, 0xfc, 0xfb, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 
+    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd
+};
+const tImage water = { image_data_water, 60, 60,
+    8 };
+
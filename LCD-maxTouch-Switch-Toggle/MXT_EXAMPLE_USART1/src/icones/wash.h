@@ -1,95 +1,300 @@
 
 /*******************************************************************************
 * image
-* filename: unsaved
 * name: wash
 *
 * preset name: Color R8G8B8
 * data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Color, not_used not_used
+* RLE compression enabled: yes (tools/rle_icons.py, 10800 -> 6501 bytes)
 * bits per pixel: 24
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
 *******************************************************************************/
 
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
 #include <stdint.h>
+#include "tipos.h"
 
 
+static const uint8_t image_data_wash[6501] = {
+    0x97, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xf5, 0xf4, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xf9, 0xf6, 0xfd,
+    0xfd, 0xff, 0xe7, 0xeb, 0xf4, 0xa8, 0xca, 0xe6, 0xc0, 0xd6, 0xed, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xf8, 0xff, 0xfc, 0xf7, 0xfc,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfd, 0x06,
+    0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0x97, 0xff, 0xff,
+    0xff, 0x0f, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xfd, 0xfe, 0xf9, 0xfc, 0xfc, 0xfc, 0xf8, 0xff, 0xff, 0xec,
+    0xfd, 0xff, 0x78, 0xa8, 0xd0, 0x93, 0xb7, 0xd7, 0xd8, 0xed, 0xff, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xfb, 0xfd, 0xfc, 0xf5,
+    0xfa, 0xfd, 0x87, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xff, 0xff, 0x81, 0xfc, 0xfd, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfc,
+    0xfb, 0xf9, 0x81, 0xff, 0xff, 0xfd, 0x00, 0xfe, 0xfe, 0xfe, 0x97, 0xff, 0xff, 0xff, 0x0c, 0xfe, 0xff, 0xff, 0xf9, 0xfd, 0xff, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0xff, 0xff, 0xfb, 0xf5, 0xfa, 0xfd, 0xc9, 0xde, 0xef, 0xaa, 0xcb, 0xea, 0x65, 0xa6, 0xdc, 0x6c, 0xa2, 0xd0, 0xa5, 0xca, 0xe7,
+    0xce, 0xdf, 0xef, 0xf6, 0xfb, 0xff, 0x81, 0xff, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0xfb, 0xff,
+    0xff, 0xf8, 0xfd, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfd, 0xf7, 0xff, 0xfb, 0xf2, 0xff, 0xfb, 0xf8, 0x81, 0xff, 0xfe, 0xfb, 0x00,
+    0xfc, 0xfb, 0xf9, 0x97, 0xff, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xff, 0xf1, 0xf6, 0xfa, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xfe, 0xfb, 0x08, 0xf1, 0xf8,
+    0xfe, 0xa1, 0xbd, 0xd3, 0x6e, 0x9a, 0xbf, 0x5f, 0xab, 0xe9, 0x52, 0x93, 0xc9, 0x7d, 0xaa, 0xd1, 0xa8, 0xc3, 0xd8, 0xe0, 0xea, 0xf3, 0xf8, 0xfa,
+    0xf9, 0x81, 0xff, 0xff, 0xfb, 0x87, 0xff, 0xff, 0xff, 0x0b, 0xfd, 0xfc, 0xfa, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfb, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xf5, 0xff, 0xf8, 0xed, 0xfa, 0xfe, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0x97, 0xff,
+    0xff, 0xff, 0x0f, 0xfb, 0xff, 0xff, 0xf3, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xf9, 0xf6, 0xff, 0xfe, 0xfb, 0xf9, 0xfe, 0xff, 0xbc, 0xd7, 0xec,
+    0x98, 0xc3, 0xe5, 0x62, 0xa8, 0xe3, 0x62, 0x9e, 0xd0, 0x97, 0xc3, 0xe6, 0xc5, 0xde, 0xf4, 0xf3, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfa,
+    0xfb, 0xfa, 0xf6, 0x87, 0xff, 0xff, 0xff, 0x02, 0xfc, 0xfb, 0xf9, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x81, 0xfb, 0xff, 0xff, 0x06, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xf9, 0xd2, 0xe5, 0xf4, 0xc6, 0xd6, 0xe3, 0xf6, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0x0d,
+    0xfd, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xff, 0xec, 0xfd, 0xff, 0xe3, 0xff, 0xff,
+    0x86, 0xb5, 0xdf, 0x96, 0xbe, 0xe1, 0xd4, 0xf0, 0xff, 0xf1, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfd, 0x87, 0xff,
+    0xff, 0xff, 0x0b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfc, 0xfc, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xf0, 0xfd, 0xff,
+    0xe6, 0xf4, 0xff, 0x90, 0xbb, 0xdd, 0x92, 0xb5, 0xd1, 0xda, 0xf3, 0xff, 0xf4, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0x0f, 0xf9, 0xf8, 0xf3, 0xfe,
+    0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xc2, 0xd7, 0xea, 0xc9,
+    0xda, 0xea, 0xf2, 0xfc, 0xff, 0xf7, 0xfb, 0xfe, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf6, 0xfb, 0xfd, 0xfc, 0xfb, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
+    0x0b, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfb, 0xf4, 0xff, 0xff, 0xfd, 0xed, 0xfa, 0xff, 0xc8, 0xe3, 0xf8, 0xa4, 0xc9,
+    0xe6, 0x65, 0xa4, 0xd7, 0x6b, 0xa1, 0xcd, 0xa4, 0xcd, 0xed, 0xc3, 0xdc, 0xf0, 0x97, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xff,
+    0xf3, 0xfa, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xf8, 0xf2, 0xff, 0xfd, 0xf4, 0xf9, 0xf5, 0xea, 0xfc, 0xff, 0xff, 0xf8, 0xf8, 0xfa,
+    0xff, 0xfe, 0xfd, 0xfe, 0xf9, 0xf5, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xf7, 0xfc, 0xff, 0x87, 0xff, 0xff, 0xff, 0x0b, 0xf9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xff, 0xfc, 0xf1, 0xff, 0xfe, 0xfa, 0xe1, 0xf1, 0xfe, 0xa1, 0xc6, 0xe3, 0x67, 0x9b, 0xc3, 0x59,
+    0xa7, 0xe5, 0x5a, 0x9d, 0xd2, 0x71, 0xa5, 0xcd, 0x90, 0xb0, 0xc9, 0x87, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xfb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xe3, 0xf5, 0xff, 0xd0, 0xea, 0xf9, 0xd0, 0xeb, 0xfc, 0xd9, 0xf3,
+    0xff, 0xed, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfe, 0xfd, 0xfb, 0xfa, 0xfe, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x13, 0xf7, 0xff, 0xff,
+    0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xfc, 0xfa, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfc, 0xfa,
+    0xfb, 0xfc, 0xff, 0xf4, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0xfd, 0xf7, 0xf4, 0xf3, 0xef, 0xd6, 0xe0, 0xea, 0xb0, 0xc8, 0xe0, 0x6c, 0xa9, 0xd8,
+    0x6d, 0x9e, 0xc6, 0xb5, 0xd5, 0xee, 0xcc, 0xda, 0xe5, 0x87, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe,
+    0xfd, 0xfb, 0xff, 0xfc, 0xf9, 0xf7, 0xf8, 0xfa, 0xdb, 0xeb, 0xf8, 0xbf, 0xdd, 0xf5, 0xac, 0xd0, 0xe8, 0xae, 0xd3, 0xed, 0xbb, 0xde, 0xf4, 0xd9,
+    0xef, 0xfc, 0xf6, 0xfb, 0xfe, 0x81, 0xff, 0xfe, 0xfb, 0x00, 0xfd, 0xfe, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x13, 0xf9, 0xfe, 0xff, 0xff, 0xfe, 0xfa,
+    0xff, 0xfe, 0xf6, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xfb, 0xfd, 0xfc, 0xff, 0xfe, 0xf9, 0xff, 0xfc, 0xfa, 0xfa, 0xfb, 0xff,
+    0xf6, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfb, 0xf3, 0xfc, 0xff, 0xd9, 0xee, 0xff, 0x83, 0xb3, 0xd9, 0x91, 0xb8, 0xd7,
+    0xe0, 0xf7, 0xff, 0xef, 0xf8, 0xff, 0x87, 0xff, 0xff, 0xff, 0x81, 0xfc, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xfe, 0xfa, 0x0a, 0xf1,
+    0xf8, 0xfe, 0xc8, 0xe4, 0xfa, 0xa4, 0xd0, 0xf3, 0x9f, 0xd1, 0xf4, 0x9d, 0xcf, 0xf2, 0xa9, 0xd4, 0xf4, 0xc9, 0xe5, 0xfa, 0xee, 0xf7, 0xfe, 0xff,
+    0xfe, 0xfb, 0xff, 0xfd, 0xfa, 0xfd, 0xfb, 0xfc, 0x8f, 0xff, 0xff, 0xff, 0x13, 0xfc, 0xfb, 0xf7, 0xff, 0xfb, 0xf5, 0xff, 0xfd, 0xf4, 0xff, 0xff,
+    0xfa, 0xfb, 0xff, 0xff, 0xf2, 0xfb, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfc, 0xfe,
+    0xfb, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xc2, 0xde, 0xf4, 0xc9, 0xde, 0xef, 0xf7, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xfe, 0xfa, 0x0a, 0xf1, 0xfb, 0xff, 0xbf,
+    0xe2, 0xfe, 0x94, 0xca, 0xf6, 0xa2, 0xdd, 0xff, 0x9c, 0xd6, 0xfe, 0xa2, 0xd4, 0xf7, 0xc1, 0xe1, 0xf8, 0xe6, 0xf3, 0xfb, 0xfe, 0xfd, 0xfb, 0xff,
+    0xfe, 0xfb, 0xfe, 0xfd, 0xfb, 0x8f, 0xff, 0xff, 0xff, 0x0e, 0xfe, 0xfe, 0xfc, 0xff, 0xfe, 0xf9, 0xff, 0xfe, 0xfb, 0xf8, 0xfd, 0xff, 0xe3, 0xf4,
+    0xfe, 0xd5, 0xea, 0xfb, 0xd9, 0xec, 0xfa, 0xe6, 0xf4, 0xfd, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xf7, 0xfe, 0xf9,
+    0xf3, 0xff, 0xfc, 0xf7, 0xfb, 0xfc, 0xfe, 0x81, 0xf8, 0xff, 0xff, 0x02, 0xf1, 0xf6, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xf5, 0xf2, 0x87, 0xff, 0xff,
+    0xff, 0x0f, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfb, 0xef, 0xf8, 0xff, 0xc0, 0xe0, 0xf9, 0x95,
+    0xc9, 0xf1, 0x9f, 0xd5, 0xfb, 0x9a, 0xd0, 0xf6, 0xa3, 0xd1, 0xf2, 0xc3, 0xe2, 0xf7, 0xea, 0xf5, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xff,
+    0xfe, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x13, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf3, 0xfb, 0xfe, 0xda, 0xed, 0xfb, 0xba, 0xdc, 0xf5, 0xa9, 0xd2,
+    0xf0, 0xad, 0xd2, 0xed, 0xb9, 0xd9, 0xf0, 0xe0, 0xed, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xf8, 0xff, 0xfe, 0xfa, 0xff, 0xff,
+    0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xfa, 0xf7, 0xff, 0xfe, 0xfa, 0xff, 0xfb, 0xf7, 0x88, 0xff, 0xff, 0xff, 0x0e,
+    0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xf9, 0xfd, 0xff, 0xd9, 0xee, 0xff, 0xbd, 0xdf, 0xfa, 0xae, 0xd3, 0xed,
+    0xad, 0xd5, 0xef, 0xbb, 0xdd, 0xf6, 0xd9, 0xef, 0xfd, 0xf7, 0xfc, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0x8f, 0xff, 0xff,
+    0xff, 0x13, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xe8, 0xf6, 0xff, 0xc4, 0xe0, 0xf5, 0xa3, 0xd0, 0xf1, 0x97, 0xcc, 0xf4, 0x9c, 0xd0, 0xf7, 0xa4,
+    0xd2, 0xf4, 0xc7, 0xde, 0xee, 0xf0, 0xfb, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xfa, 0xf8, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xf9, 0xff,
+    0xff, 0xfa, 0xff, 0xfa, 0xf4, 0xff, 0xfd, 0xf9, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0x87, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfc, 0xf8, 0xfe, 0xfe,
+    0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfd, 0x09, 0xfa, 0xff, 0xff, 0xed, 0xfa, 0xff, 0xd9, 0xec, 0xf3, 0xda, 0xee, 0xf9,
+    0xe2, 0xf6, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xfd, 0xfd, 0xf9, 0xfe, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x13, 0xfc,
+    0xfc, 0xfa, 0xfe, 0xff, 0xff, 0xeb, 0xf6, 0xfc, 0xc0, 0xdc, 0xf1, 0xa1, 0xcf, 0xf1, 0x9c, 0xd5, 0xff, 0xa3, 0xda, 0xff, 0xa4, 0xd6, 0xfb, 0xbb,
+    0xdb, 0xf0, 0xea, 0xfb, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xf7, 0xf5, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xff,
+    0xfc, 0xf9, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x08, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0xfd, 0xfb, 0xff,
+    0xff, 0xf8, 0xfd, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xfe, 0x81, 0xf8, 0xff, 0xff, 0x04,
+    0xfc, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xf5, 0xfe, 0xfe, 0xfe, 0xf9, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x13, 0xff, 0xfe, 0xf8, 0xff,
+    0xff, 0xfa, 0xf2, 0xfa, 0xfd, 0xc1, 0xdb, 0xec, 0xa0, 0xcd, 0xee, 0x9f, 0xd6, 0xff, 0xa3, 0xd8, 0xff, 0x9d, 0xcd, 0xf1, 0xb6, 0xdb, 0xf5, 0xea,
+    0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf7, 0xf5, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xfb, 0xfa, 0xff, 0xff, 0xf4, 0xfc, 0xfc, 0xfc, 0xfe,
+    0xff, 0xff, 0xf8, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0x1a, 0xff, 0xfe, 0xf4, 0xfe, 0xfd, 0xfb, 0xf8, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd,
+    0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xff, 0xee, 0xf6, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfa, 0xff, 0xfe,
+    0xfa, 0xff, 0xfc, 0xfb, 0xff, 0xfd, 0xfb, 0xff, 0xfb, 0xf6, 0xfd, 0xff, 0xf9, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfd,
+    0xff, 0xfd, 0xfb, 0xff, 0xfc, 0xfa, 0xff, 0xfa, 0xf8, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xf8, 0xfb, 0xff, 0x81, 0xfb, 0xff, 0xff, 0x15, 0xfe,
+    0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xf4, 0xff, 0xfe, 0xfa, 0xfb, 0xfa, 0xf8, 0xf7, 0xf8, 0xfc, 0xf9, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0xff, 0xfb, 0xf6, 0xff, 0xf9, 0xf0, 0xf6, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xe0, 0xf0, 0xfd, 0xc2, 0xde, 0xf4, 0xa6,
+    0xcb, 0xe8, 0xa7, 0xcc, 0xe9, 0xbc, 0xde, 0xf9, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0x85, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe,
+    0xfe, 0x00, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xd0, 0xe0, 0xed, 0xd3, 0xe1, 0xee, 0xf4, 0xf8, 0xff, 0xff, 0xfe, 0xff,
+    0x81, 0xff, 0xff, 0xfb, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xff, 0xff, 0x03, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xfc, 0xfd, 0xff,
+    0xfa, 0xfc, 0xfe, 0xf9, 0x81, 0xff, 0xfe, 0xfb, 0x02, 0xff, 0xfb, 0xf8, 0xff, 0xfb, 0xfa, 0xfe, 0xfc, 0xfd, 0x82, 0xff, 0xfe, 0xff, 0x04, 0xfd,
+    0xfb, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfb, 0xfc, 0xfe, 0x81, 0xfe, 0xff, 0xff, 0x07, 0xfb, 0xfd, 0xfc, 0xea, 0xf6,
+    0xff, 0xe2, 0xf2, 0xff, 0xdb, 0xee, 0xfd, 0xd9, 0xee, 0xff, 0xde, 0xf1, 0xff, 0xea, 0xf6, 0xff, 0xf9, 0xff, 0xff, 0x81, 0xfe, 0xff, 0xff, 0x81,
+    0xff, 0xff, 0xfd, 0x06, 0xf4, 0xf9, 0xfd, 0xe2, 0xf4, 0xff, 0xd1, 0xea, 0xfe, 0xd3, 0xea, 0xfc, 0xe4, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xfb, 0xfb,
+    0xfb, 0x82, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x09, 0xe2, 0xf0,
+    0xf9, 0xdb, 0xf6, 0xff, 0x8c, 0xb1, 0xce, 0x85, 0xa8, 0xc8, 0xdc, 0xf2, 0xff, 0xf6, 0xfd, 0xff, 0xf1, 0xee, 0xe9, 0xff, 0xfe, 0xf4, 0xfb, 0xfd,
+    0xfc, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfd, 0x00, 0xfe, 0xfd, 0xfb, 0x81, 0xff, 0xfe, 0xfd, 0x06, 0xff, 0xfd, 0xfc, 0xff, 0xfd, 0xf4, 0xff,
+    0xfe, 0xf6, 0xff, 0xfd, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x81, 0xf9, 0xff, 0xff, 0x18, 0xfc, 0xfc, 0xfe, 0xff, 0xfe,
+    0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfc, 0xf8, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xef, 0xfc, 0xff, 0xdb, 0xed, 0xf9, 0xb6, 0xdb, 0xf8, 0xb0, 0xd7,
+    0xf6, 0xac, 0xd5, 0xf5, 0xa9, 0xd2, 0xf2, 0xad, 0xd2, 0xef, 0xba, 0xda, 0xf3, 0xd2, 0xeb, 0xff, 0xe7, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+    0xfa, 0xff, 0xfc, 0xf5, 0xff, 0xfc, 0xf8, 0xfc, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf6, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x83, 0xff,
+    0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x0c,
+    0xab, 0xcb, 0xe0, 0xa0, 0xce, 0xf0, 0x6e, 0xa8, 0xd8, 0x6e, 0xa8, 0xda, 0xa9, 0xd3, 0xf9, 0xd3, 0xe6, 0xf7, 0xf1, 0xf3, 0xf2, 0xff, 0xfe, 0xf4,
+    0xfa, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xf9, 0xf8, 0xfe, 0xfa, 0xf9, 0x81, 0xff, 0xfe, 0xff, 0x20, 0xff, 0xfd, 0xff, 0xf7,
+    0xfb, 0xfc, 0xf4, 0xf9, 0xfc, 0xf5, 0xfa, 0xfe, 0xf8, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xf9, 0xf6, 0xff, 0xfc, 0xf6, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0xd2, 0xec, 0xfd, 0xb1, 0xd3, 0xec, 0x9e,
+    0xd2, 0xf9, 0x9d, 0xd2, 0xfa, 0x9e, 0xd3, 0xfb, 0x9e, 0xd2, 0xfa, 0x9f, 0xcf, 0xf5, 0xa6, 0xd1, 0xf1, 0xb7, 0xdc, 0xf7, 0xc6, 0xe8, 0xff, 0xf4,
+    0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xf5, 0xff, 0xfc, 0xf6, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfd, 0xf7, 0x84,
+    0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x82, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x08, 0x89, 0xb2, 0xce, 0x64,
+    0x9b, 0xc4, 0x5a, 0x9f, 0xd8, 0x65, 0xaa, 0xe5, 0x64, 0x99, 0xc5, 0x9c, 0xb8, 0xd0, 0xec, 0xf5, 0xfa, 0xf2, 0xf3, 0xee, 0xfe, 0xff, 0xff, 0x81,
+    0xff, 0xff, 0xfd, 0x24, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xf3, 0xfa, 0xff, 0xe7, 0xef, 0xfc, 0xce, 0xeb, 0xfd, 0xcd, 0xe8,
+    0xfb, 0xd0, 0xea, 0xfb, 0xda, 0xef, 0xff, 0xe7, 0xf5, 0xff, 0xf0, 0xf7, 0xfd, 0xfd, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xf9,
+    0xfa, 0xff, 0xfa, 0xf7, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xdd, 0xf0, 0xff, 0xb4, 0xd8, 0xf2, 0x9b, 0xc9, 0xea, 0xa1, 0xd6, 0xfe, 0xa0, 0xd5,
+    0xfd, 0xa1, 0xd6, 0xfe, 0xa3, 0xd7, 0xfe, 0xa4, 0xd6, 0xf9, 0xa6, 0xd3, 0xf4, 0xab, 0xd4, 0xf2, 0xb1, 0xd8, 0xf5, 0xe3, 0xf5, 0xff, 0xf8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xf8, 0x88, 0xff, 0xff, 0xff, 0x81,
+    0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x07, 0xc2, 0xe5, 0xfb, 0xa2, 0xd0, 0xf2, 0x6b, 0xa8, 0xd7, 0x6a, 0xa6, 0xd8, 0x99, 0xc6, 0xed, 0xca,
+    0xe3, 0xf9, 0xf3, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0x82, 0xff, 0xff, 0xfd, 0x24, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xea, 0xf8, 0xff, 0xd1, 0xe6,
+    0xf9, 0xbf, 0xd9, 0xf0, 0xac, 0xda, 0xfc, 0xa7, 0xd5, 0xf6, 0xa9, 0xd4, 0xf4, 0xb3, 0xd8, 0xf3, 0xc2, 0xdd, 0xf2, 0xd6, 0xe4, 0xef, 0xef, 0xf3,
+    0xf6, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xe8, 0xfa, 0xff, 0xc2, 0xe0, 0xf8, 0xa8, 0xd3,
+    0xf3, 0xa1, 0xd5, 0xfa, 0xa4, 0xd6, 0xfb, 0xa0, 0xd2, 0xf7, 0x9e, 0xd0, 0xf3, 0xa1, 0xd1, 0xf5, 0xa3, 0xd1, 0xf3, 0xa2, 0xcf, 0xf0, 0xa3, 0xce,
+    0xee, 0xa5, 0xd1, 0xee, 0xcc, 0xe7, 0xfc, 0xeb, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x84, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff,
+    0x06, 0xf5, 0xff, 0xff, 0xe5, 0xfc, 0xff, 0x90, 0xb3, 0xcf, 0x89, 0xac, 0xca, 0xde, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xf1, 0xf5, 0xf6, 0x81, 0xff,
+    0xff, 0xfd, 0x07, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xee, 0xfd, 0xff, 0xcc, 0xe7, 0xf8, 0xaf, 0xd7, 0xf0, 0xa3, 0xd2, 0xf0,
+    0x9f, 0xd3, 0xf8, 0x81, 0x9b, 0xcf, 0xf4, 0x0f, 0xa1, 0xd1, 0xf5, 0xa9, 0xd2, 0xf0, 0xb7, 0xd6, 0xeb, 0xd3, 0xe6, 0xf5, 0xed, 0xfa, 0xff, 0xff,
+    0xfe, 0xff, 0xf5, 0xfa, 0xff, 0xea, 0xf6, 0xff, 0xdc, 0xf1, 0xff, 0xc7, 0xe7, 0xff, 0xb1, 0xda, 0xf8, 0xa5, 0xd5, 0xf9, 0xa5, 0xd9, 0xfe, 0xa8,
+    0xd9, 0xfa, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0x81, 0xa5, 0xd6, 0xf7, 0x81, 0xa4, 0xd5, 0xf6, 0x0c, 0xa7, 0xd7, 0xfb, 0xc1, 0xdc, 0xf1, 0xe5,
+    0xf5, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xfa, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe,
+    0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0x82, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00,
+    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf6, 0xf0, 0xf5, 0xf8, 0xd0, 0xde, 0xeb, 0xd6, 0xe3, 0xf3, 0xee, 0xf2, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xfe,
+    0xf8, 0xff, 0xfe, 0xf7, 0xff, 0xfe, 0xfb, 0xfd, 0xfc, 0xf8, 0xfe, 0xfe, 0xfc, 0xf8, 0xff, 0xff, 0xdd, 0xf1, 0xfa, 0xb5, 0xda, 0xed, 0x9e, 0xd1,
+    0xee, 0x9b, 0xd7, 0xfb, 0xa4, 0xd5, 0xf5, 0xa2, 0xd4, 0xf7, 0xa2, 0xd8, 0xfe, 0xa4, 0xd9, 0xff, 0xa3, 0xd5, 0xfa, 0xa6, 0xd1, 0xf1, 0xba, 0xdc,
+    0xf7, 0xd2, 0xee, 0xff, 0xf9, 0xf9, 0xfb, 0xe5, 0xec, 0xf4, 0xc7, 0xda, 0xe9, 0xb1, 0xcf, 0xe9, 0xa8, 0xd1, 0xf1, 0xa8, 0xd6, 0xfa, 0xa2, 0xd4,
+    0xf9, 0x9b, 0xcd, 0xf2, 0x81, 0xa0, 0xd1, 0xf2, 0x0d, 0xa2, 0xd3, 0xf4, 0xa4, 0xd6, 0xf7, 0xa3, 0xd5, 0xf8, 0x9d, 0xd1, 0xf6, 0x9b, 0xd1, 0xf7,
+    0x9d, 0xd4, 0xfb, 0xc3, 0xdc, 0xf0, 0xea, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0xff, 0xfd, 0xf9, 0x81, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc,
+    0xfc, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x81, 0xfd, 0xfd, 0xff, 0x81, 0xff, 0xfe, 0xff,
+    0x0b, 0xfd, 0xfc, 0xfa, 0xfc, 0xfc, 0xfa, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xf8, 0xff, 0xfa, 0xf4, 0xff, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xb7, 0xd9,
+    0xf2, 0x9f, 0xd1, 0xf6, 0xa4, 0xdb, 0xff, 0x9f, 0xd4, 0xfc, 0xa2, 0xd3, 0xf4, 0x81, 0xa4, 0xd5, 0xf6, 0x0e, 0xa3, 0xd4, 0xf5, 0xa1, 0xd2, 0xf3,
+    0xa4, 0xd5, 0xf6, 0xaa, 0xdb, 0xfc, 0xb0, 0xe1, 0xff, 0xb5, 0xe1, 0xff, 0xad, 0xdb, 0xfd, 0xa6, 0xd4, 0xf6, 0xa0, 0xd1, 0xf2, 0xa1, 0xd3, 0xf4,
+    0xa4, 0xd6, 0xf7, 0xa2, 0xd7, 0xf7, 0xa1, 0xd6, 0xf6, 0xa5, 0xd6, 0xf7, 0xa4, 0xd5, 0xf6, 0x84, 0xa3, 0xd4, 0xf5, 0x05, 0xa4, 0xd5, 0xf6, 0xbb,
+    0xd9, 0xe4, 0xdf, 0xf6, 0xfe, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xfb, 0x81, 0xff, 0xfd, 0xff, 0x08, 0xfe, 0xfd, 0xff, 0xff, 0xfd,
+    0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xfb, 0xff, 0xfd, 0xfa, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xfe, 0xf8, 0xfe, 0xfe, 0x81, 0xff,
+    0xff, 0xff, 0x01, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0x10, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfc,
+    0xfd, 0xfc, 0xfb, 0xf9, 0xfc, 0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0xfd, 0xee, 0xfb, 0xff, 0xb9, 0xd9,
+    0xf0, 0xa2, 0xcf, 0xf0, 0xa6, 0xd6, 0xfa, 0xa1, 0xcf, 0xf1, 0xa3, 0xd4, 0xf5, 0x81, 0xa5, 0xd6, 0xf7, 0x0c, 0xa3, 0xd4, 0xf5, 0xa1, 0xd2, 0xf3,
+    0xa2, 0xd3, 0xf4, 0xa7, 0xd8, 0xf9, 0xab, 0xdc, 0xfd, 0xad, 0xd9, 0xfc, 0xa8, 0xd6, 0xf8, 0xa4, 0xd2, 0xf4, 0xa1, 0xd2, 0xf3, 0xa4, 0xd5, 0xf6,
+    0xa4, 0xd6, 0xf7, 0xa1, 0xd6, 0xf6, 0x9f, 0xd4, 0xf4, 0x81, 0xa4, 0xd5, 0xf6, 0x83, 0xa3, 0xd4, 0xf5, 0x81, 0xa4, 0xd5, 0xf6, 0x0f, 0xde, 0xec,
+    0xf9, 0xf2, 0xfb, 0xff, 0xfc, 0xfd, 0xff, 0xfc, 0xf8, 0xf5, 0xff, 0xfc, 0xf9, 0xfd, 0xff, 0xfe, 0xf3, 0xfc, 0xff, 0xef, 0xfd, 0xff, 0xd9, 0xec,
+    0xfd, 0xd4, 0xe7, 0xf8, 0xd1, 0xe4, 0xf3, 0xd8, 0xe8, 0xf7, 0xe7, 0xf4, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0x81, 0xff,
+    0xff, 0xff, 0x01, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x81, 0xff, 0xfc, 0xfd, 0x0e,
+    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf5, 0xfa, 0xfd, 0xf6, 0xfe, 0xff, 0xe4, 0xf5, 0xff, 0xbb, 0xdb, 0xf2,
+    0xa7, 0xd2, 0xf2, 0xab, 0xd6, 0xf6, 0xa6, 0xcf, 0xed, 0xa3, 0xd4, 0xf5, 0xa5, 0xd6, 0xf7, 0xa6, 0xd7, 0xf8, 0xa4, 0xd5, 0xf6, 0x81, 0xa1, 0xd2,
+    0xf3, 0x09, 0xa3, 0xd4, 0xf5, 0xa6, 0xd7, 0xf8, 0xa4, 0xd2, 0xf4, 0xa3, 0xd1, 0xf3, 0xa0, 0xd1, 0xf2, 0xa2, 0xd3, 0xf4, 0xa5, 0xd6, 0xf7, 0xa5,
+    0xd7, 0xf8, 0xa2, 0xd4, 0xf5, 0x9f, 0xd1, 0xf2, 0x84, 0xa3, 0xd4, 0xf5, 0x00, 0xa4, 0xd5, 0xf6, 0x81, 0xa5, 0xd6, 0xf7, 0x13, 0xee, 0xf1, 0xff,
+    0xf7, 0xf9, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xee, 0xfd, 0xff, 0xcf, 0xea, 0xf1, 0xc1, 0xe1, 0xec, 0xac, 0xda, 0xfc,
+    0xa6, 0xd6, 0xfa, 0xa4, 0xd4, 0xf8, 0xab, 0xd8, 0xf9, 0xbe, 0xe0, 0xfb, 0xd9, 0xec, 0xfb, 0xf3, 0xf8, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xfe, 0xfe,
+    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xff, 0x0f, 0xfc, 0xff, 0xff,
+    0xf5, 0xfe, 0xff, 0xe8, 0xf5, 0xfb, 0xd5, 0xf0, 0xff, 0xd2, 0xe9, 0xf9, 0xd4, 0xea, 0xf8, 0xca, 0xe6, 0xfb, 0xb0, 0xd7, 0xf4, 0xa7, 0xd5, 0xf7,
+    0xab, 0xd9, 0xfb, 0xaa, 0xd3, 0xf1, 0xa2, 0xd3, 0xf4, 0xa4, 0xd5, 0xf6, 0xa5, 0xd6, 0xf7, 0xa4, 0xd5, 0xf6, 0xa2, 0xd3, 0xf4, 0x81, 0xa1, 0xd2,
+    0xf3, 0x04, 0xa2, 0xd3, 0xf4, 0xa1, 0xd2, 0xf3, 0xa0, 0xd1, 0xf2, 0xa1, 0xd2, 0xf3, 0xa3, 0xd4, 0xf5, 0x81, 0xa5, 0xd6, 0xf7, 0x01, 0xa3, 0xd4,
+    0xf5, 0xa0, 0xd2, 0xf3, 0x83, 0xa2, 0xd3, 0xf4, 0x17, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa5, 0xd6, 0xf7, 0xa6, 0xd7, 0xf8, 0xd1, 0xe3, 0xf9,
+    0xd6, 0xe7, 0xfb, 0xdd, 0xed, 0xfc, 0xeb, 0xfb, 0xff, 0xef, 0xff, 0xff, 0xd4, 0xef, 0xff, 0xb0, 0xd5, 0xe8, 0xa1, 0xcb, 0xe3, 0x9f, 0xd1, 0xf2,
+    0x9f, 0xd7, 0xfc, 0x9d, 0xda, 0xff, 0x9c, 0xd7, 0xff, 0x9f, 0xd0, 0xf8, 0xb4, 0xd3, 0xef, 0xda, 0xe8, 0xf5, 0xfa, 0xfb, 0xff, 0xfc, 0xfc, 0xfc,
+    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xfe, 0xff, 0x10, 0xfc, 0xff, 0xff,
+    0xf2, 0xfc, 0xff, 0xda, 0xed, 0xfb, 0xc4, 0xe0, 0xee, 0xab, 0xd9, 0xfb, 0xac, 0xd5, 0xf3, 0xb0, 0xd5, 0xf0, 0xaa, 0xd5, 0xf5, 0x9e, 0xd2, 0xf9,
+    0x9c, 0xd3, 0xfc, 0xa1, 0xd5, 0xfd, 0xa3, 0xd3, 0xf7, 0xa1, 0xd2, 0xf3, 0xa2, 0xd3, 0xf4, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5,
+    0x82, 0xa2, 0xd3, 0xf4, 0x01, 0xa3, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0x81, 0xa2, 0xd3, 0xf4, 0x82, 0xa3, 0xd4, 0xf5, 0x84, 0xa2, 0xd3, 0xf4, 0x17,
+    0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa5, 0xd6, 0xf7, 0xa6, 0xd7, 0xf8, 0xa7, 0xd9, 0xf4, 0xa8, 0xd6, 0xf0, 0xaa, 0xd4, 0xec, 0xb7, 0xdb, 0xf5,
+    0xbf, 0xe2, 0xfe, 0xb5, 0xd9, 0xf9, 0xa7, 0xcf, 0xf3, 0xa8, 0xd4, 0xfb, 0xac, 0xd2, 0xe9, 0xa9, 0xd6, 0xf3, 0xa5, 0xdb, 0xff, 0x9d, 0xd8, 0xff,
+    0x97, 0xce, 0xf7, 0xa1, 0xcc, 0xee, 0xc1, 0xdd, 0xf5, 0xde, 0xef, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+    0x0f, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xf2, 0xfb, 0xff, 0xd5, 0xea, 0xfb, 0xb6, 0xd9, 0xef, 0xa4, 0xcd,
+    0xe9, 0x99, 0xd2, 0xfd, 0x9f, 0xd1, 0xf6, 0xa2, 0xd0, 0xf2, 0x9f, 0xd1, 0xf6, 0x9a, 0xd3, 0xfe, 0x98, 0xd5, 0xff, 0x9e, 0xd5, 0xfe, 0xa3, 0xd5,
+    0xfa, 0x81, 0xa1, 0xd2, 0xf3, 0x01, 0xa2, 0xd3, 0xf4, 0xa3, 0xd4, 0xf5, 0x81, 0xa4, 0xd5, 0xf6, 0x81, 0xa3, 0xd4, 0xf5, 0x03, 0xa5, 0xd7, 0xf8,
+    0xa4, 0xd6, 0xf7, 0xa3, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0x81, 0xa2, 0xd3, 0xf4, 0x01, 0xa5, 0xd3, 0xf5, 0xa6, 0xd4, 0xf6, 0x84, 0xa3, 0xd4, 0xf5,
+    0x00, 0xa4, 0xd5, 0xf6, 0x81, 0xa5, 0xd6, 0xf7, 0x10, 0x98, 0xda, 0xfc, 0x99, 0xd8, 0xf9, 0x99, 0xd1, 0xf2, 0x9e, 0xd0, 0xf1, 0xa6, 0xd4, 0xf6,
+    0xa3, 0xcf, 0xf6, 0xa2, 0xcd, 0xf8, 0xab, 0xd7, 0xff, 0xb4, 0xd4, 0xe9, 0xab, 0xd0, 0xea, 0xa1, 0xcf, 0xf0, 0x9f, 0xd3, 0xf8, 0xa0, 0xd4, 0xfb,
+    0xa4, 0xd5, 0xf6, 0xb3, 0xda, 0xf9, 0xc1, 0xe3, 0xfe, 0xf9, 0xf9, 0xf9, 0x82, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xfb, 0xfe,
+    0xfc, 0xfd, 0xfa, 0xfd, 0xff, 0xe2, 0xef, 0xff, 0xba, 0xd8, 0xf0, 0xa0, 0xce, 0xf0, 0x98, 0xd2, 0xf8, 0x9d, 0xd4, 0xfd, 0xa6, 0xd6, 0xfc, 0xa7,
+    0xd4, 0xf5, 0xa5, 0xd3, 0xf5, 0xa3, 0xd8, 0xff, 0x9e, 0xd7, 0xff, 0xa0, 0xd4, 0xfb, 0xa9, 0xd5, 0xf8, 0x81, 0xa3, 0xd4, 0xf5, 0x01, 0xa2, 0xd3,
+    0xf4, 0xa3, 0xd4, 0xf5, 0x82, 0xa4, 0xd5, 0xf6, 0x00, 0xa3, 0xd4, 0xf5, 0x81, 0xa1, 0xd6, 0xf6, 0x05, 0xa3, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa2,
+    0xd3, 0xf4, 0xa4, 0xd2, 0xf4, 0xa5, 0xd3, 0xf5, 0xa7, 0xd3, 0xf6, 0x81, 0xa4, 0xd5, 0xf6, 0x83, 0xa3, 0xd4, 0xf5, 0x81, 0xa4, 0xd5, 0xf6, 0x10,
+    0x9e, 0xd8, 0xfe, 0xa5, 0xdd, 0xff, 0xa3, 0xd9, 0xfd, 0xa5, 0xd7, 0xfa, 0xa8, 0xd9, 0xfa, 0xa3, 0xd3, 0xf7, 0x9d, 0xcf, 0xf4, 0xa1, 0xd3, 0xf8,
+    0xab, 0xd8, 0xf9, 0xa1, 0xcf, 0xf0, 0x9c, 0xcd, 0xee, 0xa2, 0xd2, 0xf6, 0xa6, 0xd7, 0xf8, 0xa7, 0xd5, 0xf6, 0xab, 0xd8, 0xf7, 0xb1, 0xde, 0xfb,
+    0xf7, 0xf7, 0xf7, 0x82, 0xff, 0xff, 0xff, 0x11, 0xff, 0xfe, 0xfb, 0xfe, 0xfa, 0xf7, 0xfe, 0xfc, 0xfd, 0xf7, 0xfb, 0xff, 0xd7, 0xe8, 0xfa, 0xab,
+    0xd0, 0xed, 0x98, 0xcf, 0xf6, 0x9d, 0xe0, 0xff, 0x9f, 0xd1, 0xf6, 0xaa, 0xd5, 0xf7, 0xab, 0xd2, 0xef, 0xa9, 0xd2, 0xf0, 0xa7, 0xd7, 0xfb, 0xa3,
+    0xd5, 0xfa, 0xa2, 0xd0, 0xf2, 0xab, 0xd2, 0xef, 0xa6, 0xd7, 0xf8, 0xa4, 0xd5, 0xf6, 0x82, 0xa3, 0xd4, 0xf5, 0x00, 0xa4, 0xd5, 0xf6, 0x81, 0xa3,
+    0xd4, 0xf5, 0x01, 0x9d, 0xd2, 0xf2, 0x9f, 0xd4, 0xf4, 0x81, 0xa3, 0xd5, 0xf6, 0x00, 0xa4, 0xd5, 0xf6, 0x81, 0xa5, 0xd3, 0xf5, 0x02, 0xa6, 0xd2,
+    0xf5, 0xa5, 0xd6, 0xf7, 0xa4, 0xd5, 0xf6, 0x84, 0xa3, 0xd4, 0xf5, 0x12, 0xa4, 0xd5, 0xf6, 0xa3, 0xce, 0xf8, 0xa9, 0xd5, 0xfc, 0xa6, 0xd2, 0xf7,
+    0xa2, 0xcf, 0xf0, 0xa7, 0xd6, 0xf4, 0xa4, 0xd7, 0xf4, 0x9f, 0xd7, 0xf2, 0xa1, 0xda, 0xf5, 0x9d, 0xda, 0xff, 0x9c, 0xd5, 0xff, 0x9f, 0xd4, 0xfc,
+    0xa6, 0xd8, 0xfb, 0xa5, 0xd3, 0xf4, 0xa0, 0xcf, 0xeb, 0xa5, 0xd4, 0xf0, 0xb0, 0xdf, 0xfb, 0xf6, 0xf6, 0xf6, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff,
+    0xff, 0x07, 0xf6, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfd, 0xf8, 0xee, 0xf3, 0xf6, 0xb6, 0xd3, 0xe5, 0x9c, 0xc9, 0xe6, 0xa3, 0xd2, 0xec, 0xa6,
+    0xd1, 0xe4, 0x87, 0x99, 0xcf, 0xeb, 0x8f, 0x9c, 0xcd, 0xeb, 0x8f, 0x99, 0xcf, 0xeb, 0x0b, 0x99, 0xca, 0xeb, 0x9f, 0xd1, 0xf2, 0x9a, 0xcf, 0xee,
+    0x95, 0xcd, 0xe8, 0x99, 0xcf, 0xeb, 0x9d, 0xcf, 0xea, 0xa3, 0xd1, 0xeb, 0xae, 0xd7, 0xf3, 0xf4, 0xf5, 0xf0, 0xf2, 0xf4, 0xf1, 0xfb, 0xff, 0xfe,
+    0xfc, 0xff, 0xff, 0x07, 0xfb, 0xff, 0xff, 0xe1, 0xdd, 0xd4, 0xbd, 0xb1, 0xa5, 0xa0, 0x99, 0x93, 0x82, 0x8b, 0x92, 0x7e, 0x8f, 0xa1, 0x80, 0x90,
+    0xa0, 0x77, 0x7f, 0x8c, 0x87, 0x81, 0x86, 0x99, 0x8f, 0x83, 0x86, 0x99, 0x8f, 0x81, 0x86, 0x99, 0x0b, 0x81, 0x83, 0x98, 0x86, 0x88, 0x9d, 0x80,
+    0x87, 0x9a, 0x7d, 0x84, 0x96, 0x82, 0x88, 0x98, 0x84, 0x87, 0x98, 0x88, 0x87, 0x97, 0x90, 0x8c, 0x9d, 0xa4, 0x9b, 0x96, 0xbe, 0xb9, 0xb5, 0xe5,
+    0xe1, 0xe0, 0xff, 0xff, 0xff, 0x07, 0xd0, 0xd3, 0xc8, 0x84, 0x7d, 0x6d, 0x4f, 0x3e, 0x2c, 0x4a, 0x37, 0x28, 0x48, 0x36, 0x32, 0x46, 0x36, 0x37,
+    0x4a, 0x36, 0x38, 0x4c, 0x30, 0x2f, 0xa7, 0x4e, 0x32, 0x2f, 0x0b, 0x4c, 0x30, 0x2f, 0x50, 0x34, 0x33, 0x4b, 0x31, 0x30, 0x4a, 0x31, 0x2d, 0x4f,
+    0x36, 0x32, 0x4f, 0x33, 0x30, 0x4e, 0x2f, 0x2c, 0x55, 0x33, 0x31, 0x49, 0x35, 0x2e, 0x56, 0x45, 0x3e, 0x81, 0x76, 0x72, 0xf8, 0xf2, 0xf2, 0x07,
+    0xd1, 0xca, 0xc2, 0x6c, 0x60, 0x54, 0x39, 0x23, 0x15, 0x4e, 0x32, 0x24, 0x56, 0x39, 0x2b, 0x4b, 0x2b, 0x20, 0x51, 0x2d, 0x21, 0x5f, 0x39, 0x2e,
+    0xa7, 0x4d, 0x36, 0x24, 0x01, 0x4c, 0x35, 0x23, 0x4f, 0x38, 0x26, 0x81, 0x4b, 0x36, 0x23, 0x07, 0x52, 0x3b, 0x29, 0x4e, 0x37, 0x25, 0x4a, 0x33,
+    0x21, 0x51, 0x37, 0x26, 0x50, 0x32, 0x28, 0x3f, 0x24, 0x1d, 0x69, 0x56, 0x52, 0xff, 0xf6, 0xf4, 0x07, 0xf2, 0xe2, 0xe3, 0x8e, 0x7e, 0x7e, 0x4f,
+    0x3c, 0x38, 0x51, 0x39, 0x2f, 0x56, 0x36, 0x27, 0x4e, 0x2e, 0x19, 0x4d, 0x2e, 0x1a, 0x4e, 0x33, 0x20, 0xa7, 0x4c, 0x35, 0x25, 0x0b, 0x4b, 0x34,
+    0x22, 0x4d, 0x36, 0x24, 0x4a, 0x33, 0x21, 0x4c, 0x35, 0x25, 0x51, 0x3a, 0x2a, 0x4c, 0x35, 0x25, 0x48, 0x33, 0x22, 0x4f, 0x3a, 0x29, 0x53, 0x35,
+    0x2b, 0x58, 0x3d, 0x36, 0x90, 0x7d, 0x79, 0xff, 0xf8, 0xf6, 0x07, 0xff, 0xf9, 0xff, 0xdf, 0xd2, 0xdb, 0xb7, 0xab, 0xaf, 0x98, 0x85, 0x7f, 0x7e,
+    0x61, 0x4f, 0x7a, 0x5a, 0x41, 0x7b, 0x61, 0x48, 0x6c, 0x5a, 0x46, 0xa7, 0x80, 0x55, 0x4c, 0x0b, 0x80, 0x56, 0x4a, 0x81, 0x57, 0x4b, 0x80, 0x54,
+    0x4b, 0x82, 0x56, 0x4d, 0x85, 0x59, 0x50, 0x7f, 0x54, 0x4d, 0x7c, 0x56, 0x4d, 0x88, 0x63, 0x5a, 0x9b, 0x87, 0x80, 0xba, 0xa9, 0xa2, 0xdd, 0xd2,
+    0xce, 0xff, 0xfd, 0xfd, 0x00, 0xff, 0xfd, 0xfe, 0x81, 0xff, 0xfe, 0xff, 0x04, 0xe7, 0xda, 0xd4, 0xb9, 0x99, 0x84, 0xab, 0x82, 0x66, 0xae, 0x89,
+    0x6f, 0xa4, 0x87, 0x75, 0x87, 0xb0, 0x7f, 0x70, 0x8f, 0xaf, 0x80, 0x70, 0x8f, 0xb0, 0x7f, 0x70, 0x0b, 0xae, 0x7f, 0x6b, 0xb1, 0x81, 0x6d, 0xb1,
+    0x7e, 0x6d, 0xb3, 0x7e, 0x6e, 0xb4, 0x80, 0x72, 0xac, 0x7d, 0x6d, 0xae, 0x83, 0x73, 0xbf, 0x95, 0x85, 0xf0, 0xe7, 0xe2, 0xff, 0xfe, 0xfa, 0xff,
+    0xfe, 0xfd, 0xff, 0xff, 0xff, 0x07, 0xf7, 0xfe, 0xf7, 0xf3, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xf0, 0xe6, 0xdd, 0xca, 0xa4, 0x8d, 0xb2, 0x7d, 0x5e,
+    0xaf, 0x7b, 0x63, 0xaa, 0x7f, 0x6f, 0x87, 0xa8, 0x84, 0x64, 0x8f, 0xa7, 0x84, 0x64, 0x8f, 0xa8, 0x84, 0x64, 0x0b, 0xa6, 0x84, 0x5f, 0xaa, 0x86,
+    0x62, 0xaa, 0x83, 0x62, 0xac, 0x83, 0x63, 0xab, 0x84, 0x65, 0xa3, 0x80, 0x62, 0xa8, 0x89, 0x6a, 0xbb, 0xa0, 0x82, 0xe7, 0xe8, 0xe3, 0xfe, 0xff,
+    0xfd, 0xf7, 0xfb, 0xfa, 0xfc, 0xff, 0xff, 0x07, 0xff, 0xff, 0xfb, 0xfa, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xf0, 0xe7, 0xe2, 0xc2, 0xa8, 0x99, 0xa9,
+    0x83, 0x6c, 0xa5, 0x7b, 0x63, 0xaa, 0x81, 0x6b, 0xa7, 0xad, 0x81, 0x68, 0x09, 0xb0, 0x7f, 0x5f, 0xad, 0x83, 0x6a, 0xa6, 0x80, 0x6d, 0xac, 0x81,
+    0x6e, 0xac, 0x7d, 0x63, 0xb1, 0x82, 0x66, 0xa6, 0x7e, 0x64, 0xc4, 0xa4, 0x8d, 0xed, 0xed, 0xed, 0xfd, 0xfd, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x07,
+    0xff, 0xff, 0xfb, 0xfc, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xf4, 0xeb, 0xe6, 0xca, 0xb0, 0xa1, 0xa9, 0x83, 0x6c, 0xa9, 0x7f, 0x67, 0xab, 0x81, 0x6b,
+    0xa7, 0xad, 0x81, 0x68, 0x09, 0xad, 0x7e, 0x60, 0xad, 0x83, 0x6a, 0xa6, 0x80, 0x6d, 0xae, 0x83, 0x70, 0xae, 0x7f, 0x65, 0xb2, 0x83, 0x67, 0xa6,
+    0x81, 0x66, 0xc8, 0xa9, 0x94, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x07, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xfa,
+    0xfe, 0xfb, 0xf3, 0xf0, 0xd5, 0xbe, 0xb0, 0xa6, 0x82, 0x6c, 0xab, 0x81, 0x69, 0xac, 0x82, 0x6a, 0xa7, 0xad, 0x81, 0x68, 0x09, 0xae, 0x7f, 0x61,
+    0xac, 0x82, 0x6a, 0xa9, 0x80, 0x6c, 0xaf, 0x85, 0x6f, 0xae, 0x7f, 0x65, 0xb0, 0x83, 0x66, 0xa8, 0x84, 0x6c, 0xcd, 0xb2, 0x9d, 0xf1, 0xf1, 0xf1,
+    0xfe, 0xfe, 0xfe, 0x81, 0xff, 0xff, 0xff, 0x07, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xff, 0xf5, 0xf8, 0xfd, 0xff, 0xfc, 0xfc, 0xdf, 0xc9, 0xbe, 0xa4,
+    0x7f, 0x6c, 0xab, 0x81, 0x69, 0xac, 0x82, 0x6a, 0xa7, 0xad, 0x81, 0x68, 0x08, 0xae, 0x81, 0x64, 0xac, 0x82, 0x6a, 0xa9, 0x80, 0x6c, 0xb2, 0x85,
+    0x70, 0xad, 0x7e, 0x64, 0xae, 0x80, 0x66, 0xa8, 0x85, 0x6f, 0xd1, 0xba, 0xa8, 0xf4, 0xf4, 0xf4, 0x82, 0xff, 0xff, 0xff, 0x07, 0xff, 0xfa, 0xf6,
+    0xfe, 0xff, 0xff, 0xf6, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xe5, 0xd3, 0xc9, 0xa8, 0x85, 0x71, 0xa9, 0x7f, 0x67, 0xae, 0x81, 0x6a, 0xa7, 0xad, 0x81,
+    0x68, 0x08, 0xaf, 0x82, 0x65, 0xac, 0x82, 0x6a, 0xa8, 0x7f, 0x6b, 0xb2, 0x85, 0x6e, 0xac, 0x7d, 0x61, 0xaa, 0x7e, 0x63, 0xa7, 0x88, 0x73, 0xd8,
+    0xc5, 0xb7, 0xf8, 0xf8, 0xf8, 0x82, 0xff, 0xff, 0xff, 0x06, 0xff, 0xfa, 0xf4, 0xfe, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xee, 0xdd,
+    0xd5, 0xb6, 0x95, 0x82, 0xa9, 0x7f, 0x67, 0xa8, 0xad, 0x81, 0x68, 0x0b, 0xb0, 0x84, 0x69, 0xab, 0x81, 0x69, 0xa7, 0x7e, 0x68, 0xb3, 0x85, 0x6e,
+    0xad, 0x7b, 0x60, 0xa9, 0x7d, 0x64, 0xab, 0x8e, 0x7c, 0xe3, 0xd2, 0xc8, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+    0x07, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xf7, 0xe8, 0xe1, 0xcc, 0xad, 0x9b, 0xac, 0x82, 0x6a, 0xac, 0x80,
+    0x67, 0xa7, 0xad, 0x81, 0x68, 0x0b, 0xb0, 0x84, 0x69, 0xaa, 0x80, 0x68, 0xa7, 0x7d, 0x67, 0xb3, 0x85, 0x6d, 0xae, 0x7c, 0x61, 0xa9, 0x7f, 0x66,
+    0xb2, 0x97, 0x86, 0xef, 0xe1, 0xd8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0x07, 0xff, 0xfe, 0xf8, 0xfc, 0xfd,
+    0xff, 0xf5, 0xfe, 0xff, 0xf8, 0xfb, 0xff, 0xfd, 0xf0, 0xea, 0xde, 0xbf, 0xad, 0xb0, 0x86, 0x6e, 0xac, 0x80, 0x67, 0xa7, 0xad, 0x81, 0x68, 0x07,
+    0xad, 0x83, 0x6a, 0xa8, 0x80, 0x67, 0xa6, 0x7c, 0x66, 0xb4, 0x86, 0x6e, 0xaf, 0x7d, 0x62, 0xac, 0x82, 0x69, 0xb7, 0x9d, 0x8c, 0xf9, 0xec, 0xe4,
+    0x81, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xfa, 0xfb, 0xf6, 0xfc, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xda, 0xcf, 0xcb, 0xb4, 0x93, 0x84, 0xaf, 0x7d, 0x64, 0xac, 0x83, 0x6d, 0xa7, 0x7e, 0x68, 0xa8, 0x7f, 0x69, 0xa9, 0x80, 0x6a,
+    0xa7, 0x7f, 0x66, 0xad, 0x83, 0x6b, 0xaf, 0x85, 0x6c, 0xa9, 0x7d, 0x62, 0x9f, 0xad, 0x81, 0x68, 0x08, 0xb5, 0x81, 0x73, 0xa7, 0x7a, 0x63, 0xa8,
+    0x80, 0x5d, 0xb4, 0x86, 0x64, 0xb3, 0x7d, 0x63, 0xab, 0x80, 0x70, 0xc7, 0xb6, 0xaf, 0xef, 0xf8, 0xf5, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe,
+    0x00, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfd, 0xf9, 0x81, 0xfe, 0xff, 0xff, 0x0a, 0xeb, 0xe1, 0xdf, 0xc4, 0xa7,
+    0x99, 0xaa, 0x7c, 0x64, 0xab, 0x81, 0x69, 0xa7, 0x7d, 0x65, 0xaa, 0x80, 0x68, 0xab, 0x81, 0x69, 0xa8, 0x7e, 0x66, 0xab, 0x81, 0x68, 0xaf, 0x85,
+    0x6c, 0xa9, 0x7f, 0x66, 0x9f, 0xad, 0x81, 0x68, 0x08, 0xb4, 0x80, 0x72, 0xad, 0x80, 0x69, 0xab, 0x82, 0x62, 0xad, 0x80, 0x5f, 0xae, 0x7c, 0x63,
+    0xb7, 0x90, 0x81, 0xd9, 0xca, 0xc3, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xfa, 0xfa,
+    0x81, 0xff, 0xff, 0xfb, 0x0c, 0xfb, 0xfd, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xf5, 0xdd, 0xc5, 0xb9, 0xaa, 0x84, 0x6f, 0xae, 0x82, 0x67, 0xab,
+    0x7d, 0x63, 0xaf, 0x81, 0x67, 0xb2, 0x84, 0x6a, 0xab, 0x7f, 0x64, 0xab, 0x7f, 0x66, 0xad, 0x83, 0x6a, 0xab, 0x81, 0x69, 0x9f, 0xad, 0x81, 0x68,
+    0x08, 0xac, 0x7b, 0x6a, 0xb0, 0x83, 0x6c, 0xac, 0x83, 0x65, 0xa5, 0x79, 0x5c, 0xa9, 0x7f, 0x69, 0xc6, 0xa6, 0x99, 0xed, 0xe0, 0xda, 0xfc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xfa, 0xfc, 0xfb, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfb, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xf0, 0xdf, 0xd5, 0xbb, 0x9e, 0x8c, 0xb1, 0x85, 0x6a, 0xab, 0x7e, 0x61, 0xaf, 0x82, 0x65, 0xb6, 0x87,
+    0x69, 0xaf, 0x80, 0x64, 0xab, 0x7d, 0x63, 0xad, 0x80, 0x69, 0xab, 0x81, 0x69, 0x9f, 0xad, 0x81, 0x68, 0x08, 0xa7, 0x7a, 0x65, 0xb3, 0x86, 0x6f,
+    0xae, 0x84, 0x6b, 0xa2, 0x7a, 0x61, 0xaf, 0x8e, 0x7b, 0xd9, 0xc3, 0xb8, 0xf8, 0xf0, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe,
+    0xfe, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xff, 0xff, 0xfc, 0xfd, 0xf8, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0xf0, 0xe9, 0xd8, 0xc5, 0xb6, 0xb2, 0x8d, 0x73, 0xa7, 0x7d, 0x64, 0xaa, 0x7d, 0x60, 0xb3, 0x84, 0x66, 0xb0, 0x81, 0x63, 0xad, 0x7e, 0x64,
+    0xad, 0x80, 0x69, 0xab, 0x81, 0x6b, 0x9f, 0xad, 0x81, 0x68, 0x08, 0xa9, 0x7f, 0x67, 0xb3, 0x86, 0x6f, 0xad, 0x83, 0x6d, 0xa6, 0x83, 0x6f, 0xbd,
+    0xa6, 0x96, 0xec, 0xdf, 0xd6, 0xff, 0xfe, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x03, 0xfb,
+    0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0x81, 0xfb, 0xff, 0xff, 0x09, 0xfb, 0xf8, 0xf3, 0xf2, 0xe8, 0xdc, 0xc1, 0xa5,
+    0x90, 0xa9, 0x89, 0x72, 0xa3, 0x7b, 0x61, 0xae, 0x81, 0x64, 0xb0, 0x81, 0x65, 0xae, 0x7f, 0x65, 0xae, 0x80, 0x69, 0xae, 0x81, 0x6c, 0x9f, 0xad,
+    0x81, 0x68, 0x08, 0xaa, 0x82, 0x68, 0xac, 0x7f, 0x68, 0xa9, 0x7e, 0x6b, 0xb0, 0x90, 0x81, 0xcd, 0xbf, 0xb2, 0xf2, 0xf2, 0xea, 0xff, 0xff, 0xfd,
+    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xf9,
+    0xff, 0xfc, 0xfb, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf9, 0xfb, 0xf8, 0xff, 0xfe, 0xf5, 0xe3, 0xd0, 0xc2, 0xbc, 0xa2, 0x91, 0xa6, 0x83, 0x6d,
+    0xaa, 0x80, 0x67, 0xb0, 0x81, 0x65, 0xaf, 0x80, 0x66, 0xae, 0x80, 0x69, 0xad, 0x80, 0x6b, 0x9f, 0xad, 0x81, 0x68, 0x08, 0xa9, 0x84, 0x67, 0xa9,
+    0x7c, 0x65, 0xb5, 0x87, 0x78, 0xce, 0xb0, 0xa5, 0xe8, 0xe1, 0xd7, 0xf7, 0xfe, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x81,
+    0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xf6, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xf9, 0xf8, 0xfc, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xf8, 0xfe, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xf5, 0xec, 0xd0, 0xbd, 0xaf, 0xae, 0x8f, 0x7b, 0xad, 0x85, 0x6c, 0xb0, 0x82, 0x68, 0xaf,
+    0x80, 0x66, 0xae, 0x7e, 0x68, 0xab, 0x7c, 0x68, 0x9f, 0xad, 0x81, 0x68, 0x08, 0xab, 0x88, 0x6a, 0xaf, 0x82, 0x6b, 0xc9, 0x9b, 0x8c, 0xf0, 0xd4,
+    0xc9, 0xff, 0xff, 0xf6, 0xf8, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff,
+    0x87, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xfd, 0xf0, 0xed, 0xe8, 0xcd, 0xc0, 0xb8, 0xac, 0x96, 0x88, 0xa3, 0x82, 0x6f, 0xac, 0x82, 0x6a, 0xb4,
+    0x81, 0x64, 0xb1, 0x7a, 0x5b, 0x81, 0xaf, 0x7f, 0x68, 0x84, 0xb0, 0x80, 0x69, 0x90, 0xaf, 0x7f, 0x68, 0x0f, 0xac, 0x82, 0x69, 0xaa, 0x80, 0x67,
+    0xa8, 0x7e, 0x65, 0xab, 0x81, 0x69, 0xae, 0x86, 0x6d, 0xaf, 0x87, 0x6e, 0xab, 0x83, 0x6a, 0xa7, 0x7e, 0x68, 0x9a, 0x7d, 0x6d, 0xc3, 0xab, 0x9f,
+    0xec, 0xdf, 0xd9, 0xfe, 0xf8, 0xf8, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfd, 0xfc, 0xf8, 0x81, 0xff, 0xff, 0xff, 0x01, 0xf9,
+    0xf9, 0xf9, 0xff, 0xff, 0xff, 0x87, 0xfd, 0xfd, 0xfd, 0x07, 0xf9, 0xf9, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0xfc, 0xf5, 0xde, 0xcd, 0xc3, 0xb0, 0x96,
+    0x87, 0x9d, 0x7a, 0x67, 0xa3, 0x7a, 0x64, 0xb0, 0x83, 0x6c, 0x83, 0xae, 0x80, 0x68, 0x82, 0xad, 0x7f, 0x67, 0x00, 0xae, 0x80, 0x68, 0x8f, 0xaf,
+    0x81, 0x69, 0x10, 0xaa, 0x7e, 0x63, 0xb0, 0x84, 0x69, 0xb2, 0x88, 0x6f, 0xad, 0x85, 0x6b, 0xa4, 0x7c, 0x63, 0x9f, 0x79, 0x62, 0xa5, 0x81, 0x69,
+    0xad, 0x89, 0x73, 0xd1, 0xb9, 0xad, 0xe9, 0xd6, 0xcf, 0xfd, 0xf3, 0xf1, 0xff, 0xfd, 0xfe, 0xfb, 0xfc, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xfd,
+    0xff, 0xfe, 0xfb, 0xf7, 0xf7, 0xf7, 0x81, 0xff, 0xff, 0xff, 0x00, 0xf3, 0xf3, 0xf3, 0x87, 0xff, 0xff, 0xff, 0x0a, 0xf5, 0xf7, 0xf6, 0xfd, 0xfd,
+    0xfb, 0xff, 0xfe, 0xfb, 0xff, 0xf7, 0xf3, 0xf7, 0xe6, 0xde, 0xe0, 0xca, 0xbf, 0xbc, 0xa2, 0x95, 0x9e, 0x82, 0x74, 0xaa, 0x84, 0x6d, 0xa9, 0x83,
+    0x6c, 0xa8, 0x82, 0x6b, 0x82, 0xa6, 0x80, 0x69, 0x81, 0xa7, 0x81, 0x6a, 0x8f, 0xa8, 0x82, 0x6b, 0x13, 0xa6, 0x7e, 0x65, 0xa6, 0x81, 0x67, 0xa4,
+    0x80, 0x68, 0x9f, 0x7c, 0x66, 0xa1, 0x80, 0x6d, 0xb2, 0x95, 0x83, 0xd4, 0xb9, 0xa8, 0xee, 0xd3, 0xc2, 0xff, 0xf2, 0xec, 0xff, 0xfc, 0xfa, 0xff,
+    0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa,
+    0xfa, 0xfa, 0xff, 0xff, 0xff, 0x87, 0xfd, 0xfd, 0xfd, 0x0b, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xfe,
+    0xfb, 0xff, 0xfc, 0xfa, 0xfc, 0xf1, 0xed, 0xee, 0xe0, 0xdd, 0xdb, 0xc5, 0xb7, 0xd9, 0xc3, 0xb5, 0xd7, 0xc1, 0xb3, 0xd6, 0xc0, 0xb2, 0x81, 0xd5,
+    0xbf, 0xb1, 0x01, 0xd6, 0xc0, 0xb2, 0xd7, 0xc1, 0xb3, 0x8f, 0xd6, 0xc0, 0xb2, 0x10, 0xdd, 0xc3, 0xb2, 0xdc, 0xc5, 0xb5, 0xdf, 0xc9, 0xbb, 0xe4,
+    0xd0, 0xc5, 0xee, 0xdd, 0xd3, 0xfa, 0xeb, 0xe4, 0xff, 0xf7, 0xf1, 0xff, 0xfc, 0xf6, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfa,
+    0xfd, 0xff, 0xf9, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xf9, 0xf6, 0xfc, 0xfc, 0xfc, 0x82, 0xfd, 0xfd, 0xfd
+};
 
-static const uint8_t image_data_wash[10800] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf4, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xf9, 0xf6, 0xfd, 0xfd, 0xff, 0xe7, 0xeb, 0xf4, 0xa8, 0xca, 0xe6, 0xc0, 0xd6, 0xed, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xf8, 0xff, 0xfc, 0xf7, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xfd, 0xfe, 0xf9, 0xfc, 0xfc, 0xfc, 0xf8, 0xff, 0xff, 0xec, 0xfd, 0xff, 0x78, 0xa8, 0xd0, 0x93, 0xb7, 0xd7, 0xd8, 0xed, 0xff, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xfb, 0xfd, 0xfc, 0xf5, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfc, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfb, 0xf5, 0xfa, 0xfd, 0xc9, 0xde, 0xef, 0xaa, 0xcb, 0xea, 0x65, 0xa6, 0xdc, 0x6c, 0xa2, 0xd0, 0xa5, 0xca, 0xe7, 0xce, 0xdf, 0xef, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfd, 0xf7, 0xff, 0xfb, 0xf2, 0xff, 0xfb, 0xf8, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfb, 0xfc, 0xfb, 0xf9, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf1, 0xf6, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfb, 0xf1, 0xf8, 0xfe, 0xa1, 0xbd, 0xd3, 0x6e, 0x9a, 0xbf, 0x5f, 0xab, 0xe9, 0x52, 0x93, 0xc9, 0x7d, 0xaa, 0xd1, 0xa8, 0xc3, 0xd8, 0xe0, 0xea, 0xf3, 0xf8, 0xfa, 0xf9, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfa, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xf5, 0xff, 0xf8, 0xed, 0xfa, 0xfe, 0xff, 0xf3, 0xf4, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf3, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xf9, 0xf6, 0xff, 0xfe, 0xfb, 0xf9, 0xfe, 0xff, 0xbc, 0xd7, 0xec, 0x98, 0xc3, 0xe5, 0x62, 0xa8, 0xe3, 0x62, 0x9e, 0xd0, 0x97, 0xc3, 0xe6, 0xc5, 0xde, 0xf4, 0xf3, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfb, 0xfa, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xf9, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xf9, 0xd2, 0xe5, 0xf4, 0xc6, 0xd6, 0xe3, 0xf6, 0xff, 0xff, 0xfb, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfa, 0xf7, 0xff, 0xff, 0xff, 0xec, 0xfd, 0xff, 0xe3, 0xff, 0xff, 0x86, 0xb5, 0xdf, 0x96, 0xbe, 0xe1, 0xd4, 0xf0, 0xff, 0xf1, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfc, 0xfc, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xf0, 0xfd, 0xff, 0xe6, 0xf4, 0xff, 0x90, 0xbb, 0xdd, 0x92, 0xb5, 0xd1, 0xda, 0xf3, 0xff, 0xf4, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xf3, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xc2, 0xd7, 0xea, 0xc9, 0xda, 0xea, 0xf2, 0xfc, 0xff, 0xf7, 0xfb, 0xfe, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf6, 0xfb, 0xfd, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfb, 0xf4, 0xff, 0xff, 0xfd, 0xed, 0xfa, 0xff, 0xc8, 0xe3, 0xf8, 0xa4, 0xc9, 0xe6, 0x65, 0xa4, 0xd7, 0x6b, 0xa1, 0xcd, 0xa4, 0xcd, 0xed, 0xc3, 0xdc, 0xf0, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xff, 0xf3, 0xfa, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xf8, 0xf2, 0xff, 0xfd, 0xf4, 0xf9, 0xf5, 0xea, 0xfc, 0xff, 0xff, 0xf8, 0xf8, 0xfa, 0xff, 0xfe, 0xfd, 0xfe, 0xf9, 0xf5, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xff, 0xfc, 0xf1, 0xff, 0xfe, 0xfa, 0xe1, 0xf1, 0xfe, 0xa1, 0xc6, 0xe3, 0x67, 0x9b, 0xc3, 0x59, 0xa7, 0xe5, 0x5a, 0x9d, 0xd2, 0x71, 0xa5, 0xcd, 0x90, 0xb0, 0xc9, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xe3, 0xf5, 0xff, 0xd0, 0xea, 0xf9, 0xd0, 0xeb, 0xfc, 0xd9, 0xf3, 0xff, 0xed, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfe, 0xfd, 0xfb, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xfc, 0xfa, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfc, 0xfa, 0xfb, 0xfc, 0xff, 0xf4, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0xfd, 0xf7, 0xf4, 0xf3, 0xef, 0xd6, 0xe0, 0xea, 0xb0, 0xc8, 0xe0, 0x6c, 0xa9, 0xd8, 0x6d, 0x9e, 0xc6, 0xb5, 0xd5, 0xee, 0xcc, 0xda, 0xe5, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfc, 0xf9, 0xf7, 0xf8, 0xfa, 0xdb, 0xeb, 0xf8, 0xbf, 0xdd, 0xf5, 0xac, 0xd0, 0xe8, 0xae, 0xd3, 0xed, 0xbb, 0xde, 0xf4, 0xd9, 0xef, 0xfc, 0xf6, 0xfb, 0xfe, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xf6, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xfb, 0xfd, 0xfc, 0xff, 0xfe, 0xf9, 0xff, 0xfc, 0xfa, 0xfa, 0xfb, 0xff, 0xf6, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfb, 0xf3, 0xfc, 0xff, 0xd9, 0xee, 0xff, 0x83, 0xb3, 0xd9, 0x91, 0xb8, 0xd7, 0xe0, 0xf7, 0xff, 0xef, 0xf8, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfa, 0xf1, 0xf8, 0xfe, 0xc8, 0xe4, 0xfa, 0xa4, 0xd0, 0xf3, 0x9f, 0xd1, 0xf4, 0x9d, 0xcf, 0xf2, 0xa9, 0xd4, 0xf4, 0xc9, 0xe5, 0xfa, 0xee, 0xf7, 0xfe, 0xff, 0xfe, 0xfb, 0xff, 0xfd, 0xfa, 0xfd, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xf7, 0xff, 0xfb, 0xf5, 0xff, 0xfd, 0xf4, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xf2, 0xfb, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xc2, 0xde, 0xf4, 0xc9, 0xde, 0xef, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfa, 0xf1, 0xfb, 0xff, 0xbf, 0xe2, 0xfe, 0x94, 0xca, 0xf6, 0xa2, 0xdd, 0xff, 0x9c, 0xd6, 0xfe, 0xa2, 0xd4, 0xf7, 0xc1, 0xe1, 0xf8, 0xe6, 0xf3, 0xfb, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfb, 0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xfe, 0xf9, 0xff, 0xfe, 0xfb, 0xf8, 0xfd, 0xff, 0xe3, 0xf4, 0xfe, 0xd5, 0xea, 0xfb, 0xd9, 0xec, 0xfa, 0xe6, 0xf4, 0xfd, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xf7, 0xfe, 0xf9, 0xf3, 0xff, 0xfc, 0xf7, 0xfb, 0xfc, 0xfe, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf1, 0xf6, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xf5, 0xf2, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfb, 0xef, 0xf8, 0xff, 0xc0, 0xe0, 0xf9, 0x95, 0xc9, 0xf1, 0x9f, 0xd5, 0xfb, 0x9a, 0xd0, 0xf6, 0xa3, 0xd1, 0xf2, 0xc3, 0xe2, 0xf7, 0xea, 0xf5, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf3, 0xfb, 0xfe, 0xda, 0xed, 0xfb, 0xba, 0xdc, 0xf5, 0xa9, 0xd2, 0xf0, 0xad, 0xd2, 0xed, 0xb9, 0xd9, 0xf0, 0xe0, 0xed, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xf8, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xfa, 0xf7, 0xff, 0xfe, 0xfa, 0xff, 0xfb, 0xf7, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xf9, 0xfd, 0xff, 0xd9, 0xee, 0xff, 0xbd, 0xdf, 0xfa, 0xae, 0xd3, 0xed, 0xad, 0xd5, 0xef, 0xbb, 0xdd, 0xf6, 0xd9, 0xef, 0xfd, 0xf7, 0xfc, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xe8, 0xf6, 0xff, 0xc4, 0xe0, 0xf5, 0xa3, 0xd0, 0xf1, 0x97, 0xcc, 0xf4, 0x9c, 0xd0, 0xf7, 0xa4, 0xd2, 0xf4, 0xc7, 0xde, 0xee, 0xf0, 0xfb, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xfa, 0xf8, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xf9, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xf4, 0xff, 0xfd, 0xf9, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xfe, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xed, 0xfa, 0xff, 0xd9, 0xec, 0xf3, 0xda, 0xee, 0xf9, 0xe2, 0xf6, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xfd, 0xfd, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfa, 0xfe, 0xff, 0xff, 0xeb, 0xf6, 0xfc, 0xc0, 0xdc, 0xf1, 0xa1, 0xcf, 0xf1, 0x9c, 0xd5, 0xff, 0xa3, 0xda, 0xff, 0xa4, 0xd6, 0xfb, 0xbb, 0xdb, 0xf0, 0xea, 0xfb, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xf7, 0xf5, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xfe, 0xf5, 0xff, 0xfc, 0xf9, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xf5, 0xfe, 0xfe, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xfa, 0xf2, 0xfa, 0xfd, 0xc1, 0xdb, 0xec, 0xa0, 0xcd, 0xee, 0x9f, 0xd6, 0xff, 0xa3, 0xd8, 0xff, 0x9d, 0xcd, 0xf1, 0xb6, 0xdb, 0xf5, 0xea, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf7, 0xf5, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xfb, 0xfa, 0xff, 0xff, 0xf4, 0xfc, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xf9, 0xff, 0xff, 
-    0xff, 0xfe, 0xf4, 0xfe, 0xfd, 0xfb, 0xf8, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xff, 0xee, 0xf6, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfa, 0xff, 0xfc, 0xfb, 0xff, 0xfd, 0xfb, 0xff, 0xfb, 0xf6, 0xfd, 0xff, 0xf9, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xfb, 0xff, 0xfc, 0xfa, 0xff, 0xfa, 0xf8, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xf8, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xf4, 0xff, 0xfe, 0xfa, 0xfb, 0xfa, 0xf8, 0xf7, 0xf8, 0xfc, 0xf9, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xf6, 0xff, 0xf9, 0xf0, 0xf6, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xfe, 0xff, 0xe0, 0xf0, 0xfd, 0xc2, 0xde, 0xf4, 0xa6, 0xcb, 0xe8, 0xa7, 0xcc, 0xe9, 0xbc, 0xde, 0xf9, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xfb, 0xf8, 0xff, 0xff, 0xd0, 0xe0, 0xed, 0xd3, 0xe1, 0xee, 0xf4, 0xf8, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xfc, 0xfd, 0xff, 0xfa, 0xfc, 0xfe, 0xf9, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfb, 0xff, 0xfb, 0xf8, 0xff, 0xfb, 0xfa, 0xfe, 0xfc, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfb, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfc, 0xea, 0xf6, 0xff, 0xe2, 0xf2, 0xff, 0xdb, 0xee, 0xfd, 0xd9, 0xee, 0xff, 0xde, 0xf1, 0xff, 0xea, 0xf6, 0xff, 0xf9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xf4, 0xf9, 0xfd, 0xe2, 0xf4, 0xff, 0xd1, 0xea, 0xfe, 0xd3, 0xea, 0xfc, 0xe4, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xe2, 0xf0, 0xf9, 0xdb, 0xf6, 0xff, 0x8c, 0xb1, 0xce, 0x85, 0xa8, 0xc8, 0xdc, 0xf2, 0xff, 0xf6, 0xfd, 0xff, 0xf1, 0xee, 0xe9, 0xff, 0xfe, 0xf4, 0xfb, 0xfd, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xff, 0xfd, 0xfc, 0xff, 0xfd, 0xf4, 0xff, 0xfe, 0xf6, 0xff, 0xfd, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xfc, 0xf8, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xef, 0xfc, 0xff, 0xdb, 0xed, 0xf9, 0xb6, 0xdb, 0xf8, 0xb0, 0xd7, 0xf6, 0xac, 0xd5, 0xf5, 0xa9, 0xd2, 0xf2, 0xad, 0xd2, 0xef, 0xba, 0xda, 0xf3, 0xd2, 0xeb, 0xff, 0xe7, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfa, 0xff, 0xfc, 0xf5, 0xff, 0xfc, 0xf8, 0xfc, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf6, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xab, 0xcb, 0xe0, 0xa0, 0xce, 0xf0, 0x6e, 0xa8, 0xd8, 0x6e, 0xa8, 0xda, 0xa9, 0xd3, 0xf9, 0xd3, 0xe6, 0xf7, 0xf1, 0xf3, 0xf2, 0xff, 0xfe, 0xf4, 0xfa, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xf9, 0xf8, 0xfe, 0xfa, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xf7, 0xfb, 0xfc, 0xf4, 0xf9, 0xfc, 0xf5, 0xfa, 0xfe, 0xf8, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xf9, 0xf6, 0xff, 0xfc, 0xf6, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0xd2, 0xec, 0xfd, 0xb1, 0xd3, 0xec, 0x9e, 0xd2, 0xf9, 0x9d, 0xd2, 0xfa, 0x9e, 0xd3, 0xfb, 0x9e, 0xd2, 0xfa, 0x9f, 0xcf, 0xf5, 0xa6, 0xd1, 0xf1, 0xb7, 0xdc, 0xf7, 0xc6, 0xe8, 0xff, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xf5, 0xff, 0xfc, 0xf6, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0x89, 0xb2, 0xce, 0x64, 0x9b, 0xc4, 0x5a, 0x9f, 0xd8, 0x65, 0xaa, 0xe5, 0x64, 0x99, 0xc5, 0x9c, 0xb8, 0xd0, 0xec, 0xf5, 0xfa, 0xf2, 0xf3, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xf3, 0xfa, 0xff, 0xe7, 0xef, 0xfc, 0xce, 0xeb, 0xfd, 0xcd, 0xe8, 0xfb, 0xd0, 0xea, 0xfb, 0xda, 0xef, 0xff, 0xe7, 0xf5, 0xff, 0xf0, 0xf7, 0xfd, 0xfd, 0xfb, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfb, 0xf9, 0xfa, 0xff, 0xfa, 0xf7, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xdd, 0xf0, 0xff, 0xb4, 0xd8, 0xf2, 0x9b, 0xc9, 0xea, 0xa1, 0xd6, 0xfe, 0xa0, 0xd5, 0xfd, 0xa1, 0xd6, 0xfe, 0xa3, 0xd7, 0xfe, 0xa4, 0xd6, 0xf9, 0xa6, 0xd3, 0xf4, 0xab, 0xd4, 0xf2, 0xb1, 0xd8, 0xf5, 0xe3, 0xf5, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xc2, 0xe5, 0xfb, 0xa2, 0xd0, 0xf2, 0x6b, 0xa8, 0xd7, 0x6a, 0xa6, 0xd8, 0x99, 0xc6, 0xed, 0xca, 0xe3, 0xf9, 0xf3, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xea, 0xf8, 0xff, 0xd1, 0xe6, 0xf9, 0xbf, 0xd9, 0xf0, 0xac, 0xda, 0xfc, 0xa7, 0xd5, 0xf6, 0xa9, 0xd4, 0xf4, 0xb3, 0xd8, 0xf3, 0xc2, 0xdd, 0xf2, 0xd6, 0xe4, 0xef, 0xef, 0xf3, 0xf6, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xe8, 0xfa, 0xff, 0xc2, 0xe0, 0xf8, 0xa8, 0xd3, 0xf3, 0xa1, 0xd5, 0xfa, 0xa4, 0xd6, 0xfb, 0xa0, 0xd2, 0xf7, 0x9e, 0xd0, 0xf3, 0xa1, 0xd1, 0xf5, 0xa3, 0xd1, 0xf3, 0xa2, 0xcf, 0xf0, 0xa3, 0xce, 0xee, 0xa5, 0xd1, 0xee, 0xcc, 0xe7, 0xfc, 0xeb, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xf5, 0xff, 0xff, 0xe5, 0xfc, 0xff, 0x90, 0xb3, 0xcf, 0x89, 0xac, 0xca, 0xde, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xf1, 0xf5, 0xf6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xee, 0xfd, 0xff, 0xcc, 0xe7, 0xf8, 0xaf, 0xd7, 0xf0, 0xa3, 0xd2, 0xf0, 0x9f, 0xd3, 0xf8, 0x9b, 0xcf, 0xf4, 0x9b, 0xcf, 0xf4, 0xa1, 0xd1, 0xf5, 0xa9, 0xd2, 0xf0, 0xb7, 0xd6, 0xeb, 0xd3, 0xe6, 0xf5, 0xed, 0xfa, 0xff, 0xff, 0xfe, 0xff, 0xf5, 0xfa, 0xff, 0xea, 0xf6, 0xff, 0xdc, 0xf1, 0xff, 0xc7, 0xe7, 0xff, 0xb1, 0xda, 0xf8, 0xa5, 0xd5, 0xf9, 0xa5, 0xd9, 0xfe, 0xa8, 0xd9, 0xfa, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa5, 0xd6, 0xf7, 0xa5, 0xd6, 0xf7, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xa7, 0xd7, 0xfb, 0xc1, 0xdc, 0xf1, 0xe5, 0xf5, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xfa, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xf6, 0xf0, 0xf5, 0xf8, 0xd0, 0xde, 0xeb, 0xd6, 0xe3, 0xf3, 0xee, 0xf2, 0xfb, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 0xf7, 0xff, 0xfe, 0xfb, 0xfd, 0xfc, 0xf8, 0xfe, 0xfe, 0xfc, 0xf8, 0xff, 0xff, 0xdd, 0xf1, 0xfa, 0xb5, 0xda, 0xed, 0x9e, 0xd1, 0xee, 0x9b, 0xd7, 0xfb, 0xa4, 0xd5, 0xf5, 0xa2, 0xd4, 0xf7, 0xa2, 0xd8, 0xfe, 0xa4, 0xd9, 0xff, 0xa3, 0xd5, 0xfa, 0xa6, 0xd1, 0xf1, 0xba, 0xdc, 0xf7, 0xd2, 0xee, 0xff, 0xf9, 0xf9, 0xfb, 0xe5, 0xec, 0xf4, 0xc7, 0xda, 0xe9, 0xb1, 0xcf, 0xe9, 0xa8, 0xd1, 0xf1, 0xa8, 0xd6, 0xfa, 0xa2, 0xd4, 0xf9, 0x9b, 0xcd, 0xf2, 0xa0, 0xd1, 0xf2, 0xa0, 0xd1, 0xf2, 0xa2, 0xd3, 0xf4, 0xa4, 0xd6, 0xf7, 0xa3, 0xd5, 0xf8, 0x9d, 0xd1, 0xf6, 0x9b, 0xd1, 0xf7, 0x9d, 0xd4, 0xfb, 0xc3, 0xdc, 0xf0, 0xea, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfc, 0xfa, 0xfc, 0xfc, 0xfa, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xf8, 0xff, 0xfa, 0xf4, 0xff, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xb7, 0xd9, 0xf2, 0x9f, 0xd1, 0xf6, 0xa4, 0xdb, 0xff, 0x9f, 0xd4, 0xfc, 0xa2, 0xd3, 0xf4, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa1, 0xd2, 0xf3, 0xa4, 0xd5, 0xf6, 0xaa, 0xdb, 0xfc, 0xb0, 0xe1, 0xff, 0xb5, 0xe1, 0xff, 0xad, 0xdb, 0xfd, 0xa6, 0xd4, 0xf6, 0xa0, 0xd1, 0xf2, 0xa1, 0xd3, 0xf4, 0xa4, 0xd6, 0xf7, 0xa2, 0xd7, 0xf7, 0xa1, 0xd6, 0xf6, 0xa5, 0xd6, 0xf7, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xbb, 0xd9, 0xe4, 0xdf, 0xf6, 0xfe, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xfb, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xfb, 0xff, 0xfd, 0xfa, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xfe, 0xf8, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfc, 0xfd, 0xfc, 0xfb, 0xf9, 0xfc, 0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0xfd, 0xee, 0xfb, 0xff, 0xb9, 0xd9, 0xf0, 0xa2, 0xcf, 0xf0, 0xa6, 0xd6, 0xfa, 0xa1, 0xcf, 0xf1, 0xa3, 0xd4, 0xf5, 0xa5, 0xd6, 0xf7, 0xa5, 0xd6, 0xf7, 0xa3, 0xd4, 0xf5, 0xa1, 0xd2, 0xf3, 0xa2, 0xd3, 0xf4, 0xa7, 0xd8, 0xf9, 0xab, 0xdc, 0xfd, 0xad, 0xd9, 0xfc, 0xa8, 0xd6, 0xf8, 0xa4, 0xd2, 0xf4, 0xa1, 0xd2, 0xf3, 0xa4, 0xd5, 0xf6, 0xa4, 0xd6, 0xf7, 0xa1, 0xd6, 0xf6, 0x9f, 0xd4, 0xf4, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xde, 0xec, 0xf9, 0xf2, 0xfb, 0xff, 0xfc, 0xfd, 0xff, 0xfc, 0xf8, 0xf5, 0xff, 0xfc, 0xf9, 0xfd, 0xff, 0xfe, 0xf3, 0xfc, 0xff, 0xef, 0xfd, 0xff, 0xd9, 0xec, 0xfd, 0xd4, 0xe7, 0xf8, 0xd1, 0xe4, 0xf3, 0xd8, 0xe8, 0xf7, 0xe7, 0xf4, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf5, 0xfa, 0xfd, 0xf6, 0xfe, 0xff, 0xe4, 0xf5, 0xff, 0xbb, 0xdb, 0xf2, 0xa7, 0xd2, 0xf2, 0xab, 0xd6, 0xf6, 0xa6, 0xcf, 0xed, 0xa3, 0xd4, 0xf5, 0xa5, 0xd6, 0xf7, 0xa6, 0xd7, 0xf8, 0xa4, 0xd5, 0xf6, 0xa1, 0xd2, 0xf3, 0xa1, 0xd2, 0xf3, 0xa3, 0xd4, 0xf5, 0xa6, 0xd7, 0xf8, 0xa4, 0xd2, 0xf4, 0xa3, 0xd1, 0xf3, 0xa0, 0xd1, 0xf2, 0xa2, 0xd3, 0xf4, 0xa5, 0xd6, 0xf7, 0xa5, 0xd7, 0xf8, 0xa2, 0xd4, 0xf5, 0x9f, 0xd1, 0xf2, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa5, 0xd6, 0xf7, 0xa5, 0xd6, 0xf7, 0xee, 0xf1, 0xff, 0xf7, 0xf9, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xee, 0xfd, 0xff, 0xcf, 0xea, 0xf1, 0xc1, 0xe1, 0xec, 0xac, 0xda, 0xfc, 0xa6, 0xd6, 0xfa, 0xa4, 0xd4, 0xf8, 0xab, 0xd8, 0xf9, 0xbe, 0xe0, 0xfb, 0xd9, 0xec, 0xfb, 0xf3, 0xf8, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xf5, 0xfe, 0xff, 0xe8, 0xf5, 0xfb, 0xd5, 0xf0, 0xff, 0xd2, 0xe9, 0xf9, 0xd4, 0xea, 0xf8, 0xca, 0xe6, 0xfb, 0xb0, 0xd7, 0xf4, 0xa7, 0xd5, 0xf7, 0xab, 0xd9, 0xfb, 0xaa, 0xd3, 0xf1, 0xa2, 0xd3, 0xf4, 0xa4, 0xd5, 0xf6, 0xa5, 0xd6, 0xf7, 0xa4, 0xd5, 0xf6, 0xa2, 0xd3, 0xf4, 0xa1, 0xd2, 0xf3, 0xa1, 0xd2, 0xf3, 0xa2, 0xd3, 0xf4, 0xa1, 0xd2, 0xf3, 0xa0, 0xd1, 0xf2, 0xa1, 0xd2, 0xf3, 0xa3, 0xd4, 0xf5, 0xa5, 0xd6, 0xf7, 0xa5, 0xd6, 0xf7, 0xa3, 0xd4, 0xf5, 0xa0, 0xd2, 0xf3, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa5, 0xd6, 0xf7, 0xa6, 0xd7, 0xf8, 0xd1, 0xe3, 0xf9, 0xd6, 0xe7, 0xfb, 0xdd, 0xed, 0xfc, 0xeb, 0xfb, 0xff, 0xef, 0xff, 0xff, 0xd4, 0xef, 0xff, 0xb0, 0xd5, 0xe8, 0xa1, 0xcb, 0xe3, 0x9f, 0xd1, 0xf2, 0x9f, 0xd7, 0xfc, 0x9d, 0xda, 0xff, 0x9c, 0xd7, 0xff, 0x9f, 0xd0, 0xf8, 0xb4, 0xd3, 0xef, 0xda, 0xe8, 0xf5, 0xfa, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xda, 0xed, 0xfb, 0xc4, 0xe0, 0xee, 0xab, 0xd9, 0xfb, 0xac, 0xd5, 0xf3, 0xb0, 0xd5, 0xf0, 0xaa, 0xd5, 0xf5, 0x9e, 0xd2, 0xf9, 0x9c, 0xd3, 0xfc, 0xa1, 0xd5, 0xfd, 0xa3, 0xd3, 0xf7, 0xa1, 0xd2, 0xf3, 0xa2, 0xd3, 0xf4, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa3, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa5, 0xd6, 0xf7, 0xa6, 0xd7, 0xf8, 0xa7, 0xd9, 0xf4, 0xa8, 0xd6, 0xf0, 0xaa, 0xd4, 0xec, 0xb7, 0xdb, 0xf5, 0xbf, 0xe2, 0xfe, 0xb5, 0xd9, 0xf9, 0xa7, 0xcf, 0xf3, 0xa8, 0xd4, 0xfb, 0xac, 0xd2, 0xe9, 0xa9, 0xd6, 0xf3, 0xa5, 0xdb, 0xff, 0x9d, 0xd8, 0xff, 0x97, 0xce, 0xf7, 0xa1, 0xcc, 0xee, 0xc1, 0xdd, 0xf5, 0xde, 0xef, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xf2, 0xfb, 0xff, 0xd5, 0xea, 0xfb, 0xb6, 0xd9, 0xef, 0xa4, 0xcd, 0xe9, 0x99, 0xd2, 0xfd, 0x9f, 0xd1, 0xf6, 0xa2, 0xd0, 0xf2, 0x9f, 0xd1, 0xf6, 0x9a, 0xd3, 0xfe, 0x98, 0xd5, 0xff, 0x9e, 0xd5, 0xfe, 0xa3, 0xd5, 0xfa, 0xa1, 0xd2, 0xf3, 0xa1, 0xd2, 0xf3, 0xa2, 0xd3, 0xf4, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa5, 0xd7, 0xf8, 0xa4, 0xd6, 0xf7, 0xa3, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa2, 0xd3, 0xf4, 0xa2, 0xd3, 0xf4, 0xa5, 0xd3, 0xf5, 0xa6, 0xd4, 0xf6, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa5, 0xd6, 0xf7, 0xa5, 0xd6, 0xf7, 0x98, 0xda, 0xfc, 0x99, 0xd8, 0xf9, 0x99, 0xd1, 0xf2, 0x9e, 0xd0, 0xf1, 0xa6, 0xd4, 0xf6, 0xa3, 0xcf, 0xf6, 0xa2, 0xcd, 0xf8, 0xab, 0xd7, 0xff, 0xb4, 0xd4, 0xe9, 0xab, 0xd0, 0xea, 0xa1, 0xcf, 0xf0, 0x9f, 0xd3, 0xf8, 0xa0, 0xd4, 0xfb, 0xa4, 0xd5, 0xf6, 0xb3, 0xda, 0xf9, 0xc1, 0xe3, 0xfe, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xfd, 0xff, 0xfc, 0xfb, 0xfe, 0xfc, 0xfd, 0xfa, 0xfd, 0xff, 0xe2, 0xef, 0xff, 0xba, 0xd8, 0xf0, 0xa0, 0xce, 0xf0, 0x98, 0xd2, 0xf8, 0x9d, 0xd4, 0xfd, 0xa6, 0xd6, 0xfc, 0xa7, 0xd4, 0xf5, 0xa5, 0xd3, 0xf5, 0xa3, 0xd8, 0xff, 0x9e, 0xd7, 0xff, 0xa0, 0xd4, 0xfb, 0xa9, 0xd5, 0xf8, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa2, 0xd3, 0xf4, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa1, 0xd6, 0xf6, 0xa1, 0xd6, 0xf6, 0xa3, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa2, 0xd3, 0xf4, 0xa4, 0xd2, 0xf4, 0xa5, 0xd3, 0xf5, 0xa7, 0xd3, 0xf6, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0x9e, 0xd8, 0xfe, 0xa5, 0xdd, 0xff, 0xa3, 0xd9, 0xfd, 0xa5, 0xd7, 0xfa, 0xa8, 0xd9, 0xfa, 0xa3, 0xd3, 0xf7, 0x9d, 0xcf, 0xf4, 0xa1, 0xd3, 0xf8, 0xab, 0xd8, 0xf9, 0xa1, 0xcf, 0xf0, 0x9c, 0xcd, 0xee, 0xa2, 0xd2, 0xf6, 0xa6, 0xd7, 0xf8, 0xa7, 0xd5, 0xf6, 0xab, 0xd8, 0xf7, 0xb1, 0xde, 0xfb, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xfe, 0xfb, 0xfe, 0xfa, 0xf7, 0xfe, 0xfc, 0xfd, 0xf7, 0xfb, 0xff, 0xd7, 0xe8, 0xfa, 0xab, 0xd0, 0xed, 0x98, 0xcf, 0xf6, 0x9d, 0xe0, 0xff, 0x9f, 0xd1, 0xf6, 0xaa, 0xd5, 0xf7, 0xab, 0xd2, 0xef, 0xa9, 0xd2, 0xf0, 0xa7, 0xd7, 0xfb, 0xa3, 0xd5, 0xfa, 0xa2, 0xd0, 0xf2, 0xab, 0xd2, 0xef, 0xa6, 0xd7, 0xf8, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0x9d, 0xd2, 0xf2, 0x9f, 0xd4, 0xf4, 0xa3, 0xd5, 0xf6, 0xa3, 0xd5, 0xf6, 0xa4, 0xd5, 0xf6, 0xa5, 0xd3, 0xf5, 0xa5, 0xd3, 0xf5, 0xa6, 0xd2, 0xf5, 0xa5, 0xd6, 0xf7, 0xa4, 0xd5, 0xf6, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa3, 0xd4, 0xf5, 0xa4, 0xd5, 0xf6, 0xa3, 0xce, 0xf8, 0xa9, 0xd5, 0xfc, 0xa6, 0xd2, 0xf7, 0xa2, 0xcf, 0xf0, 0xa7, 0xd6, 0xf4, 0xa4, 0xd7, 0xf4, 0x9f, 0xd7, 0xf2, 0xa1, 0xda, 0xf5, 0x9d, 0xda, 0xff, 0x9c, 0xd5, 0xff, 0x9f, 0xd4, 0xfc, 0xa6, 0xd8, 0xfb, 0xa5, 0xd3, 0xf4, 0xa0, 0xcf, 0xeb, 0xa5, 0xd4, 0xf0, 0xb0, 0xdf, 0xfb, 0xf6, 0xf6, 0xf6, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xf6, 0xf9, 0xff, 0xfe, 0xf8, 0xf8, 0xff, 0xfd, 0xf8, 0xee, 0xf3, 0xf6, 0xb6, 0xd3, 0xe5, 0x9c, 0xc9, 0xe6, 0xa3, 0xd2, 0xec, 0xa6, 0xd1, 0xe4, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x9c, 0xcd, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xcf, 0xeb, 0x99, 0xca, 0xeb, 0x9f, 0xd1, 0xf2, 0x9a, 0xcf, 0xee, 0x95, 0xcd, 0xe8, 0x99, 0xcf, 0xeb, 0x9d, 0xcf, 0xea, 0xa3, 0xd1, 0xeb, 0xae, 0xd7, 0xf3, 0xf4, 0xf5, 0xf0, 0xf2, 0xf4, 0xf1, 0xfb, 0xff, 0xfe, 0xfc, 0xff, 0xff, 
-    0xfb, 0xff, 0xff, 0xe1, 0xdd, 0xd4, 0xbd, 0xb1, 0xa5, 0xa0, 0x99, 0x93, 0x82, 0x8b, 0x92, 0x7e, 0x8f, 0xa1, 0x80, 0x90, 0xa0, 0x77, 0x7f, 0x8c, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x83, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x86, 0x99, 0x81, 0x83, 0x98, 0x86, 0x88, 0x9d, 0x80, 0x87, 0x9a, 0x7d, 0x84, 0x96, 0x82, 0x88, 0x98, 0x84, 0x87, 0x98, 0x88, 0x87, 0x97, 0x90, 0x8c, 0x9d, 0xa4, 0x9b, 0x96, 0xbe, 0xb9, 0xb5, 0xe5, 0xe1, 0xe0, 0xff, 0xff, 0xff, 
-    0xd0, 0xd3, 0xc8, 0x84, 0x7d, 0x6d, 0x4f, 0x3e, 0x2c, 0x4a, 0x37, 0x28, 0x48, 0x36, 0x32, 0x46, 0x36, 0x37, 0x4a, 0x36, 0x38, 0x4c, 0x30, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4e, 0x32, 0x2f, 0x4c, 0x30, 0x2f, 0x50, 0x34, 0x33, 0x4b, 0x31, 0x30, 0x4a, 0x31, 0x2d, 0x4f, 0x36, 0x32, 0x4f, 0x33, 0x30, 0x4e, 0x2f, 0x2c, 0x55, 0x33, 0x31, 0x49, 0x35, 0x2e, 0x56, 0x45, 0x3e, 0x81, 0x76, 0x72, 0xf8, 0xf2, 0xf2, 
-    0xd1, 0xca, 0xc2, 0x6c, 0x60, 0x54, 0x39, 0x23, 0x15, 0x4e, 0x32, 0x24, 0x56, 0x39, 0x2b, 0x4b, 0x2b, 0x20, 0x51, 0x2d, 0x21, 0x5f, 0x39, 0x2e, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4d, 0x36, 0x24, 0x4c, 0x35, 0x23, 0x4f, 0x38, 0x26, 0x4b, 0x36, 0x23, 0x4b, 0x36, 0x23, 0x52, 0x3b, 0x29, 0x4e, 0x37, 0x25, 0x4a, 0x33, 0x21, 0x51, 0x37, 0x26, 0x50, 0x32, 0x28, 0x3f, 0x24, 0x1d, 0x69, 0x56, 0x52, 0xff, 0xf6, 0xf4, 
-    0xf2, 0xe2, 0xe3, 0x8e, 0x7e, 0x7e, 0x4f, 0x3c, 0x38, 0x51, 0x39, 0x2f, 0x56, 0x36, 0x27, 0x4e, 0x2e, 0x19, 0x4d, 0x2e, 0x1a, 0x4e, 0x33, 0x20, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4c, 0x35, 0x25, 0x4b, 0x34, 0x22, 0x4d, 0x36, 0x24, 0x4a, 0x33, 0x21, 0x4c, 0x35, 0x25, 0x51, 0x3a, 0x2a, 0x4c, 0x35, 0x25, 0x48, 0x33, 0x22, 0x4f, 0x3a, 0x29, 0x53, 0x35, 0x2b, 0x58, 0x3d, 0x36, 0x90, 0x7d, 0x79, 0xff, 0xf8, 0xf6, 
-    0xff, 0xf9, 0xff, 0xdf, 0xd2, 0xdb, 0xb7, 0xab, 0xaf, 0x98, 0x85, 0x7f, 0x7e, 0x61, 0x4f, 0x7a, 0x5a, 0x41, 0x7b, 0x61, 0x48, 0x6c, 0x5a, 0x46, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x55, 0x4c, 0x80, 0x56, 0x4a, 0x81, 0x57, 0x4b, 0x80, 0x54, 0x4b, 0x82, 0x56, 0x4d, 0x85, 0x59, 0x50, 0x7f, 0x54, 0x4d, 0x7c, 0x56, 0x4d, 0x88, 0x63, 0x5a, 0x9b, 0x87, 0x80, 0xba, 0xa9, 0xa2, 0xdd, 0xd2, 0xce, 0xff, 0xfd, 0xfd, 
-    0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xe7, 0xda, 0xd4, 0xb9, 0x99, 0x84, 0xab, 0x82, 0x66, 0xae, 0x89, 0x6f, 0xa4, 0x87, 0x75, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xaf, 0x80, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xb0, 0x7f, 0x70, 0xae, 0x7f, 0x6b, 0xb1, 0x81, 0x6d, 0xb1, 0x7e, 0x6d, 0xb3, 0x7e, 0x6e, 0xb4, 0x80, 0x72, 0xac, 0x7d, 0x6d, 0xae, 0x83, 0x73, 0xbf, 0x95, 0x85, 0xf0, 0xe7, 0xe2, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 
-    0xf7, 0xfe, 0xf7, 0xf3, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xf0, 0xe6, 0xdd, 0xca, 0xa4, 0x8d, 0xb2, 0x7d, 0x5e, 0xaf, 0x7b, 0x63, 0xaa, 0x7f, 0x6f, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa7, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa8, 0x84, 0x64, 0xa6, 0x84, 0x5f, 0xaa, 0x86, 0x62, 0xaa, 0x83, 0x62, 0xac, 0x83, 0x63, 0xab, 0x84, 0x65, 0xa3, 0x80, 0x62, 0xa8, 0x89, 0x6a, 0xbb, 0xa0, 0x82, 0xe7, 0xe8, 0xe3, 0xfe, 0xff, 0xfd, 0xf7, 0xfb, 0xfa, 0xfc, 0xff, 0xff, 
-    0xff, 0xff, 0xfb, 0xfa, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xf0, 0xe7, 0xe2, 0xc2, 0xa8, 0x99, 0xa9, 0x83, 0x6c, 0xa5, 0x7b, 0x63, 0xaa, 0x81, 0x6b, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xb0, 0x7f, 0x5f, 0xad, 0x83, 0x6a, 0xa6, 0x80, 0x6d, 0xac, 0x81, 0x6e, 0xac, 0x7d, 0x63, 0xb1, 0x82, 0x66, 0xa6, 0x7e, 0x64, 0xc4, 0xa4, 0x8d, 0xed, 0xed, 0xed, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xfb, 0xfc, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xf4, 0xeb, 0xe6, 0xca, 0xb0, 0xa1, 0xa9, 0x83, 0x6c, 0xa9, 0x7f, 0x67, 0xab, 0x81, 0x6b, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x7e, 0x60, 0xad, 0x83, 0x6a, 0xa6, 0x80, 0x6d, 0xae, 0x83, 0x70, 0xae, 0x7f, 0x65, 0xb2, 0x83, 0x67, 0xa6, 0x81, 0x66, 0xc8, 0xa9, 0x94, 0xee, 0xee, 0xee, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xfa, 0xfe, 0xfb, 0xf3, 0xf0, 0xd5, 0xbe, 0xb0, 0xa6, 0x82, 0x6c, 0xab, 0x81, 0x69, 0xac, 0x82, 0x6a, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xae, 0x7f, 0x61, 0xac, 0x82, 0x6a, 0xa9, 0x80, 0x6c, 0xaf, 0x85, 0x6f, 0xae, 0x7f, 0x65, 0xb0, 0x83, 0x66, 0xa8, 0x84, 0x6c, 0xcd, 0xb2, 0x9d, 0xf1, 0xf1, 0xf1, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xff, 0xf5, 0xf8, 0xfd, 0xff, 0xfc, 0xfc, 0xdf, 0xc9, 0xbe, 0xa4, 0x7f, 0x6c, 0xab, 0x81, 0x69, 0xac, 0x82, 0x6a, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xae, 0x81, 0x64, 0xac, 0x82, 0x6a, 0xa9, 0x80, 0x6c, 0xb2, 0x85, 0x70, 0xad, 0x7e, 0x64, 0xae, 0x80, 0x66, 0xa8, 0x85, 0x6f, 0xd1, 0xba, 0xa8, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xfa, 0xf6, 0xfe, 0xff, 0xff, 0xf6, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xe5, 0xd3, 0xc9, 0xa8, 0x85, 0x71, 0xa9, 0x7f, 0x67, 0xae, 0x81, 0x6a, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xaf, 0x82, 0x65, 0xac, 0x82, 0x6a, 0xa8, 0x7f, 0x6b, 0xb2, 0x85, 0x6e, 0xac, 0x7d, 0x61, 0xaa, 0x7e, 0x63, 0xa7, 0x88, 0x73, 0xd8, 0xc5, 0xb7, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xfa, 0xf4, 0xfe, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xee, 0xdd, 0xd5, 0xb6, 0x95, 0x82, 0xa9, 0x7f, 0x67, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xb0, 0x84, 0x69, 0xab, 0x81, 0x69, 0xa7, 0x7e, 0x68, 0xb3, 0x85, 0x6e, 0xad, 0x7b, 0x60, 0xa9, 0x7d, 0x64, 0xab, 0x8e, 0x7c, 0xe3, 0xd2, 0xc8, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xf7, 0xe8, 0xe1, 0xcc, 0xad, 0x9b, 0xac, 0x82, 0x6a, 0xac, 0x80, 0x67, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xb0, 0x84, 0x69, 0xaa, 0x80, 0x68, 0xa7, 0x7d, 0x67, 0xb3, 0x85, 0x6d, 0xae, 0x7c, 0x61, 0xa9, 0x7f, 0x66, 0xb2, 0x97, 0x86, 0xef, 0xe1, 0xd8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 
-    0xff, 0xfe, 0xf8, 0xfc, 0xfd, 0xff, 0xf5, 0xfe, 0xff, 0xf8, 0xfb, 0xff, 0xfd, 0xf0, 0xea, 0xde, 0xbf, 0xad, 0xb0, 0x86, 0x6e, 0xac, 0x80, 0x67, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x83, 0x6a, 0xa8, 0x80, 0x67, 0xa6, 0x7c, 0x66, 0xb4, 0x86, 0x6e, 0xaf, 0x7d, 0x62, 0xac, 0x82, 0x69, 0xb7, 0x9d, 0x8c, 0xf9, 0xec, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xfa, 0xfb, 0xf6, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xda, 0xcf, 0xcb, 0xb4, 0x93, 0x84, 0xaf, 0x7d, 0x64, 0xac, 0x83, 0x6d, 0xa7, 0x7e, 0x68, 0xa8, 0x7f, 0x69, 0xa9, 0x80, 0x6a, 0xa7, 0x7f, 0x66, 0xad, 0x83, 0x6b, 0xaf, 0x85, 0x6c, 0xa9, 0x7d, 0x62, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xb5, 0x81, 0x73, 0xa7, 0x7a, 0x63, 0xa8, 0x80, 0x5d, 0xb4, 0x86, 0x64, 0xb3, 0x7d, 0x63, 0xab, 0x80, 0x70, 0xc7, 0xb6, 0xaf, 0xef, 0xf8, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfd, 0xf9, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xeb, 0xe1, 0xdf, 0xc4, 0xa7, 0x99, 0xaa, 0x7c, 0x64, 0xab, 0x81, 0x69, 0xa7, 0x7d, 0x65, 0xaa, 0x80, 0x68, 0xab, 0x81, 0x69, 0xa8, 0x7e, 0x66, 0xab, 0x81, 0x68, 0xaf, 0x85, 0x6c, 0xa9, 0x7f, 0x66, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xb4, 0x80, 0x72, 0xad, 0x80, 0x69, 0xab, 0x82, 0x62, 0xad, 0x80, 0x5f, 0xae, 0x7c, 0x63, 0xb7, 0x90, 0x81, 0xd9, 0xca, 0xc3, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfb, 0xfd, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0xf5, 0xdd, 0xc5, 0xb9, 0xaa, 0x84, 0x6f, 0xae, 0x82, 0x67, 0xab, 0x7d, 0x63, 0xaf, 0x81, 0x67, 0xb2, 0x84, 0x6a, 0xab, 0x7f, 0x64, 0xab, 0x7f, 0x66, 0xad, 0x83, 0x6a, 0xab, 0x81, 0x69, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xac, 0x7b, 0x6a, 0xb0, 0x83, 0x6c, 0xac, 0x83, 0x65, 0xa5, 0x79, 0x5c, 0xa9, 0x7f, 0x69, 0xc6, 0xa6, 0x99, 0xed, 0xe0, 0xda, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfa, 0xfc, 0xfb, 0xff, 0xfe, 0xfa, 0xff, 0xfe, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xf0, 0xdf, 0xd5, 0xbb, 0x9e, 0x8c, 0xb1, 0x85, 0x6a, 0xab, 0x7e, 0x61, 0xaf, 0x82, 0x65, 0xb6, 0x87, 0x69, 0xaf, 0x80, 0x64, 0xab, 0x7d, 0x63, 0xad, 0x80, 0x69, 0xab, 0x81, 0x69, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xa7, 0x7a, 0x65, 0xb3, 0x86, 0x6f, 0xae, 0x84, 0x6b, 0xa2, 0x7a, 0x61, 0xaf, 0x8e, 0x7b, 0xd9, 0xc3, 0xb8, 0xf8, 0xf0, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfc, 0xff, 0xff, 0xfc, 0xfd, 0xf8, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf0, 0xe9, 0xd8, 0xc5, 0xb6, 0xb2, 0x8d, 0x73, 0xa7, 0x7d, 0x64, 0xaa, 0x7d, 0x60, 0xb3, 0x84, 0x66, 0xb0, 0x81, 0x63, 0xad, 0x7e, 0x64, 0xad, 0x80, 0x69, 0xab, 0x81, 0x6b, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xa9, 0x7f, 0x67, 0xb3, 0x86, 0x6f, 0xad, 0x83, 0x6d, 0xa6, 0x83, 0x6f, 0xbd, 0xa6, 0x96, 0xec, 0xdf, 0xd6, 0xff, 0xfe, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xfb, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xf8, 0xf3, 0xf2, 0xe8, 0xdc, 0xc1, 0xa5, 0x90, 0xa9, 0x89, 0x72, 0xa3, 0x7b, 0x61, 0xae, 0x81, 0x64, 0xb0, 0x81, 0x65, 0xae, 0x7f, 0x65, 0xae, 0x80, 0x69, 0xae, 0x81, 0x6c, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xaa, 0x82, 0x68, 0xac, 0x7f, 0x68, 0xa9, 0x7e, 0x6b, 0xb0, 0x90, 0x81, 0xcd, 0xbf, 0xb2, 0xf2, 0xf2, 0xea, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xf9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xf9, 0xff, 0xfc, 0xfb, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf9, 0xfb, 0xf8, 0xff, 0xfe, 0xf5, 0xe3, 0xd0, 0xc2, 0xbc, 0xa2, 0x91, 0xa6, 0x83, 0x6d, 0xaa, 0x80, 0x67, 0xb0, 0x81, 0x65, 0xaf, 0x80, 0x66, 0xae, 0x80, 0x69, 0xad, 0x80, 0x6b, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xa9, 0x84, 0x67, 0xa9, 0x7c, 0x65, 0xb5, 0x87, 0x78, 0xce, 0xb0, 0xa5, 0xe8, 0xe1, 0xd7, 0xf7, 0xfe, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xf6, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xf9, 0xf8, 0xfc, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf8, 0xfe, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xf5, 0xec, 0xd0, 0xbd, 0xaf, 0xae, 0x8f, 0x7b, 0xad, 0x85, 0x6c, 0xb0, 0x82, 0x68, 0xaf, 0x80, 0x66, 0xae, 0x7e, 0x68, 0xab, 0x7c, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xad, 0x81, 0x68, 0xab, 0x88, 0x6a, 0xaf, 0x82, 0x6b, 0xc9, 0x9b, 0x8c, 0xf0, 0xd4, 0xc9, 0xff, 0xff, 0xf6, 0xf8, 0xff, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf0, 0xed, 0xe8, 0xcd, 0xc0, 0xb8, 0xac, 0x96, 0x88, 0xa3, 0x82, 0x6f, 0xac, 0x82, 0x6a, 0xb4, 0x81, 0x64, 0xb1, 0x7a, 0x5b, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xb0, 0x80, 0x69, 0xb0, 0x80, 0x69, 0xb0, 0x80, 0x69, 0xb0, 0x80, 0x69, 0xb0, 0x80, 0x69, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xaf, 0x7f, 0x68, 0xac, 0x82, 0x69, 0xaa, 0x80, 0x67, 0xa8, 0x7e, 0x65, 0xab, 0x81, 0x69, 0xae, 0x86, 0x6d, 0xaf, 0x87, 0x6e, 0xab, 0x83, 0x6a, 0xa7, 0x7e, 0x68, 0x9a, 0x7d, 0x6d, 0xc3, 0xab, 0x9f, 0xec, 0xdf, 0xd9, 0xfe, 0xf8, 0xf8, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfd, 0xfc, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf9, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0xfc, 0xf5, 0xde, 0xcd, 0xc3, 0xb0, 0x96, 0x87, 0x9d, 0x7a, 0x67, 0xa3, 0x7a, 0x64, 0xb0, 0x83, 0x6c, 0xae, 0x80, 0x68, 0xae, 0x80, 0x68, 0xae, 0x80, 0x68, 0xae, 0x80, 0x68, 0xad, 0x7f, 0x67, 0xad, 0x7f, 0x67, 0xad, 0x7f, 0x67, 0xae, 0x80, 0x68, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaf, 0x81, 0x69, 0xaa, 0x7e, 0x63, 0xb0, 0x84, 0x69, 0xb2, 0x88, 0x6f, 0xad, 0x85, 0x6b, 0xa4, 0x7c, 0x63, 0x9f, 0x79, 0x62, 0xa5, 0x81, 0x69, 0xad, 0x89, 0x73, 0xd1, 0xb9, 0xad, 0xe9, 0xd6, 0xcf, 0xfd, 0xf3, 0xf1, 0xff, 0xfd, 0xfe, 0xfb, 0xfc, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf7, 0xf6, 0xfd, 0xfd, 0xfb, 0xff, 0xfe, 0xfb, 0xff, 0xf7, 0xf3, 0xf7, 0xe6, 0xde, 0xe0, 0xca, 0xbf, 0xbc, 0xa2, 0x95, 0x9e, 0x82, 0x74, 0xaa, 0x84, 0x6d, 0xa9, 0x83, 0x6c, 0xa8, 0x82, 0x6b, 0xa6, 0x80, 0x69, 0xa6, 0x80, 0x69, 0xa6, 0x80, 0x69, 0xa7, 0x81, 0x6a, 0xa7, 0x81, 0x6a, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa8, 0x82, 0x6b, 0xa6, 0x7e, 0x65, 0xa6, 0x81, 0x67, 0xa4, 0x80, 0x68, 0x9f, 0x7c, 0x66, 0xa1, 0x80, 0x6d, 0xb2, 0x95, 0x83, 0xd4, 0xb9, 0xa8, 0xee, 0xd3, 0xc2, 0xff, 0xf2, 0xec, 0xff, 0xfc, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 
-    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xfb, 0xff, 0xfc, 0xfa, 0xfc, 0xf1, 0xed, 0xee, 0xe0, 0xdd, 0xdb, 0xc5, 0xb7, 0xd9, 0xc3, 0xb5, 0xd7, 0xc1, 0xb3, 0xd6, 0xc0, 0xb2, 0xd5, 0xbf, 0xb1, 0xd5, 0xbf, 0xb1, 0xd6, 0xc0, 0xb2, 0xd7, 0xc1, 0xb3, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xd6, 0xc0, 0xb2, 0xdd, 0xc3, 0xb2, 0xdc, 0xc5, 0xb5, 0xdf, 0xc9, 0xbb, 0xe4, 0xd0, 0xc5, 0xee, 0xdd, 0xd3, 0xfa, 0xeb, 0xe4, 0xff, 0xf7, 0xf1, 0xff, 0xfc, 0xf6, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xf9, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xf9, 0xf6, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd
+static const uint16_t image_rows_wash[60] = {
+    0x0000, 0x005d, 0x00b2, 0x010b, 0x0166, 0x01c3, 0x021f, 0x027d, 0x02db, 0x0351, 0x03c6, 0x0439,
+    0x04ad, 0x0523, 0x0596, 0x060b, 0x0680, 0x0725, 0x07c5, 0x086f, 0x0913, 0x09af, 0x0a50, 0x0afb,
+    0x0bac, 0x0c51, 0x0cf9, 0x0da1, 0x0e49, 0x0ee8, 0x0f88, 0x1027, 0x10c9, 0x1113, 0x115d, 0x119f,
+    0x11e0, 0x1222, 0x1264, 0x12ad, 0x12f7, 0x1337, 0x1377, 0x13b7, 0x13f4, 0x1431, 0x1470, 0x14b2,
+    0x14f3, 0x154c, 0x15a4, 0x15fc, 0x1655, 0x16ae, 0x1706, 0x175f, 0x17b8, 0x181d, 0x1886, 0x18f5
 };
+
 const tImage wash = { image_data_wash, 60, 60,
-    8 };
+    8, image_rows_wash };
 
@@ -0,0 +1,47 @@
+/*
+ * image_rle.c
+ *
+ * Decoder of the RLE images, expanding only the requested part of a row.
+ */
+
+#include <string.h>
+#include "image_rle.h"
+
+/* Decodes n pixels of row y, starting at column x, into dst (3 bytes per pixel) */
+void image_rle_read(const tImage *image, uint32_t x, uint32_t y, uint32_t n, uint8_t *dst)
+{
+	const uint8_t *p = image->data + image->rows[y];
+	uint32_t count, used;
+	uint8_t b;
+
+	while (n > 0) {
+		b = *p++;
+		count = (b & ~IMAGE_RLE_RUN) + 1;
+
+		/* Packets before the first pixel are only skipped */
+		if (x >= count) {
+			x -= count;
+			p += (b & IMAGE_RLE_RUN) ? 3 : count * 3;
+			continue;
+		}
+
+		used = count - x;
+		if (used > n) {
+			used = n;
+		}
+		if (b & IMAGE_RLE_RUN) {
+			for (uint32_t i = 0; i < used; i++) {
+				*dst++ = p[0];
+				*dst++ = p[1];
+				*dst++ = p[2];
+			}
+			p += 3;
+		} else {
+			memcpy(dst, p + x * 3, used * 3);
+			dst += used * 3;
+			p += count * 3;
+		}
+		n -= used;
+		x = 0;
+	}
+}
@@ -0,0 +1,31 @@
+/*
+ * image_rle.h
+ *
+ * Run-length encoded R8G8B8 images, generated by tools/rle_icons.py.
+ *
+ * Each row is an independent stream of packets:
+ *   0x80 | (n - 1), R, G, B         the pixel repeated n times
+ *   n - 1, R, G, B, ... (n pixels)  n literal pixels
+ * image->rows[y] is the offset of row y in image->data.
+ */
+
+
+#ifndef IMAGE_RLE_H_
+#define IMAGE_RLE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tipos.h"
+
+#define IMAGE_RLE_RUN  0x80
+#define IMAGE_RLE_MAX  128
+
+static inline bool image_is_rle(const tImage *image)
+{
+	return image->rows != 0;
+}
+
+void image_rle_read(const tImage *image, uint32_t x, uint32_t y, uint32_t n, uint8_t *dst);
+
+
+#endif /* IMAGE_RLE_H_ */
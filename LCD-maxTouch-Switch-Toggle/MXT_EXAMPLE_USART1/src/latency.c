@@ -0,0 +1,186 @@
+/*
+ * latency.c
+ *
+ * Trace of one touch at a time, from its CHG edge to the last byte of its
+ * redraw, and the window of the last LATENCY_WINDOW touches traced.
+ *
+ * The edge and the end of the LCD transfers come in interrupts, the other
+ * stamps in the main loop: the state changes with interrupts masked.
+ */
+
+#include <string.h>
+#include "latency.h"
+
+#define LATENCY_MASK (LATENCY_WINDOW - 1)
+
+#if (LATENCY_WINDOW & LATENCY_MASK) != 0
+#error "LATENCY_WINDOW must be a power of 2"
+#endif
+
+#ifdef PROF_HOST
+#  define LATENCY_IRQ_SAVE()      0
+#  define LATENCY_IRQ_RESTORE(f)  ((void)(f))
+#else
+#  define LATENCY_IRQ_SAVE()      cpu_irq_save()
+#  define LATENCY_IRQ_RESTORE(f)  cpu_irq_restore(f)
+#endif
+
+/* Stage of the touch being traced */
+enum {
+	TRACE_IDLE,
+	TRACE_CHG,
+	TRACE_READ,
+	TRACE_DISPATCH,
+	TRACE_FLUSHED,
+};
+
+static const char *const span_names[LATENCY_N_SPANS] = {
+	"read", "queue", "redraw", "total"
+};
+
+static volatile uint8_t trace;
+static uint32_t t_chg;
+static uint32_t t_read;
+static uint32_t t_dispatch;
+
+static uint32_t window[LATENCY_WINDOW][LATENCY_N_SPANS];
+static uint32_t n_traced;
+
+void latency_init(void)
+{
+	latency_clear();
+}
+
+void latency_clear(void)
+{
+	uint32_t flags = LATENCY_IRQ_SAVE();
+
+	trace = TRACE_IDLE;
+	n_traced = 0;
+	LATENCY_IRQ_RESTORE(flags);
+}
+
+/* From the CHG interrupt: a new touch, unless one is in flight */
+void latency_chg(void)
+{
+	uint32_t flags = LATENCY_IRQ_SAVE();
+
+	if (trace == TRACE_IDLE) {
+		t_chg = LATENCY_NOW();
+		trace = TRACE_CHG;
+	}
+	LATENCY_IRQ_RESTORE(flags);
+}
+
+/* After the T5 messages of the touch were read */
+void latency_read(void)
+{
+	uint32_t flags = LATENCY_IRQ_SAVE();
+
+	if (trace == TRACE_CHG) {
+		t_read = LATENCY_NOW();
+		trace = TRACE_READ;
+	}
+	LATENCY_IRQ_RESTORE(flags);
+}
+
+/* Before the handler of the button touched: only the first one counts */
+void latency_dispatch(void)
+{
+	uint32_t flags = LATENCY_IRQ_SAVE();
+
+	if (trace == TRACE_READ) {
+		t_dispatch = LATENCY_NOW();
+		trace = TRACE_DISPATCH;
+	}
+	LATENCY_IRQ_RESTORE(flags);
+}
+
+static void trace_done(void)
+{
+	uint32_t *spans = window[n_traced++ & LATENCY_MASK];
+	uint32_t t_done = LATENCY_NOW();
+
+	spans[LATENCY_READ] = t_read - t_chg;
+	spans[LATENCY_QUEUE] = t_dispatch - t_read;
+	spans[LATENCY_REDRAW] = t_done - t_dispatch;
+	spans[LATENCY_TOTAL] = t_done - t_chg;
+	trace = TRACE_IDLE;
+}
+
+/*
+ * End of the iteration of the main loop. The redraw of a dispatched touch
+ * is queued: done if the LCD is idle already, else when it gets idle. A
+ * touch read but not dispatched redraws nothing and is dropped.
+ */
+void latency_flushed(bool lcd_busy)
+{
+	if (trace == TRACE_READ) {
+		trace = TRACE_IDLE;
+	} else if (trace == TRACE_DISPATCH) {
+		if (lcd_busy) {
+			trace = TRACE_FLUSHED;
+		} else {
+			trace_done();
+		}
+	}
+}
+
+/* Transfer callback of the LCD driver: every queued byte is out */
+void latency_lcd_idle(void)
+{
+	uint32_t flags = LATENCY_IRQ_SAVE();
+
+	if (trace == TRACE_FLUSHED) {
+		trace_done();
+	}
+	LATENCY_IRQ_RESTORE(flags);
+}
+
+uint32_t latency_count(void)
+{
+	return n_traced;
+}
+
+/*
+ * Percentiles of a span over the touches of the window, by nearest rank.
+ * Returns false when no touch was traced yet.
+ */
+bool latency_percentiles(enum latency_span span, latency_pct_t *out)
+{
+	uint32_t v[LATENCY_WINDOW];
+	uint32_t n, x, j;
+	uint32_t flags = LATENCY_IRQ_SAVE();
+
+	n = n_traced < LATENCY_WINDOW ? n_traced : LATENCY_WINDOW;
+	for (uint32_t i = 0; i < n; i++) {
+		v[i] = window[(n_traced - n + i) & LATENCY_MASK][span];
+	}
+	LATENCY_IRQ_RESTORE(flags);
+
+	memset(out, 0, sizeof(*out));
+	if (n == 0) {
+		return false;
+	}
+
+	/* Insertion sort: a few dozen values, on request */
+	for (uint32_t i = 1; i < n; i++) {
+		x = v[i];
+		for (j = i; j > 0 && v[j - 1] > x; j--) {
+			v[j] = v[j - 1];
+		}
+		v[j] = x;
+	}
+
+	out->count = n;
+	out->p50 = v[(50 * n + 99) / 100 - 1];
+	out->p95 = v[(95 * n + 99) / 100 - 1];
+	out->p99 = v[(99 * n + 99) / 100 - 1];
+	out->max = v[n - 1];
+	return true;
+}
+
+const char *latency_span_name(enum latency_span span)
+{
+	return span < LATENCY_N_SPANS ? span_names[span] : "?";
+}
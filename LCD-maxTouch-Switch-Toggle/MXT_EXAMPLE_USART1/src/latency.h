@@ -0,0 +1,74 @@
+/*
+ * latency.h
+ *
+ * Touch to photon latency: a touch is stamped on the SysTick clock at the
+ * falling edge of CHG, when its T5 messages have been read, when the
+ * handler of a button is dispatched for it and when the last byte of the
+ * redraw that follows is out on the SPI of the LCD, in the callback of
+ * the LCD driver. The last touches traced are kept, and the percentiles
+ * of each span between two stamps are computed on request.
+ *
+ * One touch is traced at a time: a CHG edge while one is in flight is not
+ * traced. A touch whose messages dispatch no button (a press, the buttons
+ * act on release) is dropped at the end of the iteration of the main loop.
+ *
+ * The clock is relogio_ler() of main.c, the SysTick at HCLK/8 with its
+ * wraps counted: the cycle counter stops in WFI, where the main loop waits
+ * for the redraw, and the SysTick does not. A test on the host gives its
+ * own relogio_ler().
+ */
+
+
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "prof.h"
+
+/* Core cycles in a tick of the clock */
+#define LATENCY_TICK_CYCLES 8
+
+/* Call with interrupts masked */
+uint64_t relogio_ler(void);
+#define LATENCY_NOW() ((uint32_t)relogio_ler())
+
+/* Touches kept for the percentiles, must be a power of 2 */
+#define LATENCY_WINDOW 64
+
+enum latency_span {
+	LATENCY_READ,       /* CHG edge to the T5 messages read */
+	LATENCY_QUEUE,      /* read to the handler dispatched */
+	LATENCY_REDRAW,     /* dispatch to the last byte on the LCD */
+	LATENCY_TOTAL,      /* CHG edge to the last byte on the LCD */
+	LATENCY_N_SPANS
+};
+
+typedef struct {
+	uint32_t count;     /* touches in the window */
+	uint32_t p50;
+	uint32_t p95;
+	uint32_t p99;
+	uint32_t max;       /* all in ticks of the clock */
+} latency_pct_t;
+
+void latency_init(void);
+void latency_clear(void);
+
+/*
+ * Stamps, in the order of a touch. latency_flushed() goes after the redraw
+ * is queued, with interrupts masked and lcd_busy read under the same mask,
+ * so the callback of the driver, latency_lcd_idle(), is not missed.
+ */
+void latency_chg(void);
+void latency_read(void);
+void latency_dispatch(void);
+void latency_flushed(bool lcd_busy);
+void latency_lcd_idle(void);
+
+uint32_t latency_count(void);
+bool latency_percentiles(enum latency_span span, latency_pct_t *out);
+const char *latency_span_name(enum latency_span span);
+
+
+#endif /* LATENCY_H_ */
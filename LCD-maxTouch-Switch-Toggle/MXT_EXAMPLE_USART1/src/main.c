@@ -91,7 +91,6 @@
 #include "maquina1.h"
 
 #define MAX_ENTRIES        3
-#define STRING_LENGTH     70
 
 #define USART_TX_MAX_LENGTH     0xff
 #define COLOR_BLUE           (0x0000FFu)
@@ -106,21 +105,21 @@ struct ili9488_opt_t g_ili9488_display_opt;
 #include "conf_board.h"
 #include "conf_example.h"
 #include "conf_uart_serial.h"
-#include "calibri_36.h"
-#include "arial_72.h"
-#include "icones/centri.h"
-#include "icones/heavy.h"
-#include "icones/icon_backward.h"
-#include "icones/icon_forward.h"
-#include "icones/next.h"
-#include "icones/play.h"
-#include "icones/previous.h"
-#include "icones/wash.h"
-#include "icones/water.h"
-#include "icones/lock.h"
-#include "icones/unlocked.h"
-#include "icones/locked.h"
+#include "assets.h"
 #include "coordenadas.h"
+#include "dirty_rect.h"
+#include "event_loop.h"
+#include "event_ring.h"
+#include "hit_grid.h"
+#include "latency.h"
+#include "prof.h"
+#include "serial_tx.h"
+#include "settings_log.h"
+#include "timebase.h"
+#include "tlog.h"
+#include "wash_journal.h"
+#include "wash_program.h"
+#include "tile_render.h"
 
 
 #define BUT_PIO      PIOA
@@ -137,48 +136,135 @@ botao but_play;
 botao but_next;
 botao but_lock;
 
+/* Buttons that answer to touch; with the screen locked only the first one */
+botao *const botoes[8] = {&but_lock, &but_play, &numero_centri, &numero_exagues, &bubbles, &heavy, &but_next, &but_back};
+
+/* Icons, pointing into the asset blob */
+tImage water;
+tImage recyclewater;
+tImage wash;
+tImage tumbledry;
+tImage forwardbuttonformultimedia;
+tImage icon_backward;
+tImage icon_forward;
+tImage locked;
+tImage unlocked;
+
 volatile bool lock_flag = true;
-volatile t_ciclo *ciclo_atual;
+// indice em ciclos[] do ciclo mostrado
+uint8_t ciclo_atual;
 volatile int numero_de_botoes = 8;
 
 volatile bool flag_porta_aberta = false;
-volatile int f_rtt_alarme = 0;
-volatile int f_but_back = 0;
-volatile int f_but_next = 0;
-volatile int f_but_play = 0;
-volatile int f_but_nexagues = 0;
-volatile int f_but_ncentri = 0;
-volatile int f_but_bubbles = 0;
-volatile int f_but_heavy = 0;
+volatile int f_touch = 0;
+/* Ultimo comando recebido no console, 0 se nenhum */
+volatile uint8_t comando_console = 0;
+/* Alarme do RTT ainda nao atendido: fica ate timebase_run(), mesmo se o evento nao coube no anel */
+volatile bool alarme_rtt = false;
+volatile uint32_t cor_status = COLOR_RED;
+
+/* Status circle of the door */
+#define STATUS_X 445
+#define STATUS_Y 30
+#define STATUS_R 20
+
+/* Line of text owned by the UI, redrawn only when its content changes */
+typedef struct {
+	dirty_rect_t box;
+	tile_item item;
+	char text[40];
+} campo_texto;
+
+campo_texto campo_q     = {{Q_X, Q_Y, 150, 80}};
+campo_texto campo_c     = {{C_X, C_Y, 150, 160}};
+campo_texto campo_b     = {{B_X, B_Y, 150, 240}};
+campo_texto campo_h     = {{H_X, H_Y, 150, 319}};
+campo_texto campo_ciclo = {{160, 130, 420, 169}};
+campo_texto campo_timer = {{160, 170, 459, 209}};
+
+campo_texto *campos[] = {&campo_q, &campo_c, &campo_b, &campo_h, &campo_ciclo, &campo_timer};
+
+/* Input events, consumed only by the main loop */
+event_ring_t eventos;
+
+/* Atualiza o tempo restante da lavagem na tela a cada segundo */
+sw_timer_t timer_lavagem;
+
+/* Salva o ponto do programa, para voltar a ele depois de um reset */
+sw_timer_t timer_journal;
+
+/* source of the EVENT_BUTTON events */
+enum {
+	BOTAO_EXAGUES,
+	BOTAO_CENTRI,
+	BOTAO_BUBBLES,
+	BOTAO_HEAVY,
+	BOTAO_PLAY,
+	BOTAO_BACK,
+	BOTAO_NEXT,
+};
+
+/* Items of the screen painted by the tile renderer */
+tile_item item_botoes[7];
+tile_item item_lock;
+tile_item item_status;
 
 void draw_cicle(void);
+void invalida_botao(botao *but);
+
+/* Timestamp of the events: cycle counter of the core */
+void tempo_init(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* Producer in interrupt: every ISR that posts runs with priority 4, so none preempts another */
+void evento_isr(uint8_t tipo, uint8_t fonte) {
+	event_t ev = {.time = DWT->CYCCNT, .type = tipo, .source = fonte};
+	event_push(&eventos, &ev);
+}
+
+/* Producer in the main loop: the ISRs must not push in the middle */
+void evento_post(event_t *ev) {
+	irqflags_t flags = cpu_irq_save();
+	ev->time = DWT->CYCCNT;
+	event_push(&eventos, ev);
+	cpu_irq_restore(flags);
+}
+
+void evento_botao(uint8_t fonte) {
+	event_t ev = {.type = EVENT_BUTTON, .source = fonte};
+	evento_post(&ev);
+}
 
 void numero_exagues_callback(void) {
-	f_but_nexagues = 1;
+	evento_botao(BOTAO_EXAGUES);
 }
 
 void numero_centri_callback(void) {
-	f_but_ncentri = 1;
+	evento_botao(BOTAO_CENTRI);
 }
 
 void bubbles_callback(void) {
-	f_but_bubbles = 1;
+	evento_botao(BOTAO_BUBBLES);
 }
 
 void heavy_callback(void) {
-	f_but_heavy = 1;
+	evento_botao(BOTAO_HEAVY);
 }
 
 void but_play_callback(void) {
-	f_but_play = 1;
+	evento_botao(BOTAO_PLAY);
 }
 
 void but_back_callback(void) {
-	f_but_back = 1;
+	evento_botao(BOTAO_BACK);
 }
 
 void but_next_callback(void) {
-	f_but_next = 1;
+	evento_botao(BOTAO_NEXT);
 }
 
 void but_lock_callback(void) {
@@ -192,13 +278,10 @@ void but_lock_callback(void) {
 		lock_flag = true;
 		numero_de_botoes = 1;
 	}
+	hit_grid_build(botoes, numero_de_botoes);
 	
-	ili9488_draw_pixmap(but_lock.x,
-	but_lock.y,
-	but_lock.image->width,
-	but_lock.image->height,
-	but_lock.image->data);
-	
+	item_lock.image = but_lock.image;
+	invalida_botao(&but_lock);
 }
 
 void but_callback(void){
@@ -209,9 +292,89 @@ void but_callback(void){
 		} else{
 		color = COLOR_RED;
 	}
-	flag_porta_aberta = !flag_porta_aberta;
-	ili9488_set_foreground_color(COLOR_CONVERT(color));
-	ili9488_draw_filled_circle(445, 30, 20);
+	flag_porta_aberta = !flag_porta_aberta;
+	cor_status = color;
+	
+	// desenho fica para o loop principal
+	evento_isr(EVENT_DOOR, 0);
+}
+
+/* CHG do maXTouch desce quando ha mensagens na fila do controlador */
+void chg_callback(uint32_t id, uint32_t mask) {
+	f_touch = 1;
+	latency_chg();
+}
+
+void chg_init(void) {
+	pio_handler_set_pin(MAXTOUCH_XPRO_CHG_PIO, PIO_IT_FALL_EDGE, chg_callback);
+	pio_enable_pin_interrupt(MAXTOUCH_XPRO_CHG_PIO);
+	
+	// CHG pode ja estar em baixo (mensagens da calibracao), sem borda
+	f_touch = 1;
+}
+
+/*
+ * Relogio do tempo dormindo/acordado: SysTick livre no clock de referencia
+ * (HCLK/8), que continua contando com o processador em WFI, ao contrario
+ * do DWT. O contador de 24 bits da a volta a cada ~0,45 s.
+ */
+volatile uint32_t systick_voltas = 0;
+
+void SysTick_Handler(void) {
+	systick_voltas++;
+}
+
+void relogio_init(void) {
+	SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+	SysTick->VAL = 0;
+	SysTick->CTRL = SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+/* Chamar com as interrupcoes desabilitadas */
+uint64_t relogio_ler(void) {
+	uint32_t voltas = systick_voltas;
+	uint32_t val = SysTick->VAL;
+	
+	// deu a volta e o SysTick_Handler ainda nao rodou
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+		voltas++;
+		val = SysTick->VAL;
+	}
+	return ((uint64_t)voltas << 24) + (SysTick_LOAD_RELOAD_Msk - val);
+}
+
+/* Tempo dormindo e acordado, em ticks do relogio */
+struct {
+	uint64_t dormindo;
+	uint64_t acordado;
+	uint32_t n_sono;
+} sono_stats;
+
+uint64_t acordou_em = 0;
+
+/* Dorme ate a proxima interrupcao, se nao houver nada para fazer */
+void espera_evento(void) {
+	uint64_t dormiu_em;
+	
+	cpu_irq_disable();
+	// com a porta aberta o toque e ignorado
+	if ((f_touch && !flag_porta_aberta) || !event_ring_empty(&eventos) || comando_console ||
+	    alarme_rtt) {
+		cpu_irq_enable();
+		return;
+	}
+	
+	dormiu_em = relogio_ler();
+	sono_stats.acordado += dormiu_em - acordou_em;
+	sono_stats.n_sono++;
+	
+	// volta depois da ISR que acordou o processador, cujo tempo conta como dormindo
+	sleepmgr_enter_sleep();
+	
+	cpu_irq_disable();
+	acordou_em = relogio_ler();
+	sono_stats.dormindo += acordou_em - dormiu_em;
+	cpu_irq_enable();
 }
 
 
@@ -242,18 +405,39 @@ void io_init(void)
 	NVIC_SetPriority(BUT_PIO_ID, 4); // Prioridade 4
 }
 
-void font_draw_text(tFont *font, const char *text, int x, int y, int spacing) {
-	char *p = text;
-	while(*p != NULL) {
-		char letter = *p;
-		int letter_offset = letter - font->start_char;
-		if(letter <= font->end_char) {
-			tChar *current_char = font->chars + letter_offset;
-			ili9488_draw_pixmap(x, y, current_char->image->width, current_char->image->height, current_char->image->data);
-			x += current_char->image->width + spacing;
-		}
-		p++;
-	}
+/* Icons of the asset blob: false if the blob is not the one of assets.h or an icon is missing */
+bool load_icons(void) {
+	bool ok;
+	
+	if (!asset_check()) {
+		return false;
+	}
+	ok = asset_get(ASSET_WATER, &water);
+	ok &= asset_get(ASSET_RECYCLEWATER, &recyclewater);
+	ok &= asset_get(ASSET_WASH, &wash);
+	ok &= asset_get(ASSET_TUMBLEDRY, &tumbledry);
+	ok &= asset_get(ASSET_FORWARDBUTTONFORMULTIMEDIA, &forwardbuttonformultimedia);
+	ok &= asset_get(ASSET_ICON_BACKWARD, &icon_backward);
+	ok &= asset_get(ASSET_ICON_FORWARD, &icon_forward);
+	ok &= asset_get(ASSET_LOCKED, &locked);
+	ok &= asset_get(ASSET_UNLOCKED, &unlocked);
+	return ok;
+}
+
+/* Erro na partida: a mensagem fica na tela e o processador dorme para sempre */
+void erro_fatal(const char *msg) {
+	ili9488_wait_for_idle();
+	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_RED));
+	ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH-1, ILI9488_LCD_HEIGHT-1);
+	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
+	ili9488_set_background_color(COLOR_CONVERT(COLOR_RED));
+	ili9488_draw_string(10, 10, (const uint8_t *)msg);
+	ili9488_wait_for_idle();
+	
+	while (true) {
+		cpu_irq_disable();
+		sleepmgr_enter_sleep();
+	}
 }
 	
 static void configure_lcd(void){
@@ -267,168 +451,155 @@ static void configure_lcd(void){
 	ili9488_init(&g_ili9488_display_opt);
 }
 
-int processa_touch(botao *b, botao *rtn, int N ,uint32_t x, uint32_t y ){
-	for (int i=0; i<N; i++){
-		if (((x >= b->x) && (x <= b->x + b->size_x)) && ((y >= b->y) && (y <= b->y + b->size_y))){
-			*rtn = *b;
-			return 1;
-		}
-		b++;
-	}
-	return 0;
+uint16_t largura_texto(const char *text) {
+	uint32_t len = strlen(text);
+	return len ? len * (gfont.width + 2) - 2 : 0;
 }
 
-t_ciclo *initMenuOrder(){
-	c_rapido.previous = &c_enxague;
-	c_rapido.next = &c_diario;
-
-	c_diario.previous = &c_rapido;
-	c_diario.next = &c_pesado;
-
-	c_pesado.previous = &c_diario;
-	c_pesado.next = &c_enxague;
-
-	c_enxague.previous = &c_pesado;
-	c_enxague.next = &c_centrifuga;
-
-	c_centrifuga.previous = &c_enxague;
-	c_centrifuga.next = &c_rapido;
-
-	return(&c_diario);
-}
-
-void draw_info() {
-	
-	char Q[512];
-	char C[512];
-	char B[512];
-	char H[512];
-	
-	sprintf(Q, "x%d",  ciclo_atual->enxagueQnt);
-	sprintf(C, "x%d", ciclo_atual->centrifugacaoTempo);
-	sprintf(B, "%d", ciclo_atual->bubblesOn);
-	sprintf(H, "%d", ciclo_atual->heavy);
-	
-	
-		ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-		ili9488_draw_filled_rectangle(80, 40, 150, 80);
-		ili9488_draw_filled_rectangle(80, 120, 150, 160);
-		ili9488_draw_filled_rectangle(80, 200, 150, 240);
-		ili9488_draw_filled_rectangle(80, 280, 150, 320);
-		
-		ili9488_set_foreground_color(COLOR_BLACK);		
-		ili9488_draw_string(Q_X,Q_Y, Q);
-		ili9488_draw_string(C_X, C_Y, C);
-		ili9488_draw_string(B_X, B_Y, B);
-		ili9488_draw_string(H_X, H_Y, H);
-	
-}
-
-void draw_timer(int x, int y, int tempo) {
-	char A[512];
+/* Changes the text of a field, invalidating only the part of the line that is affected */
+void set_campo(campo_texto *campo, const char *text) {
+	uint16_t w, w_novo;
 	
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-	ili9488_draw_filled_rectangle(x, y, x+270, y+40);
+	if (strcmp(campo->text, text) == 0) {
+		return;
+	}
+	w = largura_texto(campo->text);
+	strncpy(campo->text, text, sizeof(campo->text) - 1);
+	
+	w_novo = largura_texto(campo->text);
+	if (w_novo > w) {
+		w = w_novo;
+	}
+	if (w > 0) {
+		dirty_invalidate(campo->box.x1, campo->box.y1,
+		                 campo->box.x1 + w - 1, campo->box.y1 + gfont.height - 1);
+	}
+}
+
+void invalida_botao(botao *but) {
+	dirty_invalidate(but->x, but->y, but->x + but->image->width - 1, but->y + but->image->height - 1);
+}
+
+void draw_info() {
+	PROF_SCOPE(PROF_DRAW_INFO);
+	
+	char Q[16];
+	char C[16];
+	char B[16];
+	char H[16];
+	
+	sprintf(Q, "x%d",  ciclo_valor(ciclo_atual, CICLO_ENXAGUE_QNT));
+	sprintf(C, "x%d", ciclo_valor(ciclo_atual, CICLO_CENTRIFUGACAO_TEMPO));
+	sprintf(B, "%d", ciclo_valor(ciclo_atual, CICLO_BUBBLES));
+	sprintf(H, "%d", ciclo_valor(ciclo_atual, CICLO_HEAVY));
+	
+	set_campo(&campo_q, Q);
+	set_campo(&campo_c, C);
+	set_campo(&campo_b, B);
+	set_campo(&campo_h, H);
+}
+
+void draw_timer(int tempo) {
+	char A[40];
 	
 	sprintf(A, "Tempo de lavagem: %d min", tempo);
+	set_campo(&campo_timer, A);
+}
+
+void draw_restante(uint32_t segundos) {
+	static const char *nome_fase[] = {"Enchendo", "Lavando", "Enxague", "Centrifuga"};
+	const wash_phase_t *fase = wash_phase();
+	char A[40];
 	
-	ili9488_set_foreground_color(COLOR_BLACK);
-	ili9488_draw_string(x, y, A);
+	if (fase == NULL) {
+		sprintf(A, "Fim da lavagem");
+	} else if (wash_state() == WASH_PAUSED) {
+		sprintf(A, "Pausado %d:%02d", (int)(segundos / 60), (int)(segundos % 60));
+	} else if (fase->type == WASH_RINSE) {
+		sprintf(A, "%s %d: %d:%02d", nome_fase[fase->type], fase->n,
+		        (int)(segundos / 60), (int)(segundos % 60));
+	} else {
+		sprintf(A, "%s: %d:%02d", nome_fase[fase->type],
+		        (int)(segundos / 60), (int)(segundos % 60));
+	}
+	set_campo(&campo_timer, A);
 }
 
-void draw_background(void) {
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-	ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH-1, ILI9488_LCD_HEIGHT-1);
+void conta_lavagem(void *arg) {
+	draw_restante((wash_remaining() + 999) / 1000);
 }
 
-void draw_botao(botao *but) {
-	ili9488_draw_pixmap(but->x, but->y, but->image->width, but->image->height, but->image->data);
+void salva_lavagem(void *arg) {
+	wash_journal_checkpoint();
 }
 
-void draw_screen(void) {
-	draw_botao(&numero_exagues);
-	draw_botao(&numero_centri);
-	draw_botao(&bubbles);
-	draw_botao(&heavy);
-	draw_botao(&but_back);
-	draw_botao(&but_next);
-	draw_botao(&but_play);
-	draw_botao(&but_lock);
-	
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_RED));
-	ili9488_draw_filled_circle(445, 30, 20);
-}
-
-void draw_screen1(void) {
-	ili9488_draw_pixmap(numero_exagues.x,
-	numero_exagues.y,
-	numero_exagues.image->width,
-	numero_exagues.image->height,
-	numero_exagues.image->data);
-	
-	ili9488_draw_pixmap(numero_centri.x,
-	numero_centri.y,
-	numero_centri.image->width,
-	numero_centri.image->height,
-	numero_centri.image->data);
-	
-	ili9488_draw_pixmap(bubbles.x,
-	bubbles.y,
-	bubbles.image->width,
-	bubbles.image->height,
-	bubbles.image->data);
-	
-	ili9488_draw_pixmap(heavy.x,
-	heavy.y,
-	heavy.image->width,
-	heavy.image->height,
-	heavy.image->data);
-	
-	ili9488_draw_pixmap(but_back.x,
-	but_back.y,
-	but_back.image->width,
-	but_back.image->height,
-	but_back.image->data);
-	
-	ili9488_draw_pixmap(but_next.x,
-	but_next.y,
-	but_next.image->width,
-	but_next.image->height,
-	but_next.image->data);
-	
-	ili9488_draw_pixmap(but_play.x,
-	but_play.y,
-	but_play.image->width,
-	but_play.image->height,
-	but_play.image->data);
-	
-	ili9488_draw_pixmap(but_lock.x,
-	but_lock.y,
-	but_lock.image->width,
-	but_lock.image->height,
-	but_lock.image->data);
-	
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_RED));
-	ili9488_draw_filled_circle(445, 30, 20);
+/* Contagem na tela e checkpoints, enquanto o programa roda */
+void timers_lavagem(bool liga) {
+	if (liga) {
+		sw_timer_start(&timer_lavagem, 1000, 1000, conta_lavagem, NULL);
+		sw_timer_start(&timer_journal, WASH_JOURNAL_PERIOD, WASH_JOURNAL_PERIOD, salva_lavagem, NULL);
+	} else {
+		sw_timer_stop(&timer_lavagem);
+		sw_timer_stop(&timer_journal);
+	}
+}
 
+/* Inicio de cada fase do programa, NULL no fim */
+void fase_lavagem(const wash_phase_t *fase) {
+	if (fase == NULL) {
+		timers_lavagem(false);
+		wash_journal_end();
+		TLOG0(TLOG_FIM);
+	} else {
+		// mudou a fase: vai tambem para a flash
+		wash_journal_checkpoint();
+		TLOG(TLOG_FASE, fase->type, fase->n, fase->duration);
+	}
+	conta_lavagem(NULL);
 }
 
-void draw_cicle(void) {
+/* Builds the list of items of the screen and invalidates all of it */
+void draw_screen(void) {
+	botao *icones[7] = {&numero_exagues, &numero_centri, &bubbles, &heavy, &but_back, &but_next, &but_play};
 	
-	char F[512];
-	sprintf(F, "Ciclo atual: %s", ciclo_atual->nome);
+	tile_init(COLOR_WHITE);
 	
+	for (int i = 0; i < 7; i++) {
+		tile_image(&item_botoes[i], icones[i]->x, icones[i]->y, icones[i]->image);
+		tile_add(&item_botoes[i]);
+	}
+	tile_image(&item_lock, but_lock.x, but_lock.y, but_lock.image);
+	tile_add(&item_lock);
 	
+	tile_circle(&item_status, STATUS_X, STATUS_Y, STATUS_R, cor_status);
+	tile_add(&item_status);
 	
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-	ili9488_draw_filled_rectangle(160, 130, 420, 170);
-
+	for (int i = 0; i < sizeof(campos)/sizeof(campos[0]); i++) {
+		campo_texto *campo = campos[i];
+		tile_text(&campo->item, campo->box.x1, campo->box.y1,
+		          campo->box.x2 - campo->box.x1 + 1, campo->text, COLOR_BLACK);
+		tile_add(&campo->item);
+	}
 	
-	ili9488_set_foreground_color(COLOR_BLACK);
-	ili9488_draw_string(160, 130, F);	
-	draw_timer(160, 170, ciclo_atual->centrifugacaoTempo+ciclo_atual->enxagueTempo);
+	dirty_invalidate(0, 0, ILI9488_LCD_WIDTH-1, ILI9488_LCD_HEIGHT-1);
+}
+
+void draw_cicle(void) {
 	
+	char F[40];
+	sprintf(F, "Ciclo atual: %s", ciclos[ciclo_atual].nome);
 	
+	set_campo(&campo_ciclo, F);
+	// com um programa em curso a linha mostra o tempo restante dele, senao
+	// o total das fases do ciclo atual, montadas como o play as monta
+	if (wash_phase() != NULL) {
+		conta_lavagem(NULL);
+	} else {
+		t_ciclo ciclo;
+		ciclo_le(ciclo_atual, &ciclo);
+		wash_load(&ciclo);
+		draw_timer((wash_total_ms() + 59999) / 60000);
+	}
 }
 
 uint32_t convert_axis_system_x(uint32_t touch_y) {
@@ -443,26 +614,6 @@ uint32_t convert_axis_system_y(uint32_t touch_x) {
 	return ILI9488_LCD_WIDTH - ILI9488_LCD_WIDTH*touch_x/4096;
 }
 
-static void RTT_init(uint16_t pllPreScale, uint32_t IrqNPulses)
-{
-	uint32_t ul_previous_time;
-
-	/* Configure RTT for a 1 second tick interrupt */
-	rtt_sel_source(RTT, false);
-	rtt_init(RTT, pllPreScale);
-	
-	ul_previous_time = rtt_read_timer_value(RTT);
-	while (ul_previous_time == rtt_read_timer_value(RTT));
-	
-	rtt_write_alarm_time(RTT, IrqNPulses+ul_previous_time);
-
-	/* Enable RTT interrupt */
-	NVIC_DisableIRQ(RTT_IRQn);
-	NVIC_ClearPendingIRQ(RTT_IRQn);
-	NVIC_SetPriority(RTT_IRQn, 0);
-	NVIC_EnableIRQ(RTT_IRQn);
-	rtt_enable_interrupt(RTT, RTT_MR_ALMIEN);
-}
 
 static void mxt_init(struct mxt_device *device)
 {
@@ -560,64 +711,95 @@ void RTT_Handler(void)
 
 	/* IRQ due to Alarm */
 	if ((ul_status & RTT_SR_ALMS) == RTT_SR_ALMS) {
-		f_rtt_alarme = 1;
+		alarme_rtt = true;
+		evento_isr(EVENT_RTT, 0);
 	}
 }
 
-void mxt_handler(struct mxt_device *device, botao *botoes, int Nbotoes)
+/* Console: command received, and transmission from the ring of serial_tx */
+void USART1_Handler(void)
 {
-	int last_status;
-	/* USART tx buffer initialized to 0 */
-	char tx_buf[STRING_LENGTH * MAX_ENTRIES] = {0};
-	uint8_t i = 0; /* Iterator */
-
-	/* Temporary touch event data struct */
-	struct mxt_touch_event touch_event;
-
-	/* Collect touch events and put the data in a string,
-	 * maximum 2 events at the time */
-	do {
-		/* Temporary buffer for each new touch event line */
-		char buf[STRING_LENGTH];
-	
-		/* Read next next touch event in the queue, discard if read fails */
-		if (mxt_read_touch_event(device, &touch_event) != STATUS_OK) {
-			continue;
+	uint32_t c;
+	
+	if (usart_is_rx_ready(USART_SERIAL_EXAMPLE) && usart_read(USART_SERIAL_EXAMPLE, &c) == 0) {
+		comando_console = c;
+	}
+	serial_tx_isr();
+}
+
+/* Ticks do relogio em us */
+static unsigned long ticks_us(uint32_t ticks, uint32_t mhz) {
+	return (unsigned long)((uint64_t)ticks * LATENCY_TICK_CYCLES / mhz);
+}
+
+/* Percentis da latencia do toque ate o ultimo byte no LCD, em us */
+void mostra_latencia(void) {
+	latency_pct_t pct;
+	uint32_t mhz = sysclk_get_cpu_hz() / 1000000;
+	
+	printf("lat: %lu toques, us p50 p95 p99 max\n\r", (unsigned long)latency_count());
+	for (int i = 0; i < LATENCY_N_SPANS; i++) {
+		if (latency_percentiles(i, &pct)) {
+			printf("%-8s %7lu %7lu %7lu %7lu\n\r", latency_span_name(i),
+			       ticks_us(pct.p50, mhz), ticks_us(pct.p95, mhz),
+			       ticks_us(pct.p99, mhz), ticks_us(pct.max, mhz));
 		}
+	}
+}
+
+/*
+ * Comandos de uma letra do console: p perfil, s perfil e amostras,
+ * l latencia do toque, c zera o perfil e a latencia
+ */
+void trata_comando(uint8_t c) {
+	switch (c) {
+	case 'p':
+		prof_report_start(false);
+		break;
+	case 's':
+		prof_report_start(true);
+		break;
+	case 'l':
+		mostra_latencia();
+		break;
+	case 'c':
+		prof_clear();
+		latency_clear();
+		printf("prof: zerado\n\r");
+		break;
+	}
+}
+
+void mxt_handler(struct mxt_device *device)
+{
+	uint8_t i, n = 0;
+	PROF_SCOPE(PROF_MXT_HANDLER);
+
+	/* Touch events of the whole queue, read in one burst */
+	struct mxt_touch_event eventos[MAX_ENTRIES];
+
+	/* Discard the batch if the read fails */
+	if (mxt_read_touch_events(device, eventos, MAX_ENTRIES, &n) != STATUS_OK) {
+		return;
+	}
+	latency_read();
+
+	/* Log the touch events and queue them for the main loop */
+	for (i = 0; i < n; i++) {
+		struct mxt_touch_event touch_event = eventos[i];
 		
 		 // eixos trocados (quando na vertical LCD)
 		uint32_t conv_y = convert_axis_system_x(touch_event.y);
 		uint32_t conv_x = convert_axis_system_y(touch_event.x);
 		
-		/* Format a new entry in the data string that will be sent over USART */
-		sprintf(buf, "Nr: %1d, X:%4d, Y:%4d, Status:0x%2x conv X:%3d Y:%3d\n\r",
-				touch_event.id, touch_event.x, touch_event.y,
-				touch_event.status, conv_x, conv_y);
+		/* Tokenized line (TLOG_TOUCH in tlog.def), put back into text on the host */
+		TLOG(TLOG_TOUCH, touch_event.id, touch_event.x, touch_event.y,
+		     touch_event.status, conv_x, conv_y);
 	
 		
-		touch_event.id, touch_event.x, touch_event.y,
-		touch_event.status, conv_x, conv_y;
-		
-		last_status = touch_event.status;
-		
-		if (last_status < 60) {
-			botao but_atual;
-			if (processa_touch(botoes, &but_atual, Nbotoes, conv_x, conv_y)){
-				but_atual.p_handler();
-			}
-		}
-		
-		/* Add the new string to the string buffer */
-		strcat(tx_buf, buf);
-		i++;
-		break;
-		/* Check if there is still messages in the queue and
-		 * if we have reached the maximum numbers of events */
-	} while ((mxt_is_message_pending(device)) & (i < MAX_ENTRIES));
-
-	/* If there is any entries in the buffer, send them over USART */
-	if (i > 0) {
-		usart_serial_write_packet(USART_SERIAL_EXAMPLE, (uint8_t *)tx_buf, strlen(tx_buf));
+		event_t ev = {.type = EVENT_TOUCH, .source = touch_event.id,
+		              .x = conv_x, .y = conv_y, .data = touch_event.status};
+		evento_post(&ev);
 	}
 }
 
@@ -680,6 +862,108 @@ void config_buttons(){
 	
 }
 
+void trata_toque(const event_t *ev) {
+	if (ev->data < 60) {
+		botao *but = hit_grid_find(ev->x, ev->y);
+		if (but) {
+			latency_dispatch();
+			but->p_handler();
+		}
+	}
+}
+
+void trata_botao(const event_t *ev) {
+	switch (ev->source) {
+	case BOTAO_BACK:
+		ciclo_atual = ciclo_anterior(ciclo_atual);
+		settings_log_cycle(ciclo_atual);
+		draw_cicle();
+		draw_info();
+		break;
+	
+	case BOTAO_NEXT:
+		ciclo_atual = ciclo_proximo(ciclo_atual);
+		settings_log_cycle(ciclo_atual);
+		draw_cicle();
+		draw_info();
+		break;
+	
+	case BOTAO_PLAY:
+		// play inicia, pausa e retoma o programa
+		if (wash_state() == WASH_RUNNING) {
+			wash_pause();
+			timers_lavagem(false);
+			wash_journal_checkpoint();
+			conta_lavagem(NULL);
+		} else if (wash_state() == WASH_PAUSED) {
+			wash_resume();
+			timers_lavagem(true);
+			wash_journal_checkpoint();
+		} else {
+			t_ciclo ciclo;
+			ciclo_le(ciclo_atual, &ciclo);
+			wash_load(&ciclo);
+			wash_journal_begin(ciclo_atual, &ciclo);
+			timers_lavagem(true);
+			wash_start(fase_lavagem);
+		}
+		break;
+	
+	case BOTAO_EXAGUES:
+		if (ciclo_valor(ciclo_atual, CICLO_ENXAGUE_QNT) <= 6) {
+			ciclo_altera(ciclo_atual, CICLO_ENXAGUE_QNT, ciclo_valor(ciclo_atual, CICLO_ENXAGUE_QNT) + 1);
+		} else {
+			ciclo_altera(ciclo_atual, CICLO_ENXAGUE_QNT, 0);
+		}
+		settings_log_field(ciclo_atual, CICLO_ENXAGUE_QNT);
+		
+		draw_cicle();
+		draw_info();
+		break;
+	
+	case BOTAO_CENTRI:
+		if (ciclo_valor(ciclo_atual, CICLO_CENTRIFUGACAO_TEMPO) <= 12) {
+			ciclo_altera(ciclo_atual, CICLO_CENTRIFUGACAO_TEMPO, ciclo_valor(ciclo_atual, CICLO_CENTRIFUGACAO_TEMPO) + 1);
+		} else {
+			ciclo_altera(ciclo_atual, CICLO_CENTRIFUGACAO_TEMPO, 0);
+		}
+		settings_log_field(ciclo_atual, CICLO_CENTRIFUGACAO_TEMPO);
+		
+		draw_cicle();
+		draw_info();
+		break;
+	
+	case BOTAO_BUBBLES:
+		ciclo_altera(ciclo_atual, CICLO_BUBBLES, !ciclo_valor(ciclo_atual, CICLO_BUBBLES));
+		settings_log_field(ciclo_atual, CICLO_BUBBLES);
+		
+		draw_info();
+		break;
+	
+	case BOTAO_HEAVY:
+		ciclo_altera(ciclo_atual, CICLO_HEAVY, !ciclo_valor(ciclo_atual, CICLO_HEAVY));
+		settings_log_field(ciclo_atual, CICLO_HEAVY);
+		
+		draw_cicle();
+		draw_info(0);
+		break;
+	}
+}
+
+void trata_rtt(const event_t *ev) {
+	// timers vencidos e proximo alarme
+	alarme_rtt = false;
+	timebase_run();
+}
+
+void trata_porta(const event_t *ev) {
+	// mensagens que chegaram com a porta aberta
+	f_touch = 1;
+	item_status.color = cor_status;
+	dirty_invalidate(STATUS_X - STATUS_R, STATUS_Y - STATUS_R,
+	                 STATUS_X + STATUS_R, STATUS_Y + STATUS_R);
+}
+
 int main(void)
 {
 	struct mxt_device device; /* Device data container */
@@ -692,130 +976,107 @@ int main(void)
 		.stopbits     = USART_SERIAL_STOP_BIT
 	};
 	
-	int timer = 100000;
-
 	sysclk_init(); /* Initialize system clocks */
 	board_init();  /* Initialize board */
+	sleepmgr_init();
+	/* SPI, XDMAC and TWIHS need the clocks running: only WFI sleep */
+	sleepmgr_lock_mode(SLEEPMGR_SLEEP_WFI);
+	tempo_init();
+	prof_init();
+	relogio_init();
+	timebase_init();
+	event_ring_init(&eventos);
 	io_init();
 	configure_lcd();
-	draw_background();
+	/* Fim das transferencias do LCD: ultimo byte do redesenho de um toque */
+	latency_init();
+	ili9488_set_transfer_callback(latency_lcd_idle);
+	/* Sem os icones nao ha tela */
+	if (!load_icons()) {
+		erro_fatal("assets.bin invalido ou incompleto:\nrefaca com tools/pack_assets.py");
+	}
+	dirty_init(tile_render);
 	config_buttons();
+	/* Ciclo escolhido e alteracoes do usuario salvos na flash */
+	ciclo_atual = 2; // Pesado
+	settings_log_init(&ciclo_atual);
+	/* Programa em curso antes do reset, nos registradores de backup ou na flash */
+	wash_journal_init();
 	/* Initialize the mXT touch device */
 	mxt_init(&device);
+	chg_init();
 	draw_screen();
-	ciclo_atual = initMenuOrder();
-	ciclo_atual = ciclo_atual->next;
 	draw_info();
 	
 	/* Initialize stdio on USART */
 	stdio_serial_init(USART_SERIAL_EXAMPLE, &usart_serial_options);
+	/* printf too goes through the ring, so its lines do not mix with the others */
+	serial_tx_init();
+	ptr_put = serial_tx_putchar;
+	usart_enable_interrupt(USART_SERIAL_EXAMPLE, US_IER_RXRDY);
 
 	printf("\n\rmaXTouch data USART transmitter\n\r");
 		
-	const botao botoes[8] = {but_lock, but_play, numero_centri, numero_exagues, bubbles, heavy, but_next, but_back};
+	hit_grid_build(botoes, numero_de_botoes);
 	
+	event_loop_init(&eventos);
+	event_register(EVENT_TOUCH, trata_toque);
+	event_register(EVENT_BUTTON, trata_botao);
+	event_register(EVENT_RTT, trata_rtt);
+	event_register(EVENT_DOOR, trata_porta);
 	
-	uint16_t pllPreScale = (int) (((float) 32768) / 1.0);
-	uint32_t irqRTTvalue  = 60; // 1 minuto
+	/* Volta direto ao programa interrompido: a tela so e desenhada no loop */
+	if (wash_journal_resume(fase_lavagem, &ciclo_atual)) {
+		if (wash_state() == WASH_RUNNING) {
+			timers_lavagem(true);
+		}
+		draw_info();
+	}
 	
 	draw_cicle();
 	
 	while (true) {
-		/* Check for any pending messages and run message handler if any
-		 * message is found in the queue */
-		if (!flag_porta_aberta)
-		{
-		if (mxt_is_message_pending(&device)) {
-			mxt_handler(&device, botoes, numero_de_botoes);
-		}
-		}
-		
-		if (f_but_back) {
-			ciclo_atual=ciclo_atual->previous;
-			draw_cicle();
-			draw_info();
-			f_but_back = 0;
-		}
+		PROF_BEGIN(PROF_MAIN_LOOP);
 		
-		if (f_but_next) {
-			ciclo_atual=ciclo_atual->previous;
-			draw_cicle();
-			draw_info();
-			f_but_next = 0;
-		}
-		
-		if (f_but_play) {
-			RTT_init(pllPreScale, 1);
-			timer = ciclo_atual->enxagueTempo + ciclo_atual->centrifugacaoTempo;
-			
-			ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-			ili9488_draw_filled_rectangle(160, 170, 450, 200);
+		/* Read the touch messages only after CHG went low */
+		if (f_touch && !flag_porta_aberta) {
+			f_touch = 0;
+			mxt_handler(&device);
 			
-			f_but_play = 0;
+			// CHG continua em baixo enquanto houver mensagens: sem nova borda
+			if (mxt_is_message_pending(&device)) {
+				f_touch = 1;
+			}
 		}
 		
-		if (f_rtt_alarme){
-					
-			// reinicia RTT para gerar um novo IRQ
-			RTT_init(pllPreScale, irqRTTvalue);
-			
-			timer -= 1;
-			draw_timer(150, 130, timer);
-			/*
-			* CLEAR FLAG
-			*/
-			f_rtt_alarme = 0;
-		}
+		/* Events in the order they happened */
+		event_dispatch();
 		
-		if (f_but_nexagues) {
-			
-			if (ciclo_atual->enxagueQnt <=6) {
-				ciclo_atual->enxagueQnt += 1;
-			} else {
-				ciclo_atual->enxagueQnt = 0;
-			}
-			
-			draw_info();
-			f_but_nexagues = 0;
+		/* Alarme cujo evento se perdeu com o anel cheio: sem ele os timers parariam */
+		if (alarme_rtt) {
+			trata_rtt(NULL);
 		}
 		
-		if (f_but_ncentri) {
-			
-			if (ciclo_atual->centrifugacaoTempo <= 12) {
-				ciclo_atual->centrifugacaoTempo += 1;
-				} else {
-				ciclo_atual->centrifugacaoTempo = 0;
-			}
-			
-			draw_info();
-			f_but_ncentri = 0;
-		}
+		/* Redraw only what changed in this iteration */
+		PROF_BEGIN(PROF_DIRTY_FLUSH);
+		dirty_flush();
+		PROF_END(PROF_DIRTY_FLUSH);
 		
-		if (f_but_bubbles) {
-			
-			if (ciclo_atual->bubblesOn) {
-				ciclo_atual->bubblesOn = 0;
-				} else {
-				ciclo_atual->bubblesOn = 1;
-			}
-			
-			draw_info();
-			f_but_bubbles = 0;
-		}
+		/* Redesenho de um toque na fila: a latencia termina com o LCD livre */
+		irqflags_t flags = cpu_irq_save();
+		latency_flushed(ili9488_is_busy());
+		cpu_irq_restore(flags);
 		
-		if (f_but_heavy) {
-			
-			if (ciclo_atual->heavy) {
-				ciclo_atual->heavy = 0;
-				} else {
-				ciclo_atual->heavy = 1;
-			}
-			
-			draw_info(0);
-			f_but_heavy = 0;
+		if (comando_console) {
+			trata_comando(comando_console);
+			comando_console = 0;
 		}
+		/* Relatorio do profiler, aos poucos, conforme cabe no anel de transmissao */
+		prof_report_poll();
 		
-		
+		/* O sono fica fora da volta medida */
+		PROF_END(PROF_MAIN_LOOP);
+		espera_evento();
 	}
 
 	return 0;
@@ -0,0 +1,124 @@
+/*
+ * maquina1.c
+ *
+ * Ciclos de lavagem: os de fabrica ficam numa tabela constante (flash) e
+ * as alteracoes do usuario numa camada de diferencas em RAM, por ciclo e
+ * por campo, que cobre o valor de fabrica enquanto existir.
+ */
+
+#include "maquina1.h"
+
+const t_ciclo ciclos[N_CICLOS] = {
+  {.nome = "Rapido",
+   .enxagueTempo = 5,
+   .enxagueQnt = 3,
+   .centrifugacaoRPM = 900,
+   .centrifugacaoTempo = 5,
+   .heavy = 0,
+   .bubblesOn = 1,
+  },
+  {.nome = "Diario",
+   .enxagueTempo = 15,
+   .enxagueQnt = 2,
+   .centrifugacaoRPM = 1200,
+   .centrifugacaoTempo = 8,
+   .heavy = 0,
+   .bubblesOn = 1,
+  },
+  {.nome = "Pesado",
+   .enxagueTempo = 10,
+   .enxagueQnt = 3,
+   .centrifugacaoRPM = 1200,
+   .centrifugacaoTempo = 10,
+   .heavy = 1,
+   .bubblesOn = 1,
+  },
+  {.nome = "Enxague",
+   .enxagueTempo = 10,
+   .enxagueQnt = 1,
+   .centrifugacaoRPM = 0,
+   .centrifugacaoTempo = 0,
+   .heavy = 0,
+   .bubblesOn = 0,
+  },
+  {.nome = "Centrifuga",
+   .enxagueTempo = 0,
+   .enxagueQnt = 0,
+   .centrifugacaoRPM = 1200,
+   .centrifugacaoTempo = 10,
+   .heavy = 0,
+   .bubblesOn = 0,
+  },
+};
+
+// bit (1 << campo) de alterado[i] indica que valor[i][campo] vale no lugar do de fabrica
+static uint8_t alterado[N_CICLOS];
+static int16_t valor[N_CICLOS][CICLO_N_CAMPOS];
+
+static int valor_fabrica(const t_ciclo *c, uint8_t campo) {
+  switch (campo) {
+    case CICLO_ENXAGUE_TEMPO:       return c->enxagueTempo;
+    case CICLO_ENXAGUE_QNT:         return c->enxagueQnt;
+    case CICLO_CENTRIFUGACAO_RPM:   return c->centrifugacaoRPM;
+    case CICLO_CENTRIFUGACAO_TEMPO: return c->centrifugacaoTempo;
+    case CICLO_HEAVY:               return c->heavy;
+    case CICLO_BUBBLES:             return c->bubblesOn;
+    default:                        return 0;
+  }
+}
+
+uint8_t ciclo_proximo(uint8_t i) {
+  return (i + 1 < N_CICLOS) ? i + 1 : 0;
+}
+
+uint8_t ciclo_anterior(uint8_t i) {
+  return (i > 0) ? i - 1 : N_CICLOS - 1;
+}
+
+// fora da tabela vale 0: os indices podem vir da flash ou do GPBR
+int ciclo_valor(uint8_t i, uint8_t campo) {
+  if (i >= N_CICLOS || campo >= CICLO_N_CAMPOS) {
+    return 0;
+  }
+  if (alterado[i] & (1 << campo)) {
+    return valor[i][campo];
+  }
+  return valor_fabrica(&ciclos[i], campo);
+}
+
+bool ciclo_alterado(uint8_t i, uint8_t campo) {
+  if (i >= N_CICLOS || campo >= CICLO_N_CAMPOS) {
+    return false;
+  }
+  return (alterado[i] >> campo) & 1;
+}
+
+// voltar ao valor de fabrica apaga a alteracao
+void ciclo_altera(uint8_t i, uint8_t campo, int v) {
+  if (i >= N_CICLOS || campo >= CICLO_N_CAMPOS) {
+    return;
+  }
+  if (v == valor_fabrica(&ciclos[i], campo)) {
+    alterado[i] &= ~(1 << campo);
+  } else {
+    valor[i][campo] = v;
+    alterado[i] |= 1 << campo;
+  }
+}
+
+void ciclo_restaura(uint8_t i) {
+  if (i < N_CICLOS) {
+    alterado[i] = 0;
+  }
+}
+
+// copia do ciclo i com as alteracoes do usuario
+void ciclo_le(uint8_t i, t_ciclo *ciclo) {
+  *ciclo = ciclos[i];
+  ciclo->enxagueTempo       = ciclo_valor(i, CICLO_ENXAGUE_TEMPO);
+  ciclo->enxagueQnt         = ciclo_valor(i, CICLO_ENXAGUE_QNT);
+  ciclo->centrifugacaoRPM   = ciclo_valor(i, CICLO_CENTRIFUGACAO_RPM);
+  ciclo->centrifugacaoTempo = ciclo_valor(i, CICLO_CENTRIFUGACAO_TEMPO);
+  ciclo->heavy              = ciclo_valor(i, CICLO_HEAVY);
+  ciclo->bubblesOn          = ciclo_valor(i, CICLO_BUBBLES);
+}
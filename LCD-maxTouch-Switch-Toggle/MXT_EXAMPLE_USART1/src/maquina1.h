@@ -1,67 +1,33 @@
 #ifndef MAQUINA1
 #define MAQUINA1
 
-typedef struct ciclo t_ciclo;
-
-struct ciclo{
-  char nome[32];           // nome do ciclo, para ser exibido
-  int  enxagueTempo;       // tempo que fica em cada enxague
-  int  enxagueQnt;         // quantidade de enxagues
-  int  centrifugacaoRPM;   // velocidade da centrifugacao
-  int  centrifugacaoTempo; // tempo que centrifuga
-  char heavy;              // modo pesado de lavagem
-  char bubblesOn;          // smart bubbles on (???)
-  t_ciclo *previous;
-  t_ciclo *next;
-};
-
-t_ciclo c_rapido = {.nome = "Rapido",
-                    .enxagueTempo = 5,
-                    .enxagueQnt = 3,
-                    .centrifugacaoRPM = 900,
-                    .centrifugacaoTempo = 5,
-                    .heavy = 0,
-                    .bubblesOn = 1
-                  };
-
-t_ciclo c_diario = {.nome = "Diario",
-                    .enxagueTempo = 15,
-                    .enxagueQnt = 2,
-                    .centrifugacaoRPM = 1200,
-                    .centrifugacaoTempo = 8,
-                    .heavy = 0,
-                    .bubblesOn = 1,
-                  };
-
-t_ciclo c_pesado = {.nome = "Pesado",
-                     .enxagueTempo = 10,
-                     .enxagueQnt = 3,
-                     .centrifugacaoRPM = 1200,
-                     .centrifugacaoTempo = 10,
-                     .heavy = 1,
-                     .bubblesOn = 1,
-                  };
-
-t_ciclo c_enxague = {.nome = "Enxague",
-                     .enxagueTempo = 10,
-                     .enxagueQnt = 1,
-                     .centrifugacaoRPM = 0,
-                     .centrifugacaoTempo = 0,
-                     .heavy = 0,
-                     .bubblesOn = 0,
-                  };
-
-t_ciclo c_centrifuga = {.nome = "Centrifuga",
-                     .enxagueTempo = 0,
-                     .enxagueQnt = 0,
-                     .centrifugacaoRPM = 1200,
-                     .centrifugacaoTempo = 10,
-                     .heavy = 0,
-                     .bubblesOn = 0,
+#include <stdint.h>
+#include <stdbool.h>
+#include "tipos.h"
+
+// ciclos de fabrica, na ordem em que aparecem no menu (circular)
+#define N_CICLOS 5
+
+extern const t_ciclo ciclos[N_CICLOS];
+
+// campos do ciclo que o usuario pode alterar
+enum {
+  CICLO_ENXAGUE_TEMPO,
+  CICLO_ENXAGUE_QNT,
+  CICLO_CENTRIFUGACAO_RPM,
+  CICLO_CENTRIFUGACAO_TEMPO,
+  CICLO_HEAVY,
+  CICLO_BUBBLES,
+  CICLO_N_CAMPOS
 };
 
+uint8_t ciclo_proximo(uint8_t i);
+uint8_t ciclo_anterior(uint8_t i);
 
-t_ciclo *initMenuOrder();
+int  ciclo_valor(uint8_t i, uint8_t campo);
+bool ciclo_alterado(uint8_t i, uint8_t campo);
+void ciclo_altera(uint8_t i, uint8_t campo, int valor);
+void ciclo_restaura(uint8_t i);
+void ciclo_le(uint8_t i, t_ciclo *ciclo);
 
 #endif
-
@@ -0,0 +1,231 @@
+/*
+ * prof.c
+ *
+ * Bookkeeping of the zones of the profiler, and its report.
+ *
+ * A sample is counted with interrupts masked, since zones end in the main
+ * loop and in interrupts alike. As in serial_tx.c, the index of the ring
+ * runs free and is reduced modulo PROF_RING_SIZE on access; the oldest
+ * sample is overwritten.
+ *
+ * The report is taken as a snapshot when it starts and goes out one line
+ * at a time, only while serial_tx has room for the line, so it never
+ * drops lines of the others nor its own.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "prof.h"
+#include "serial_tx.h"
+
+#define PROF_RING_MASK (PROF_RING_SIZE - 1)
+
+#if (PROF_RING_SIZE & PROF_RING_MASK) != 0
+#error "PROF_RING_SIZE must be a power of 2"
+#endif
+
+#ifdef PROF_HOST
+#  define PROF_IRQ_SAVE()      0
+#  define PROF_IRQ_RESTORE(f)  ((void)(f))
+#else
+#  define PROF_IRQ_SAVE()      cpu_irq_save()
+#  define PROF_IRQ_RESTORE(f)  cpu_irq_restore(f)
+#endif
+
+static const char *const zone_names[PROF_N_ZONES] = {
+#define PROF_ZONE(id, name) name,
+#include "prof.def"
+#undef PROF_ZONE
+};
+
+static prof_stats_t stats[PROF_N_ZONES];
+static prof_sample_t ring[PROF_RING_SIZE];
+static uint32_t ring_head;
+
+/* Report being sent: snapshot and next line, -1 when there is none */
+static struct {
+	int32_t line;
+	uint32_t n_lines;
+	uint32_t n_samples;
+	prof_stats_t stats[PROF_N_ZONES];
+	prof_sample_t samples[PROF_RING_SIZE];
+} report = {.line = -1};
+
+void prof_init(void)
+{
+#ifndef PROF_HOST
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+	prof_clear();
+	report.line = -1;
+}
+
+void prof_clear(void)
+{
+	uint32_t flags = PROF_IRQ_SAVE();
+
+	memset(stats, 0, sizeof(stats));
+	for (uint32_t i = 0; i < PROF_N_ZONES; i++) {
+		stats[i].min = UINT32_MAX;
+	}
+	ring_head = 0;
+	PROF_IRQ_RESTORE(flags);
+}
+
+uint32_t prof_bucket(uint32_t cycles)
+{
+	uint32_t log2 = 31 - __builtin_clz(cycles | 1);
+	uint32_t bucket;
+
+	if (log2 < 10) {
+		return 0;
+	}
+	bucket = (log2 - 10) / 2 + 1;
+	return bucket < PROF_HIST_BUCKETS ? bucket : PROF_HIST_BUCKETS - 1;
+}
+
+/* Fewest cycles of a duration counted in the bucket */
+uint32_t prof_bucket_floor(uint32_t bucket)
+{
+	return bucket ? 1024u << (2 * (bucket - 1)) : 0;
+}
+
+void prof_record(enum prof_zone zone, uint32_t start, uint32_t cycles)
+{
+	prof_stats_t *s = &stats[zone];
+	prof_sample_t *sample;
+	uint32_t flags = PROF_IRQ_SAVE();
+
+	s->count++;
+	s->total += cycles;
+	if (cycles < s->min) {
+		s->min = cycles;
+	}
+	if (cycles > s->max) {
+		s->max = cycles;
+	}
+	s->hist[prof_bucket(cycles)]++;
+
+	sample = &ring[ring_head++ & PROF_RING_MASK];
+	sample->start = start;
+	sample->cycles = cycles;
+	sample->zone = zone;
+	PROF_IRQ_RESTORE(flags);
+}
+
+void prof_end(enum prof_zone zone, uint32_t start)
+{
+	/* Unsigned difference: right across a wrap of the counter */
+	prof_record(zone, start, PROF_CYCLES() - start);
+}
+
+void prof_get(enum prof_zone zone, prof_stats_t *out)
+{
+	uint32_t flags = PROF_IRQ_SAVE();
+
+	*out = stats[zone];
+	PROF_IRQ_RESTORE(flags);
+}
+
+/* Copies the last samples, up to max, the oldest first; returns how many */
+uint32_t prof_samples(prof_sample_t *out, uint32_t max)
+{
+	uint32_t flags = PROF_IRQ_SAVE();
+	uint32_t n = ring_head < PROF_RING_SIZE ? ring_head : PROF_RING_SIZE;
+
+	if (n > max) {
+		n = max;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		out[i] = ring[(ring_head - n + i) & PROF_RING_MASK];
+	}
+	PROF_IRQ_RESTORE(flags);
+	return n;
+}
+
+const char *prof_zone_name(enum prof_zone zone)
+{
+	return zone < PROF_N_ZONES ? zone_names[zone] : "?";
+}
+
+/*
+ * Starts sending the statistics of every zone (a line with count, min,
+ * avg and max in cycles, and one with the histogram), then the samples of
+ * the ring if asked. A report still being sent starts over.
+ */
+void prof_report_start(bool samples)
+{
+	for (uint32_t i = 0; i < PROF_N_ZONES; i++) {
+		prof_get(i, &report.stats[i]);
+	}
+	report.n_samples = samples ? prof_samples(report.samples, PROF_RING_SIZE) : 0;
+	report.n_lines = 1 + 2 * PROF_N_ZONES + (samples ? 1 + report.n_samples : 0);
+	report.line = 0;
+}
+
+static uint32_t format_line(char *buf, uint32_t size, uint32_t line)
+{
+	static const char *const hist_names[PROF_HIST_BUCKETS] = {
+		"<1k", "<4k", "<16k", "<64k", "<256k", "<1M", "<4M", ">4M"
+	};
+	const prof_stats_t *s;
+	uint32_t zone;
+	int n;
+
+	if (line == 0) {
+		return snprintf(buf, size, "prof: zone count min avg max (cycles)\n\r");
+	}
+	line--;
+
+	if (line < 2 * PROF_N_ZONES) {
+		zone = line / 2;
+		s = &report.stats[zone];
+		if (line % 2 == 0) {
+			return snprintf(buf, size, "%-12s %7lu %9lu %9lu %9lu\n\r", zone_names[zone],
+			                (unsigned long)s->count,
+			                (unsigned long)(s->count ? s->min : 0),
+			                (unsigned long)(s->count ? s->total / s->count : 0),
+			                (unsigned long)s->max);
+		}
+		n = snprintf(buf, size, "   ");
+		for (uint32_t i = 0; i < PROF_HIST_BUCKETS; i++) {
+			n += snprintf(buf + n, size - n, " %s %lu", hist_names[i], (unsigned long)s->hist[i]);
+		}
+		return n + snprintf(buf + n, size - n, "\n\r");
+	}
+	line -= 2 * PROF_N_ZONES;
+
+	if (line == 0) {
+		return snprintf(buf, size, "prof: last %lu samples, start and cycles\n\r",
+		                (unsigned long)report.n_samples);
+	}
+	line--;
+	return snprintf(buf, size, "%-12s %10lu %9lu\n\r",
+	                prof_zone_name(report.samples[line].zone),
+	                (unsigned long)report.samples[line].start,
+	                (unsigned long)report.samples[line].cycles);
+}
+
+/*
+ * Sends the lines of the report that fit in serial_tx now. Called from
+ * the main loop; returns true while lines are left.
+ */
+bool prof_report_poll(void)
+{
+	char buf[96];
+	uint32_t len;
+
+	while (report.line >= 0 && (uint32_t)report.line < report.n_lines) {
+		len = format_line(buf, sizeof(buf), report.line);
+		if (len >= sizeof(buf)) {
+			len = sizeof(buf) - 1;
+		}
+		if (serial_tx_free() < len || !serial_tx_write(buf, len)) {
+			return true;
+		}
+		report.line++;
+	}
+	report.line = -1;
+	return false;
+}
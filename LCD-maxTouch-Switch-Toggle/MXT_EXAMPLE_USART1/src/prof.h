@@ -0,0 +1,103 @@
+/*
+ * prof.h
+ *
+ * Profiler of the hot paths, on the cycle counter of the core (DWT
+ * CYCCNT). A zone is timed from PROF_BEGIN() to PROF_END(), or over the
+ * rest of the block of PROF_SCOPE(). Each zone keeps its count, min, max,
+ * total and a histogram of its durations; every sample also goes to a
+ * ring that keeps the last PROF_RING_SIZE of them, in order.
+ *
+ * Zones can be timed in interrupts too. A zone of the thread counts the
+ * interrupts that preempt it. The zones are listed in prof.def.
+ *
+ * With PROF_HOST the cycles come from prof_host_cycles(), given by the
+ * host tests, and nothing of the device is used.
+ */
+
+
+#ifndef PROF_H_
+#define PROF_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef PROF_HOST
+uint32_t prof_host_cycles(void);
+#  define PROF_CYCLES() prof_host_cycles()
+#else
+#  include <asf.h>
+/* Started by tempo_init() of main.c, or by prof_init() */
+#  define PROF_CYCLES() (DWT->CYCCNT)
+#endif
+
+enum prof_zone {
+#define PROF_ZONE(id, name) id,
+#include "prof.def"
+#undef PROF_ZONE
+	PROF_N_ZONES
+};
+
+/*
+ * Bucket 0 of the histogram holds the durations under 1024 cycles, bucket
+ * i the ones from 4^(i - 1) * 1024 up to 4 times that, and the last one
+ * everything above: 1k 4k 16k 64k 256k 1M 4M cycles, 3.4 us to 14 ms at
+ * 300 MHz.
+ */
+#define PROF_HIST_BUCKETS 8
+
+/* Samples kept, must be a power of 2 */
+#define PROF_RING_SIZE 64
+
+typedef struct {
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+	uint32_t hist[PROF_HIST_BUCKETS];
+} prof_stats_t;
+
+typedef struct {
+	uint32_t start;     /* cycle counter at the begin */
+	uint32_t cycles;
+	uint8_t zone;
+} prof_sample_t;
+
+typedef struct {
+	uint8_t zone;
+	uint32_t start;
+} prof_scope_t;
+
+void prof_init(void);
+void prof_clear(void);
+void prof_end(enum prof_zone zone, uint32_t start);
+void prof_record(enum prof_zone zone, uint32_t start, uint32_t cycles);
+void prof_get(enum prof_zone zone, prof_stats_t *stats);
+uint32_t prof_samples(prof_sample_t *out, uint32_t max);
+uint32_t prof_bucket(uint32_t cycles);
+uint32_t prof_bucket_floor(uint32_t bucket);
+const char *prof_zone_name(enum prof_zone zone);
+
+/* Report on the console, through serial_tx */
+void prof_report_start(bool samples);
+bool prof_report_poll(void);
+
+static inline uint32_t prof_begin(void)
+{
+	return PROF_CYCLES();
+}
+
+static inline void prof_scope_end(prof_scope_t *scope)
+{
+	prof_end((enum prof_zone)scope->zone, scope->start);
+}
+
+#define PROF_BEGIN(zone) uint32_t prof_start_##zone = prof_begin()
+#define PROF_END(zone)   prof_end((zone), prof_start_##zone)
+
+/* Times the rest of the block, however it is left */
+#define PROF_SCOPE(zone) \
+	prof_scope_t prof_scope_##zone __attribute__((cleanup(prof_scope_end))) = \
+		{(zone), prof_begin()}
+
+
+#endif /* PROF_H_ */
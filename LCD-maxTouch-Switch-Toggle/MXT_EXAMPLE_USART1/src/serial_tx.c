@@ -0,0 +1,119 @@
+/*
+ * serial_tx.c
+ *
+ * Ring buffer of the console transmission.
+ *
+ * As in event_ring.c, head and tail run free and are reduced modulo
+ * SERIAL_TX_SIZE on access; the main loop only moves head and the
+ * interrupt only moves tail. The TXRDY interrupt is enabled by every write
+ * and disabled by the handler once the ring is empty; the enable comes
+ * after the new head is published, so the handler cannot miss the bytes.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "serial_tx.h"
+
+#define SERIAL_TX_MASK (SERIAL_TX_SIZE - 1)
+
+#if (SERIAL_TX_SIZE & SERIAL_TX_MASK) != 0
+#error "SERIAL_TX_SIZE must be a power of 2"
+#endif
+
+#define TX_USART    CONSOLE_UART
+#define TX_USART_ID CONSOLE_UART_ID
+
+static uint8_t buffer[SERIAL_TX_SIZE];
+static uint32_t head;   /* written only by the main loop */
+static uint32_t tail;   /* written only by the interrupt */
+
+serial_tx_stats_t serial_tx_stats;
+
+/* The USART must be configured already (stdio_serial_init()) */
+void serial_tx_init(void)
+{
+	head = 0;
+	tail = 0;
+	serial_tx_stats = (serial_tx_stats_t){0};
+
+	usart_disable_interrupt(TX_USART, US_IDR_TXRDY);
+	NVIC_DisableIRQ((IRQn_Type)TX_USART_ID);
+	NVIC_ClearPendingIRQ((IRQn_Type)TX_USART_ID);
+	NVIC_SetPriority((IRQn_Type)TX_USART_ID, 5);
+	NVIC_EnableIRQ((IRQn_Type)TX_USART_ID);
+}
+
+/*
+ * Copies len bytes to the ring and returns at once. Returns false, and
+ * sends nothing of them, if they do not fit.
+ */
+bool serial_tx_write(const void *data, uint32_t len)
+{
+	uint32_t t = __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+	uint32_t at = head & SERIAL_TX_MASK;
+	uint32_t first;
+
+	if (len > SERIAL_TX_SIZE - (head - t)) {
+		serial_tx_stats.dropped += len;
+		serial_tx_stats.overflows++;
+		return false;
+	}
+
+	/* At most two copies: up to the end of the buffer, then from its start */
+	first = SERIAL_TX_SIZE - at;
+	if (first > len) {
+		first = len;
+	}
+	memcpy(&buffer[at], data, first);
+	memcpy(buffer, (const uint8_t *)data + first, len - first);
+
+	__atomic_store_n(&head, head + len, __ATOMIC_RELEASE);
+	if (head - t > serial_tx_stats.max_used) {
+		serial_tx_stats.max_used = head - t;
+	}
+	usart_enable_interrupt(TX_USART, US_IER_TXRDY);
+	return true;
+}
+
+uint32_t serial_tx_free(void)
+{
+	return SERIAL_TX_SIZE - (head - __atomic_load_n(&tail, __ATOMIC_ACQUIRE));
+}
+
+/* Waits until everything written is out, before a reset for example */
+void serial_tx_flush(void)
+{
+	while (__atomic_load_n(&tail, __ATOMIC_ACQUIRE) != head) {
+		/* With the interrupts masked nobody else empties the ring */
+		if (!cpu_irq_is_enabled()) {
+			serial_tx_isr();
+		}
+	}
+	while (!usart_is_tx_empty(TX_USART)) {
+	}
+}
+
+/* From the handler of the USART */
+void serial_tx_isr(void)
+{
+	uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+	uint32_t t = tail;
+	uint32_t start = t;
+
+	while (t != h && usart_is_tx_ready(TX_USART)) {
+		usart_write(TX_USART, buffer[t & SERIAL_TX_MASK]);
+		t++;
+	}
+	if (t == h) {
+		usart_disable_interrupt(TX_USART, US_IDR_TXRDY);
+	}
+	serial_tx_stats.sent += t - start;
+	__atomic_store_n(&tail, t, __ATOMIC_RELEASE);
+}
+
+/* For ptr_put of stdio: printf goes through the ring too, byte by byte */
+int serial_tx_putchar(void volatile *usart, char c)
+{
+	serial_tx_write(&c, 1);
+	return 1;
+}
@@ -0,0 +1,41 @@
+/*
+ * serial_tx.h
+ *
+ * Transmission on the console USART through a ring buffer, emptied by
+ * the TXRDY interrupt: writing only copies the bytes to the ring, so it
+ * takes microseconds instead of the whole time the line takes on the wire.
+ *
+ * Only the main loop writes, and only the interrupt reads. A write that
+ * does not fit in the ring is dropped whole and counted (drop newest), so
+ * the lines that do go out are never cut; what is already in the ring is
+ * sent as it was written.
+ */
+
+
+#ifndef SERIAL_TX_H_
+#define SERIAL_TX_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Bytes of the ring, must be a power of 2: about 90 ms at 115200 baud */
+#define SERIAL_TX_SIZE 1024
+
+typedef struct {
+	uint32_t sent;       /* bytes written to the USART */
+	uint32_t dropped;    /* bytes of the writes that did not fit */
+	uint32_t overflows;  /* writes dropped */
+	uint32_t max_used;   /* most bytes waiting in the ring at once */
+} serial_tx_stats_t;
+
+void serial_tx_init(void);
+bool serial_tx_write(const void *data, uint32_t len);
+uint32_t serial_tx_free(void);
+void serial_tx_flush(void);
+void serial_tx_isr(void);
+int serial_tx_putchar(void volatile *usart, char c);
+
+extern serial_tx_stats_t serial_tx_stats;
+
+
+#endif /* SERIAL_TX_H_ */
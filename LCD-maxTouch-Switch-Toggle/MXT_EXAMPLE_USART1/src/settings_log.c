@@ -0,0 +1,284 @@
+/*
+ * settings_log.c
+ *
+ * Log of the cycle settings in the flash.
+ *
+ * The region is split in blocks of FLASH_EFC_BLOCK_SIZE bytes, used one at
+ * a time in a ring. Each block holds records of FLASH_EFC_CHUNK bytes, the
+ * first one being the block header. A new block is written in this order:
+ * erase, a copy of the current settings, and the header last, so a block
+ * only counts once the copy is complete; until then the previous block is
+ * still the newest one. Every record carries the generation of its block,
+ * which keeps records left over from an older use of the block out.
+ */
+
+#include <stddef.h>
+#include "flash_efc.h"
+#include "maquina1.h"
+#include "settings_log.h"
+#include "wash_program.h"
+
+#define BLOCKS (FLASH_EFC_SIZE / FLASH_EFC_BLOCK_SIZE)
+#define SLOTS  (FLASH_EFC_BLOCK_SIZE / FLASH_EFC_CHUNK)
+
+enum record_type {
+	REC_BLOCK = 0xB1,
+	REC_FIELD = 0xF1,
+	REC_CYCLE = 0xC1,
+	REC_WASH  = 0xA1,
+};
+
+typedef struct {
+	uint32_t generation;
+	uint8_t type;
+	uint8_t ciclo;
+	uint8_t campo;      /* REC_WASH: phase */
+	uint8_t estado;     /* REC_WASH: state */
+	int16_t valor;      /* REC_WASH: s run of the phase */
+	uint16_t programa;  /* REC_WASH: fingerprint of the settings */
+	uint8_t reserved[2];
+	uint16_t crc;
+} record_t;
+
+typedef char record_size_check[sizeof(record_t) == FLASH_EFC_CHUNK ? 1 : -1];
+
+settings_log_stats_t settings_log_stats;
+
+static uint32_t block = BLOCKS - 1;
+static uint32_t next = SLOTS;
+static uint32_t generation;
+static uint8_t selecionado;
+/* Last checkpoint of the wash program, copied to every new block */
+static wash_checkpoint_t lavagem;
+
+/* CRC-16/CCITT of the record up to the crc field */
+static uint16_t crc16(const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	uint16_t crc = 0xFFFF;
+
+	while (len--) {
+		crc ^= (uint16_t)*p++ << 8;
+		for (int i = 0; i < 8; i++) {
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+static const record_t *record_at(uint32_t b, uint32_t slot)
+{
+	return flash_efc_ptr(b * FLASH_EFC_BLOCK_SIZE + slot * FLASH_EFC_CHUNK);
+}
+
+static bool blank(const record_t *r)
+{
+	const uint32_t *w = (const uint32_t *)r;
+
+	for (int i = 0; i < FLASH_EFC_CHUNK / 4; i++) {
+		if (w[i] != 0xFFFFFFFF) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool valid(const record_t *r)
+{
+	return r->crc == crc16(r, offsetof(record_t, crc));
+}
+
+/* Writes at the next slot of the block in use, which must not be full */
+static bool put_record(record_t *r)
+{
+	uint32_t slot = (r->type == REC_BLOCK) ? 0 : next++;
+
+	r->generation = generation;
+	r->crc = crc16(r, offsetof(record_t, crc));
+	if (!flash_efc_write(block * FLASH_EFC_BLOCK_SIZE + slot * FLASH_EFC_CHUNK, r)) {
+		settings_log_stats.errors++;
+		return false;
+	}
+	return true;
+}
+
+static bool put(uint8_t type, uint8_t ciclo, uint8_t campo, int valor)
+{
+	record_t r = {
+		.type = type,
+		.ciclo = ciclo,
+		.campo = campo,
+		.valor = valor,
+	};
+
+	return put_record(&r);
+}
+
+static bool put_wash(void)
+{
+	record_t r = {
+		.type = REC_WASH,
+		.ciclo = lavagem.ciclo,
+		.campo = lavagem.phase,
+		.estado = lavagem.state,
+		.valor = (int16_t)lavagem.elapsed,
+		.programa = lavagem.program,
+	};
+
+	return put_record(&r);
+}
+
+/* Moves to the next block of the ring with a copy of the settings */
+static bool start_block(void)
+{
+	uint32_t b = (block + 1) % BLOCKS;
+
+	if (!flash_efc_erase(b * FLASH_EFC_BLOCK_SIZE)) {
+		settings_log_stats.errors++;
+		return false;
+	}
+	block = b;
+	generation++;
+	next = 1;
+
+	put(REC_CYCLE, selecionado, 0, 0);
+	for (uint8_t i = 0; i < N_CICLOS; i++) {
+		for (uint8_t campo = 0; campo < CICLO_N_CAMPOS; campo++) {
+			if (ciclo_alterado(i, campo)) {
+				put(REC_FIELD, i, campo, ciclo_valor(i, campo));
+			}
+		}
+	}
+	if (lavagem.state != WASH_IDLE) {
+		put_wash();
+	}
+	if (!put(REC_BLOCK, 0, 0, 0)) {
+		/* Not a block without its header: the next write starts another one */
+		next = SLOTS;
+		return false;
+	}
+	settings_log_stats.generation = generation;
+	return true;
+}
+
+/* Makes room for one record, starting a block if needed */
+static bool reserve(void)
+{
+	return next < SLOTS || start_block();
+}
+
+static bool append(uint8_t type, uint8_t ciclo, uint8_t campo, int valor)
+{
+	bool ok;
+
+	if (!reserve()) {
+		return false;
+	}
+	ok = put(type, ciclo, campo, valor);
+	settings_log_stats.free = SLOTS - next;
+	return ok;
+}
+
+/*
+ * Applies the settings found in the flash to the cycles and to *ciclo,
+ * which keeps its value if no cycle was ever selected.
+ */
+void settings_log_init(uint8_t *ciclo)
+{
+	const record_t *r;
+	bool found = false;
+
+	settings_log_stats = (settings_log_stats_t){0};
+	selecionado = *ciclo;
+	lavagem = (wash_checkpoint_t){.state = WASH_IDLE};
+
+	/* Newest complete block */
+	for (uint32_t b = 0; b < BLOCKS; b++) {
+		r = record_at(b, 0);
+		if (r->type == REC_BLOCK && valid(r) &&
+		    (!found || (int32_t)(r->generation - generation) > 0)) {
+			block = b;
+			generation = r->generation;
+			found = true;
+		}
+	}
+	if (!found) {
+		/* Blank region: the first record starts block 0 */
+		block = BLOCKS - 1;
+		generation = 0;
+		next = SLOTS;
+		return;
+	}
+
+	/* Records in the order they were written; the next one goes after the last */
+	next = 1;
+	for (uint32_t slot = 1; slot < SLOTS; slot++) {
+		r = record_at(block, slot);
+		if (blank(r)) {
+			continue;
+		}
+		next = slot + 1;
+		if (!valid(r) || r->generation != generation) {
+			settings_log_stats.bad++;
+			continue;
+		}
+		if (r->type == REC_FIELD) {
+			ciclo_altera(r->ciclo, r->campo, r->valor);
+		} else if (r->type == REC_CYCLE && r->ciclo < N_CICLOS) {
+			selecionado = r->ciclo;
+		} else if (r->type == REC_WASH && r->ciclo < N_CICLOS) {
+			lavagem.ciclo = r->ciclo;
+			lavagem.phase = r->campo;
+			lavagem.state = r->estado;
+			lavagem.elapsed = (uint16_t)r->valor;
+			lavagem.program = r->programa;
+		} else {
+			settings_log_stats.bad++;
+			continue;
+		}
+		settings_log_stats.replayed++;
+	}
+
+	*ciclo = selecionado;
+	settings_log_stats.generation = generation;
+	settings_log_stats.free = SLOTS - next;
+}
+
+/* Saves the current value of a field of a cycle, after ciclo_altera() */
+bool settings_log_field(uint8_t ciclo, uint8_t campo)
+{
+	return append(REC_FIELD, ciclo, campo, ciclo_valor(ciclo, campo));
+}
+
+bool settings_log_cycle(uint8_t ciclo)
+{
+	selecionado = ciclo;
+	return append(REC_CYCLE, ciclo, 0, 0);
+}
+
+/*
+ * Saves a checkpoint of the wash program; one with state WASH_IDLE ends
+ * it, and is not copied to the next blocks.
+ */
+bool settings_log_wash(const wash_checkpoint_t *cp)
+{
+	bool ok;
+
+	lavagem = *cp;
+	if (!reserve()) {
+		return false;
+	}
+	ok = put_wash();
+	settings_log_stats.free = SLOTS - next;
+	return ok;
+}
+
+/* Last checkpoint found by settings_log_init() or saved since, if running */
+bool settings_log_wash_last(wash_checkpoint_t *cp)
+{
+	if (lavagem.state != WASH_RUNNING && lavagem.state != WASH_PAUSED) {
+		return false;
+	}
+	*cp = lavagem;
+	return true;
+}
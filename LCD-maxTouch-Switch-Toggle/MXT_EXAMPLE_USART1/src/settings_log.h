@@ -0,0 +1,44 @@
+/*
+ * settings_log.h
+ *
+ * The user's changes to the cycles (maquina1.h) and the selected cycle,
+ * kept across resets in a log in the internal flash (flash_efc.h).
+ *
+ * Every change appends a record with a CRC to the block in use; when the
+ * block is full the current settings are copied to the next block, in a
+ * ring over all the blocks of the region, so the erases are spread over
+ * them. At boot settings_log_init() finds the newest block from the block
+ * headers and replays its records in one pass; a record cut by a power
+ * loss fails its CRC and is skipped.
+ *
+ * The log also keeps the flash copy of the checkpoints of the wash
+ * program (wash_journal.h), one record each.
+ */
+
+
+#ifndef SETTINGS_LOG_H_
+#define SETTINGS_LOG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "wash_journal.h"
+
+/* Records found by settings_log_init(), writes that failed */
+typedef struct {
+	uint32_t generation; /* blocks started since the region was blank */
+	uint16_t replayed;
+	uint16_t bad;        /* records skipped for a bad CRC */
+	uint16_t free;       /* records left in the block in use */
+	uint16_t errors;
+} settings_log_stats_t;
+
+void settings_log_init(uint8_t *ciclo);
+bool settings_log_field(uint8_t ciclo, uint8_t campo);
+bool settings_log_cycle(uint8_t ciclo);
+bool settings_log_wash(const wash_checkpoint_t *cp);
+bool settings_log_wash_last(wash_checkpoint_t *cp);
+
+extern settings_log_stats_t settings_log_stats;
+
+
+#endif /* SETTINGS_LOG_H_ */
@@ -0,0 +1,369 @@
+/*
+ * tile_render.c
+ *
+ * Tile renderer for the 18 bits SPI interface of the ILI9488 (3 bytes per
+ * pixel, same layout as the R8G8B8 icons).
+ */
+
+#include <string.h>
+#include "tile_render.h"
+#include "image_rle.h"
+#include "ili9488.h"
+#include "prof.h"
+
+#define TILE_BYTES_PER_PIXEL 3
+
+/* Two tiles: one is composited while the other is sent by the XDMAC */
+static uint8_t tiles[2][TILE_SIZE * TILE_SIZE * TILE_BYTES_PER_PIXEL];
+static uint32_t tile_atual;
+
+static tile_item *items[TILE_MAX_ITEMS];
+static uint32_t n_items;
+static uint32_t cor_fundo;
+
+/* Area of the current tile, inclusive corners */
+static uint16_t t_x1, t_y1, t_x2, t_y2;
+
+#ifdef ILI9488_STATS_ENABLED
+static tile_stats_t stats[TILE_STATS_COUNT];
+static const char *const stats_names[TILE_STATS_COUNT] = {
+	"fill", "image", "text", "circle", "background"
+};
+/* Kind painted last on each pixel of the tile being composited */
+static uint8_t dono[TILE_SIZE * TILE_SIZE];
+/* Pixels of each kind in the tile sent last, the one a wait is for */
+static uint32_t enviados[TILE_STATS_COUNT];
+static uint32_t stats_inicio;
+
+#  define STATS_OWN(x, y, n, kind) \
+	memset(&dono[((y) - t_y1) * (t_x2 - t_x1 + 1) + ((x) - t_x1)], (kind), (n))
+#  define STATS_BEGIN()            (stats_inicio = PROF_CYCLES())
+#  define STATS_PAINT(kind, c)     stats_paint((kind), (c))
+#  define STATS_WAIT()             stats_wait(PROF_CYCLES() - stats_inicio)
+#  define STATS_SENT()             stats_sent()
+#else
+#  define STATS_OWN(x, y, n, kind)
+#  define STATS_BEGIN()
+#  define STATS_PAINT(kind, c)
+#  define STATS_WAIT()
+#  define STATS_SENT()
+#endif
+
+void tile_init(uint32_t background)
+{
+	n_items = 0;
+	cor_fundo = background;
+}
+
+bool tile_add(tile_item *item)
+{
+	if (n_items >= TILE_MAX_ITEMS) {
+		return false;
+	}
+	items[n_items++] = item;
+	return true;
+}
+
+void tile_fill(tile_item *item, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t color)
+{
+	memset(item, 0, sizeof(*item));
+	item->tipo = TILE_FILL;
+	item->visible = true;
+	item->x = x;
+	item->y = y;
+	item->w = w;
+	item->h = h;
+	item->color = color;
+}
+
+void tile_image(tile_item *item, uint16_t x, uint16_t y, const tImage *image)
+{
+	tile_fill(item, x, y, image->width, image->height, 0);
+	item->tipo = TILE_IMAGE;
+	item->image = image;
+}
+
+void tile_text(tile_item *item, uint16_t x, uint16_t y, uint16_t w, const char *text, uint32_t color)
+{
+	tile_fill(item, x, y, w, gfont.height, color);
+	item->tipo = TILE_TEXT;
+	item->text = text;
+}
+
+/* x, y is the center of the circle */
+void tile_circle(tile_item *item, uint16_t x, uint16_t y, uint16_t r, uint32_t color)
+{
+	tile_fill(item, x - r, y - r, 2 * r + 1, 2 * r + 1, color);
+	item->tipo = TILE_CIRCLE;
+}
+
+static inline uint8_t *tile_pixel(uint8_t *tile, uint32_t x, uint32_t y)
+{
+	return tile + ((y - t_y1) * (t_x2 - t_x1 + 1) + (x - t_x1)) * TILE_BYTES_PER_PIXEL;
+}
+
+static inline void put_color(uint8_t *p, uint32_t color)
+{
+	p[0] = color >> 16;
+	p[1] = color >> 8;
+	p[2] = color & 0xFF;
+}
+
+/* Part of the item inside the current tile */
+static bool clip(const tile_item *item, dirty_rect_t *c)
+{
+	uint16_t w = item->w, h = item->h;
+
+	if (item->tipo == TILE_IMAGE) {
+		w = item->image->width;
+		h = item->image->height;
+	}
+	if (w == 0 || h == 0) {
+		return false;
+	}
+	c->x1 = item->x > t_x1 ? item->x : t_x1;
+	c->y1 = item->y > t_y1 ? item->y : t_y1;
+	c->x2 = item->x + w - 1 < t_x2 ? item->x + w - 1 : t_x2;
+	c->y2 = item->y + h - 1 < t_y2 ? item->y + h - 1 : t_y2;
+	return (c->x1 <= c->x2) && (c->y1 <= c->y2);
+}
+
+static void fill_area(uint8_t *tile, const dirty_rect_t *c, uint32_t color)
+{
+	uint32_t x, y;
+
+	for (y = c->y1; y <= c->y2; y++) {
+		uint8_t *p = tile_pixel(tile, c->x1, y);
+		for (x = c->x1; x <= c->x2; x++) {
+			put_color(p, color);
+			p += TILE_BYTES_PER_PIXEL;
+		}
+	}
+}
+
+static void paint_fill(uint8_t *tile, const tile_item *item, const dirty_rect_t *c)
+{
+	fill_area(tile, c, COLOR_CONVERT(item->color));
+}
+
+/* Expands the indexes of a palette image through the palette */
+static void paint_indexed(uint8_t *tile, const tile_item *item, const dirty_rect_t *c)
+{
+	const tImage *image = item->image;
+	uint32_t stride = (image->width * image->bpp + 7) / 8;
+	uint32_t mask = (1 << image->bpp) - 1;
+	uint32_t x, y, bit;
+
+	for (y = c->y1; y <= c->y2; y++) {
+		const uint8_t *row = image->data + (y - item->y) * stride;
+		uint8_t *p = tile_pixel(tile, c->x1, y);
+
+		for (x = c->x1; x <= c->x2; x++) {
+			bit = (x - item->x) * image->bpp;
+			put_color(p, image->palette[(row[bit >> 3] >> (8 - image->bpp - (bit & 7))) & mask]);
+			p += TILE_BYTES_PER_PIXEL;
+		}
+	}
+}
+
+static void paint_image(uint8_t *tile, const tile_item *item, const dirty_rect_t *c)
+{
+	const tImage *image = item->image;
+	uint32_t y;
+
+	if (image->bpp) {
+		paint_indexed(tile, item, c);
+		return;
+	}
+
+	for (y = c->y1; y <= c->y2; y++) {
+		if (image_is_rle(image)) {
+			/* Only the span inside the tile is expanded */
+			image_rle_read(image, c->x1 - item->x, y - item->y, c->x2 - c->x1 + 1,
+			               tile_pixel(tile, c->x1, y));
+		} else {
+			const uint8_t *src = image->data +
+				((y - item->y) * image->width + (c->x1 - item->x)) * TILE_BYTES_PER_PIXEL;
+			memcpy(tile_pixel(tile, c->x1, y), src, (c->x2 - c->x1 + 1) * TILE_BYTES_PER_PIXEL);
+		}
+	}
+}
+
+/* Text is transparent: only the pixels of the characters are painted */
+static void paint_text(uint8_t *tile, const tile_item *item, const dirty_rect_t *c)
+{
+	uint32_t color = COLOR_CONVERT(item->color);
+	uint32_t cell = gfont.width + 2;
+	uint32_t len = strlen(item->text);
+	uint32_t x, y, row, col, i, ch, offset;
+
+	for (y = c->y1; y <= c->y2; y++) {
+		row = y - item->y;
+		for (x = c->x1; x <= c->x2; x++) {
+			i = (x - item->x) / cell;
+			col = (x - item->x) % cell;
+			if (i >= len) {
+				break;
+			}
+			ch = (uint8_t)item->text[i];
+			/* The charset has 0x20 to 0x7F only: the other characters are blank cells */
+			if (col >= gfont.width || ch < 0x20 || ch > 0x7F) {
+				continue;
+			}
+			/* Same charset layout as ili9488_draw_string() */
+			offset = (ch - 0x20) * 20;
+			offset += (row < 8) ? 0 : 1;
+			if ((p_uc_charset10x14[offset + col * 2] >> (7 - (row & 7))) & 0x1) {
+				put_color(tile_pixel(tile, x, y), color);
+				STATS_OWN(x, y, 1, TILE_TEXT);
+			}
+		}
+	}
+}
+
+static void paint_circle(uint8_t *tile, const tile_item *item, const dirty_rect_t *c)
+{
+	uint32_t color = COLOR_CONVERT(item->color);
+	int32_t r = item->w / 2;
+	int32_t cx = item->x + r;
+	int32_t cy = item->y + r;
+	int32_t x, y;
+
+	for (y = c->y1; y <= c->y2; y++) {
+		for (x = c->x1; x <= c->x2; x++) {
+			if ((x - cx) * (x - cx) + (y - cy) * (y - cy) <= r * r) {
+				put_color(tile_pixel(tile, x, y), color);
+				STATS_OWN(x, y, 1, TILE_CIRCLE);
+			}
+		}
+	}
+}
+
+#ifdef ILI9488_STATS_ENABLED
+/* An item, or the background, composited into the tile */
+static void stats_paint(uint32_t kind, const dirty_rect_t *c)
+{
+	uint32_t y;
+
+	stats[kind].items++;
+	/* Text and circles own only the pixels they paint */
+	if (kind != TILE_TEXT && kind != TILE_CIRCLE) {
+		for (y = c->y1; y <= c->y2; y++) {
+			STATS_OWN(c->x1, y, c->x2 - c->x1 + 1, kind);
+		}
+	}
+}
+
+/* A wait for the tile in flight, shared out by its pixels */
+static void stats_wait(uint32_t cycles)
+{
+	uint32_t total = 0, k;
+
+	for (k = 0; k < TILE_STATS_COUNT; k++) {
+		total += enviados[k];
+	}
+	for (k = 0; k < TILE_STATS_COUNT && total; k++) {
+		stats[k].busy_cycles += (uint64_t)cycles * enviados[k] / total;
+	}
+}
+
+/* The current tile handed to the driver */
+static void stats_sent(void)
+{
+	uint32_t area = (t_x2 - t_x1 + 1) * (t_y2 - t_y1 + 1);
+	uint32_t i, k;
+
+	memset(enviados, 0, sizeof(enviados));
+	for (i = 0; i < area; i++) {
+		enviados[dono[i]]++;
+	}
+	for (k = 0; k < TILE_STATS_COUNT; k++) {
+		stats[k].pixels += enviados[k];
+	}
+}
+#endif
+
+static void render_tile(void)
+{
+	uint8_t *tile = tiles[tile_atual];
+	dirty_rect_t c, fundo;
+	uint32_t i;
+
+	fundo.x1 = t_x1;
+	fundo.y1 = t_y1;
+	fundo.x2 = t_x2;
+	fundo.y2 = t_y2;
+	fill_area(tile, &fundo, COLOR_CONVERT(cor_fundo));
+	STATS_PAINT(TILE_STATS_BACKGROUND, &fundo);
+
+	for (i = 0; i < n_items; i++) {
+		const tile_item *item = items[i];
+
+		if (!item->visible || !clip(item, &c)) {
+			continue;
+		}
+		switch (item->tipo) {
+		case TILE_FILL:
+			paint_fill(tile, item, &c);
+			break;
+		case TILE_IMAGE:
+			paint_image(tile, item, &c);
+			break;
+		case TILE_TEXT:
+			paint_text(tile, item, &c);
+			break;
+		case TILE_CIRCLE:
+			paint_circle(tile, item, &c);
+			break;
+		}
+		STATS_PAINT(item->tipo, &c);
+	}
+
+	/* The other tile is the only transfer that can still be in flight */
+	STATS_BEGIN();
+	ili9488_wait_for_idle();
+	STATS_WAIT();
+	/* Only the start of the transfer: the pixels go out by DMA after it */
+	PROF_BEGIN(PROF_DRAW_PIXMAP);
+	ili9488_draw_pixmap(t_x1, t_y1, t_x2 - t_x1 + 1, t_y2 - t_y1 + 1, tile);
+	PROF_END(PROF_DRAW_PIXMAP);
+	STATS_SENT();
+	tile_atual ^= 1;
+}
+
+/*
+ * Redraws the area with every item that intersects it, one tile at a time.
+ * Can be used directly as the paint function of dirty_init().
+ */
+void tile_render(const dirty_rect_t *rect)
+{
+	uint32_t x, y;
+
+	for (y = rect->y1; y <= rect->y2; y += TILE_SIZE) {
+		for (x = rect->x1; x <= rect->x2; x += TILE_SIZE) {
+			t_x1 = x;
+			t_y1 = y;
+			t_x2 = (x + TILE_SIZE - 1 < rect->x2) ? x + TILE_SIZE - 1 : rect->x2;
+			t_y2 = (y + TILE_SIZE - 1 < rect->y2) ? y + TILE_SIZE - 1 : rect->y2;
+			render_tile();
+		}
+	}
+}
+
+#ifdef ILI9488_STATS_ENABLED
+void tile_stats_reset(void)
+{
+	memset(stats, 0, sizeof(stats));
+}
+
+void tile_stats_get(uint32_t kind, tile_stats_t *out)
+{
+	*out = stats[kind];
+}
+
+/* Lower case name of a kind, for reports */
+const char *tile_stats_name(uint32_t kind)
+{
+	return stats_names[kind];
+}
+#endif
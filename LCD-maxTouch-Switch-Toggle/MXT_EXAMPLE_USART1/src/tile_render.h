@@ -0,0 +1,87 @@
+/*
+ * tile_render.h
+ *
+ * Tile renderer: the screen is described by a list of items (fills,
+ * images, text, circles) that are composited into a small SRAM tile and
+ * sent to the ILI9488 one tile at a time, so overlapping items never
+ * reach the panel more than once.
+ */
+
+
+#ifndef TILE_RENDER_H_
+#define TILE_RENDER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tipos.h"
+#include "dirty_rect.h"
+#include "ili9488.h"
+
+/* Side of the square tile, in pixels */
+#ifndef TILE_SIZE
+#define TILE_SIZE 32
+#endif
+
+/* Maximum number of items on the screen */
+#define TILE_MAX_ITEMS 24
+
+typedef enum {
+	TILE_FILL,
+	TILE_IMAGE,
+	TILE_TEXT,
+	TILE_CIRCLE
+} tile_tipo;
+
+/*
+ * Item of the screen, owned by the application. Fields can be changed at any
+ * time, as long as the area is invalidated afterwards.
+ * Items are painted in the order they were added.
+ */
+typedef struct {
+	uint8_t tipo;
+	bool visible;
+	/* Top-left corner and size of the area covered by the item */
+	uint16_t x;
+	uint16_t y;
+	uint16_t w;
+	uint16_t h;
+	/* 24 bits RGB, used by fills, text and circles */
+	uint32_t color;
+	const tImage *image;
+	const char *text;
+} tile_item;
+
+void tile_init(uint32_t background);
+bool tile_add(tile_item *item);
+
+void tile_fill(tile_item *item, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t color);
+void tile_image(tile_item *item, uint16_t x, uint16_t y, const tImage *image);
+void tile_text(tile_item *item, uint16_t x, uint16_t y, uint16_t w, const char *text, uint32_t color);
+void tile_circle(tile_item *item, uint16_t x, uint16_t y, uint16_t r, uint32_t color);
+
+void tile_render(const dirty_rect_t *rect);
+
+#ifdef ILI9488_STATS_ENABLED
+/*
+ * Cost of the items of each kind (TILE_FILL to TILE_CIRCLE), and of the
+ * background, since tile_stats_reset(). A pixel sent is charged to the
+ * kind painted last on it; the waits for the SPI are shared out by the
+ * pixels of the tile waited for. The tiles themselves, their windows and
+ * commands, are the "pixmap" of ili9488_stats_get().
+ */
+#define TILE_STATS_BACKGROUND 4
+#define TILE_STATS_COUNT      5
+
+typedef struct {
+	uint32_t items;         /* items painted, once per tile they cross; tiles, for the background */
+	uint32_t pixels;        /* pixels sent */
+	uint32_t busy_cycles;   /* CPU cycles waiting for the SPI */
+} tile_stats_t;
+
+void tile_stats_reset(void);
+void tile_stats_get(uint32_t kind, tile_stats_t *stats);
+const char *tile_stats_name(uint32_t kind);
+#endif
+
+
+#endif /* TILE_RENDER_H_ */
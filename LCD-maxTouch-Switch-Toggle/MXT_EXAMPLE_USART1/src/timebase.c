@@ -0,0 +1,300 @@
+/*
+ * timebase.c
+ *
+ * Monotonic time and software timers on the RTT.
+ *
+ * Time is kept in RTT ticks and shown in ms; a point of the wheel in ms is
+ * turned into the first tick at which timebase_now() reaches it. The timers
+ * are only touched from the main loop, the RTT interrupt never sees them.
+ *
+ * The 32 bits counter wraps at a tick that is no whole number of ms, so
+ * the ms are taken from a count of 64 bits: the turns of the counter are
+ * counted each time it is read and found below the last value read. The
+ * alarm is never more than TIMEBASE_MAX_ALARM ticks ahead, even with the
+ * wheel empty, so no turn goes by unread. The ms then wrap at 2^32, as
+ * the comparisons of the wheel expect.
+ *
+ * The wheel has WHEEL_LEVELS levels of WHEEL_SLOTS slots, level L counting
+ * in units of 2^(8L) ms, so together they cover the whole 32 bits of a
+ * deadline. A timer goes to the level of the highest byte in which its
+ * deadline differs from the current time of the wheel, in the slot given
+ * by that byte of the deadline. When the wheel reaches a slot of level 0
+ * its timers are due; a slot of a higher level is instead spread again
+ * over the levels below it. A bitmap per level marks the slots in use, so
+ * the wheel jumps straight to the next one instead of stepping through
+ * every ms.
+ */
+
+#include <asf.h>
+#include "timebase.h"
+
+#define WHEEL_LEVELS 4
+#define WHEEL_BITS   8
+#define WHEEL_SLOTS  (1 << WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define MAP_WORDS    (WHEEL_SLOTS / 32)
+
+static sw_timer_t *wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint32_t map[WHEEL_LEVELS][MAP_WORDS];
+
+/* Every timer in the wheel is due at or after this time, in ms */
+static uint32_t wheel_now;
+
+/* Turns of the RTT counter, and its value when last read */
+static uint32_t rtt_turns;
+static uint32_t rtt_last;
+
+/* Ticks since timebase_init() */
+static uint64_t ticks_now(void)
+{
+	uint32_t ticks = rtt_read_timer_value(RTT);
+
+	if (ticks < rtt_last) {
+		rtt_turns++;
+	}
+	rtt_last = ticks;
+	return ((uint64_t)rtt_turns << 32) | ticks;
+}
+
+static uint64_t ticks_to_ms(uint64_t ticks)
+{
+	return ticks * 1000 / TIMEBASE_HZ;
+}
+
+static uint64_t ms_to_ticks(uint64_t ms)
+{
+	return (ms * TIMEBASE_HZ + 999) / 1000;
+}
+
+/* a is before b, with wrap around */
+static bool before(uint32_t a, uint32_t b)
+{
+	return (int32_t)(a - b) < 0;
+}
+
+static void insert(sw_timer_t *t)
+{
+	/* Late timers are due at once */
+	uint32_t key = before(t->deadline, wheel_now) ? wheel_now : t->deadline;
+	uint32_t diff = key ^ wheel_now;
+	uint32_t level = diff ? (31 - __builtin_clz(diff)) / WHEEL_BITS : 0;
+	uint32_t slot = (key >> (level * WHEEL_BITS)) & WHEEL_MASK;
+	sw_timer_t **head;
+
+	t->slot = level * WHEEL_SLOTS + slot;
+	head = &wheel[level][slot];
+	t->next = *head;
+	if (*head != NULL) {
+		(*head)->pprev = &t->next;
+	}
+	t->pprev = head;
+	*head = t;
+	map[level][slot / 32] |= 1u << (slot % 32);
+}
+
+static void unlink(sw_timer_t *t)
+{
+	uint32_t level = t->slot / WHEEL_SLOTS;
+	uint32_t slot = t->slot % WHEEL_SLOTS;
+
+	*t->pprev = t->next;
+	if (t->next != NULL) {
+		t->next->pprev = t->pprev;
+	}
+	if (wheel[level][slot] == NULL) {
+		map[level][slot / 32] &= ~(1u << (slot % 32));
+	}
+}
+
+/* First slot in use from slot 'from' to the end of the level, -1 if none */
+static int32_t next_slot(uint32_t level, uint32_t from)
+{
+	uint32_t w = from / 32;
+	uint32_t bits;
+
+	if (from >= WHEEL_SLOTS) {
+		return -1;
+	}
+
+	bits = map[level][w] & (0xFFFFFFFFu << (from % 32));
+	while (bits == 0) {
+		if (++w == MAP_WORDS) {
+			return -1;
+		}
+		bits = map[level][w];
+	}
+	return w * 32 + __builtin_ctz(bits);
+}
+
+/*
+ * Next time the wheel has work to do, the deadline of a timer or the
+ * start of a slot to spread, and where. False when the wheel is empty.
+ */
+static bool next_point(uint32_t *when, uint32_t *level, uint32_t *slot)
+{
+	uint32_t l, shift, idx;
+	int32_t s;
+
+	for (l = 0; l < WHEEL_LEVELS; l++) {
+		shift = l * WHEEL_BITS;
+		idx = (wheel_now >> shift) & WHEEL_MASK;
+
+		/* level 0 holds the timers due right now in its current slot */
+		s = next_slot(l, l == 0 ? idx : idx + 1);
+		if (s < 0 && l == WHEEL_LEVELS - 1) {
+			/* deadlines after the wrap of the 32 bits */
+			s = next_slot(l, 0);
+		}
+		if (s >= 0) {
+			*level = l;
+			*slot = s;
+			if (l == WHEEL_LEVELS - 1) {
+				*when = (uint32_t)s << shift;
+			} else {
+				*when = (wheel_now & ~((1u << (shift + WHEEL_BITS)) - 1)) |
+				        ((uint32_t)s << shift);
+			}
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Runs everything in the wheel up to now */
+static void advance(uint32_t now)
+{
+	uint32_t when, level, slot;
+	sw_timer_t *t;
+
+	while (next_point(&when, &level, &slot) && !before(now, when)) {
+		wheel_now = when;
+
+		while ((t = wheel[level][slot]) != NULL) {
+			unlink(t);
+			if (level != 0) {
+				insert(t);
+			} else if (t->period != 0) {
+				t->deadline += t->period;
+				insert(t);
+				t->cb(t->arg);
+			} else {
+				t->active = false;
+				t->cb(t->arg);
+			}
+		}
+	}
+
+	if (before(wheel_now, now)) {
+		wheel_now = now;
+	}
+}
+
+/*
+ * The alarm only fires when the counter goes through its value, so one
+ * that is already due is moved to the next tick, and written again if the
+ * counter passed it meanwhile. No more margin than that: a deadline just
+ * after the start of a slot of a higher level is one tick after the
+ * alarm that spreads the slot.
+ */
+static void program_alarm(void)
+{
+	uint32_t when, level, slot;
+	uint32_t alarm, now;
+	uint64_t ticks = ticks_now();
+	uint64_t ms = ticks_to_ms(ticks);
+	uint64_t at = ticks + TIMEBASE_MAX_ALARM;
+	int32_t ahead;
+
+	if (next_point(&when, &level, &slot)) {
+		/* The point on 64 bits; one already due goes to the next tick below */
+		ahead = (int32_t)(when - (uint32_t)ms);
+		if (ahead <= 0) {
+			at = ticks;
+		} else if (ms_to_ticks(ms + ahead) < at) {
+			at = ms_to_ticks(ms + ahead);
+		}
+	}
+
+	alarm = (uint32_t)at;
+	do {
+		now = rtt_read_timer_value(RTT);
+		if ((int32_t)(alarm - now) < 1) {
+			alarm = now + 1;
+		}
+		rtt_write_alarm_time(RTT, alarm);
+	} while ((int32_t)(alarm - rtt_read_timer_value(RTT)) <= 0);
+}
+
+void timebase_init(void)
+{
+	uint32_t l, i;
+
+	for (l = 0; l < WHEEL_LEVELS; l++) {
+		for (i = 0; i < WHEEL_SLOTS; i++) {
+			wheel[l][i] = NULL;
+		}
+		for (i = 0; i < MAP_WORDS; i++) {
+			map[l][i] = 0;
+		}
+	}
+	wheel_now = 0;
+	rtt_turns = 0;
+	rtt_last = 0;
+
+	rtt_sel_source(RTT, false);
+	rtt_init(RTT, TIMEBASE_PRESCALER);
+	rtt_write_alarm_time(RTT, 0);
+
+	NVIC_DisableIRQ(RTT_IRQn);
+	NVIC_ClearPendingIRQ(RTT_IRQn);
+	NVIC_SetPriority(RTT_IRQn, 4);
+	NVIC_EnableIRQ(RTT_IRQn);
+	rtt_enable_interrupt(RTT, RTT_MR_ALMIEN);
+}
+
+/* ms since timebase_init() */
+uint32_t timebase_now(void)
+{
+	return (uint32_t)ticks_to_ms(ticks_now());
+}
+
+/* Runs the callbacks of the timers that are due and programs the next alarm */
+void timebase_run(void)
+{
+	advance(timebase_now());
+	program_alarm();
+}
+
+/*
+ * First call of cb after delay ms, then every period ms if period is not 0.
+ * Restarts t if it was already running.
+ */
+void sw_timer_start(sw_timer_t *t, uint32_t delay, uint32_t period,
+                    sw_timer_cb_t cb, void *arg)
+{
+	if (t->active) {
+		unlink(t);
+	}
+
+	t->deadline = timebase_now() + delay;
+	t->period = period;
+	t->cb = cb;
+	t->arg = arg;
+	t->active = true;
+	insert(t);
+
+	program_alarm();
+}
+
+void sw_timer_stop(sw_timer_t *t)
+{
+	if (!t->active) {
+		return;
+	}
+
+	unlink(t);
+	t->active = false;
+
+	program_alarm();
+}
@@ -0,0 +1,51 @@
+/*
+ * timebase.h
+ *
+ * Monotonic time from the RTT, left running from timebase_init() on, and
+ * software timers kept in a hierarchical timer wheel: starting and
+ * stopping a timer take constant time, whatever the number of timers.
+ * Only the nearest point of the wheel is programmed in the RTT alarm; the
+ * RTT interrupt just has to get timebase_run() called from the main loop,
+ * where the callbacks run.
+ *
+ * Deadlines are absolute, so periodic timers do not drift. The ms of
+ * timebase_now() wrap at 2^32, after about 49 days; the 32 bits RTT counter
+ * wraps before that, after about 48 days, and is extended in software.
+ */
+
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* RTT on the 32768 Hz slow clock with prescaler 32 */
+#define TIMEBASE_PRESCALER 32
+#define TIMEBASE_HZ        (32768 / TIMEBASE_PRESCALER)
+/* Farthest alarm, in ticks (about 12 days): the counter is read at least this often */
+#define TIMEBASE_MAX_ALARM (1u << 30)
+
+typedef void (*sw_timer_cb_t)(void *arg);
+
+typedef struct sw_timer {
+	struct sw_timer *next;
+	struct sw_timer **pprev;
+	uint16_t slot;       /* slot of the wheel holding the timer */
+	uint32_t deadline;   /* ms, same scale as timebase_now() */
+	uint32_t period;     /* ms, 0 for a one shot timer */
+	sw_timer_cb_t cb;
+	void *arg;
+	bool active;
+} sw_timer_t;
+
+void timebase_init(void);
+uint32_t timebase_now(void);
+void timebase_run(void);
+
+void sw_timer_start(sw_timer_t *t, uint32_t delay, uint32_t period,
+                    sw_timer_cb_t cb, void *arg);
+void sw_timer_stop(sw_timer_t *t);
+
+
+#endif /* TIMEBASE_H_ */
@@ -15,6 +15,12 @@
 	 uint16_t width;
 	 uint16_t height;
 	 uint8_t dataSize;
+	 /* Offset of each row in data for RLE images (see image_rle.h), NULL for raw R8G8B8 */
+	 const uint16_t *rows;
+	 /* Indexed images: bits per pixel (1, 2, 4 or 8) and their 24 bits RGB palette.
+	  * 0 for R8G8B8 images. Rows start on a byte boundary, first pixel in the MSBs. */
+	 uint8_t bpp;
+	 const uint32_t *palette;
  } tImage;
 
  typedef struct {
@@ -44,5 +50,17 @@
 	 char end_char;
  } tFont;
 
+typedef struct ciclo t_ciclo;
+
+struct ciclo{
+  char nome[32];           // nome do ciclo, para ser exibido
+  int  enxagueTempo;       // tempo que fica em cada enxague
+  int  enxagueQnt;         // quantidade de enxagues
+  int  centrifugacaoRPM;   // velocidade da centrifugacao
+  int  centrifugacaoTempo; // tempo que centrifuga
+  char heavy;              // modo pesado de lavagem
+  char bubblesOn;          // smart bubbles on (???)
+};
+
 
 #endif /* TIPOS_H_ */
\ No newline at end of file
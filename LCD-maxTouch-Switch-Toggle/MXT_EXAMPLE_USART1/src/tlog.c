@@ -0,0 +1,49 @@
+/*
+ * tlog.c
+ *
+ * Encoding of the records of the tokenized log.
+ *
+ * A varint takes 7 bits per byte, low bits first, with the top bit set on
+ * every byte but the last. Arguments are zigzag coded first (0, -1, 1,
+ * -2, ... become 0, 1, 2, 3, ...) so small negative numbers stay short.
+ */
+
+#include "serial_tx.h"
+#include "tlog.h"
+
+/* Longest record: marker, id and the arguments, 5 bytes each at most */
+#define TLOG_MAX_RECORD (1 + 5 + 5 * TLOG_MAX_ARGS)
+
+static uint8_t *varint(uint8_t *p, uint32_t v)
+{
+	while (v >= 0x80) {
+		*p++ = (uint8_t)v | 0x80;
+		v >>= 7;
+	}
+	*p++ = (uint8_t)v;
+	return p;
+}
+
+/* Writes the record to out, of TLOG_MAX_RECORD bytes; returns its length */
+uint32_t tlog_encode(uint8_t *out, uint32_t id, const int32_t *args, uint32_t n)
+{
+	uint8_t *p = out;
+
+	if (n > TLOG_MAX_ARGS) {
+		n = TLOG_MAX_ARGS;
+	}
+	*p++ = TLOG_MARKER;
+	p = varint(p, id);
+	for (uint32_t i = 0; i < n; i++) {
+		p = varint(p, ((uint32_t)args[i] << 1) ^ (uint32_t)(args[i] >> 31));
+	}
+	return p - out;
+}
+
+/* Queues a record on the console; false if the ring had no room for it */
+bool tlog_emit(uint32_t id, const int32_t *args, uint32_t n)
+{
+	uint8_t record[TLOG_MAX_RECORD];
+
+	return serial_tx_write(record, tlog_encode(record, id, args, n));
+}
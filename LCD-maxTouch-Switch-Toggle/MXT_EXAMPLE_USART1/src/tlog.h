@@ -0,0 +1,43 @@
+/*
+ * tlog.h
+ *
+ * Tokenized log: instead of formatting text, a log line sends the number
+ * of its format (tlog.def) and its arguments, and the host puts the text
+ * back together. A record costs a few hundred cycles and some 10 bytes,
+ * where sprintf() and the text cost thousands of cycles and 50 or more.
+ *
+ * Record on the wire, through serial_tx:
+ *     TLOG_MARKER, varint id, one zigzag varint per argument
+ * The marker is not ASCII, so records and printf() text can share the
+ * console; the number of arguments comes from the format.
+ */
+
+
+#ifndef TLOG_H_
+#define TLOG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define TLOG_MARKER   0x9E
+#define TLOG_MAX_ARGS 8
+
+enum tlog_id {
+#define TLOG_FORMAT(id, format) id,
+#include "tlog.def"
+#undef TLOG_FORMAT
+	TLOG_N_FORMATS
+};
+
+/* TLOG(id, args...): up to TLOG_MAX_ARGS integer arguments; TLOG0(id): none */
+#define TLOG(id, ...) \
+	tlog_emit((id), (const int32_t[]){__VA_ARGS__}, \
+	          sizeof((const int32_t[]){__VA_ARGS__}) / sizeof(int32_t))
+#define TLOG0(id) tlog_emit((id), NULL, 0)
+
+bool tlog_emit(uint32_t id, const int32_t *args, uint32_t n);
+uint32_t tlog_encode(uint8_t *out, uint32_t id, const int32_t *args, uint32_t n);
+
+
+#endif /* TLOG_H_ */
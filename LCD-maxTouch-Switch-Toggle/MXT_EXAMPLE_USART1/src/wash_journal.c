@@ -0,0 +1,237 @@
+/*
+ * wash_journal.c
+ *
+ * Journal of the wash program in the GPBR backup registers and the flash.
+ *
+ * The 8 registers hold two slots of 4 words. A checkpoint is written to
+ * the slot that does not hold the newest one, with a sequence number one
+ * above it and a CRC over the slot, so at boot the valid slot with the
+ * highest sequence number is the last checkpoint written in full.
+ *
+ *   word 0: magic << 16 | sequence
+ *   word 1: state << 16 | phase << 8 | ciclo
+ *   word 2: program << 16 | elapsed
+ *   word 3: CRC-16 of words 0 to 2
+ */
+
+#include <asf.h>
+#include "maquina1.h"
+#include "settings_log.h"
+#include "timebase.h"
+#include "wash_journal.h"
+
+#define SLOT_WORDS 4
+#define SLOTS      2
+#define MAGIC      0x5A17u
+
+static uint8_t source = WASH_JOURNAL_NONE;
+static wash_checkpoint_t found;
+/* Checkpoint of the program being run, and the last one in the flash */
+static wash_checkpoint_t current;
+static wash_checkpoint_t flashed;
+static uint32_t flashed_at;
+static uint16_t sequence;
+static uint8_t slot;
+static bool active;
+
+/* CRC-16/CCITT */
+static uint16_t crc16(const uint32_t *w, uint32_t n)
+{
+	uint16_t crc = 0xFFFF;
+
+	while (n--) {
+		uint32_t v = *w++;
+		for (int b = 0; b < 4; b++, v >>= 8) {
+			crc ^= (uint16_t)(v & 0xFF) << 8;
+			for (int i = 0; i < 8; i++) {
+				crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+			}
+		}
+	}
+	return crc;
+}
+
+static bool read_slot(uint32_t s, wash_checkpoint_t *cp, uint16_t *seq)
+{
+	uint32_t w[SLOT_WORDS];
+
+	for (int i = 0; i < SLOT_WORDS; i++) {
+		w[i] = GPBR->SYS_GPBR[s * SLOT_WORDS + i];
+	}
+	if ((w[0] >> 16) != MAGIC || w[3] != crc16(w, SLOT_WORDS - 1)) {
+		return false;
+	}
+	*seq = w[0] & 0xFFFF;
+	cp->ciclo = w[1] & 0xFF;
+	cp->phase = (w[1] >> 8) & 0xFF;
+	cp->state = (w[1] >> 16) & 0xFF;
+	cp->elapsed = w[2] & 0xFFFF;
+	cp->program = w[2] >> 16;
+	return true;
+}
+
+/* Writes over the older slot; the newer one stays until this is complete */
+static void write_slot(const wash_checkpoint_t *cp)
+{
+	uint32_t w[SLOT_WORDS];
+
+	slot ^= 1;
+	sequence++;
+	w[0] = (MAGIC << 16) | sequence;
+	w[1] = ((uint32_t)cp->state << 16) | ((uint32_t)cp->phase << 8) | cp->ciclo;
+	w[2] = ((uint32_t)cp->program << 16) | cp->elapsed;
+	w[3] = crc16(w, SLOT_WORDS - 1);
+
+	/* The CRC word first: a slot cut half way cannot pass for valid */
+	GPBR->SYS_GPBR[slot * SLOT_WORDS + 3] = ~w[3];
+	for (int i = 0; i < SLOT_WORDS; i++) {
+		GPBR->SYS_GPBR[slot * SLOT_WORDS + i] = w[i];
+	}
+}
+
+/*
+ * Looks for the checkpoint left before the reset: in the registers, or in
+ * the flash if they hold none. Call after settings_log_init().
+ */
+void wash_journal_init(void)
+{
+	wash_checkpoint_t cp;
+	uint16_t seq;
+	bool valid = false;
+
+	source = WASH_JOURNAL_NONE;
+	active = false;
+	slot = SLOTS - 1;
+	sequence = 0;
+
+	for (uint32_t s = 0; s < SLOTS; s++) {
+		if (read_slot(s, &cp, &seq) &&
+		    (!valid || (int16_t)(seq - sequence) > 0)) {
+			found = cp;
+			sequence = seq;
+			slot = s;
+			valid = true;
+		}
+	}
+
+	if (valid) {
+		/* A program that ended left an idle checkpoint: nothing to resume */
+		if (found.state == WASH_RUNNING || found.state == WASH_PAUSED) {
+			source = WASH_JOURNAL_GPBR;
+		} else if (settings_log_wash_last(&cp)) {
+			/* Its end did not reach the flash, which would bring it back without VDDBU */
+			settings_log_wash(&found);
+		}
+	} else if (settings_log_wash_last(&found)) {
+		source = WASH_JOURNAL_FLASH;
+	}
+}
+
+uint8_t wash_journal_source(void)
+{
+	return source;
+}
+
+/* Fingerprint of the settings a program is built from */
+uint16_t wash_journal_program(const t_ciclo *ciclo)
+{
+	uint32_t w[4] = {
+		(uint32_t)ciclo->enxagueTempo,
+		(uint32_t)ciclo->enxagueQnt,
+		((uint32_t)ciclo->centrifugacaoRPM << 16) | (uint16_t)ciclo->centrifugacaoTempo,
+		((uint32_t)(uint8_t)ciclo->heavy << 8) | (uint8_t)ciclo->bubblesOn,
+	};
+
+	return crc16(w, 4);
+}
+
+/*
+ * Loads and starts the program of the checkpoint found by wash_journal_init(),
+ * paused if it was. It is dropped if the settings of its cycle are no
+ * longer the ones it was built from. Returns its cycle in *ciclo.
+ */
+bool wash_journal_resume(wash_phase_cb_t cb, uint8_t *ciclo)
+{
+	t_ciclo settings;
+
+	if (source == WASH_JOURNAL_NONE || found.ciclo >= N_CICLOS) {
+		return false;
+	}
+	ciclo_le(found.ciclo, &settings);
+	if (wash_journal_program(&settings) != found.program) {
+		wash_journal_end();
+		return false;
+	}
+
+	wash_load(&settings);
+	if (found.phase >= wash_phase_count()) {
+		wash_journal_end();
+		return false;
+	}
+
+	wash_journal_begin(found.ciclo, &settings);
+	wash_start_at(cb, found.phase, (uint32_t)found.elapsed * 1000);
+	if (found.state == WASH_PAUSED) {
+		wash_pause();
+	}
+	wash_journal_checkpoint();
+
+	*ciclo = found.ciclo;
+	return true;
+}
+
+/* Call before starting the program loaded from settings, of cycle ciclo */
+void wash_journal_begin(uint8_t ciclo, const t_ciclo *settings)
+{
+	current.ciclo = ciclo;
+	current.program = wash_journal_program(settings);
+	flashed.state = WASH_IDLE;
+	active = true;
+}
+
+/*
+ * Saves where the program is: to the registers always, to the flash if a
+ * minute went by or the phase or the state changed since the last time.
+ */
+void wash_journal_checkpoint(void)
+{
+	uint32_t now = timebase_now();
+	uint32_t elapsed;
+
+	if (!active) {
+		return;
+	}
+	if (wash_state() != WASH_RUNNING && wash_state() != WASH_PAUSED) {
+		wash_journal_end();
+		return;
+	}
+
+	elapsed = wash_phase_elapsed() / 1000;
+	current.phase = wash_phase_index();
+	current.state = wash_state();
+	current.elapsed = elapsed > 0xFFFF ? 0xFFFF : elapsed;
+	write_slot(&current);
+
+	if (current.phase != flashed.phase || current.state != flashed.state ||
+	    now - flashed_at >= WASH_JOURNAL_FLASH_PERIOD) {
+		if (settings_log_wash(&current)) {
+			flashed = current;
+			flashed_at = now;
+		}
+	}
+}
+
+/* The program ended or was stopped: nothing to resume after a reset */
+void wash_journal_end(void)
+{
+	wash_checkpoint_t idle = {.state = WASH_IDLE};
+	wash_checkpoint_t last;
+
+	write_slot(&idle);
+	if (settings_log_wash_last(&last)) {
+		settings_log_wash(&idle);
+	}
+	flashed.state = WASH_IDLE;
+	source = WASH_JOURNAL_NONE;
+	active = false;
+}
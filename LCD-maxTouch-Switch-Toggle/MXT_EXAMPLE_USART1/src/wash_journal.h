@@ -0,0 +1,53 @@
+/*
+ * wash_journal.h
+ *
+ * Checkpoints of the wash program being run (wash_program.h), so that it
+ * goes on from where it was after a reset or a power loss.
+ *
+ * A checkpoint goes every few seconds to the GPBR backup registers, which
+ * keep their value across resets and, with a backup supply on VDDBU,
+ * without the main one. Two slots are written in turn, so a checkpoint
+ * cut half way leaves the previous one. Once a minute, and when the phase
+ * or the state changes, it also goes to the settings log in the flash
+ * (settings_log.h), which is read when the registers hold no checkpoint.
+ */
+
+
+#ifndef WASH_JOURNAL_H_
+#define WASH_JOURNAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tipos.h"
+#include "wash_program.h"
+
+/* ms between two checkpoints to the registers, and to the flash */
+#define WASH_JOURNAL_PERIOD        (5 * 1000)
+#define WASH_JOURNAL_FLASH_PERIOD  (60 * 1000)
+
+typedef struct {
+	uint8_t ciclo;      /* index in ciclos[] */
+	uint8_t phase;      /* index of the phase, from 0 */
+	uint8_t state;      /* WASH_RUNNING or WASH_PAUSED, WASH_IDLE if none */
+	uint16_t elapsed;   /* s run of the phase */
+	uint16_t program;   /* fingerprint of the settings of the cycle */
+} wash_checkpoint_t;
+
+/* Where wash_journal_init() found the checkpoint */
+enum wash_journal_source {
+	WASH_JOURNAL_NONE,
+	WASH_JOURNAL_GPBR,
+	WASH_JOURNAL_FLASH,
+};
+
+void wash_journal_init(void);
+uint8_t wash_journal_source(void);
+bool wash_journal_resume(wash_phase_cb_t cb, uint8_t *ciclo);
+
+uint16_t wash_journal_program(const t_ciclo *ciclo);
+void wash_journal_begin(uint8_t ciclo, const t_ciclo *settings);
+void wash_journal_checkpoint(void);
+void wash_journal_end(void);
+
+
+#endif /* WASH_JOURNAL_H_ */
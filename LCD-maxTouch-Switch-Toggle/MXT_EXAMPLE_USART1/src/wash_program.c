@@ -0,0 +1,226 @@
+/*
+ * wash_program.c
+ *
+ * Execution of a wash program on the timebase.
+ *
+ * The remaining time of the phases after each one is computed once by
+ * wash_load(), so the remaining time of the program is that sum plus what
+ * is left of the current phase, which only depends on its end time.
+ */
+
+#include <stddef.h>
+#include "wash_program.h"
+#include "timebase.h"
+
+#define MINUTES(m) ((uint32_t)(m) * 60 * 1000)
+
+static wash_phase_t phases[WASH_MAX_PHASES];
+/* after[i]: total duration of the phases after phase i */
+static uint32_t after[WASH_MAX_PHASES];
+static uint32_t n_phases;
+
+static uint32_t current;
+static uint8_t state = WASH_IDLE;
+static uint32_t phase_end;      /* while running, in timebase_now() ms */
+static uint32_t phase_left;     /* while paused */
+static sw_timer_t phase_timer;
+static wash_phase_cb_t phase_cb;
+
+static void add_phase(uint8_t type, uint8_t n, uint16_t rpm, uint32_t duration)
+{
+	if (duration == 0 || n_phases == WASH_MAX_PHASES) {
+		return;
+	}
+	phases[n_phases].type = type;
+	phases[n_phases].n = n;
+	phases[n_phases].rpm = rpm;
+	phases[n_phases].duration = duration;
+	n_phases++;
+}
+
+static void enter_phase(uint32_t i, uint32_t start);
+
+static void phase_done(void *arg)
+{
+	/* The next phase starts when this one should end, not when the timer ran */
+	enter_phase(current + 1, phase_end);
+}
+
+/* start: timebase_now() at which phase i started */
+static void enter_phase(uint32_t i, uint32_t start)
+{
+	int32_t delay;
+
+	current = i;
+
+	if (i >= n_phases) {
+		state = WASH_DONE;
+		if (phase_cb) {
+			phase_cb(NULL);
+		}
+		return;
+	}
+
+	phase_end = start + phases[i].duration;
+	delay = (int32_t)(phase_end - timebase_now());
+	sw_timer_start(&phase_timer, delay > 0 ? delay : 0, 0, phase_done, NULL);
+	if (phase_cb) {
+		phase_cb(&phases[i]);
+	}
+}
+
+/*
+ * Builds the phases of ciclo: the heavy mode doubles the wash. Phases
+ * of zero minutes are left out. Returns the duration of the program in ms.
+ */
+uint32_t wash_load(const t_ciclo *ciclo)
+{
+	uint32_t i, rinses, wash;
+
+	wash_stop();
+	n_phases = 0;
+
+	rinses = ciclo->enxagueQnt > 0 ? ciclo->enxagueQnt : 0;
+	if (rinses > WASH_MAX_RINSES) {
+		rinses = WASH_MAX_RINSES;
+	}
+	wash = MINUTES(ciclo->enxagueTempo > 0 ? ciclo->enxagueTempo : 0);
+	if (ciclo->heavy) {
+		wash *= 2;
+	}
+
+	if (wash != 0) {
+		add_phase(WASH_FILL, 0, 0, WASH_FILL_TIME);
+		add_phase(WASH_WASH, 0, 0, wash);
+		for (i = 0; i < rinses; i++) {
+			add_phase(WASH_RINSE, i + 1, 0, MINUTES(ciclo->enxagueTempo));
+		}
+	}
+	if (ciclo->centrifugacaoTempo > 0) {
+		add_phase(WASH_SPIN, 0, ciclo->centrifugacaoRPM,
+		          MINUTES(ciclo->centrifugacaoTempo));
+	}
+
+	for (i = n_phases; i-- > 0;) {
+		after[i] = (i + 1 < n_phases) ? after[i + 1] + phases[i + 1].duration : 0;
+	}
+
+	return wash_total_ms();
+}
+
+/* cb runs from the main loop, with the timer callbacks of the timebase */
+void wash_start(wash_phase_cb_t cb)
+{
+	wash_start_at(cb, 0, 0);
+}
+
+/* Starts in the given phase, elapsed ms after its beginning */
+void wash_start_at(wash_phase_cb_t cb, uint32_t phase, uint32_t elapsed)
+{
+	wash_stop();
+	phase_cb = cb;
+	state = WASH_RUNNING;
+	if (phase < n_phases && elapsed > phases[phase].duration) {
+		elapsed = phases[phase].duration;
+	}
+	enter_phase(phase, timebase_now() - elapsed);
+}
+
+void wash_pause(void)
+{
+	if (state != WASH_RUNNING) {
+		return;
+	}
+	phase_left = wash_phase_remaining();
+	sw_timer_stop(&phase_timer);
+	state = WASH_PAUSED;
+}
+
+void wash_resume(void)
+{
+	if (state != WASH_PAUSED) {
+		return;
+	}
+	phase_end = timebase_now() + phase_left;
+	sw_timer_start(&phase_timer, phase_left, 0, phase_done, NULL);
+	state = WASH_RUNNING;
+}
+
+void wash_stop(void)
+{
+	sw_timer_stop(&phase_timer);
+	state = WASH_IDLE;
+	current = 0;
+}
+
+uint8_t wash_state(void)
+{
+	return state;
+}
+
+/* Phase being run or paused, NULL otherwise */
+const wash_phase_t *wash_phase(void)
+{
+	if (state != WASH_RUNNING && state != WASH_PAUSED) {
+		return NULL;
+	}
+	return &phases[current];
+}
+
+/* Phases of the program loaded */
+uint32_t wash_phase_count(void)
+{
+	return n_phases;
+}
+
+/* ms of the whole program loaded, from its first phase */
+uint32_t wash_total_ms(void)
+{
+	return n_phases ? after[0] + phases[0].duration : 0;
+}
+
+/* Index of the phase being run or paused, from 0 */
+uint32_t wash_phase_index(void)
+{
+	return current;
+}
+
+/* ms run of the current phase */
+uint32_t wash_phase_elapsed(void)
+{
+	const wash_phase_t *phase = wash_phase();
+
+	return phase ? phase->duration - wash_phase_remaining() : 0;
+}
+
+/* ms left in the current phase */
+uint32_t wash_phase_remaining(void)
+{
+	int32_t left;
+
+	switch (state) {
+	case WASH_RUNNING:
+		left = (int32_t)(phase_end - timebase_now());
+		return left > 0 ? left : 0;
+	case WASH_PAUSED:
+		return phase_left;
+	case WASH_IDLE:
+		return n_phases ? phases[0].duration : 0;
+	default:
+		return 0;
+	}
+}
+
+/* ms left in the whole program */
+uint32_t wash_remaining(void)
+{
+	switch (state) {
+	case WASH_RUNNING:
+	case WASH_PAUSED:
+		return after[current] + wash_phase_remaining();
+	case WASH_IDLE:
+		return wash_total_ms();
+	default:
+		return 0;
+	}
+}
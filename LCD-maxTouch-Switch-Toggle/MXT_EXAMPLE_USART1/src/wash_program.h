@@ -0,0 +1,63 @@
+/*
+ * wash_program.h
+ *
+ * Execution of a wash program: a t_ciclo is expanded into a list of
+ * phases (fill, wash, one rinse per enxagueQnt, spin) that run one after
+ * the other on a timer of the timebase, and can be paused and resumed.
+ */
+
+
+#ifndef WASH_PROGRAM_H_
+#define WASH_PROGRAM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tipos.h"
+
+/* Time to fill the drum with water, before the wash */
+#define WASH_FILL_TIME   (60 * 1000)
+#define WASH_MAX_RINSES  8
+#define WASH_MAX_PHASES  (3 + WASH_MAX_RINSES)
+
+enum wash_phase_type {
+	WASH_FILL,
+	WASH_WASH,
+	WASH_RINSE,
+	WASH_SPIN,
+};
+
+enum wash_state {
+	WASH_IDLE,
+	WASH_RUNNING,
+	WASH_PAUSED,
+	WASH_DONE,
+};
+
+typedef struct {
+	uint8_t type;       /* enum wash_phase_type */
+	uint8_t n;          /* number of the rinse, from 1 */
+	uint16_t rpm;       /* drum speed of the spin */
+	uint32_t duration;  /* ms */
+} wash_phase_t;
+
+/* Called when a phase starts, and with NULL when the program ends */
+typedef void (*wash_phase_cb_t)(const wash_phase_t *phase);
+
+uint32_t wash_load(const t_ciclo *ciclo);
+void wash_start(wash_phase_cb_t cb);
+void wash_start_at(wash_phase_cb_t cb, uint32_t phase, uint32_t elapsed);
+void wash_pause(void);
+void wash_resume(void);
+void wash_stop(void);
+
+uint8_t wash_state(void);
+const wash_phase_t *wash_phase(void);
+uint32_t wash_phase_count(void);
+uint32_t wash_total_ms(void);
+uint32_t wash_phase_index(void);
+uint32_t wash_phase_elapsed(void);
+uint32_t wash_phase_remaining(void);
+uint32_t wash_remaining(void);
+
+
+#endif /* WASH_PROGRAM_H_ */
@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""
+golden.py
+
+Compares the screens dumped by the simulator (sim/, PPM) with the golden
+images checked in (PNG), pixel by pixel. For every screen that differs it
+lists the regions where the differences are, as boxes of the panel
+coordinates, and writes a diff image: the reference dimmed, the pixels
+that differ in red, the boxes in yellow.
+
+A region is a group of differing pixels whose 8x8 cells touch, so a
+shifted text line is one region and not one per glyph.
+
+Exit status 0 when every screen matches, 1 otherwise (a screen without
+a reference, or a reference without its screen, is a mismatch too).
+--update writes the screens as the new references instead.
+
+usage: golden.py [--update] [--tolerance N] [--diff-dir DIR] golden_dir screens_dir
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+CELL = 8
+PNG_MAGIC = b"\x89PNG\r\n\x1a\n"
+
+
+def read_ppm(path):
+    """Binary PPM, maxval 255: (width, height, RGB bytes)."""
+    data = open(path, "rb").read()
+    fields = []
+    i = 0
+    while len(fields) < 4:
+        while data[i:i + 1].isspace():
+            i += 1
+        if data[i:i + 1] == b"#":
+            i = data.index(b"\n", i)
+            continue
+        j = i
+        while not data[j:j + 1].isspace():
+            j += 1
+        fields.append(data[i:j])
+        i = j
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise ValueError("%s: not a P6 PPM of maxval 255" % path)
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[i + 1:i + 1 + width * height * 3]
+    if len(pixels) != width * height * 3:
+        raise ValueError("%s: cut" % path)
+    return width, height, pixels
+
+
+def write_ppm(path, width, height, pixels):
+    with open(path, "wb") as f:
+        f.write(b"P6\n%d %d\n255\n" % (width, height))
+        f.write(pixels)
+
+
+def png_chunk(kind, body):
+    return (struct.pack(">I", len(body)) + kind + body +
+            struct.pack(">I", zlib.crc32(kind + body) & 0xFFFFFFFF))
+
+
+def write_png(path, width, height, pixels):
+    """8 bit RGB, every row with filter 0 (none)."""
+    stride = width * 3
+    raw = b"".join(b"\0" + pixels[y * stride:(y + 1) * stride] for y in range(height))
+    with open(path, "wb") as f:
+        f.write(PNG_MAGIC)
+        f.write(png_chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(png_chunk(b"IDAT", zlib.compress(raw, 9)))
+        f.write(png_chunk(b"IEND", b""))
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    """8 bit RGB PNG, not interlaced: (width, height, RGB bytes)."""
+    data = open(path, "rb").read()
+    if not data.startswith(PNG_MAGIC):
+        raise ValueError("%s: not a PNG" % path)
+    i = len(PNG_MAGIC)
+    idat = b""
+    while i < len(data):
+        length, kind = struct.unpack(">I4s", data[i:i + 8])
+        body = data[i + 8:i + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or color != 2 or interlace:
+                raise ValueError("%s: only 8 bit RGB, not interlaced" % path)
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+        i += 12 + length
+
+    raw = zlib.decompress(idat)
+    stride = width * 3
+    out = bytearray(stride * height)
+    prev = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for x in range(stride):
+            a = row[x - 3] if x >= 3 else 0
+            b = prev[x]
+            c = prev[x - 3] if x >= 3 else 0
+            if kind == 1:
+                row[x] = (row[x] + a) & 0xFF
+            elif kind == 2:
+                row[x] = (row[x] + b) & 0xFF
+            elif kind == 3:
+                row[x] = (row[x] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                row[x] = (row[x] + paeth(a, b, c)) & 0xFF
+        out[y * stride:(y + 1) * stride] = row
+        prev = row
+    return width, height, bytes(out)
+
+
+def differing(width, height, ref, new, tolerance):
+    """Positions (x, y) of the pixels with a channel off by more than tolerance."""
+    diff = []
+    for y in range(height):
+        base = y * width * 3
+        r = ref[base:base + width * 3]
+        n = new[base:base + width * 3]
+        if r == n:
+            continue
+        for x in range(width):
+            k = x * 3
+            if (abs(r[k] - n[k]) > tolerance or abs(r[k + 1] - n[k + 1]) > tolerance or
+                    abs(r[k + 2] - n[k + 2]) > tolerance):
+                diff.append((x, y))
+    return diff
+
+
+def regions(diff):
+    """Boxes (x1, y1, x2, y2, pixels) of the groups of touching cells, largest first."""
+    cells = {}
+    for x, y in diff:
+        cells.setdefault((x // CELL, y // CELL), []).append((x, y))
+
+    boxes = []
+    seen = set()
+    for start in cells:
+        if start in seen:
+            continue
+        seen.add(start)
+        todo = [start]
+        x1 = y1 = 1 << 30
+        x2 = y2 = -1
+        count = 0
+        while todo:
+            cx, cy = todo.pop()
+            for x, y in cells[(cx, cy)]:
+                x1, y1, x2, y2 = min(x1, x), min(y1, y), max(x2, x), max(y2, y)
+                count += 1
+            for dx in (-1, 0, 1):
+                for dy in (-1, 0, 1):
+                    c = (cx + dx, cy + dy)
+                    if c in cells and c not in seen:
+                        seen.add(c)
+                        todo.append(c)
+        boxes.append((x1, y1, x2, y2, count))
+    boxes.sort(key=lambda b: -b[4])
+    return boxes
+
+
+def diff_image(width, height, ref, diff, boxes):
+    out = bytearray(len(ref))
+    for i in range(0, len(ref), 3):
+        gray = (ref[i] + ref[i + 1] + ref[i + 2]) // 12
+        out[i:i + 3] = bytes((gray, gray, gray))
+    for x, y in diff:
+        k = (y * width + x) * 3
+        out[k:k + 3] = b"\xff\x00\x00"
+    for x1, y1, x2, y2, _ in boxes:
+        x1, y1 = max(x1 - 1, 0), max(y1 - 1, 0)
+        x2, y2 = min(x2 + 1, width - 1), min(y2 + 1, height - 1)
+        for x in range(x1, x2 + 1):
+            for y in (y1, y2):
+                k = (y * width + x) * 3
+                out[k:k + 3] = b"\xff\xff\x00"
+        for y in range(y1, y2 + 1):
+            for x in (x1, x2):
+                k = (y * width + x) * 3
+                out[k:k + 3] = b"\xff\xff\x00"
+    return bytes(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Compare simulator screens with golden images.")
+    ap.add_argument("golden", help="directory of the reference PNG images")
+    ap.add_argument("screens", help="directory of the PPM screens of the run")
+    ap.add_argument("--update", action="store_true", help="write the screens as the references")
+    ap.add_argument("--tolerance", type=int, default=0,
+                    help="difference allowed per channel (0)")
+    ap.add_argument("--diff-dir", help="where the diff images go (the screens directory)")
+    args = ap.parse_args()
+
+    screens = sorted(f[:-4] for f in os.listdir(args.screens)
+                     if f.endswith(".ppm") and not f.endswith(".diff.ppm"))
+    if args.update:
+        os.makedirs(args.golden, exist_ok=True)
+        for name in screens:
+            w, h, pixels = read_ppm(os.path.join(args.screens, name + ".ppm"))
+            write_png(os.path.join(args.golden, name + ".png"), w, h, pixels)
+        print("%d references written to %s" % (len(screens), args.golden))
+        return 0
+
+    golden = sorted(f[:-4] for f in os.listdir(args.golden) if f.endswith(".png"))
+    diff_dir = args.diff_dir or args.screens
+    failed = 0
+
+    for name in sorted(set(screens) | set(golden)):
+        if name not in golden:
+            print("%-20s no reference" % name)
+            failed += 1
+            continue
+        if name not in screens:
+            print("%-20s not rendered" % name)
+            failed += 1
+            continue
+
+        rw, rh, ref = read_png(os.path.join(args.golden, name + ".png"))
+        w, h, new = read_ppm(os.path.join(args.screens, name + ".ppm"))
+        if (rw, rh) != (w, h):
+            print("%-20s size %dx%d, reference %dx%d" % (name, w, h, rw, rh))
+            failed += 1
+            continue
+
+        diff = differing(w, h, ref, new, args.tolerance)
+        if not diff:
+            print("%-20s ok" % name)
+            continue
+
+        boxes = regions(diff)
+        failed += 1
+        print("%-20s %d pixels differ, %d regions" % (name, len(diff), len(boxes)))
+        for x1, y1, x2, y2, count in boxes:
+            print("    (%3d,%3d)-(%3d,%3d) %5d pixels" % (x1, y1, x2, y2, count))
+        path = os.path.join(diff_dir, name + ".diff.ppm")
+        write_ppm(path, w, h, diff_image(w, h, ref, diff, boxes))
+        print("    diff: %s" % path)
+
+    if failed:
+        print("%d of %d screens do not match" % (failed, len(set(screens) | set(golden))))
+        return 1
+    print("all %d screens match" % len(golden))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+pack_assets.py
+
+Packs every image of the icon and font headers (R8G8B8, RLE or palette
+indexed) into one binary blob, read at run time by assets.c, and writes
+the matching ids to assets_id.h.
+
+Blob layout, little endian, every block aligned to 4 bytes:
+    header   magic "ASET", uint16 version, uint16 count, uint32 size
+    index    count entries sorted by id:
+             uint32 id, uint16 width, uint16 height, uint8 format,
+             uint8 bpp, uint16 reserved, uint32 data, uint32 aux
+    payload  pixels, RLE row offsets (aux) and palettes (aux)
+Offsets are from the start of the blob, so it can be mapped anywhere.
+
+The id of an asset is the FNV-1a hash of its tImage name, computed here
+only: the firmware looks assets up by the ids of assets_id.h. Font glyphs
+are named <font>_0x<code>. Only the icons are packed into src/assets.bin:
+the text of the screen is composited with the charset of the driver, and
+no screen draws with calibri_36 or arial_72.
+
+usage: pack_assets.py [-o src/assets.bin] [--ids src/assets_id.h] header.h...
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+MAGIC = b"ASET"
+VERSION = 1
+HEADER = struct.Struct("<4sHHI")
+ENTRY = struct.Struct("<IHHBBHII")
+
+FORMAT_RGB888, FORMAT_RLE, FORMAT_INDEXED = 0, 1, 2
+
+ARRAY_RE = re.compile(r"static const (uint8_t|uint16_t|uint32_t) (\w+)\[\d+\]\s*=\s*\{(.*?)\};", re.S)
+IMAGE_RE = re.compile(r"tImage (\w+) = \{\s*(\w+),\s*(\d+),\s*(\d+),\s*\d+"
+                      r"(?:,\s*(\w+)(?:,\s*(\d+),\s*(\w+))?)?\s*\}")
+FONT_RE = re.compile(r"const tFont (\w+) = \{")
+
+
+def fnv1a(name, h=0x811C9DC5):
+    for c in name.encode():
+        h = ((h ^ c) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def align(blob):
+    blob += b"\0" * (-len(blob) % 4)
+
+
+def read_header(path):
+    text = open(path, encoding="latin-1").read()
+    arrays = {}
+    for kind, name, body in ARRAY_RE.findall(text):
+        values = [int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]+)", body)]
+        fmt = {"uint8_t": "B", "uint16_t": "H", "uint32_t": "I"}[kind]
+        arrays[name] = struct.pack("<%d%s" % (len(values), fmt), *values)
+
+    images = []
+    for name, data, width, height, rows, bpp, palette in IMAGE_RE.findall(text):
+        image = {"name": name, "width": int(width), "height": int(height),
+                 "data": arrays[data], "format": FORMAT_RGB888, "bpp": 0, "aux": b""}
+        if bpp and int(bpp):
+            image.update(format=FORMAT_INDEXED, bpp=int(bpp), aux=arrays[palette])
+        elif rows and rows != "0":
+            image.update(format=FORMAT_RLE, aux=arrays[rows])
+        images.append(image)
+    return images, FONT_RE.findall(text)
+
+
+def pack(images):
+    images = sorted(images, key=lambda i: fnv1a(i["name"]))
+    ids = [fnv1a(i["name"]) for i in images]
+    if len(set(ids)) != len(ids):
+        sys.exit("two assets have the same id, rename one of them")
+
+    payload = bytearray()
+    base = HEADER.size + ENTRY.size * len(images)
+    index = bytearray()
+    for image in images:
+        data = base + len(payload)
+        payload += image["data"]
+        align(payload)
+        aux = 0
+        if image["aux"]:
+            aux = base + len(payload)
+            payload += image["aux"]
+            align(payload)
+        index += ENTRY.pack(fnv1a(image["name"]), image["width"], image["height"],
+                            image["format"], image["bpp"], 0, data, aux)
+
+    size = base + len(payload)
+    return HEADER.pack(MAGIC, VERSION, len(images), size) + index + payload
+
+
+def write_ids(path, images, fonts):
+    lines = ["/*", " * assets_id.h", " *",
+             " * Generated by tools/pack_assets.py, do not edit.", " */", "",
+             "", "#ifndef ASSETS_ID_H_", "#define ASSETS_ID_H_", ""]
+    for name in fonts:
+        lines.append("#define ASSET_FONT_%-30s 0x%08xu" % (name.upper(), fnv1a(name)))
+    if fonts:
+        lines.append("")
+    for image in images:
+        if not any(image["name"].startswith(font + "_0x") for font in fonts):
+            lines.append("#define ASSET_%-35s 0x%08xu" % (image["name"].upper(), fnv1a(image["name"])))
+    lines += ["", "", "#endif /* ASSETS_ID_H_ */", ""]
+    open(path, "w", newline="\r\n").write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1])
+    parser.add_argument("-o", "--output", default="src/assets.bin")
+    parser.add_argument("--ids", default="src/assets_id.h")
+    parser.add_argument("headers", nargs="+")
+    args = parser.parse_args()
+
+    images, fonts = [], []
+    for path in args.headers:
+        i, f = read_header(path)
+        if not i:
+            sys.exit("%s: no image found" % path)
+        images += i
+        fonts += f
+
+    blob = pack(images)
+    open(args.output, "wb").write(blob)
+    write_ids(args.ids, images, fonts)
+    print("%d assets (%d fonts), %d bytes" % (len(images), len(fonts), len(blob)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""
+palette_image.py
+
+Converts the images of a header (one icon, or every glyph of a font) from
+R8G8B8, raw or RLE, to palette indexed pixels of 1, 2, 4 or 8 bits.
+
+All images of the header share one palette, palette_<file>, of 24 bits
+RGB colors. Pixels are packed from the most significant bit and every row
+starts on a new byte, so row y of an image is at y * ((width * bpp + 7) / 8).
+
+By default the conversion is exact, with the most used color (the
+background) at index 0, and fails if the header uses more
+colors than the bit depth allows. --quantize maps a grayscale image to
+evenly spaced gray levels instead: the largest error is written in the
+header of the output, and the R8G8B8 export must be kept (the icons are in
+src/icones/raw/), as the output never overwrites its input.
+
+usage: palette_image.py [--bpp N] [--quantize] file.h out.h
+"""
+
+import argparse
+import os
+import re
+import sys
+from collections import Counter
+
+from rle_icons import decode
+
+DATA_RE = re.compile(r"static const uint8_t image_data_(\w+)\[\d+\]\s*=\s*\{(.*?)\};", re.S)
+ROWS_RE = re.compile(r"static const uint16_t image_rows_(\w+)\[\d+\]\s*=\s*\{(.*?)\};\s*", re.S)
+IMAGE_RE = re.compile(r"(tImage \w+ = \{\s*image_data_(\w+),\s*(\d+),\s*(\d+),\s*(\d+))"
+                      r"(?:,\s*image_rows_\w+)?\s*\}")
+
+
+def numbers(text):
+    return [int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]+)", text)]
+
+
+def read_images(text):
+    data = {m.group(1): bytes(numbers(m.group(2))) for m in DATA_RE.finditer(text)}
+    rows = {m.group(1): numbers(m.group(2)) for m in ROWS_RE.finditer(text)}
+    images = {}
+    for m in IMAGE_RE.finditer(text):
+        name, width, height = m.group(2), int(m.group(3)), int(m.group(4))
+        if name in rows:
+            raw = b"".join(decode(data[name], rows[name], y, 0, width) for y in range(height))
+        else:
+            raw = data[name]
+        if len(raw) != width * height * 3:
+            sys.exit("image_data_%s: not a R8G8B8 image" % name)
+        images[name] = (width, height, [raw[i:i + 3] for i in range(0, len(raw), 3)])
+    if not images:
+        sys.exit("no R8G8B8 image found")
+    return images
+
+
+def make_palette(colors, bpp, quantize):
+    if not quantize:
+        # Most used color first: index 0 is the background of fonts
+        palette = sorted(colors, key=lambda c: (-colors[c], c))
+        if bpp is None:
+            bpp = next((b for b in (1, 2, 4, 8) if len(palette) <= 1 << b), None)
+        if bpp is None or len(palette) > 1 << bpp:
+            sys.exit("%d colors do not fit %s bpp, see --quantize" % (len(palette), bpp or 8))
+        return bpp, palette
+
+    if any(c[0] != c[1] or c[1] != c[2] for c in colors):
+        sys.exit("--quantize only handles grayscale images")
+    bpp = bpp or 4
+    levels = (1 << bpp) - 1
+    return bpp, [bytes([255 - 255 * i // levels] * 3) for i in range(levels + 1)]
+
+
+def nearest(palette, color):
+    return min(range(len(palette)), key=lambda i: abs(palette[i][0] - color[0]) +
+               abs(palette[i][1] - color[1]) + abs(palette[i][2] - color[2]))
+
+
+def pack(width, height, pixels, bpp, lut):
+    out = bytearray()
+    for y in range(height):
+        acc, nbits = 0, 0
+        for p in pixels[y * width:(y + 1) * width]:
+            acc = (acc << bpp) | lut[p]
+            nbits += bpp
+            if nbits == 8:
+                out.append(acc)
+                acc, nbits = 0, 0
+        if nbits:
+            out.append(acc << (8 - nbits))
+    return out
+
+
+def unpack(packed, width, y, x, bpp):
+    stride = (width * bpp + 7) // 8
+    bit = x * bpp
+    byte = packed[y * stride + bit // 8]
+    return (byte >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1)
+
+
+def hex_lines(values, fmt, per_line):
+    items = [fmt % v for v in values]
+    return ",\n".join("    " + ", ".join(items[i:i + per_line])
+                      for i in range(0, len(items), per_line))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1])
+    parser.add_argument("--bpp", type=int, choices=(1, 2, 4, 8))
+    parser.add_argument("--quantize", action="store_true")
+    parser.add_argument("src")
+    parser.add_argument("dst")
+    args = parser.parse_args()
+    if os.path.exists(args.dst) and os.path.samefile(args.src, args.dst):
+        sys.exit("%s: would overwrite the original image" % args.src)
+
+    text = open(args.src, encoding="latin-1", newline="").read()
+    nl = "\r\n" if "\r\n" in text else "\n"
+    text = text.replace("\r\n", "\n")
+    images = read_images(text)
+
+    colors = Counter(p for _, _, pixels in images.values() for p in pixels)
+    bpp, palette = make_palette(colors, args.bpp, args.quantize)
+    lut = {c: nearest(palette, c) for c in colors}
+    error = max(max(abs(a - b) for a, b in zip(c, palette[lut[c]])) for c in colors)
+
+    packed = {}
+    for name, (width, height, pixels) in images.items():
+        packed[name] = pack(width, height, pixels, bpp, lut)
+        # Read back every pixel the way the blitters do
+        for y in range(height):
+            for x in range(width):
+                if palette[unpack(packed[name], width, y, x, bpp)] != palette[lut[pixels[y * width + x]]]:
+                    sys.exit("image_data_%s: pixel %d,%d does not read back" % (name, x, y))
+
+    pal_name = "palette_" + os.path.splitext(os.path.basename(args.dst))[0]
+    text = ROWS_RE.sub("", text)
+    text = DATA_RE.sub(lambda m: "static const uint8_t image_data_%s[%d] = {\n%s\n};" %
+                       (m.group(1), len(packed[m.group(1)]),
+                        hex_lines(packed[m.group(1)], "0x%02x", 24)), text)
+    text = IMAGE_RE.sub(lambda m: "%s, 0, %d, %s }" % (m.group(1), bpp, pal_name), text)
+
+    # The palette goes right before the first image
+    first = text.index("static const uint8_t image_data_")
+    text = (text[:first] + "static const uint32_t %s[%d] = {\n%s\n};\n\n" %
+            (pal_name, len(palette), hex_lines([int.from_bytes(c, "big") for c in palette],
+                                               "0x%06x", 8)) + text[first:])
+
+    text = re.sub(r"RLE compression enabled: .*", "RLE compression enabled: no", text)
+    text = re.sub(r"bits per pixel: .*", "bits per pixel: %d (palette indexed, tools/palette_image.py)"
+                  % bpp, text)
+    if args.quantize:
+        text = re.sub(r"(bits per pixel: .*)", r"\1\n* quantized: %d gray levels, lossy, up to %d/255 a channel"
+                      % (len(palette), error), text, count=1)
+
+    with open(args.dst, "w", encoding="latin-1", newline="") as f:
+        f.write(text.replace("\n", nl))
+
+    before = sum(w * h * 3 for w, h, _ in images.values())
+    after = sum(len(p) for p in packed.values()) + 4 * len(palette)
+    print("%s: %d images, %d colors, %d bpp, %d -> %d bytes, max error %d"
+          % (args.src, len(images), len(colors), bpp, before, after, error))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+rle_icons.py
+
+Compresses the R8G8B8 icons exported by LCD Image Converter
+("RLE compression enabled: no") into the row based RLE format read by
+image_rle.c, and checks that the result decodes back to the same pixels
+before writing it.
+
+The exports are kept as they are in src/icones/raw/, the source of the
+compressed headers of src/icones/: the output never overwrites its input.
+
+Format, one independent stream per row:
+    header 0x80 | (n - 1), then 3 bytes   -> the pixel repeated n times
+    header n - 1, then 3 * n bytes        -> n literal pixels
+with n from 1 to 128. image_rows_<name>[y] is the offset of row y.
+
+usage: rle_icons.py raw.h out.h        (e.g. src/icones/raw/lock.h src/icones/lock.h)
+"""
+
+import os
+import re
+import sys
+
+MAX_PACKET = 128
+
+
+def read_raw(path):
+    text = open(path, encoding="latin-1").read()
+    data = re.search(r"image_data_\w+\[\d+\]\s*=\s*\{(.*?)\};", text, re.S)
+    image = re.search(r"const tImage (\w+) = \{\s*image_data_\w+,\s*(\d+),\s*(\d+)", text)
+    if not data or not image:
+        sys.exit("%s: not a raw R8G8B8 image" % path)
+    if "RLE compression enabled: yes" in text:
+        sys.exit("%s: already compressed" % path)
+
+    raw = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", data.group(1)))
+    name, width, height = image.group(1), int(image.group(2)), int(image.group(3))
+    if len(raw) != width * height * 3:
+        sys.exit("%s: %d bytes for a %dx%d image" % (path, len(raw), width, height))
+    return name, width, height, raw
+
+
+def encode_row(pixels):
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < MAX_PACKET and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 1))
+            out += pixels[i]
+            i += run
+            continue
+
+        # Literal until two equal pixels start a run
+        n = 1
+        while (i + n < len(pixels) and n < MAX_PACKET and
+               not (i + n + 1 < len(pixels) and pixels[i + n] == pixels[i + n + 1])):
+            n += 1
+        out.append(n - 1)
+        for p in pixels[i:i + n]:
+            out += p
+        i += n
+    return out
+
+
+def encode(width, height, raw):
+    data = bytearray()
+    rows = []
+    for y in range(height):
+        line = raw[y * width * 3:(y + 1) * width * 3]
+        rows.append(len(data))
+        data += encode_row([line[x:x + 3] for x in range(0, len(line), 3)])
+    if len(data) > 0xFFFF:
+        sys.exit("compressed image does not fit 16 bit row offsets")
+    return data, rows
+
+
+# Same walk as image_rle_read(): x pixels skipped, n pixels copied
+def decode(data, rows, y, x, n):
+    out = bytearray()
+    p = rows[y]
+    while n > 0:
+        b = data[p]
+        p += 1
+        count = (b & 0x7F) + 1
+        if x >= count:
+            x -= count
+            p += 3 if b & 0x80 else count * 3
+            continue
+        used = min(count - x, n)
+        if b & 0x80:
+            out += data[p:p + 3] * used
+            p += 3
+        else:
+            out += data[p + x * 3:p + (x + used) * 3]
+            p += count * 3
+        n -= used
+        x = 0
+    return out
+
+
+def check(width, height, raw, data, rows):
+    for y in range(height):
+        line = raw[y * width * 3:(y + 1) * width * 3]
+        if decode(data, rows, y, 0, width) != line:
+            sys.exit("row %d does not decode to the original pixels" % y)
+        # Partial spans, as read by the tile renderer
+        for x in range(0, width, 7):
+            n = min(13, width - x)
+            if decode(data, rows, y, x, n) != line[x * 3:(x + n) * 3]:
+                sys.exit("row %d, x %d does not decode to the original pixels" % (y, x))
+
+
+def hex_lines(values, fmt, per_line):
+    items = [fmt % v for v in values]
+    return ",\n".join("    " + ", ".join(items[i:i + per_line])
+                      for i in range(0, len(items), per_line))
+
+
+def write(path, name, width, height, raw, data, rows):
+    with open(path, "w", newline="\r\n") as f:
+        f.write("""
+/*******************************************************************************
+* image
+* name: %s
+*
+* preset name: Color R8G8B8
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: yes (tools/rle_icons.py, %d -> %d bytes)
+* bits per pixel: 24
+*******************************************************************************/
+
+#include <stdint.h>
+#include "tipos.h"
+
+
+static const uint8_t image_data_%s[%d] = {
+%s
+};
+
+static const uint16_t image_rows_%s[%d] = {
+%s
+};
+
+const tImage %s = { image_data_%s, %d, %d,
+    8, image_rows_%s };
+
+""" % (name, len(raw), len(data), name, len(data), hex_lines(data, "0x%02x", 24),
+       name, height, hex_lines(rows, "0x%04x", 12), name, name, width, height, name))
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    src, dst = sys.argv[1], sys.argv[2]
+    if os.path.exists(dst) and os.path.samefile(src, dst):
+        sys.exit("%s: would overwrite the original image" % src)
+
+    name, width, height, raw = read_raw(src)
+    data, rows = encode(width, height, raw)
+    check(width, height, raw, data, rows)
+    write(dst, name, width, height, raw, data, rows)
+    print("%s: %dx%d, %d -> %d bytes (+%d of row offsets)"
+          % (name, width, height, len(raw), len(data), 2 * len(rows)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+tlog_decode.py
+
+Turns the console output of the board back into text: the records of the
+tokenized log (src/tlog.h) are formatted with their format strings from
+src/tlog.def, and everything else, printf() text, goes through as it is.
+
+Record: marker 0x9E, varint format number, one zigzag varint per
+conversion of the format. A record whose format number is unknown, or
+that is cut, is shown as <tlog ?> and decoding goes on after its marker.
+
+usage: tlog_decode.py [--def src/tlog.def] [capture]   (stdin if none)
+"""
+
+import argparse
+import os
+import re
+import sys
+
+MARKER = 0x9E
+
+FORMAT_RE = re.compile(r'^\s*TLOG_FORMAT\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', re.M)
+CONVERSION_RE = re.compile(r"%[-+ #0]*\d*([diuxXc%])")
+
+
+def unescape(text):
+    return text.encode("latin-1").decode("unicode_escape")
+
+
+def read_formats(path):
+    """Formats in the order of tlog.def, which is their number."""
+    text = open(path, encoding="latin-1").read()
+    formats = []
+    for name, body in FORMAT_RE.findall(text):
+        fmt = unescape(body)
+        conversions = [c for c in CONVERSION_RE.findall(fmt) if c != "%"]
+        formats.append((name, fmt, conversions))
+    return formats
+
+
+def argument(v, conversion):
+    """The int32 as printf() on the board takes it for the conversion."""
+    if conversion in "uxX":
+        return v & 0xFFFFFFFF
+    if conversion == "c":
+        return v & 0xFF
+    return v
+
+
+def format_record(fmt, args):
+    """fmt % args, each conversion as printf() does it."""
+    values = iter(args)
+
+    def conversion(match):
+        spec, c = match.group(0), match.group(1)
+        if c == "%":
+            return "%"
+        v = next(values)
+        # Python % has no 'u', and puts 0x before a zero where C does not
+        if c == "u":
+            spec = spec[:-1] + "d"
+        if v == 0:
+            spec = spec.replace("#", "")
+        return spec % v
+
+    return CONVERSION_RE.sub(conversion, fmt)
+
+
+def varint(data, i):
+    """(value, next index), or (None, i) if the data ends inside it."""
+    value = shift = 0
+    while i < len(data):
+        b = data[i]
+        i += 1
+        value |= (b & 0x7F) << shift
+        if not b & 0x80:
+            return value, i
+        shift += 7
+        if shift > 35:
+            break
+    return None, i
+
+
+def zigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+def decode(data, formats):
+    out = []
+    i = 0
+    while i < len(data):
+        b = data[i]
+        if b != MARKER:
+            out.append(chr(b))
+            i += 1
+            continue
+        number, j = varint(data, i + 1)
+        if number is None or number >= len(formats):
+            out.append("<tlog ?>")
+            i += 1
+            continue
+        _, fmt, conversions = formats[number]
+        args = []
+        for conversion in conversions:
+            v, j = varint(data, j)
+            if v is None:
+                break
+            args.append(argument(zigzag(v), conversion))
+        if len(args) != len(conversions):
+            out.append("<tlog ?>")
+            i += 1
+            continue
+        out.append(format_record(fmt, args))
+        i = j
+    return "".join(out)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1])
+    parser.add_argument("--def", dest="defs", default=os.path.join(here, "..", "src", "tlog.def"))
+    parser.add_argument("capture", nargs="?")
+    args = parser.parse_args()
+
+    formats = read_formats(args.defs)
+    if args.capture:
+        data = open(args.capture, "rb").read()
+    else:
+        data = sys.stdin.buffer.read()
+    # One character per byte, so text that is not ASCII goes through as it is
+    sys.stdout.buffer.write(decode(data, formats).encode("latin-1"))
+
+
+if __name__ == "__main__":
+    main()